@@ -0,0 +1,68 @@
+#include "../src/spatial_solver/mesh/check_mesh.h"
+#include "../src/spatial_solver/mesh/mesh_cache.h"
+#include "../src/spatial_solver/mesh/process_mesh_data.h"
+#include "bench_tools.h"
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+using namespace DG::Mesh;
+
+/**
+ * Compare the setup of Process_mesh_data from the mesh file, i.e. checking,
+ * importing and ordering, with loading it from the Mesh_cache. The mesh is
+ * copied to the temporary directory first, where the cache is written.
+ *
+ * Usage: bench_mesh_cache [mesh.msh] [repetitions]
+ */
+int main(int argc, char *argv[]) {
+
+  const std::filesystem::path source_name(
+      argc > 1 ? argv[1]
+               : std::string(DGTD_ROOT) +
+                     "/test/src/spatial_solver/mesh/test_meshes/sphere.msh");
+  const size_t repetitions(argc > 2 ? std::stoul(argv[2]) : 5);
+
+  const std::string mesh_name(
+      (std::filesystem::temp_directory_path() /
+       ("bench_cache_" + source_name.filename().string()))
+          .string());
+  std::filesystem::copy_file(
+      source_name,
+      mesh_name,
+      std::filesystem::copy_options::overwrite_existing);
+
+  const double parse_runtime(Bench::get_median_runtime(
+      [&mesh_name]() {
+        ::Mesh::Check_mesh check_mesh(mesh_name);
+        Process_mesh_data processed_mesh(
+            mesh_name,
+            check_mesh.release_mesh_model(),
+            check_mesh.get_section_index());
+      },
+      repetitions));
+
+  {
+    Process_mesh_data processed_mesh(mesh_name);
+    processed_mesh.store_cache(Mesh_cache(mesh_name));
+    std::cout << mesh_name << '\n'
+              << processed_mesh.get_ordered_mesh().elem_tags.size()
+              << " ordered elements\n"
+              << std::endl;
+  }
+
+  const double cache_runtime(Bench::get_median_runtime(
+      [&mesh_name]() {
+        const Mesh_cache mesh_cache(mesh_name);
+        Process_mesh_data processed_mesh(mesh_name, mesh_cache.load());
+      },
+      repetitions));
+
+  Bench::stream_runtime("Check_mesh + Process_mesh_data", parse_runtime);
+  Bench::stream_runtime("Mesh_cache::load + Process_mesh_data", cache_runtime);
+  std::cout << "speedup: " << parse_runtime / cache_runtime << std::endl;
+
+  std::filesystem::remove(mesh_name + ".dgtd_cache");
+  std::filesystem::remove(mesh_name);
+}
@@ -0,0 +1,50 @@
+#include "../src/spatial_solver/mesh/import_mesh_data.h"
+#include "bench_tools.h"
+
+#include <iostream>
+#include <string>
+
+using namespace DG::Mesh;
+
+/**
+ * Compare the stream based import of the Gmsh sections through the
+ * import_gmsh_... methods with the memory mapped single pass import of the
+ * Gmsh_ascii_reader behind Import_mesh_data::import_mesh_model().
+ *
+ * Usage: bench_mesh_import [mesh.msh] [repetitions]
+ */
+int main(int argc, char *argv[]) {
+
+  const std::string mesh_name(
+      argc > 1 ? argv[1]
+               : std::string(DGTD_ROOT) +
+                     "/test/src/spatial_solver/mesh/test_meshes/sphere.msh");
+  const size_t repetitions(argc > 2 ? std::stoul(argv[2]) : 5);
+
+  Import_mesh_data mesh(mesh_name);
+  const Mesh_model mesh_model(mesh.import_mesh_model());
+  std::cout << mesh_name << '\n'
+            << mesh_model.get_number_of_nodes() << " nodes, "
+            << mesh_model.get_number_of_elems() << " elements\n"
+            << std::endl;
+
+  const double stream_runtime(Bench::get_median_runtime(
+      [&mesh, &mesh_model]() {
+        mesh.import_gmsh_nodes();
+        for (size_t entity_type{0}; entity_type <= Entity.volume;
+             ++entity_type) {
+          mesh.import_gmsh_entities(entity_type);
+        }
+        for (const auto &block : mesh_model.elem_blocks) {
+          mesh.import_gmsh_elements(block.entity_dim, block.entity_tag);
+        }
+      },
+      repetitions));
+
+  const double mapped_runtime(Bench::get_median_runtime(
+      [&mesh]() { mesh.import_mesh_model(); }, repetitions));
+
+  Bench::stream_runtime("import_gmsh_... (std::stringstream)", stream_runtime);
+  Bench::stream_runtime("import_mesh_model (std::from_chars)", mapped_runtime);
+  std::cout << "speedup: " << stream_runtime / mapped_runtime << std::endl;
+}
@@ -0,0 +1,56 @@
+#include "../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
+#include "../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../src/spatial_solver/reference_operators.h"
+#include "bench_tools.h"
+
+#include <iostream>
+#include <string>
+
+using namespace DG;
+
+/**
+ * Measure the build of the reference operators, i.e. the quadrature
+ * nodes, Vandermonde matrices, and their factorization, for the
+ * Gauss-Legendre basis and for Gauss-Lobatto orders beyond the
+ * precomputed tables. The registry is bypassed, such that every
+ * repetition builds the operators from scratch.
+ *
+ * Usage: bench_operator_build [max. polynomial order] [repetitions]
+ */
+int main(int argc, char *argv[]) {
+
+  const size_t max_order(argc > 1 ? std::stoul(argv[1]) : 64);
+  const size_t repetitions(argc > 2 ? std::stoul(argv[2]) : 5);
+
+  for (size_t order{16}; order <= max_order; order *= 2) {
+    const double gauss_runtime(Bench::get_median_runtime(
+        [order]() {
+          Operator_registry<Gauss_legendre_basis>::build_operators(order);
+        },
+        repetitions));
+    Bench::stream_runtime(
+        "Gauss-Legendre, order " + std::to_string(order), gauss_runtime);
+
+    if (!Legendre_basis().get_gll_table(order)) {
+      const double gll_runtime(Bench::get_median_runtime(
+          [order]() {
+            Operator_registry<Legendre_basis>::build_operators(order);
+          },
+          repetitions));
+      Bench::stream_runtime(
+          "Gauss-Lobatto, order " + std::to_string(order), gll_runtime);
+    }
+  }
+
+  const double quadrature_runtime(Bench::get_median_runtime(
+      [max_order]() {
+        const Jacobi_basis jacobi;
+        for (size_t order{1}; order <= max_order; ++order) {
+          jacobi.get_gauss_lobatto_quadrature(0., 0., order);
+        }
+      },
+      repetitions));
+  Bench::stream_runtime(
+      "Gauss-Lobatto rules, orders 1-" + std::to_string(max_order),
+      quadrature_runtime);
+}
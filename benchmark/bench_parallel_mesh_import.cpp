@@ -0,0 +1,104 @@
+#include "../src/spatial_solver/mesh/import_mesh_data.h"
+#include "bench_tools.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace DG::Mesh;
+
+/**
+ * Scaling of the ASCII mesh import with the number of threads. Without a
+ * given mesh, a 1D mesh of a line with num_elems elements is written to
+ * the temporary directory first, since the test meshes are too small to
+ * show any scaling.
+ *
+ * Usage:
+ * bench_parallel_mesh_import [mesh.msh | num_elems] [repetitions]
+ * [max_threads]
+ */
+std::string write_line_mesh(const size_t num_elems) {
+
+  const std::string mesh_name(
+      (std::filesystem::temp_directory_path() /
+       ("bench_line_" + std::to_string(num_elems) + ".msh"))
+          .string());
+  if (std::filesystem::exists(mesh_name)) {
+    return mesh_name;
+  }
+
+  std::ofstream mesh_file(mesh_name);
+  mesh_file << "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n"
+            << "$PhysicalNames\n2\n0 1 \"outer_bc\"\n1 2 \"line\"\n"
+            << "$EndPhysicalNames\n"
+            << "$Entities\n2 1 0 0\n1 0 0 0 1 1\n2 1 0 0 1 1\n"
+            << "1 0 0 0 1 0 0 1 2 2 1 -2\n$EndEntities\n";
+
+  const size_t num_nodes{num_elems + 1};
+  mesh_file << "$Nodes\n3 " << num_nodes << " 1 " << num_nodes << '\n'
+            << "0 1 0 1\n1\n0 0 0\n"
+            << "0 2 0 1\n2\n1 0 0\n"
+            << "1 1 0 " << num_nodes - 2 << '\n';
+  for (size_t node{3}; node <= num_nodes; ++node) {
+    mesh_file << node << '\n';
+  }
+  mesh_file.precision(16);
+  for (size_t node{1}; node < num_elems; ++node) {
+    mesh_file << double(node) / double(num_elems) << " 0 0\n";
+  }
+  mesh_file << "$EndNodes\n";
+
+  mesh_file << "$Elements\n3 " << num_elems + 2 << " 1 " << num_elems + 2
+            << '\n'
+            << "0 1 15 1\n1 1\n0 2 15 1\n2 2\n"
+            << "1 1 1 " << num_elems << '\n';
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    const size_t left_node{elem == 0 ? 1 : elem + 2};
+    const size_t right_node{elem == num_elems - 1 ? 2 : elem + 3};
+    mesh_file << elem + 3 << ' ' << left_node << ' ' << right_node << '\n';
+  }
+  mesh_file << "$EndElements\n";
+
+  return mesh_name;
+}
+
+int main(int argc, char *argv[]) {
+
+  const std::string argument(argc > 1 ? argv[1] : "2000000");
+  const std::string mesh_name(
+      argument.ends_with(".msh") ? argument
+                                 : write_line_mesh(std::stoul(argument)));
+  const size_t repetitions(argc > 2 ? std::stoul(argv[2]) : 5);
+
+  Mesh_section_index section_index;
+  const Mesh_model mesh_model(
+      Import_mesh_data::import_mesh_model(mesh_name, section_index));
+  std::cout << mesh_name << '\n'
+            << mesh_model.get_number_of_nodes() << " nodes, "
+            << mesh_model.get_number_of_elems() << " elements\n"
+            << std::endl;
+
+  double sequential_runtime{0.};
+  const size_t max_threads(
+      argc > 3 ? std::stoul(argv[3])
+               : std::max(1u, std::thread::hardware_concurrency()));
+  for (size_t num_threads{1}; num_threads <= max_threads; num_threads *= 2) {
+    const double runtime(Bench::get_median_runtime(
+        [&mesh_name, num_threads]() {
+          Mesh_section_index section_index;
+          Import_mesh_data::import_mesh_model(
+              mesh_name, section_index, num_threads);
+        },
+        repetitions));
+    if (num_threads == 1) {
+      sequential_runtime = runtime;
+    }
+
+    Bench::stream_runtime(
+        "import_mesh_model (" + std::to_string(num_threads) + " threads)",
+        runtime);
+    std::cout << "speedup: " << sequential_runtime / runtime << std::endl;
+  }
+}
@@ -0,0 +1,93 @@
+#include "../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../src/spatial_solver/solution_evaluator.h"
+#include "bench_tools.h"
+
+#include <iostream>
+#include <string>
+
+using namespace DG;
+
+/**
+ * Compare the evaluation of the modal fields at random positions by the
+ * Clenshaw recurrence of Solution_evaluator with summing up the
+ * polynomials of get_polynomial(...) per position and with summing up the
+ * Vandermonde matrix of get_polynomials(...). The mesh consists of equally
+ * sized elements on [0,1], and the positions are located once beforehand.
+ *
+ * Usage: bench_solution_evaluator [polynomial order] [positions]
+ *        [repetitions]
+ */
+int main(int argc, char *argv[]) {
+
+  const size_t order(argc > 1 ? std::stoul(argv[1]) : 8);
+  const size_t num_positions(argc > 2 ? std::stoul(argv[2]) : 10000);
+  const size_t repetitions(argc > 3 ? std::stoul(argv[3]) : 20);
+  const size_t num_elems{1000};
+
+  Mesh::Ordered_mesh ordered_mesh;
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    ordered_mesh.elem_tags.push_back(elem + 1);
+    ordered_mesh.elem_coords.push_back(double(elem) / num_elems);
+    ordered_mesh.elem_coords.push_back(double(elem + 1) / num_elems);
+  }
+
+  arma::arma_rng::set_seed(19);
+  const arma::mat modal_fields(order + 1, num_elems, arma::fill::randn);
+  const arma::vec positions(arma::randu<arma::vec>(num_positions));
+
+  const Legendre_basis basis;
+  const Solution_evaluator<Legendre_basis> evaluator(ordered_mesh, order);
+  const Sampling_points points{evaluator.locate_positions(positions)};
+
+  std::cout << num_positions << " positions, polynomial order " << order
+            << '\n'
+            << std::endl;
+
+  arma::vec scalar_values(num_positions);
+  const double scalar_runtime(Bench::get_median_runtime(
+      [&]() {
+        for (size_t i{0}; i < num_positions; ++i) {
+          double value{0.};
+          for (size_t k{0}; k <= order; ++k) {
+            value += modal_fields(k, points.elems[i]) *
+                     basis.get_polynomial(k, points.ref_positions[i]);
+          }
+          scalar_values[i] = value;
+        }
+      },
+      repetitions));
+
+  arma::vec vandermonde_values(num_positions);
+  const double vandermonde_runtime(Bench::get_median_runtime(
+      [&]() {
+        const arma::mat vandermonde_matrix{
+            basis.get_polynomials(order, points.ref_positions)};
+        for (size_t i{0}; i < num_positions; ++i) {
+          vandermonde_values[i] = arma::dot(
+              vandermonde_matrix.row(i), modal_fields.col(points.elems[i]));
+        }
+      },
+      repetitions));
+
+  arma::vec clenshaw_values(num_positions);
+  const double clenshaw_runtime(Bench::get_median_runtime(
+      [&]() {
+        clenshaw_values =
+            evaluator.get_values_from_modal(modal_fields, points);
+      },
+      repetitions));
+
+  const double locate_runtime(Bench::get_median_runtime(
+      [&]() { evaluator.locate_positions(positions); }, repetitions));
+
+  Bench::stream_runtime("get_polynomial per position", scalar_runtime);
+  Bench::stream_runtime("get_polynomials (Vandermonde)", vandermonde_runtime);
+  Bench::stream_runtime("Solution_evaluator (Clenshaw)", clenshaw_runtime);
+  Bench::stream_runtime("Solution_evaluator::locate_positions", locate_runtime);
+  std::cout << "speedup vs. get_polynomial: "
+            << scalar_runtime / clenshaw_runtime << '\n'
+            << "speedup vs. get_polynomials: "
+            << vandermonde_runtime / clenshaw_runtime << '\n'
+            << "max. deviation: "
+            << arma::abs(clenshaw_values - scalar_values).max() << std::endl;
+}
@@ -0,0 +1,158 @@
+#include "../src/pde/advection.h"
+#include "../src/pde/burgers.h"
+#include "../src/pde/maxwell.h"
+#include "../src/pde/shallow_water.h"
+#include "../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../src/spatial_solver/reference_operators.h"
+#include "bench_tools.h"
+
+#include <iostream>
+#include <string>
+
+using namespace DG;
+
+/**
+ * Compare the spatial scheme of get_spatial_scheme(...), which allocates
+ * its intermediate matrices, with the fused and allocation-free
+ * write_spatial_scheme(...) of the advection equation for several
+ * polynomial orders. The latter is timed via the virtual interface of Pde
+ * and via the pointwise functions of Static_pde. Maxwell's equations and
+ * the nonlinear Burgers and shallow water equations are timed per
+ * component for the throughput per degree of freedom of
+ * Conservation_system.
+ *
+ * Usage: bench_spatial_scheme [elements] [repetitions]
+ */
+int main(int argc, char *argv[]) {
+
+  const size_t num_elems(argc > 1 ? std::stoul(argv[1]) : 2000);
+  const size_t repetitions(argc > 2 ? std::stoul(argv[2]) : 200);
+  const std::vector<double> geo_factors(num_elems, 0.5);
+
+  std::cout << num_elems << " elements\n" << std::endl;
+  for (const size_t order : {2, 4, 8, 16, 24}) {
+    const auto operators{
+        Operator_registry<Legendre_basis>::get_operators(order)};
+    Advection advection(2 * M_PI, 1.);
+    advection.use_fixed_order_kernels(true);
+    advection.use_even_odd_diff_matrix(operators->even_odd_diff_matrix);
+
+    const Mesh::Trace_indices trace_indices{
+        Mesh::Trace_indices::get_chain(order + 1, num_elems)};
+    arma::arma_rng::set_seed(order);
+    const arma::mat fields(order + 1, num_elems, arma::fill::randn);
+
+    const double allocating_runtime(Bench::get_median_runtime(
+        [&]() {
+          const arma::mat spatial_scheme{advection.get_spatial_scheme(
+              fields,
+              0.,
+              geo_factors,
+              operators->diff_matrix,
+              operators->lift_matrix,
+              trace_indices)};
+        },
+        repetitions));
+
+    Scheme_workspace workspace;
+    arma::mat spatial_scheme;
+    const Pde &pde{advection};
+    const double virtual_runtime(Bench::get_median_runtime(
+        [&]() {
+          pde.write_spatial_scheme(
+              fields,
+              0.,
+              geo_factors,
+              operators->diff_matrix,
+              operators->lift_matrix,
+              trace_indices,
+              workspace,
+              spatial_scheme);
+        },
+        repetitions));
+
+    const double fused_runtime(Bench::get_median_runtime(
+        [&]() {
+          advection.write_spatial_scheme(
+              fields,
+              0.,
+              geo_factors,
+              operators->diff_matrix,
+              operators->lift_matrix,
+              trace_indices,
+              workspace,
+              spatial_scheme);
+        },
+        repetitions));
+
+    Maxwell maxwell(1., 1., 1.);
+    maxwell.use_fixed_order_kernels(true);
+    const arma::mat maxwell_fields(
+        order + 1, Maxwell::num_components * num_elems, arma::fill::randn);
+    Scheme_workspace maxwell_workspace;
+    arma::mat maxwell_scheme;
+    const double maxwell_runtime(Bench::get_median_runtime(
+        [&]() {
+          maxwell.write_spatial_scheme(
+              maxwell_fields,
+              0.,
+              geo_factors,
+              operators->diff_matrix,
+              operators->lift_matrix,
+              trace_indices,
+              maxwell_workspace,
+              maxwell_scheme);
+        },
+        repetitions));
+
+    Burgers burgers(1.);
+    burgers.use_fixed_order_kernels(true);
+    const arma::mat burgers_fields{1. + 0.5 * fields};
+    const double burgers_runtime(Bench::get_median_runtime(
+        [&]() {
+          burgers.write_spatial_scheme(
+              burgers_fields,
+              0.,
+              geo_factors,
+              operators->diff_matrix,
+              operators->lift_matrix,
+              trace_indices,
+              workspace,
+              spatial_scheme);
+        },
+        repetitions));
+
+    Shallow_water shallow_water(9.81, 1.);
+    shallow_water.use_fixed_order_kernels(true);
+    // Positive water heights and some discharge
+    arma::mat shallow_water_fields{maxwell_fields};
+    shallow_water_fields.cols(0, num_elems - 1) =
+        2. + arma::abs(shallow_water_fields.cols(0, num_elems - 1));
+    const double shallow_water_runtime(Bench::get_median_runtime(
+        [&]() {
+          shallow_water.write_spatial_scheme(
+              shallow_water_fields,
+              0.,
+              geo_factors,
+              operators->diff_matrix,
+              operators->lift_matrix,
+              trace_indices,
+              maxwell_workspace,
+              maxwell_scheme);
+        },
+        repetitions));
+
+    const std::string label{"order " + std::to_string(order)};
+    Bench::stream_runtime(label + ", get_spatial_scheme", allocating_runtime);
+    Bench::stream_runtime(
+        label + ", Pde::write_spatial_scheme", virtual_runtime);
+    Bench::stream_runtime(label + ", Static_pde", fused_runtime);
+    Bench::stream_runtime(
+        label + ", Maxwell per component",
+        maxwell_runtime / Maxwell::num_components);
+    Bench::stream_runtime(label + ", Burgers", burgers_runtime);
+    Bench::stream_runtime(
+        label + ", shallow water per component",
+        shallow_water_runtime / Shallow_water::num_components);
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef BENCH_TOOLS_H
+#define BENCH_TOOLS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+/**
+ * @brief Run a function several times and return the median runtime in
+ * milliseconds. The median is less sensitive to outliers (e.g. a cold
+ * file cache in the first run) than the mean.
+ */
+template <typename Function>
+double get_median_runtime(Function function, const size_t repetitions) {
+
+  std::vector<double> runtimes;
+  for (size_t rep{0}; rep < repetitions; ++rep) {
+    const auto start{std::chrono::steady_clock::now()};
+    function();
+    const auto stop{std::chrono::steady_clock::now()};
+    runtimes.push_back(
+        std::chrono::duration<double, std::milli>(stop - start).count());
+  }
+
+  std::nth_element(
+      runtimes.begin(), runtimes.begin() + runtimes.size() / 2, runtimes.end());
+  return runtimes[runtimes.size() / 2];
+}
+
+inline void stream_runtime(const std::string &label, const double runtime) {
+  std::cout << std::left << std::setw(40) << label << std::right
+            << std::setw(12) << std::fixed << std::setprecision(3)
+            << runtime << " ms" << std::endl;
+}
+} // namespace Bench
+#endif
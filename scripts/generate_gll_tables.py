@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Generate the constexpr Legendre-Gauss-Lobatto tables of DGTD.
+
+The nodes, weights, differentiation matrices and lift columns on the
+reference element [-1,1] are computed in 60-digit decimal arithmetic and
+rounded to double precision once, such that the tables are at least as
+accurate as the runtime path of Legendre_basis and Elementwise_operations.
+
+Usage:
+    python3 scripts/generate_gll_tables.py \
+        > src/spatial_solver/basis_functions/gll_tables.h
+"""
+
+import decimal
+import math
+import sys
+
+MAX_ORDER = 32
+decimal.getcontext().prec = 60
+D = decimal.Decimal
+
+
+def legendre(order, x):
+    """Legendre polynomials P_order(x) and P_{order-1}(x)."""
+    p_old, p = D(1), x
+    for n in range(1, order):
+        p_old, p = p, ((2 * n + 1) * x * p - n * p_old) / (n + 1)
+    return p, p_old
+
+
+def get_nodes(order):
+    """Roots of (1-x^2) P_N'(x), ascending, by the Lobatto Newton iteration
+    x <- x - (x P_N - P_{N-1}) / ((N+1) P_N)."""
+    nodes = []
+    for k in range(order + 1):
+        x = D(-math.cos(math.pi * k / order))
+        for _ in range(100):
+            p, p_old = legendre(order, x)
+            dx = (x * p - p_old) / ((order + 1) * p)
+            x -= dx
+            if abs(dx) < D(10) ** -55:
+                break
+        nodes.append(x)
+    nodes[0], nodes[-1] = D(-1), D(1)
+    for k in range(order // 2 + 1):
+        nodes[order - k] = -nodes[k]
+    if order % 2 == 0:
+        nodes[order // 2] = D(0)
+    return nodes
+
+
+def get_operators(order):
+    nodes = get_nodes(order)
+    p_n = [legendre(order, x)[0] for x in nodes]
+    num_nodes = order + 1
+
+    weights = [D(2) / (order * (order + 1) * p * p) for p in p_n]
+
+    diff = [[D(0)] * num_nodes for _ in range(num_nodes)]
+    for i in range(num_nodes):
+        for j in range(num_nodes):
+            if i != j:
+                diff[i][j] = p_n[i] / p_n[j] / (nodes[i] - nodes[j])
+    diff[0][0] = -D(order * (order + 1)) / 4
+    diff[order][order] = D(order * (order + 1)) / 4
+
+    # Columns of the inverse mass matrix V V^T at the end nodes, where V
+    # holds the orthonormalized Legendre polynomials
+    lift = [[D(0)] * 2 for _ in range(num_nodes)]
+    for i, x in enumerate(nodes):
+        p_old, p = D(1), x
+        lift[i][0] = D(1) / 2 - D(3) / 2 * x
+        lift[i][1] = D(1) / 2 + D(3) / 2 * x
+        for n in range(1, order):
+            p_old, p = p, ((2 * n + 1) * x * p - n * p_old) / (n + 1)
+            lift[i][0] += D(2 * n + 3) / 2 * p * (-1) ** (n + 1)
+            lift[i][1] += D(2 * n + 3) / 2 * p
+    return nodes, weights, diff, lift
+
+
+def format_array(name, values):
+    entries = [repr(float(v)) for v in values]
+    lines, line = [], "   "
+    for entry in entries:
+        if len(line) + len(entry) + 2 > 78:
+            lines.append(line + ",")
+            line = "   "
+        elif line != "   ":
+            line += ","
+        line += " " + entry
+    lines.append(line)
+    return (
+        "inline constexpr std::array<double, %d> %s{\n" % (len(values), name)
+        + "\n".join(lines)
+        + "};\n"
+    )
+
+
+def main():
+    out = sys.stdout
+    out.write(
+        "// Generated by scripts/generate_gll_tables.py, do not edit.\n"
+        "#ifndef GLL_TABLES_H\n"
+        "#define GLL_TABLES_H\n\n"
+        "#include <array>\n"
+        "#include <cstddef>\n\n"
+        "namespace DG::GLL_tables {\n\n"
+        "/**\n"
+        " * @brief Legendre-Gauss-Lobatto nodes, weights, differentiation\n"
+        " * matrix, and lift matrix on the reference element of a polynomial\n"
+        " * order. The matrices are stored column-major, i.e. in the memory\n"
+        " * layout of arma::mat.\n"
+        " */\n"
+        "struct Table {\n"
+        "  size_t polynomial_order;\n"
+        "  const double *nodes;\n"
+        "  const double *weights;\n"
+        "  const double *diff_matrix;\n"
+        "  const double *lift_matrix;\n"
+        "};\n\n"
+        "constexpr size_t max_order{%d};\n\n" % MAX_ORDER
+    )
+    for order in range(1, MAX_ORDER + 1):
+        nodes, weights, diff, lift = get_operators(order)
+        num_nodes = order + 1
+        out.write("// Polynomial order %d\n" % order)
+        out.write(format_array("nodes_%d" % order, nodes))
+        out.write(format_array("weights_%d" % order, weights))
+        out.write(
+            format_array(
+                "diff_matrix_%d" % order,
+                [diff[i][j] for j in range(num_nodes) for i in range(num_nodes)],
+            )
+        )
+        out.write(
+            format_array(
+                "lift_matrix_%d" % order,
+                [lift[i][j] for j in range(2) for i in range(num_nodes)],
+            )
+        )
+        out.write("\n")
+
+    out.write("inline constexpr std::array<Table, max_order> tables{{\n")
+    for order in range(1, MAX_ORDER + 1):
+        out.write(
+            "    {%d, nodes_%d.data(), weights_%d.data(), diff_matrix_%d.data(),\n"
+            "     lift_matrix_%d.data()},\n" % ((order,) * 5)
+        )
+    out.write(
+        "}};\n\n"
+        "/**\n"
+        " * @brief Get the table of a polynomial order\n"
+        " *\n"
+        " * @return Table, or nullptr if the order is not tabulated\n"
+        " */\n"
+        "constexpr const Table *get_table(const size_t polynomial_order) {\n"
+        "  if (polynomial_order < 1 || polynomial_order > max_order) {\n"
+        "    return nullptr;\n"
+        "  }\n"
+        "  return &tables[polynomial_order - 1];\n"
+        "}\n"
+        "} // namespace DG::GLL_tables\n\n"
+        "#endif\n"
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -3,13 +3,23 @@
 #define BOOST_BIND_GLOBAL_PLACEHOLDERS
 
 #include "tools/input.h"
+#include "tools/output.h"
+#include "pde/region_pdes.h"
+#include "pde/scheme_workspace.h"
 #include "spatial_solver/mesh/process_mesh_data.h"
 #include "spatial_solver/geometric_operations.h"
+#include "spatial_solver/basis_functions/legendre_basis.h"
 #include "spatial_solver/elementwise_operations.h"
+#include "spatial_solver/modal_transform.h"
+#include "spatial_solver/reference_operators.h"
+#include "temporal_solver/low_storage_runge_kutta.h"
 
 #include <armadillo>
+#include <list>
 #include <string>
 #include <map>
+#include <memory>
+#include <span>
 
 namespace DGTD {
 using namespace DG;
@@ -19,25 +29,52 @@ public:
   Dgtd_solver(Mesh::Process_mesh_data &processed_mesh, 
       const Input &input);
 
+  /**
+   * @brief Solve the PDE on the elements of all regions, which are coupled
+   * by the numerical flux of their shared faces (see
+   * Process_mesh_data::get_face_connectivity(...)). The fields of a system
+   * of equations are stored as one plane per component (see
+   * Conservation_system).
+   */
   arma::mat get_solution(Pde &pde);
-
-  void initialize_dg_scheme(
-      Pde &pde,
-      std::map<size_t, arma::mat> &region_field,
-      std::map<size_t, arma::mat> &region_phys_node_coords,
-      std::map<size_t, std::vector<double>> &region_geo_factors);
-
-  arma::mat evolve_dg_scheme(
-      Pde &pde,
+  /**
+   * @brief Solve with a PDE of each region, e.g. for different materials
+   * per region, where the interface of two regions takes the numerical
+   * flux of both PDEs (see Conservation_system::use_region_pdes(...))
+   */
+  arma::mat get_solution(std::map<size_t, Pde> &region_pdes);
+
+  /**
+   * @brief Set up the scheme of the PDE for the operators of the basis,
+   * e.g. the face interpolation for nodes which do not include the faces
+   */
+  void initialize_dg_scheme(Pde &pde) const;
+
+  /**
+   * @brief Evolve the fields of all regions by one time step in place. The
+   * spatial scheme is written into the stage buffers (see
+   * Pde::write_spatial_scheme(...)), such that a time step does not
+   * allocate once the workspace and the stage buffers are sized.
+   */
+  void evolve_dg_scheme(
+      const Pde &pde,
       TD_solver &lsrk,
-      const arma::mat &fields,
+      arma::mat &fields,
       const double time,
-      const std::vector<double> &geo_factors) const;
-
-  arma::mat assemble_global_solution(
+      const double time_step,
+      const std::vector<double> &geo_factors,
+      const Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace,
+      TD::Stage_buffers &stage_buffers) const;
+
+  /**
+   * @brief Copy the fields of all regions into the columns of the global
+   * solution, which is sized by the caller. For systems, the component
+   * planes of all regions are joined into global component planes.
+   */
+  void assemble_global_solution(
       std::map<size_t, arma::mat> &region_field,
-      const size_t num_nodes,
-      const size_t num_elems);
+      arma::mat &solution);
 
   arma::mat get_phys_node_coords();
   arma::mat get_phys_node_coords(const size_t region);
@@ -45,24 +82,69 @@ public:
   std::vector<double> get_geometric_factors();
   std::vector<double> get_geometric_factors(const size_t region);
 
-  double get_time_step();
-
+  /**
+   * @brief Time step of the CFL condition for the given maximum wave speed
+   * of all regions, which is clipped to the time remaining until the end
+   * time, such that the final step ends exactly at the end time. The
+   * solver recomputes it before each step from the maximum wave speed of
+   * the current fields, i.e. from a reduction per region (see
+   * get_max_wave_speed(...) of Static_pde and Conservation_system). For
+   * linear PDEs, all but the final step are thus equal.
+   */
+  double get_time_step(const double max_wave_speed, const double time) const;
+
+  /// @brief Time of the solution returned by get_solution(...)
+  inline double get_final_time() const { return this->final_time; };
+
+  /**
+   * @brief Smallest physical distance between two quadrature nodes. For
+   * nodes which do not include the element faces, this is the distance of
+   * Gauss-Lobatto nodes which allows for the same time step, i.e. scaled
+   * by the spectral radii of the upwind reference operators (see
+   * Reference_operators::get_upwind_spectral_radius()).
+   */
   double get_min_node_dist();
 
   bool is_field_name_valid(const std::string &field_name) const;
 
 private:
+  /**
+   * @brief Evolve the given initial fields of all regions until the end
+   * time and store the solution of each time step
+   */
+  arma::mat evolve_solution(const Pde &pde, arma::mat fields);
+
+  /**
+   * @brief Store the global solution, where each component of a system is
+   * stored separately as <pde name>_<field name>
+   */
+  void store_solution(
+      Output &out,
+      const std::list<std::string> &field_names,
+      const std::string &suffix,
+      const arma::mat &solution) const;
+
+  /**
+   * @brief Number of rows of the matrix which the trace indices refer to,
+   * i.e. the number of nodes, or the two face values if the nodes do not
+   * include the faces (see Pde::use_face_interpolation(...))
+   */
+  size_t get_num_trace_rows() const;
+
   Mesh::Process_mesh_data &processed_mesh;
   const Input &input;
   Geometric_operations geop;
-  Elementwise_operations<Basis> eop;
   const Basis basis;
   const std::vector<double> quad_nodes;
   const double end_time;
   const double dt_factor;
-  const double time_step;
-  const arma::mat diff_matrix;
-  const arma::mat lift_matrix;
+  /// @brief Shared with all solvers of the same basis and order
+  const std::shared_ptr<const Reference_operators> operators;
+  /// @brief See get_min_node_dist()
+  const double min_node_dist;
+  double final_time{0.};
+  const arma::mat &diff_matrix;
+  const arma::mat &lift_matrix;
 };
 } // namespace DGTD
 
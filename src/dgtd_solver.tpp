@@ -1,8 +1,8 @@
 #include "temporal_solver/low_storage_runge_kutta.h"
 #include "tools/custom_errors.h"
-#include "tools/output.h"
 #include "tools/get.h"
 
+#include <algorithm>
 #include <typeinfo>
 #include <iomanip>
 
@@ -16,13 +16,14 @@ Dgtd_solver<Pde, Basis, TD_solver>::Dgtd_solver(
     : processed_mesh{_processed_mesh},
       input{_input},
       geop(_processed_mesh),
-      eop(_input.polynomial_order),
       quad_nodes{basis.get_quad_nodes(_input.polynomial_order)},
       end_time{_input.end_time}, 
       dt_factor{_input.dt_factor},
-      time_step{this->get_time_step()},
-      diff_matrix{eop.get_diff_matrix()},
-      lift_matrix{eop.get_lift_matrix()} {
+      operators{
+          Operator_registry<Basis>::get_operators(_input.polynomial_order)},
+      min_node_dist{this->get_min_node_dist()},
+      diff_matrix{operators->diff_matrix},
+      lift_matrix{operators->lift_matrix} {
 
   if (!std::is_same<TD_solver, Low_storage_runge_kutta>::value) {
     throw Not_implemented("Given time-domain solver unknown.");
@@ -32,114 +33,208 @@ Dgtd_solver<Pde, Basis, TD_solver>::Dgtd_solver(
 template <class Pde, class Basis, class TD_solver>
 arma::mat Dgtd_solver<Pde, Basis, TD_solver>::get_solution(Pde &pde) {
 
-  const arma::mat phys_node_coords{this->get_phys_node_coords()};
+  Pde global_pde(pde);
+  this->initialize_dg_scheme(global_pde);
+
+  return this->evolve_solution(
+      global_pde, global_pde.get_initial_values(this->get_phys_node_coords()));
+}
+//----
+template <class Pde, class Basis, class TD_solver>
+arma::mat Dgtd_solver<Pde, Basis, TD_solver>::get_solution(
+    std::map<size_t, Pde> &region_pdes) {
+
+  const std::vector<size_t> &ordered_regions{
+      this->processed_mesh.get_ordered_regions()};
+  std::vector<Pde> ordered_pdes;
+  std::vector<size_t> region_offsets{0};
+  std::map<size_t, arma::mat> region_fields;
+  for (const auto &region: ordered_regions) {
+    const Pde &pde{region_pdes.at(region)};
+    ordered_pdes.push_back(pde);
+    region_offsets.push_back(
+        region_offsets.back() +
+        this->processed_mesh.get_ordered_finite_elems(region).size());
+    region_fields[region] =
+        pde.get_initial_values(this->get_phys_node_coords(region));
+  }
+
+  arma::mat fields(
+      this->quad_nodes.size(),
+      Pde::num_components * region_offsets.back());
+  this->assemble_global_solution(region_fields, fields);
+
+  // The scheme settings of the first region apply to all regions
+  Pde global_pde(ordered_pdes.front());
+  this->initialize_dg_scheme(global_pde);
+  global_pde.use_region_pdes(std::make_shared<const Region_pdes<Pde>>(
+      std::move(ordered_pdes), std::move(region_offsets)));
+
+  return this->evolve_solution(global_pde, std::move(fields));
+}
+//----
+template <class Pde, class Basis, class TD_solver>
+arma::mat Dgtd_solver<Pde, Basis, TD_solver>::evolve_solution(
+    const Pde &pde,
+    arma::mat fields) {
+
+  const std::list<std::string> field_names{pde.get_field_names()};
   Output out;
-  out.store_coords(phys_node_coords);
+  out.store_coords(this->get_phys_node_coords());
+  const Modal_transform<Basis> modal_transform(this->input.polynomial_order);
 
   TD_solver lsrk(
       this->input.runge_kutta_order, this->input.runge_kutta_stages);
+  const std::vector<double> geo_factors{this->get_geometric_factors()};
+  const Mesh::Trace_indices trace_indices{
+      this->processed_mesh
+          .get_face_connectivity(this->input.periodic_contours)
+          .get_trace_indices(this->get_num_trace_rows())};
+  Scheme_workspace workspace;
+  Stage_buffers stage_buffers;
 
-  std::map<size_t, arma::mat> region_fields;
-  std::map<size_t, arma::mat> region_phys_node_coords;
-  std::map<size_t, std::vector<double>> region_geo_factors;
-  this->initialize_dg_scheme(
-      pde, region_fields, region_phys_node_coords, region_geo_factors);
-  arma::mat solution(this->assemble_global_solution(
-        region_fields, phys_node_coords.n_rows, phys_node_coords.n_cols));
-
-  for (double time(0.); time <= end_time; time += this->time_step) {
+  double time{0.};
+  bool is_final_step{false};
+  while (true) {
     out.store_time(time);
-    out.store_fields(this->input.pde_name, solution);
-
-    for (const auto &region: this->processed_mesh.get_ordered_regions()) {
-      region_fields[region] = this->evolve_dg_scheme(
-            pde, 
-            lsrk,
-            region_fields[region], 
-            time,
-            region_geo_factors[region]);
+    this->store_solution(out, field_names, "", fields);
+    if (this->input.modal_output) {
+      this->store_solution(
+          out,
+          field_names,
+          "_modal",
+          modal_transform.get_modal_fields(fields));
     }
+    if (is_final_step || time >= this->end_time) {
+      break;
+    }
+
+    // All regions take the same time step of the current wave speeds
+    const double time_step{
+        this->get_time_step(pde.get_max_wave_speed(fields), time)};
+    is_final_step = time_step == this->end_time - time;
 
-    solution = this->assemble_global_solution(
-        region_fields, phys_node_coords.n_rows, phys_node_coords.n_cols);
+    this->evolve_dg_scheme(
+        pde,
+        lsrk,
+        fields,
+        time,
+        time_step,
+        geo_factors,
+        trace_indices,
+        workspace,
+        stage_buffers);
+
+    time = is_final_step ? this->end_time : time + time_step;
   }
+  this->final_time = time;
 
-  return solution;
+  return fields;
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
 void Dgtd_solver<Pde, Basis, TD_solver>::initialize_dg_scheme(
-    Pde &pde,
-    std::map<size_t, arma::mat> &region_fields,
-    std::map<size_t, arma::mat> &region_phys_node_coords,
-    std::map<size_t, std::vector<double>> &region_geo_factors
-    ) {
-  
-  for (const auto &region: this->processed_mesh.get_ordered_regions()) {
-    arma::mat phys_node_coords(this->get_phys_node_coords(region));
-    region_phys_node_coords[region] = phys_node_coords;
-    region_fields[region] = pde.get_initial_values(phys_node_coords);
-    region_geo_factors[region] = this->get_geometric_factors(region);
+    Pde &pde) const {
+
+  pde.use_fixed_order_kernels(this->input.fixed_order_kernels);
+  pde.use_even_odd_diff_matrix(this->operators->even_odd_diff_matrix);
+  if (!this->operators->has_face_nodes) {
+    pde.use_face_interpolation(this->operators->face_interpolation_matrix);
   }
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
-arma::mat Dgtd_solver<Pde, Basis, TD_solver>::evolve_dg_scheme(
-    Pde &pde,
+void Dgtd_solver<Pde, Basis, TD_solver>::evolve_dg_scheme(
+    const Pde &pde,
     TD_solver &lsrk,
-    const arma::mat &fields,
+    arma::mat &fields,
     const double time,
-    const std::vector<double> &geo_factors) const {
+    const double time_step,
+    const std::vector<double> &geo_factors,
+    const Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace,
+    Stage_buffers &stage_buffers) const {
 
     auto dg_scheme =
-        [pde, this, geo_factors] (arma::mat u, double t) {
-          return pde.get_spatial_scheme(
+        [&pde, this, &geo_factors, &trace_indices, &workspace](
+            const arma::mat &u, const double t, arma::mat &rhs) {
+          pde.write_spatial_scheme(
               u,
               t,
               geo_factors,
               this->diff_matrix,
-              this->lift_matrix);
+              this->lift_matrix,
+              trace_indices,
+              workspace,
+              rhs);
         };
-    return lsrk.evolve_in_time(
+    lsrk.evolve_in_place(
         dg_scheme,
         fields,
         time,
-        this->time_step);
+        time_step,
+        stage_buffers);
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
-arma::mat Dgtd_solver<Pde, Basis, TD_solver>::assemble_global_solution(
+void Dgtd_solver<Pde, Basis, TD_solver>::assemble_global_solution(
     std::map<size_t, arma::mat> &region_fields,
-    const size_t num_nodes,
-    const size_t num_elems) {
-  arma::mat solution(num_nodes, num_elems);
+    arma::mat &solution) {
 
-  size_t global_col{0};
+  const size_t num_global_elems{solution.n_cols / Pde::num_components};
+  size_t elem_offset{0};
   for (const auto &region: this->processed_mesh.get_ordered_regions()) {
-    const arma::mat region_solution(region_fields[region]);
-    for (size_t col{0}; col < region_solution.n_cols; ++col, ++global_col) {
-      for (size_t row{0}; row < region_solution.n_rows; ++row) {
-        solution(row, global_col) = region_solution(row, col);
+    const arma::mat &region_solution(region_fields[region]);
+    const size_t num_elems{region_solution.n_cols / Pde::num_components};
+    for (size_t component{0}; component < Pde::num_components; ++component) {
+      for (size_t elem{0}; elem < num_elems; ++elem) {
+        const size_t col{component * num_elems + elem};
+        const size_t global_col{
+            component * num_global_elems + elem_offset + elem};
+        for (size_t row{0}; row < region_solution.n_rows; ++row) {
+          solution(row, global_col) = region_solution(row, col);
+        }
       }
     }
+    elem_offset += num_elems;
+  }
+}
+//-------------------------------------------------------------------------
+template <class Pde, class Basis, class TD_solver>
+void Dgtd_solver<Pde, Basis, TD_solver>::store_solution(
+    Output &out,
+    const std::list<std::string> &field_names,
+    const std::string &suffix,
+    const arma::mat &solution) const {
+
+  if (Pde::num_components == 1) {
+    out.store_fields(this->input.pde_name + suffix, solution);
+    return;
   }
 
-  return solution;
+  const size_t num_elems{solution.n_cols / Pde::num_components};
+  size_t component{0};
+  for (const auto &field_name: field_names) {
+    out.store_fields(
+        this->input.pde_name + "_" + field_name + suffix,
+        solution.cols(component * num_elems, (component + 1) * num_elems - 1));
+    ++component;
+  }
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
 std::vector<double> 
 Dgtd_solver<Pde, Basis, TD_solver>::get_geometric_factors() {
   
-  std::vector<size_t> elems;
-  for (const auto region : processed_mesh.import_gmsh_regions()) {
-    elems = this->processed_mesh.get_ordered_elems(
-        this->processed_mesh.get_finite_elems(region));
-  }
-
+  // All regions in the order of the global solution
   std::vector<double> geo_factors;
-  for (const auto elem: elems) {
-    geo_factors.push_back(this->geop.get_geometric_factor(elem));
+  for (const auto region : this->processed_mesh.get_ordered_regions()) {
+    const std::vector<double> region_geo_factors{
+        this->get_geometric_factors(region)};
+    geo_factors.insert(
+        geo_factors.end(),
+        region_geo_factors.begin(),
+        region_geo_factors.end());
   }
 
   return geo_factors;
@@ -149,19 +244,9 @@ template <class Pde, class Basis, class TD_solver>
 std::vector<double> 
 Dgtd_solver<Pde, Basis, TD_solver>::get_geometric_factors(
     const size_t region) {
-  
-  std::vector<size_t> elems;
-  for (const auto region : processed_mesh.import_gmsh_regions()) {
-    elems = processed_mesh.get_ordered_elems(
-        processed_mesh.get_finite_elems(region));
-  }
 
-  std::vector<double> geo_factors;
-  for (const auto elem: elems) {
-    geo_factors.push_back(geop.get_geometric_factor(elem));
-  }
-
-  return geo_factors;
+  const auto geo_factors{this->processed_mesh.get_geometric_factors(region)};
+  return {geo_factors.begin(), geo_factors.end()};
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
@@ -169,8 +254,8 @@ arma::mat
 Dgtd_solver<Pde, Basis, TD_solver>::get_phys_node_coords(
     const size_t region) {
 
-  std::vector<size_t> elems{this->processed_mesh.get_ordered_elems(
-      this->processed_mesh.get_finite_elems(region))};
+  const std::span<const size_t> elems{
+      this->processed_mesh.get_ordered_finite_elems(region)};
 
   arma::mat phys_node_coords(this->quad_nodes.size(), elems.size());
   for (size_t n{0}; n < elems.size(); ++n) {
@@ -187,37 +272,54 @@ template <class Pde, class Basis, class TD_solver>
 arma::mat
 Dgtd_solver<Pde, Basis, TD_solver>::get_phys_node_coords() {
 
-  std::vector<size_t> elems;
-  for (const auto region : processed_mesh.import_gmsh_regions()) {
-    elems = processed_mesh.get_ordered_elems(
-        processed_mesh.get_finite_elems(region));
-  }
-
-  arma::mat phys_node_coords(this->quad_nodes.size(), elems.size());
-  for (size_t n{0}; n < elems.size(); ++n) {
-    for (size_t m{0}; m < quad_nodes.size(); ++m) {
-      phys_node_coords(m, n) =
-          geop.convert_ref_to_phys_coord(this->quad_nodes[m], elems[n]);
-    }
+  // All regions in the order of the global solution
+  arma::mat phys_node_coords(this->quad_nodes.size(), 0);
+  for (const auto region : this->processed_mesh.get_ordered_regions()) {
+    phys_node_coords =
+        arma::join_rows(phys_node_coords, this->get_phys_node_coords(region));
   }
 
   return phys_node_coords;
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
-double Dgtd_solver<Pde, Basis, TD_solver>::get_time_step() {
+double Dgtd_solver<Pde, Basis, TD_solver>::get_time_step(
+    const double max_wave_speed,
+    const double time) const {
 
-  const double min_node_dist{this->get_min_node_dist()};
-  const double dt{this->dt_factor*min_node_dist/(2*M_PI)};
-  const double num_time_steps{std::ceil(this->end_time/dt)}; 
-  
-  return this->end_time / num_time_steps;
+  const double remaining_time{this->end_time - time};
+  // Nothing propagates, e.g. Burgers' equation without any flow
+  if (max_wave_speed <= 0.) {
+    return remaining_time;
+  }
+
+  const double dt{this->dt_factor*this->min_node_dist/max_wave_speed};
+  return std::min(dt, remaining_time);
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
 double Dgtd_solver<Pde, Basis, TD_solver>::get_min_node_dist() {
 
-  return geop.get_min_node_dist(this->quad_nodes);
+  if (this->operators->has_face_nodes) {
+    return geop.get_min_node_dist(this->quad_nodes);
+  }
+
+  // Without face nodes, the CFL condition of the Gauss-Lobatto nodes is
+  // scaled by the ratio of the spectral radii of both bases
+  const auto gll_operators{
+      Operator_registry<Legendre_basis>::get_operators(
+          this->input.polynomial_order)};
+  const std::vector<double> gll_nodes(
+      gll_operators->nodes.begin(), gll_operators->nodes.end());
+  return geop.get_min_node_dist(gll_nodes) *
+         gll_operators->get_upwind_spectral_radius() /
+         this->operators->get_upwind_spectral_radius();
+}
+//-------------------------------------------------------------------------
+template <class Pde, class Basis, class TD_solver>
+size_t Dgtd_solver<Pde, Basis, TD_solver>::get_num_trace_rows() const {
+
+  return this->operators->has_face_nodes ? this->quad_nodes.size() : 2;
 }
 //-------------------------------------------------------------------------
 template <class Pde, class Basis, class TD_solver>
@@ -1,12 +1,19 @@
 #define BOOST_BIND_GLOBAL_PLACEHOLDERS
 #include "dgtd_solver.h"
 #include "pde/advection.h"
+#include "pde/burgers.h"
+#include "pde/maxwell.h"
+#include "pde/shallow_water.h"
+#include "spatial_solver/basis_functions/gauss_legendre_basis.h"
 #include "spatial_solver/basis_functions/legendre_basis.h"
 #include "spatial_solver/mesh/check_mesh.h"
+#include "spatial_solver/mesh/mesh_cache.h"
+#include "spatial_solver/mesh/mesh_generator.h"
 #include "spatial_solver/mesh/process_mesh_data.h"
 #include "temporal_solver/low_storage_runge_kutta.h"
 #include "tools/input.h"
 
+#include <boost/log/trivial.hpp>
 #include <boost/program_options.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -25,23 +32,117 @@ void stream_welcome_message() {
             << std::endl;
 }
 
-int main(int argc, char *argv[]) {
-  stream_welcome_message();
+/**
+ * Import and order the mesh, or load both from the mesh cache if it is
+ * enabled and up to date with the mesh file. A cache which cannot be
+ * written only costs the next run its speed-up, hence it is no error.
+ * Instead of a Gmsh file, a JSON specification of a generated 1D mesh can
+ * be given (see Mesh_generator).
+ */
+DG::Mesh::Process_mesh_data
+get_processed_mesh(const std::string &mesh_name, const Input &input) {
 
-  Mesh::Check_mesh check_mesh(argv[1]);
-  DG::Mesh::Process_mesh_data processed_mesh(argv[1]);
+  if (mesh_name.ends_with(".json")) {
+    return DG::Mesh::Process_mesh_data(
+        mesh_name,
+        DG::Mesh::Mesh_generator(mesh_name).generate_mesh_model(),
+        DG::Mesh::Mesh_section_index());
+  }
 
-  Input input(argv[2]);
+  if (!input.mesh_cache) {
+    Mesh::Check_mesh check_mesh(mesh_name, input.mesh_import_threads);
+    return DG::Mesh::Process_mesh_data(
+        mesh_name,
+        check_mesh.release_mesh_model(),
+        check_mesh.get_section_index());
+  }
+
+  const DG::Mesh::Mesh_cache mesh_cache(mesh_name);
+  if (mesh_cache.is_valid()) {
+    return DG::Mesh::Process_mesh_data(mesh_name, mesh_cache.load());
+  }
+
+  Mesh::Check_mesh check_mesh(mesh_name, input.mesh_import_threads);
+  DG::Mesh::Process_mesh_data processed_mesh(
+      mesh_name,
+      check_mesh.release_mesh_model(),
+      check_mesh.get_section_index());
+  try {
+    processed_mesh.store_cache(mesh_cache);
+  } catch (std::exception &e) {
+    BOOST_LOG_TRIVIAL(warning)
+        << "Mesh cache not written: " << e.what() << std::endl;
+  }
+
+  return processed_mesh;
+}
+
+/// Solve the PDE given in the input with the basis given in the input
+template <class Basis>
+void solve(DG::Mesh::Process_mesh_data &processed_mesh, const Input &input) {
 
   if (input.pde_name == "advection") {
-    DGTD::Dgtd_solver<
-        Advection,
-        DG::Legendre_basis,
-        TD::Low_storage_runge_kutta>
-        dgtd(processed_mesh, input);
+    DGTD::Dgtd_solver<Advection, Basis, TD::Low_storage_runge_kutta> dgtd(
+        processed_mesh, input);
 
     Advection advection(input.material_params.front(), input.upwind_param);
+    advection.use_numerical_flux(
+        DG::Fluxes::get_numerical_flux(input.numerical_flux));
 
     dgtd.get_solution(advection);
+  } else if (input.pde_name == "maxwell") {
+    DGTD::Dgtd_solver<Maxwell, Basis, TD::Low_storage_runge_kutta> dgtd(
+        processed_mesh, input);
+
+    // The material of each region, which is given by its physical name
+    const auto physical_names(processed_mesh.get_physical_names());
+    std::map<size_t, Maxwell> region_pdes;
+    for (size_t region{0}; region < input.region_names.size(); ++region) {
+      Maxwell maxwell(
+          input.material_params.at(2 * region),
+          input.material_params.at(2 * region + 1),
+          input.upwind_param);
+      maxwell.use_numerical_flux(
+          DG::Fluxes::get_numerical_flux(input.numerical_flux));
+      region_pdes.emplace(
+          physical_names.at(input.region_names[region]), maxwell);
+    }
+
+    dgtd.get_solution(region_pdes);
+  } else if (input.pde_name == "burgers") {
+    DGTD::Dgtd_solver<Burgers, Basis, TD::Low_storage_runge_kutta> dgtd(
+        processed_mesh, input);
+
+    Burgers burgers(input.upwind_param);
+    burgers.use_numerical_flux(
+        DG::Fluxes::get_numerical_flux(input.numerical_flux));
+    dgtd.get_solution(burgers);
+  } else if (input.pde_name == "shallow_water") {
+    DGTD::Dgtd_solver<Shallow_water, Basis, TD::Low_storage_runge_kutta>
+        dgtd(processed_mesh, input);
+
+    Shallow_water shallow_water(
+        input.material_params.front(), input.upwind_param);
+    shallow_water.use_numerical_flux(
+        DG::Fluxes::get_numerical_flux(input.numerical_flux));
+    dgtd.get_solution(shallow_water);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  stream_welcome_message();
+
+  Input input(argv[2]);
+
+  const std::string mesh_name(argv[1]);
+  DG::Mesh::Process_mesh_data processed_mesh(
+      get_processed_mesh(mesh_name, input));
+
+  if (input.basis == "gauss_lobatto") {
+    solve<DG::Legendre_basis>(processed_mesh, input);
+  } else if (input.basis == "gauss") {
+    solve<DG::Gauss_legendre_basis>(processed_mesh, input);
+  } else {
+    throw std::invalid_argument("Unknown basis: " + input.basis);
   }
 }
@@ -1,16 +1,22 @@
 #ifndef ADVECTION_H
 #define ADVECTION_H
 
-#include "pde.h"
+#include "static_pde.h"
 
-class Advection : public Pde {
+#include <cmath>
+
+/**
+ * @brief Linear advection \f$\partial_t u + a\,\partial_x u = 0\f$ with
+ * the flux \f$f(u) = a\,u\f$
+ */
+class Advection : public Static_pde<Advection> {
 public:
   Advection(const double flux_prefactor, const double upwind_param);
 
   inline std::tuple<double, double> get_boundary_conditions(
       const arma::mat &fields,
       const double time) const override {
-    return {-sin(advection_speed * time), 0.};
+    return {this->get_inflow(time), 0.};
   };
 
   arma::mat
@@ -31,9 +37,33 @@ public:
     return {"Advection"};
   };
 
+  inline double get_pointwise_flux(const double value) const {
+    return this->advection_speed * value;
+  };
+
+  inline double get_wave_speed(const double) const {
+    return this->advection_speed;
+  };
+
+  /**
+   * @brief Inflow of get_boundary_conditions(...) at the left boundary and
+   * outflow, i.e. no jump, at the right boundary
+   */
+  inline double get_boundary_value(
+      const double interior_value,
+      const double time,
+      const double normal) const {
+    return normal < 0. ? this->get_inflow(time) : interior_value;
+  };
+
 private:
   const double advection_speed;
   const double upwind_param;
+
+  /// @brief Value entering at the left boundary, i.e. the initial sine
+  inline double get_inflow(const double time) const {
+    return -sin(this->advection_speed * time);
+  };
 };
 
 #endif
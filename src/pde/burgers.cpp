@@ -0,0 +1,9 @@
+#include "burgers.h"
+
+Burgers::Burgers(const double _upwind_param)
+    : upwind_param{_upwind_param} {}
+//------------------------------------------------------------------------
+arma::mat
+Burgers::get_initial_values(const arma::mat &phys_node_coords) const {
+  return 1. + 0.5 * arma::sin(phys_node_coords);
+}
@@ -0,0 +1,62 @@
+#ifndef BURGERS_H
+#define BURGERS_H
+
+#include "conservation_system.h"
+
+#include <array>
+#include <cmath>
+#include <list>
+#include <string>
+
+/**
+ * @brief Inviscid Burgers' equation \f$\partial_t u + \partial_x (u^2/2)
+ * = 0\f$, i.e. a scalar conservation law with the state-dependent wave
+ * speed \f$\lambda(u) = u\f$, for which the default numerical flux of
+ * Conservation_system is the local Lax-Friedrichs flux of the face values.
+ * The boundaries are transmissive, i.e. without a jump. Since there is no
+ * limiter, the solution is valid until the first shock forms.
+ */
+class Burgers : public Conservation_system<Burgers> {
+public:
+  static constexpr size_t num_components{1};
+
+  explicit Burgers(const double upwind_param);
+
+  /**
+   * @brief \f$u = 1 + \sin(x)/2\f$, which steepens into a shock at
+   * \f$t = 2\f$
+   */
+  arma::mat get_initial_values(const arma::mat &phys_node_coords) const;
+
+  inline std::array<double, 1>
+  get_pointwise_flux(const std::array<double, 1> &state) const {
+    return {0.5 * state[0] * state[0]};
+  };
+
+  inline double get_wave_speed(const std::array<double, 1> &state) const {
+    return std::abs(state[0]);
+  };
+
+  inline std::array<double, 2>
+  get_wave_speed_bounds(const std::array<double, 1> &state) const {
+    return {state[0], state[0]};
+  };
+
+  inline double get_upwind_param() const { return this->upwind_param; };
+
+  inline std::array<double, 1> get_boundary_state(
+      const std::array<double, 1> &interior_state,
+      const double,
+      const double) const {
+    return interior_state;
+  };
+
+  inline std::list<std::string> get_field_names() const {
+    return {"Burgers"};
+  };
+
+private:
+  const double upwind_param;
+};
+
+#endif
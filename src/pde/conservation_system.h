@@ -0,0 +1,265 @@
+/* !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * CAUTION:
+ * Due to instantiation issues the method implementation is stored in
+ * a .tpp-file (not .cpp)
+ * For more information, see
+ * https://stackoverflow.com/questions/8752837/undefined-reference-to-template-class-constructor
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ */
+
+#ifndef CONSERVATION_SYSTEM_H
+#define CONSERVATION_SYSTEM_H
+
+#include "../spatial_solver/even_odd_matrix.h"
+#include "../spatial_solver/mesh/face_connectivity.h"
+#include "numerical_fluxes.h"
+#include "region_pdes.h"
+#include "scheme_workspace.h"
+
+#include <armadillo>
+#include <array>
+#include <concepts>
+#include <memory>
+
+/**
+ * @brief Pointwise functions of a system of conservation laws
+ * \f$\partial_t q + \partial_x f(q) = 0\f$ with \f$C\f$ components:
+ * - num_components: number of components \f$C\f$
+ * - get_pointwise_flux(q): physical flux \f$f(q)\f$ of a state
+ * - get_wave_speed(q): largest magnitude of the eigenvalues of the flux
+ *   Jacobian \f$\partial f / \partial q\f$ at a state
+ * - get_wave_speed_bounds(q): smallest and largest eigenvalue at a state,
+ *   e.g. for the HLL flux
+ * - get_upwind_param(): upwind parameter \f$\sigma \in [0,1]\f$
+ * - get_boundary_state(q_int, time, normal): exterior state at a boundary
+ *   face, where \f$n = -1\f$ denotes the left and \f$n = 1\f$ the right
+ *   boundary
+ */
+template <class Pde_impl>
+concept System_pde = requires(
+    const Pde_impl &pde,
+    const std::array<double, Pde_impl::num_components> &state,
+    const double time) {
+  {
+    pde.get_pointwise_flux(state)
+  } -> std::convertible_to<std::array<double, Pde_impl::num_components>>;
+  { pde.get_wave_speed(state) } -> std::convertible_to<double>;
+  {
+    pde.get_wave_speed_bounds(state)
+  } -> std::convertible_to<std::array<double, 2>>;
+  { pde.get_upwind_param() } -> std::convertible_to<double>;
+  {
+    pde.get_boundary_state(state, time, time)
+  } -> std::convertible_to<std::array<double, Pde_impl::num_components>>;
+};
+
+/**
+ * @brief System of linear conservation laws, i.e. \f$f(q) = A\,q\f$,
+ * which additionally provides get_flux_jacobian(), the \f$(C \times
+ * C)\f$-matrix \f$A\f$ stored row by row. Its wave speed does not
+ * depend on the state.
+ */
+template <class Pde_impl>
+concept Linear_system_pde =
+    System_pde<Pde_impl> && requires(const Pde_impl &pde) {
+  {
+    pde.get_flux_jacobian()
+  } -> std::convertible_to<std::array<
+      std::array<double, Pde_impl::num_components>,
+      Pde_impl::num_components>>;
+};
+
+/**
+ * @brief System whose PDE provides the numerical flux at an interface to
+ * the PDE of another region, i.e. get_interface_fluxes(right_pde, q_L,
+ * q_R), which returns the flux \f$f^*\f$ of the left and of the right
+ * element. The fluxes of both elements differ, e.g. if the material
+ * parameters are divided out of the fields of each region.
+ */
+template <class Pde_impl>
+concept Interface_flux_pde = System_pde<Pde_impl> && requires(
+    const Pde_impl &pde,
+    const std::array<double, Pde_impl::num_components> &state) {
+  {
+    pde.get_interface_fluxes(pde, state, state)
+  } -> std::convertible_to<std::array<
+      std::array<double, Pde_impl::num_components>,
+      2>>;
+};
+
+/**
+ * @brief Spatial scheme of a system of conservation laws by the curiously
+ * recurring template pattern, where the PDE derives from
+ * Conservation_system<PDE> and provides the functions of System_pde.<br>
+ * The fields of all components are stored in a single matrix with one
+ * contiguous plane of \f$N_\mathrm{p} \times K\f$ values per component,
+ * i.e. the columns \f$cK, \dots, (c+1)K-1\f$ hold component \f$c\f$. The
+ * trace indices refer to a single plane and are shifted to the others.
+ * The pointwise flux is evaluated node by node over the contiguous
+ * planes, such that the inlined flux is vectorized by the compiler. For
+ * linear systems (see Linear_system_pde), the flux Jacobian is applied
+ * plane by plane instead, where its zero entries are skipped. A single
+ * product with the differentiation matrix serves all components. Since
+ * the material is constant per PDE, regions of different materials get a
+ * PDE each, which are coupled by the numerical flux of their interfaces
+ * (see use_region_pdes(...)).
+ */
+template <class Derived> class Conservation_system {
+public:
+  /// @brief See Pde::use_fixed_order_kernels(...)
+  inline void use_fixed_order_kernels(const bool use_kernels) {
+    this->fixed_order_kernels = use_kernels;
+  };
+
+  /**
+   * @brief Accepted for the interface of Dgtd_solver only, since the
+   * volume term of all components is a single matrix product instead of a
+   * product per column
+   */
+  inline void use_even_odd_diff_matrix(
+      std::shared_ptr<const DG::Even_odd_matrix>){};
+
+  /// @brief See Pde::use_face_interpolation(...)
+  inline void use_face_interpolation(const arma::mat &face_interpolation) {
+    this->face_interpolation_matrix = face_interpolation;
+  };
+
+  /**
+   * @brief Numerical flux of the interfaces within a region (see
+   * numerical_fluxes.h), where the local Lax-Friedrichs flux scaled by the
+   * upwind parameter of the PDE is the default
+   */
+  inline void use_numerical_flux(
+      const DG::Fluxes::Numerical_flux _numerical_flux) {
+    this->numerical_flux = _numerical_flux;
+  };
+
+  inline DG::Fluxes::Numerical_flux get_numerical_flux() const {
+    return this->numerical_flux;
+  };
+
+  /**
+   * @brief Evaluate the elements of each region with the PDE of the region
+   * instead of this PDE, whose scheme settings apply to all regions. At an
+   * interface of two regions, the numerical flux is the one of
+   * Interface_flux_pde if the PDE provides it, and otherwise the local
+   * Lax-Friedrichs flux of the pointwise fluxes and the wave speeds of
+   * both PDEs.
+   */
+  inline void use_region_pdes(
+      std::shared_ptr<const Region_pdes<Derived>> _region_pdes) {
+    this->region_pdes = std::move(_region_pdes);
+  };
+
+  /**
+   * @brief Write the spatial scheme of all components, i.e. per component
+   * \f$c\f$ and element \f$k\f$ <br>
+   * \f$ \underline{r}^k_{h,c} = J^k \left(-\boldsymbol{\mathcal{D}} \cdot
+   * \underline{f}_c(\underline{q}^k_h) + c^k_{\mathrm{L},c} \mathcal L_1 +
+   * c^k_{\mathrm{R},c} \mathcal L_2 \right) \f$. <br>
+   * The numerical flux of each interface is the selected one (see
+   * use_numerical_flux(...)), which is evaluated once and scattered to both
+   * faces as \f$n\,(f(q^-) - f^*)\f$. By default, it is the local
+   * Lax-Friedrichs flux \f$f^* = \{\!\{f(q)\}\!\} - \sigma C / 2 \,
+   * (q_\mathrm{R} - q_\mathrm{L})\f$ with the maximum wave speed \f$C =
+   * \max(\lambda(q_\mathrm{L}), \lambda(q_\mathrm{R}))\f$ of the
+   * interface @cite toro2009riemann. If all eigenvalues of a linear system
+   * have the same magnitude, as for Maxwell's equations in a homogeneous
+   * medium, it is the upwind flux for \f$\sigma = 1\f$
+   * @cite hesthaven2008nodal.
+   *
+   * @param[in] fields Component planes of \f$N_\mathrm{p} \times K\f$
+   * values each
+   * @param[in] geometric_factors Geometric factor of each of the \f$K\f$
+   * elements
+   * @param[in,out] workspace Buffers owned by the caller, one per mesh
+   * @param[out] spatial_scheme Spatial scheme, which is resized to the
+   * size of the fields if necessary
+   */
+  void write_spatial_scheme(
+      const arma::mat &fields,
+      const double time,
+      const std::vector<double> &geometric_factors,
+      const arma::mat &diff_matrix,
+      const arma::mat &lift_matrix,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace,
+      arma::mat &spatial_scheme) const;
+
+  /// @brief Allocating counterpart of write_spatial_scheme(...)
+  arma::mat get_spatial_scheme(
+      const arma::mat &fields,
+      const double time,
+      const std::vector<double> &geometric_factors,
+      const arma::mat &diff_matrix,
+      const arma::mat &lift_matrix,
+      const DG::Mesh::Trace_indices &trace_indices) const;
+
+  /**
+   * @brief Largest wave speed of all nodes of the fields, e.g. for the
+   * time step, which is a single reduction over the contiguous planes
+   */
+  double get_max_wave_speed(const arma::mat &fields) const;
+
+private:
+  bool fixed_order_kernels{false};
+  arma::mat face_interpolation_matrix;
+  DG::Fluxes::Numerical_flux numerical_flux{
+      DG::Fluxes::Numerical_flux::lax_friedrichs};
+  std::shared_ptr<const Region_pdes<Derived>> region_pdes;
+
+  inline const Derived &get_derived() const {
+    return static_cast<const Derived &>(*this);
+  };
+
+  /// @brief PDE of the region of an element (see use_region_pdes(...))
+  inline const Derived &get_elem_pde(const size_t elem) const {
+    return this->region_pdes ? this->region_pdes->get_elem_pde(elem)
+                             : this->get_derived();
+  };
+
+  /**
+   * @brief Pointwise flux of the elements [first_elem, last_elem) of the
+   * fields, or the flux Jacobian times the fields plane by plane for
+   * linear systems
+   */
+  static void write_volume_fluxes(
+      const Derived &pde,
+      const arma::mat &fields,
+      const size_t first_elem,
+      const size_t last_elem,
+      Scheme_workspace &workspace);
+
+  /// @brief Largest wave speed of the elements [first_elem, last_elem)
+  static double get_max_wave_speed(
+      const Derived &pde,
+      const arma::mat &fields,
+      const size_t first_elem,
+      const size_t last_elem);
+
+  /**
+   * @brief Numerical flux of each interface and the lift coefficients of
+   * its faces
+   */
+  template <class Numerical_flux>
+  void write_face_fluxes(
+      const Numerical_flux &numerical_flux,
+      const arma::mat &trace_values,
+      const double time,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace) const;
+
+  /**
+   * @brief Lift coefficients of the left and right face of each column by
+   * the selected numerical flux
+   */
+  void write_lift_coeffs(
+      const arma::mat &trace_values,
+      const double time,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace) const;
+};
+
+#include "conservation_system.tpp"
+
+#endif
@@ -0,0 +1,388 @@
+#include "fixed_order_kernels.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+template <class Derived>
+void Conservation_system<Derived>::write_spatial_scheme(
+    const arma::mat &fields,
+    const double time,
+    const std::vector<double> &geometric_factors,
+    const arma::mat &diff_matrix,
+    const arma::mat &lift_matrix,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace,
+    arma::mat &spatial_scheme) const {
+
+  static_assert(
+      System_pde<Derived>,
+      "The PDE has to provide the functions of System_pde.");
+  constexpr size_t num_components{Derived::num_components};
+  const size_t num_nodes{fields.n_rows};
+  const size_t num_elems{geometric_factors.size()};
+  const size_t num_cols{fields.n_cols};
+  if (num_cols != num_components * num_elems) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "The fields need one plane of all elements per component.");
+  }
+
+  workspace.left_coeffs.resize(num_cols);
+  workspace.right_coeffs.resize(num_cols);
+  workspace.column_geo_factors.resize(num_cols);
+  for (size_t component{0}; component < num_components; ++component) {
+    std::copy(
+        geometric_factors.begin(),
+        geometric_factors.end(),
+        workspace.column_geo_factors.begin() + component * num_elems);
+  }
+  spatial_scheme.set_size(num_nodes, num_cols);
+
+  if (this->face_interpolation_matrix.is_empty()) {
+    this->write_lift_coeffs(fields, time, trace_indices, workspace);
+  } else {
+    workspace.face_values.set_size(2, num_cols);
+    for (size_t col{0}; col < num_cols; ++col) {
+      const double *field{fields.colptr(col)};
+      for (size_t face{0}; face < 2; ++face) {
+        const double *interpolation{
+            this->face_interpolation_matrix.colptr(face)};
+        double face_value{0.};
+        for (size_t node{0}; node < num_nodes; ++node) {
+          face_value += interpolation[node] * field[node];
+        }
+        workspace.face_values(face, col) = face_value;
+      }
+    }
+    this->write_lift_coeffs(
+        workspace.face_values, time, trace_indices, workspace);
+  }
+
+  workspace.volume_fluxes.set_size(num_nodes, num_cols);
+  if (this->region_pdes) {
+    for (size_t region{0}; region < this->region_pdes->get_num_regions();
+         ++region) {
+      write_volume_fluxes(
+          this->region_pdes->get_pde(region),
+          fields,
+          this->region_pdes->get_first_elem(region),
+          this->region_pdes->get_last_elem(region),
+          workspace);
+    }
+  } else {
+    write_volume_fluxes(
+        this->get_derived(), fields, 0, num_elems, workspace);
+  }
+
+  // All component planes are differentiated at once, as if they were
+  // num_components * num_elems elements of a scalar PDE
+  if (this->fixed_order_kernels) {
+    const auto fused_kernel{DG::Kernels::get_fused_kernel(num_nodes - 1)};
+    if (fused_kernel) {
+      fused_kernel(
+          diff_matrix.memptr(),
+          lift_matrix.memptr(),
+          workspace.volume_fluxes.memptr(),
+          1.,
+          workspace.column_geo_factors,
+          workspace.left_coeffs,
+          workspace.right_coeffs,
+          spatial_scheme.memptr());
+      return;
+    }
+  }
+
+  spatial_scheme = diff_matrix * workspace.volume_fluxes;
+  const double *left_lift{lift_matrix.colptr(0)};
+  const double *right_lift{lift_matrix.colptr(1)};
+  for (size_t col{0}; col < num_cols; ++col) {
+    const double geo_factor{workspace.column_geo_factors[col]};
+    const double left_coeff{workspace.left_coeffs[col] * geo_factor};
+    const double right_coeff{workspace.right_coeffs[col] * geo_factor};
+    double *result{spatial_scheme.colptr(col)};
+    for (size_t row{0}; row < num_nodes; ++row) {
+      result[row] = -geo_factor * result[row] + left_coeff * left_lift[row] +
+                    right_coeff * right_lift[row];
+    }
+  }
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+arma::mat Conservation_system<Derived>::get_spatial_scheme(
+    const arma::mat &fields,
+    const double time,
+    const std::vector<double> &geometric_factors,
+    const arma::mat &diff_matrix,
+    const arma::mat &lift_matrix,
+    const DG::Mesh::Trace_indices &trace_indices) const {
+
+  Scheme_workspace workspace;
+  arma::mat spatial_scheme;
+  this->write_spatial_scheme(
+      fields,
+      time,
+      geometric_factors,
+      diff_matrix,
+      lift_matrix,
+      trace_indices,
+      workspace,
+      spatial_scheme);
+
+  return spatial_scheme;
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+void Conservation_system<Derived>::write_volume_fluxes(
+    const Derived &pde,
+    const arma::mat &fields,
+    const size_t first_elem,
+    const size_t last_elem,
+    Scheme_workspace &workspace) {
+
+  constexpr size_t num_components{Derived::num_components};
+  const size_t plane_size{fields.n_elem / num_components};
+  const size_t first_node{first_elem * fields.n_rows};
+  const size_t last_node{last_elem * fields.n_rows};
+
+  if constexpr (Linear_system_pde<Derived>) {
+    const auto flux_jacobian{pde.get_flux_jacobian()};
+    for (size_t row{0}; row < num_components; ++row) {
+      double *flux{workspace.volume_fluxes.memptr() + row * plane_size};
+      bool is_zero{true};
+      for (size_t col{0}; col < num_components; ++col) {
+        const double entry{flux_jacobian[row][col]};
+        if (entry == 0.) {
+          continue;
+        }
+        const double *field{fields.memptr() + col * plane_size};
+        if (is_zero) {
+          for (size_t i{first_node}; i < last_node; ++i) {
+            flux[i] = entry * field[i];
+          }
+          is_zero = false;
+        } else {
+          for (size_t i{first_node}; i < last_node; ++i) {
+            flux[i] += entry * field[i];
+          }
+        }
+      }
+      if (is_zero) {
+        std::fill(flux + first_node, flux + last_node, 0.);
+      }
+    }
+  } else {
+    const double *field{fields.memptr()};
+    double *flux{workspace.volume_fluxes.memptr()};
+    for (size_t node{first_node}; node < last_node; ++node) {
+      std::array<double, num_components> state;
+      for (size_t component{0}; component < num_components; ++component) {
+        state[component] = field[component * plane_size + node];
+      }
+      const std::array<double, num_components> node_flux{
+          pde.get_pointwise_flux(state)};
+      for (size_t component{0}; component < num_components; ++component) {
+        flux[component * plane_size + node] = node_flux[component];
+      }
+    }
+  }
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+template <class Numerical_flux>
+void Conservation_system<Derived>::write_face_fluxes(
+    const Numerical_flux &numerical_flux,
+    const arma::mat &trace_values,
+    const double time,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace) const {
+
+  constexpr size_t num_components{Derived::num_components};
+  using State = std::array<double, num_components>;
+  const size_t num_elems{trace_indices.interior.size() / 2};
+  const size_t plane_size{trace_values.n_rows * num_elems};
+  const auto &interior(trace_indices.interior);
+  const auto &exterior(trace_indices.exterior);
+
+  // Lift coefficients n (f(q^-) - f^*) of a face, where left faces of an
+  // element have the normal -1 and right faces the normal 1
+  auto write_lift_coeffs = [&](
+                               const size_t face,
+                               const Derived &pde,
+                               const State &state,
+                               const State &face_flux) {
+    const State flux{pde.get_pointwise_flux(state)};
+    const size_t elem{face / 2};
+    for (size_t component{0}; component < num_components; ++component) {
+      const size_t col{component * num_elems + elem};
+      if (face % 2 == 0) {
+        workspace.left_coeffs[col] = face_flux[component] - flux[component];
+      } else {
+        workspace.right_coeffs[col] = flux[component] - face_flux[component];
+      }
+    }
+  };
+
+  for (size_t interface{0}; interface < workspace.interface_faces.size();
+       ++interface) {
+    const size_t face{workspace.interface_faces[interface]};
+    const size_t neighbour_face{workspace.interface_neighbours[interface]};
+    const bool is_boundary{
+        neighbour_face == DG::Mesh::Trace_indices::boundary_face};
+    const double normal{face % 2 == 0 ? -1. : 1.};
+    const Derived &pde{this->get_elem_pde(face / 2)};
+    const Derived &neighbour_pde{
+        is_boundary ? pde : this->get_elem_pde(neighbour_face / 2)};
+
+    State interior_state, exterior_state;
+    for (size_t component{0}; component < num_components; ++component) {
+      interior_state[component] =
+          trace_values(interior[face] + component * plane_size);
+    }
+    if (is_boundary) {
+      exterior_state = pde.get_boundary_state(interior_state, time, normal);
+    } else {
+      for (size_t component{0}; component < num_components; ++component) {
+        exterior_state[component] =
+            trace_values(exterior[face] + component * plane_size);
+      }
+    }
+
+    const bool is_right{normal > 0.};
+    const Derived &left_pde{is_right ? pde : neighbour_pde};
+    const Derived &right_pde{is_right ? neighbour_pde : pde};
+    const State &left_state{is_right ? interior_state : exterior_state};
+    const State &right_state{is_right ? exterior_state : interior_state};
+    if constexpr (Interface_flux_pde<Derived>) {
+      if (&left_pde != &right_pde) {
+        const auto [left_face_flux, right_face_flux]{
+            left_pde.get_interface_fluxes(
+                right_pde, left_state, right_state)};
+        write_lift_coeffs(
+            face,
+            pde,
+            interior_state,
+            is_right ? left_face_flux : right_face_flux);
+        write_lift_coeffs(
+            neighbour_face,
+            neighbour_pde,
+            exterior_state,
+            is_right ? right_face_flux : left_face_flux);
+        continue;
+      }
+    }
+
+    State face_flux;
+    if (&left_pde == &right_pde) {
+      face_flux = numerical_flux.get_flux(pde, left_state, right_state);
+    } else {
+      // At an interface of two regions, each state enters the pointwise
+      // flux and the wave speed of its own PDE
+      const DG::Fluxes::Lax_friedrichs lax_friedrichs{std::max(
+          left_pde.get_upwind_param(), right_pde.get_upwind_param())};
+      face_flux = lax_friedrichs.get_flux(
+          left_pde, right_pde, left_state, right_state);
+    }
+
+    // Scatter to both elements of the interface
+    write_lift_coeffs(face, pde, interior_state, face_flux);
+    if (!is_boundary) {
+      write_lift_coeffs(
+          neighbour_face, neighbour_pde, exterior_state, face_flux);
+    }
+  }
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+void Conservation_system<Derived>::write_lift_coeffs(
+    const arma::mat &trace_values,
+    const double time,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace) const {
+
+  workspace.number_interfaces(trace_indices);
+
+  const double upwind_param{this->get_derived().get_upwind_param()};
+  switch (this->numerical_flux) {
+  case DG::Fluxes::Numerical_flux::central:
+    this->write_face_fluxes(
+        DG::Fluxes::Central{}, trace_values, time, trace_indices, workspace);
+    break;
+  case DG::Fluxes::Numerical_flux::upwind:
+    this->write_face_fluxes(
+        DG::Fluxes::Upwind{upwind_param},
+        trace_values,
+        time,
+        trace_indices,
+        workspace);
+    break;
+  case DG::Fluxes::Numerical_flux::lax_friedrichs:
+    this->write_face_fluxes(
+        DG::Fluxes::Lax_friedrichs{upwind_param},
+        trace_values,
+        time,
+        trace_indices,
+        workspace);
+    break;
+  case DG::Fluxes::Numerical_flux::hll:
+    this->write_face_fluxes(
+        DG::Fluxes::Hll{}, trace_values, time, trace_indices, workspace);
+    break;
+  }
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+double Conservation_system<Derived>::get_max_wave_speed(
+    const arma::mat &fields) const {
+
+  if (!this->region_pdes) {
+    return get_max_wave_speed(
+        this->get_derived(),
+        fields,
+        0,
+        fields.n_cols / Derived::num_components);
+  }
+
+  double max_wave_speed{0.};
+  for (size_t region{0}; region < this->region_pdes->get_num_regions();
+       ++region) {
+    max_wave_speed = std::max(
+        max_wave_speed,
+        get_max_wave_speed(
+            this->region_pdes->get_pde(region),
+            fields,
+            this->region_pdes->get_first_elem(region),
+            this->region_pdes->get_last_elem(region)));
+  }
+
+  return max_wave_speed;
+}
+//----
+template <class Derived>
+double Conservation_system<Derived>::get_max_wave_speed(
+    const Derived &pde,
+    const arma::mat &fields,
+    const size_t first_elem,
+    const size_t last_elem) {
+
+  constexpr size_t num_components{Derived::num_components};
+  if constexpr (Linear_system_pde<Derived>) {
+    return pde.get_wave_speed(std::array<double, num_components>{});
+  } else {
+    const size_t plane_size{fields.n_elem / num_components};
+    const double *field{fields.memptr()};
+    double max_wave_speed{0.};
+    for (size_t node{first_elem * fields.n_rows};
+         node < last_elem * fields.n_rows;
+         ++node) {
+      std::array<double, num_components> state;
+      for (size_t component{0}; component < num_components; ++component) {
+        state[component] = field[component * plane_size + node];
+      }
+      max_wave_speed = std::max(max_wave_speed, pde.get_wave_speed(state));
+    }
+
+    return max_wave_speed;
+  }
+}
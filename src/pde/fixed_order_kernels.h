@@ -0,0 +1,338 @@
+#ifndef FIXED_ORDER_KERNELS_H
+#define FIXED_ORDER_KERNELS_H
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace DG::Kernels {
+
+/**
+ * @brief Highest polynomial order, for which the kernels below are
+ * instantiated. Any higher order takes the generic path of Pde.
+ */
+constexpr size_t max_fixed_order{16};
+
+/**
+ * @brief Volume field kernel for a fixed polynomial order, i.e.
+ * \f$ \underline{v}^k_h = -J^k \boldsymbol{\mathcal{D}} \cdot
+ * (a\,\underline{u}^k_h) \f$ for each element \f$k\f$ (see
+ * Pde::get_volume_fields). The differentiation matrix is copied into
+ * fixed-size storage once, such that the element loop operates on
+ * compile-time sized arrays only and is unrolled by the compiler instead
+ * of calling BLAS for tiny matrices.
+ *
+ * @param[in] diff_matrix Column-major \f$(N+1) \times (N+1)\f$
+ * differentiation matrix
+ * @param[in] fields Column-major fields with \f$N+1\f$ rows per element
+ * @param[in] flux_prefactor Volume flux prefactor \f$a\f$
+ * @param[in] geometric_factors Geometric factor \f$J^k\f$ of each element
+ * @param[out] volume_fields Column-major volume fields, sized as the
+ * fields
+ */
+template <size_t Order>
+void apply_volume_kernel(
+    const double *diff_matrix,
+    const double *fields,
+    const double flux_prefactor,
+    const std::vector<double> &geometric_factors,
+    double *volume_fields) {
+
+  constexpr size_t num_nodes{Order + 1};
+  std::array<double, num_nodes * num_nodes> diff;
+  for (size_t i{0}; i < num_nodes * num_nodes; ++i) {
+    diff[i] = diff_matrix[i];
+  }
+
+  for (size_t elem{0}; elem < geometric_factors.size(); ++elem) {
+    const double *field{fields + elem * num_nodes};
+    std::array<double, num_nodes> volume_field{};
+    for (size_t col{0}; col < num_nodes; ++col) {
+      const double flux{flux_prefactor * field[col]};
+      for (size_t row{0}; row < num_nodes; ++row) {
+        volume_field[row] += diff[row + col * num_nodes] * flux;
+      }
+    }
+
+    const double geo_factor{geometric_factors[elem]};
+    double *result{volume_fields + elem * num_nodes};
+    for (size_t row{0}; row < num_nodes; ++row) {
+      result[row] = -volume_field[row] * geo_factor;
+    }
+  }
+}
+
+/**
+ * @brief Lift kernel for a fixed polynomial order, i.e. the left and
+ * right field jumps of each element times their prefactors, lifted by the
+ * first and second column of the lift matrix (see Pde::get_lifted_jumps)
+ *
+ * @param[in] lift_matrix Column-major \f$(N+1) \times 2\f$ lift matrix
+ * @param[in] field_jumps Left and right field jump of each element
+ * @param[in] flux_prefactors Left and right flux prefactor of each
+ * element
+ * @param[in] geometric_factors Geometric factor of each element
+ * @param[in] left_prefactor Prefactor of all left faces
+ * @param[in] right_prefactor Prefactor of all right faces
+ * @param[out] lifted_fields Column-major lifted field jumps with \f$N+1\f$
+ * rows per element
+ */
+template <size_t Order>
+void apply_lift_kernel(
+    const double *lift_matrix,
+    const std::vector<std::tuple<double, double>> &field_jumps,
+    const std::vector<std::tuple<double, double>> &flux_prefactors,
+    const std::vector<double> &geometric_factors,
+    const double left_prefactor,
+    const double right_prefactor,
+    double *lifted_fields) {
+
+  constexpr size_t num_nodes{Order + 1};
+  std::array<double, num_nodes> left_lift, right_lift;
+  for (size_t row{0}; row < num_nodes; ++row) {
+    left_lift[row] = lift_matrix[row];
+    right_lift[row] = lift_matrix[row + num_nodes];
+  }
+
+  for (size_t elem{0}; elem < geometric_factors.size(); ++elem) {
+    const auto [left_flux_prefactor, right_flux_prefactor] =
+        flux_prefactors[elem];
+    const auto [left_jump, right_jump] = field_jumps[elem];
+    const double geo_factor{geometric_factors[elem]};
+    const double left_coeff{
+        left_prefactor * left_flux_prefactor * left_jump * geo_factor};
+    const double right_coeff{
+        right_prefactor * right_flux_prefactor * right_jump * geo_factor};
+
+    double *result{lifted_fields + elem * num_nodes};
+    for (size_t row{0}; row < num_nodes; ++row) {
+      result[row] = left_coeff * left_lift[row] + right_coeff * right_lift[row];
+    }
+  }
+}
+
+/**
+ * @brief Fused kernel of the spatial scheme for a fixed polynomial order
+ * and a pointwise flux \f$f\f$, i.e. the volume field and the lifted
+ * jumps of each element in a single pass over the elements (see
+ * Static_pde::write_spatial_scheme):<br>
+ * \f$ \underline{r}^k_h = J^k \left(-\boldsymbol{\mathcal{D}} \cdot
+ * f(\underline{u}^k_h) + c^k_\mathrm{L} \mathcal L_1 + c^k_\mathrm{R}
+ * \mathcal L_2 \right) \f$. <br>
+ * The flux is a template parameter, such that it is inlined into the
+ * element loop, e.g. a single multiplication for linear advection.
+ * Neither the volume fields nor the lifted jumps are stored.
+ *
+ * @param[in] diff_matrix Column-major \f$(N+1) \times (N+1)\f$
+ * differentiation matrix
+ * @param[in] lift_matrix Column-major \f$(N+1) \times 2\f$ lift matrix
+ * @param[in] fields Column-major fields with \f$N+1\f$ rows per element
+ * @param[in] flux Object whose get_pointwise_flux(value) returns
+ * \f$f(u)\f$ at a node
+ * @param[in] geometric_factors Geometric factor \f$J^k\f$ of each element
+ * @param[in] left_coeffs Coefficient \f$c^k_\mathrm{L}\f$ of the left
+ * lift column of each element
+ * @param[in] right_coeffs Coefficient \f$c^k_\mathrm{R}\f$ of the right
+ * lift column of each element
+ * @param[out] spatial_scheme Column-major spatial scheme, sized as the
+ * fields
+ */
+template <size_t Order, class Flux>
+void apply_pointwise_fused_kernel(
+    const double *diff_matrix,
+    const double *lift_matrix,
+    const double *fields,
+    const Flux &flux,
+    const std::vector<double> &geometric_factors,
+    const std::vector<double> &left_coeffs,
+    const std::vector<double> &right_coeffs,
+    double *spatial_scheme) {
+
+  constexpr size_t num_nodes{Order + 1};
+  std::array<double, num_nodes * num_nodes> diff;
+  for (size_t i{0}; i < num_nodes * num_nodes; ++i) {
+    diff[i] = diff_matrix[i];
+  }
+  std::array<double, num_nodes> left_lift, right_lift;
+  for (size_t row{0}; row < num_nodes; ++row) {
+    left_lift[row] = lift_matrix[row];
+    right_lift[row] = lift_matrix[row + num_nodes];
+  }
+
+  for (size_t elem{0}; elem < geometric_factors.size(); ++elem) {
+    const double *field{fields + elem * num_nodes};
+    std::array<double, num_nodes> volume_field{};
+    for (size_t col{0}; col < num_nodes; ++col) {
+      const double node_flux{flux.get_pointwise_flux(field[col])};
+      for (size_t row{0}; row < num_nodes; ++row) {
+        volume_field[row] += diff[row + col * num_nodes] * node_flux;
+      }
+    }
+
+    const double geo_factor{geometric_factors[elem]};
+    const double left_coeff{left_coeffs[elem] * geo_factor};
+    const double right_coeff{right_coeffs[elem] * geo_factor};
+    double *result{spatial_scheme + elem * num_nodes};
+    for (size_t row{0}; row < num_nodes; ++row) {
+      result[row] = -volume_field[row] * geo_factor +
+                    left_coeff * left_lift[row] +
+                    right_coeff * right_lift[row];
+    }
+  }
+}
+
+/// @brief Flux \f$f(u) = a\,u\f$ of the volume flux prefactor \f$a\f$
+struct Linear_flux {
+  double flux_prefactor;
+
+  inline double get_pointwise_flux(const double value) const {
+    return this->flux_prefactor * value;
+  };
+};
+
+/**
+ * @brief Fused kernel of the linear flux \f$f(u) = a\,u\f$ (see
+ * apply_pointwise_fused_kernel(...) and Pde::write_spatial_scheme)
+ *
+ * @param[in] flux_prefactor Volume flux prefactor \f$a\f$
+ */
+template <size_t Order>
+void apply_fused_kernel(
+    const double *diff_matrix,
+    const double *lift_matrix,
+    const double *fields,
+    const double flux_prefactor,
+    const std::vector<double> &geometric_factors,
+    const std::vector<double> &left_coeffs,
+    const std::vector<double> &right_coeffs,
+    double *spatial_scheme) {
+
+  apply_pointwise_fused_kernel<Order>(
+      diff_matrix,
+      lift_matrix,
+      fields,
+      Linear_flux{flux_prefactor},
+      geometric_factors,
+      left_coeffs,
+      right_coeffs,
+      spatial_scheme);
+}
+
+using Volume_kernel = void (*)(
+    const double *,
+    const double *,
+    const double,
+    const std::vector<double> &,
+    double *);
+
+using Lift_kernel = void (*)(
+    const double *,
+    const std::vector<std::tuple<double, double>> &,
+    const std::vector<std::tuple<double, double>> &,
+    const std::vector<double> &,
+    const double,
+    const double,
+    double *);
+
+using Fused_kernel = void (*)(
+    const double *,
+    const double *,
+    const double *,
+    const double,
+    const std::vector<double> &,
+    const std::vector<double> &,
+    const std::vector<double> &,
+    double *);
+
+template <class Flux>
+using Pointwise_fused_kernel = void (*)(
+    const double *,
+    const double *,
+    const double *,
+    const Flux &,
+    const std::vector<double> &,
+    const std::vector<double> &,
+    const std::vector<double> &,
+    double *);
+
+template <size_t... Orders>
+constexpr std::array<Volume_kernel, sizeof...(Orders)>
+make_volume_kernels(std::index_sequence<Orders...>) {
+  return {&apply_volume_kernel<Orders + 1>...};
+}
+
+template <size_t... Orders>
+constexpr std::array<Lift_kernel, sizeof...(Orders)>
+make_lift_kernels(std::index_sequence<Orders...>) {
+  return {&apply_lift_kernel<Orders + 1>...};
+}
+
+template <size_t... Orders>
+constexpr std::array<Fused_kernel, sizeof...(Orders)>
+make_fused_kernels(std::index_sequence<Orders...>) {
+  return {&apply_fused_kernel<Orders + 1>...};
+}
+
+template <class Flux, size_t... Orders>
+constexpr std::array<Pointwise_fused_kernel<Flux>, sizeof...(Orders)>
+make_pointwise_fused_kernels(std::index_sequence<Orders...>) {
+  return {&apply_pointwise_fused_kernel<Orders + 1, Flux>...};
+}
+
+/// @brief Dispatch tables of the orders \f$1,\dots,N_\mathrm{max}\f$
+inline constexpr auto volume_kernels{
+    make_volume_kernels(std::make_index_sequence<max_fixed_order>{})};
+inline constexpr auto lift_kernels{
+    make_lift_kernels(std::make_index_sequence<max_fixed_order>{})};
+inline constexpr auto fused_kernels{
+    make_fused_kernels(std::make_index_sequence<max_fixed_order>{})};
+template <class Flux>
+inline constexpr auto pointwise_fused_kernels{
+    make_pointwise_fused_kernels<Flux>(
+        std::make_index_sequence<max_fixed_order>{})};
+
+/**
+ * @brief Pick the volume kernel instantiated for a polynomial order
+ *
+ * @return Kernel, or nullptr if there is no instantiation for the order
+ */
+inline Volume_kernel get_volume_kernel(const size_t polynomial_order) {
+  if (polynomial_order < 1 || polynomial_order > max_fixed_order) {
+    return nullptr;
+  }
+  return volume_kernels[polynomial_order - 1];
+}
+
+/// @brief Lift counterpart of get_volume_kernel(...)
+inline Lift_kernel get_lift_kernel(const size_t polynomial_order) {
+  if (polynomial_order < 1 || polynomial_order > max_fixed_order) {
+    return nullptr;
+  }
+  return lift_kernels[polynomial_order - 1];
+}
+
+/// @brief Fused counterpart of get_volume_kernel(...)
+inline Fused_kernel get_fused_kernel(const size_t polynomial_order) {
+  if (polynomial_order < 1 || polynomial_order > max_fixed_order) {
+    return nullptr;
+  }
+  return fused_kernels[polynomial_order - 1];
+}
+
+/**
+ * @brief Fused counterpart of get_volume_kernel(...) for the pointwise
+ * flux of a PDE, which is instantiated per PDE (see Static_pde)
+ */
+template <class Flux>
+inline Pointwise_fused_kernel<Flux>
+get_pointwise_fused_kernel(const size_t polynomial_order) {
+  if (polynomial_order < 1 || polynomial_order > max_fixed_order) {
+    return nullptr;
+  }
+  return pointwise_fused_kernels<Flux>[polynomial_order - 1];
+}
+} // namespace DG::Kernels
+
+#endif
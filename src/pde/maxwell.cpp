@@ -0,0 +1,60 @@
+#include "maxwell.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+Maxwell::Maxwell(
+    const double _permittivity,
+    const double _permeability,
+    const double _upwind_param)
+    : permittivity{_permittivity}, permeability{_permeability},
+      upwind_param{_upwind_param},
+      wave_speed{1. / std::sqrt(_permittivity * _permeability)} {
+
+  if (_permittivity <= 0. || _permeability <= 0.) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Permittivity and permeability need to be positive.");
+  }
+}
+//------------------------------------------------------------------------
+arma::mat
+Maxwell::get_initial_values(const arma::mat &phys_node_coords) const {
+
+  const size_t num_elems(phys_node_coords.n_cols);
+  arma::mat initial_values(
+      phys_node_coords.n_rows, num_components * num_elems, arma::fill::zeros);
+  initial_values.cols(0, num_elems - 1) = arma::sin(phys_node_coords);
+
+  return initial_values;
+}
+//------------------------------------------------------------------------
+std::array<std::array<double, 2>, 2> Maxwell::get_interface_fluxes(
+    const Maxwell &right_pde,
+    const std::array<double, 2> &left_state,
+    const std::array<double, 2> &right_state) const {
+
+  const double left_impedance{
+      std::sqrt(this->permeability / this->permittivity)};
+  const double right_impedance{
+      std::sqrt(right_pde.permeability / right_pde.permittivity)};
+  const double upwind_param{
+      std::max(this->upwind_param, right_pde.upwind_param)};
+
+  const double magnetic{
+      (left_impedance * left_state[1] + right_impedance * right_state[1] +
+       upwind_param * (left_state[0] - right_state[0])) /
+      (left_impedance + right_impedance)};
+  const double electric{
+      (left_state[0] / left_impedance + right_state[0] / right_impedance +
+       upwind_param * (left_state[1] - right_state[1])) /
+      (1. / left_impedance + 1. / right_impedance)};
+
+  return {{
+      {magnetic / this->permittivity, electric / this->permeability},
+      {magnetic / right_pde.permittivity, electric / right_pde.permeability},
+  }};
+}
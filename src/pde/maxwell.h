@@ -0,0 +1,105 @@
+#ifndef MAXWELL_H
+#define MAXWELL_H
+
+#include "conservation_system.h"
+
+#include <array>
+#include <list>
+#include <string>
+
+/**
+ * @brief Maxwell's equations in one dimension, i.e. \f$\varepsilon\,
+ * \partial_t E + \partial_x H = 0\f$ and \f$\mu\,\partial_t H +
+ * \partial_x E = 0\f$ @cite hesthaven2008nodal, with the permittivity
+ * \f$\varepsilon\f$ and the permeability \f$\mu\f$ of a region. The
+ * boundaries of the domain are perfect electric conductors, i.e. \f$E^+ =
+ * -E^-\f$ and \f$H^+ = H^-\f$. Both waves travel at the speed \f$c =
+ * 1/\sqrt{\varepsilon\mu}\f$, such that the default numerical flux of
+ * Conservation_system is the upwind flux for the upwind parameter 1. At
+ * the interface of two materials, the flux depends on the impedances of
+ * both (see get_interface_fluxes(...)).
+ */
+class Maxwell : public Conservation_system<Maxwell> {
+public:
+  static constexpr size_t num_components{2};
+
+  Maxwell(
+      const double permittivity,
+      const double permeability,
+      const double upwind_param);
+
+  /**
+   * @brief Electric field \f$E = \sin(x)\f$ and no magnetic field, i.e.
+   * two waves of half the amplitude travelling in opposite directions
+   *
+   * @return Planes of \f$E\f$ and \f$H\f$ (see Conservation_system)
+   */
+  arma::mat get_initial_values(const arma::mat &phys_node_coords) const;
+
+  /// @brief \f$A = ((0, 1/\varepsilon), (1/\mu, 0))\f$ for \f$(E, H)\f$
+  inline std::array<std::array<double, 2>, 2> get_flux_jacobian() const {
+    return {{{0., 1. / this->permittivity}, {1. / this->permeability, 0.}}};
+  };
+
+  inline std::array<double, 2>
+  get_pointwise_flux(const std::array<double, 2> &state) const {
+    return {state[1] / this->permittivity, state[0] / this->permeability};
+  };
+
+  /// @brief Speed of light \f$c\f$ of the region for any state
+  inline double get_wave_speed(const std::array<double, 2> &) const {
+    return this->wave_speed;
+  };
+
+  /// @brief Waves of the speed \f$c\f$ in both directions
+  inline std::array<double, 2>
+  get_wave_speed_bounds(const std::array<double, 2> &) const {
+    return {-this->wave_speed, this->wave_speed};
+  };
+
+  inline double get_upwind_param() const { return this->upwind_param; };
+
+  /**
+   * @brief Upwind flux of the interface to the material of another region
+   * by the impedances \f$Z = \sqrt{\mu/\varepsilon}\f$ and the
+   * admittances \f$Y = 1/Z\f$ of both sides @cite hesthaven2008nodal
+   * (chapter 2.4), i.e. <br>
+   * \f$ H^* = (Z_\mathrm{L} H_\mathrm{L} + Z_\mathrm{R} H_\mathrm{R} +
+   * \sigma (E_\mathrm{L} - E_\mathrm{R})) / (Z_\mathrm{L} +
+   * Z_\mathrm{R}) \f$ and <br>
+   * \f$ E^* = (Y_\mathrm{L} E_\mathrm{L} + Y_\mathrm{R} E_\mathrm{R} +
+   * \sigma (H_\mathrm{L} - H_\mathrm{R})) / (Y_\mathrm{L} +
+   * Y_\mathrm{R}) \f$ <br>
+   * with the larger upwind parameter \f$\sigma\f$ of both. For \f$\sigma
+   * = 1\f$, these are the traces of the exact solution of the Riemann
+   * problem, i.e. a wave is reflected and transmitted by the Fresnel
+   * coefficients of the interface. The flux of each side is \f$(H^* /
+   * \varepsilon, E^* / \mu)\f$ of its own material.
+   *
+   * @return Flux of the left and of the right element
+   */
+  std::array<std::array<double, 2>, 2> get_interface_fluxes(
+      const Maxwell &right_pde,
+      const std::array<double, 2> &left_state,
+      const std::array<double, 2> &right_state) const;
+
+  /// @brief Perfect electric conductor at both boundaries
+  inline std::array<double, 2> get_boundary_state(
+      const std::array<double, 2> &interior_state,
+      const double,
+      const double) const {
+    return {-interior_state[0], interior_state[1]};
+  };
+
+  inline std::list<std::string> get_field_names() const {
+    return {"E", "H"};
+  };
+
+private:
+  const double permittivity;
+  const double permeability;
+  const double upwind_param;
+  const double wave_speed;
+};
+
+#endif
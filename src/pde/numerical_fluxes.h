@@ -0,0 +1,216 @@
+#ifndef NUMERICAL_FLUXES_H
+#define NUMERICAL_FLUXES_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Numerical fluxes of conservation laws, which are evaluated once
+ * per interface from the states left and right of it, i.e.
+ * \f$f^*(u_\mathrm{L}, u_\mathrm{R})\f$ is the flux in positive
+ * \f$x\f$-direction. The states are either the values of a scalar PDE
+ * (see Static_pde) or the component arrays of a system (see
+ * Conservation_system). The PDE provides its pointwise flux \f$f(u)\f$
+ * and wave speed \f$\lambda(u) = f'(u)\f$ (see Pointwise_pde and
+ * System_pde), which are inlined into the interface loop of each flux.
+ * For linear advection, the upwind flux with \f$\sigma = 1\f$, the
+ * Lax-Friedrichs and the HLL flux coincide.
+ */
+namespace DG::Fluxes {
+
+enum class Numerical_flux { central, upwind, lax_friedrichs, hll };
+
+/**
+ * @brief Get a numerical flux by its name in the input, i.e. "central",
+ * "upwind", "lax_friedrichs" (or "rusanov"), or "hll"
+ */
+inline Numerical_flux get_numerical_flux(const std::string &name) {
+  if (name == "central") {
+    return Numerical_flux::central;
+  } else if (name == "upwind") {
+    return Numerical_flux::upwind;
+  } else if (name == "lax_friedrichs" || name == "rusanov") {
+    return Numerical_flux::lax_friedrichs;
+  } else if (name == "hll") {
+    return Numerical_flux::hll;
+  }
+  throw std::invalid_argument(
+      std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+      ": "
+      "Unknown numerical flux: " +
+      name);
+}
+
+/// @brief \f$a\,x + b\,y\f$ of two values of a scalar PDE
+inline double get_combination(
+    const double a,
+    const double x,
+    const double b,
+    const double y) {
+  return a * x + b * y;
+}
+
+/// @brief \f$a\,x + b\,y\f$ of two states of a system, component-wise
+template <size_t num_components>
+inline std::array<double, num_components> get_combination(
+    const double a,
+    const std::array<double, num_components> &x,
+    const double b,
+    const std::array<double, num_components> &y) {
+  std::array<double, num_components> combination;
+  for (size_t component{0}; component < num_components; ++component) {
+    combination[component] = a * x[component] + b * y[component];
+  }
+  return combination;
+}
+
+/**
+ * @brief Smallest and largest signed wave speed of a state, which is the
+ * single wave speed \f$\lambda(u)\f$ of a scalar PDE, whereas a system
+ * provides the bounds of its eigenvalues (see System_pde)
+ */
+template <class Pde_impl, class State>
+inline std::array<double, 2>
+get_wave_speed_bounds(const Pde_impl &pde, const State &state) {
+  if constexpr (std::is_same_v<State, double>) {
+    const double wave_speed{pde.get_wave_speed(state)};
+    return {wave_speed, wave_speed};
+  } else {
+    return pde.get_wave_speed_bounds(state);
+  }
+}
+
+/// @brief \f$f^* = \{\!\{f\}\!\} = (f(u_\mathrm{L}) + f(u_\mathrm{R}))/2\f$
+struct Central {
+  template <class Pde_impl, class State>
+  inline State get_flux(
+      const Pde_impl &pde,
+      const State &left_state,
+      const State &right_state) const {
+    return get_combination(
+        0.5,
+        pde.get_pointwise_flux(left_state),
+        0.5,
+        pde.get_pointwise_flux(right_state));
+  };
+};
+
+/**
+ * @brief Central flux plus upwinding by the wave speed of the mean state,
+ * i.e. \f$f^* = \{\!\{f\}\!\} - \sigma |\lambda(\{\!\{u\}\!\})| / 2 \,
+ * (u_\mathrm{R} - u_\mathrm{L})\f$ with the upwind parameter \f$\sigma
+ * \in [0,1]\f$, which corresponds to \f$(1-\alpha)\f$ in Hesthaven and
+ * Warburton's textbook @cite hesthaven2008nodal (p. 25, chapter 2.2). For
+ * a system, \f$|\lambda|\f$ is the largest magnitude of its wave speeds.
+ */
+struct Upwind {
+  double upwind_param;
+
+  template <class Pde_impl, class State>
+  inline State get_flux(
+      const Pde_impl &pde,
+      const State &left_state,
+      const State &right_state) const {
+    const double wave_speed{pde.get_wave_speed(
+        get_combination(0.5, left_state, 0.5, right_state))};
+    return get_combination(
+        1.,
+        Central{}.get_flux(pde, left_state, right_state),
+        -0.5 * this->upwind_param * std::abs(wave_speed),
+        get_combination(1., right_state, -1., left_state));
+  };
+};
+
+/**
+ * @brief Local Lax-Friedrichs (Rusanov) flux, i.e. \f$f^* =
+ * \{\!\{f\}\!\} - \sigma C / 2 \, (u_\mathrm{R} - u_\mathrm{L})\f$ with the
+ * maximum wave speed \f$C = \max(|\lambda(u_\mathrm{L})|,
+ * |\lambda(u_\mathrm{R})|)\f$ of the interface @cite toro2009riemann.
+ * Conservation_system passes the upwind parameter of the PDE as
+ * \f$\sigma\f$, whereas Static_pde takes \f$\sigma = 1\f$.
+ */
+struct Lax_friedrichs {
+  double upwind_param{1.};
+
+  template <class Pde_impl, class State>
+  inline State get_flux(
+      const Pde_impl &pde,
+      const State &left_state,
+      const State &right_state) const {
+    return this->get_flux(pde, pde, left_state, right_state);
+  };
+
+  /**
+   * @brief Flux of an interface of two regions with a PDE each, where each
+   * state enters the pointwise flux and the wave speed of its own PDE
+   */
+  template <class Pde_impl, class State>
+  inline State get_flux(
+      const Pde_impl &left_pde,
+      const Pde_impl &right_pde,
+      const State &left_state,
+      const State &right_state) const {
+    const double max_wave_speed{std::max(
+        std::abs(left_pde.get_wave_speed(left_state)),
+        std::abs(right_pde.get_wave_speed(right_state)))};
+    return get_combination(
+        1.,
+        get_combination(
+            0.5,
+            left_pde.get_pointwise_flux(left_state),
+            0.5,
+            right_pde.get_pointwise_flux(right_state)),
+        -0.5 * this->upwind_param * max_wave_speed,
+        get_combination(1., right_state, -1., left_state));
+  };
+};
+
+/**
+ * @brief HLL flux of the wave speed estimates \f$s_\mathrm{L} =
+ * \min(\lambda(u_\mathrm{L}), \lambda(u_\mathrm{R}))\f$ and
+ * \f$s_\mathrm{R} = \max(\lambda(u_\mathrm{L}), \lambda(u_\mathrm{R}))\f$,
+ * i.e. the upwind flux if both waves travel in the same direction and
+ * otherwise \f$f^* = (s_\mathrm{R} f(u_\mathrm{L}) - s_\mathrm{L}
+ * f(u_\mathrm{R}) + s_\mathrm{L} s_\mathrm{R} (u_\mathrm{R} -
+ * u_\mathrm{L})) / (s_\mathrm{R} - s_\mathrm{L})\f$ @cite toro2009riemann.
+ * For a system, the estimates are the smallest and the largest eigenvalue
+ * of both states (see get_wave_speed_bounds(...)).
+ */
+struct Hll {
+  template <class Pde_impl, class State>
+  inline State get_flux(
+      const Pde_impl &pde,
+      const State &left_state,
+      const State &right_state) const {
+    const std::array<double, 2> left_speeds{
+        get_wave_speed_bounds(pde, left_state)};
+    const std::array<double, 2> right_speeds{
+        get_wave_speed_bounds(pde, right_state)};
+    const double min_speed{std::min(left_speeds[0], right_speeds[0])};
+    const double max_speed{std::max(left_speeds[1], right_speeds[1])};
+    if (min_speed >= 0.) {
+      return pde.get_pointwise_flux(left_state);
+    }
+    if (max_speed <= 0.) {
+      return pde.get_pointwise_flux(right_state);
+    }
+    const double scale{1. / (max_speed - min_speed)};
+    return get_combination(
+        scale,
+        get_combination(
+            max_speed,
+            pde.get_pointwise_flux(left_state),
+            -min_speed,
+            pde.get_pointwise_flux(right_state)),
+        scale * min_speed * max_speed,
+        get_combination(1., right_state, -1., left_state));
+  };
+};
+} // namespace DG::Fluxes
+
+#endif
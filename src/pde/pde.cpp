@@ -1,4 +1,5 @@
 #include "pde.h"
+#include "fixed_order_kernels.h"
 #include "../tools/get.h"
 
 #include <cmath>
@@ -10,24 +11,150 @@ arma::mat Pde::get_spatial_scheme(
     const arma::mat &diff_matrix,
     const arma::mat &lift_matrix) const {
 
+  return this->get_spatial_scheme(
+      fields,
+      time,
+      geometric_factors,
+      diff_matrix,
+      lift_matrix,
+      this->get_chain(fields));
+}
+//----
+arma::mat Pde::get_spatial_scheme(
+    const arma::mat &fields,
+    const double time,
+    const std::vector<double> &geometric_factors,
+    const arma::mat &diff_matrix,
+    const arma::mat &lift_matrix,
+    const DG::Mesh::Trace_indices &trace_indices) const {
+
   const arma::mat volume_fields(
       this->get_volume_fields(fields, geometric_factors, diff_matrix));
 
   const arma::mat surface_fields(this->get_surface_fields(
-      fields, time, geometric_factors, lift_matrix));
+      fields, time, geometric_factors, lift_matrix, trace_indices));
 
   return volume_fields + surface_fields;
 }
+//----
+void Pde::write_spatial_scheme(
+    const arma::mat &fields,
+    const double time,
+    const std::vector<double> &geometric_factors,
+    const arma::mat &diff_matrix,
+    const arma::mat &lift_matrix,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace,
+    arma::mat &spatial_scheme) const {
+
+  const size_t num_nodes{fields.n_rows};
+  const size_t num_elems{fields.n_cols};
+  if (workspace.flux_prefactors.size() != num_elems) {
+    workspace.flux_prefactors = this->get_surface_flux_prefactors(num_elems);
+  }
+  workspace.left_coeffs.resize(num_elems);
+  workspace.right_coeffs.resize(num_elems);
+  workspace.scratch.resize(num_nodes);
+  spatial_scheme.set_size(num_nodes, num_elems);
+
+  const std::tuple<double, double> boundary_conditions{
+      this->get_boundary_conditions(fields, time)};
+  if (this->face_interpolation_matrix.is_empty()) {
+    this->write_lift_coeffs(
+        fields, boundary_conditions, trace_indices, workspace);
+  } else {
+    this->write_face_values(fields, workspace);
+    this->write_lift_coeffs(
+        workspace.face_values,
+        boundary_conditions,
+        trace_indices,
+        workspace);
+  }
+
+  const double flux_prefactor{this->get_volume_flux_prefactor()};
+  if (this->fixed_order_kernels) {
+    const auto fused_kernel{DG::Kernels::get_fused_kernel(num_nodes - 1)};
+    if (fused_kernel) {
+      fused_kernel(
+          diff_matrix.memptr(),
+          lift_matrix.memptr(),
+          fields.memptr(),
+          flux_prefactor,
+          geometric_factors,
+          workspace.left_coeffs,
+          workspace.right_coeffs,
+          spatial_scheme.memptr());
+      return;
+    }
+  }
+
+  const bool is_even_odd{
+      this->even_odd_diff_matrix &&
+      this->even_odd_diff_matrix->get_num_nodes() == num_nodes};
+  const double *left_lift{lift_matrix.colptr(0)};
+  const double *right_lift{lift_matrix.colptr(1)};
+  double *volume_field{workspace.scratch.data()};
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    const double *field{fields.colptr(elem)};
+    double *result{spatial_scheme.colptr(elem)};
+
+    // The volume field is formed in the result column, where the even-odd
+    // product needs the scratch buffer instead
+    if (is_even_odd) {
+      this->even_odd_diff_matrix->apply(field, volume_field, result);
+    } else {
+      for (size_t row{0}; row < num_nodes; ++row) {
+        result[row] = 0.;
+      }
+      for (size_t col{0}; col < num_nodes; ++col) {
+        const double *diff_col{diff_matrix.colptr(col)};
+        for (size_t row{0}; row < num_nodes; ++row) {
+          result[row] += diff_col[row] * field[col];
+        }
+      }
+    }
+
+    const double geo_factor{geometric_factors[elem]};
+    const double volume_coeff{-flux_prefactor * geo_factor};
+    const double left_coeff{workspace.left_coeffs[elem] * geo_factor};
+    const double right_coeff{workspace.right_coeffs[elem] * geo_factor};
+    for (size_t row{0}; row < num_nodes; ++row) {
+      result[row] = volume_coeff * result[row] + left_coeff * left_lift[row] +
+                    right_coeff * right_lift[row];
+    }
+  }
+}
 //-------------------------------------------------------------------------
 arma::mat Pde::get_volume_fields(
     const arma::mat &fields,
     const std::vector<double> &geometric_factors,
     const arma::mat &diff_matrix) const {
 
+  if (this->fixed_order_kernels) {
+    const auto volume_kernel{
+        DG::Kernels::get_volume_kernel(diff_matrix.n_rows - 1)};
+    if (volume_kernel) {
+      arma::mat volume_fields(fields.n_rows, fields.n_cols);
+      volume_kernel(
+          diff_matrix.memptr(),
+          fields.memptr(),
+          this->get_volume_flux_prefactor(),
+          geometric_factors,
+          volume_fields.memptr());
+      return volume_fields;
+    }
+  }
+
   const arma::mat fluxes(
       this->get_flux(fields, this->get_volume_flux_prefactor()));
 
-  arma::mat volume_fields(-diff_matrix * fluxes);
+  arma::mat volume_fields;
+  if (this->even_odd_diff_matrix &&
+      this->even_odd_diff_matrix->get_num_nodes() == diff_matrix.n_rows) {
+    volume_fields = -this->even_odd_diff_matrix->apply(fluxes);
+  } else {
+    volume_fields = -diff_matrix * fluxes;
+  }
   for (size_t elem_idx{0}; elem_idx < fields.n_cols; ++elem_idx) {
     volume_fields.col(elem_idx) *= geometric_factors[elem_idx];
   }
@@ -41,59 +168,82 @@ arma::mat Pde::get_surface_fields(
     const std::vector<double> &geometric_factors,
     const arma::mat &lift_matrix) const {
 
+  return this->get_surface_fields(
+      fields,
+      time,
+      geometric_factors,
+      lift_matrix,
+      this->get_chain(fields));
+}
+//----
+arma::mat Pde::get_surface_fields(
+    const arma::mat &fields,
+    const double time,
+    const std::vector<double> &geometric_factors,
+    const arma::mat &lift_matrix,
+    const DG::Mesh::Trace_indices &trace_indices) const {
+
   std::tuple<double, double> boundary_conditions{
       this->get_boundary_conditions(fields, time)};
-  std::vector<std::tuple<double, double>> field_jumps{
-      Pde::get_field_jumps(fields, boundary_conditions)};
+  std::vector<std::tuple<double, double>> field_jumps;
+  if (this->face_interpolation_matrix.is_empty()) {
+    field_jumps =
+        Pde::get_field_jumps(fields, boundary_conditions, trace_indices);
+  } else {
+    const arma::mat face_values(this->face_interpolation_matrix.t() * fields);
+    field_jumps =
+        Pde::get_field_jumps(face_values, boundary_conditions, trace_indices);
+  }
 
   const size_t num_elems{fields.n_cols};
   std::vector<std::tuple<double, double>> surface_flux_prefactors{
       this->get_surface_flux_prefactors(num_elems)};
 
-  // central flux
-  arma::mat surface_fields(get_lifted_jumps(
+  // Central flux with the face normals plus the upwinding in one pass
+  const double upwind_param{this->get_upwind_param()};
+  return this->get_lifted_jumps(
       field_jumps,
       surface_flux_prefactors,
       lift_matrix,
       geometric_factors,
-      0.));
-
-  // uwpinding
-  const double upwind_param{this->get_upwind_param()};
-  if (upwind_param != 0) {
-    surface_fields += get_lifted_jumps(
-        field_jumps,
-        surface_flux_prefactors,
-        lift_matrix,
-        geometric_factors,
-        upwind_param);
-  }
-
-  return surface_fields;
+      -1. - upwind_param,
+      1. - upwind_param);
 }
 //-------------------------------------------------------------------------
 std::vector<std::tuple<double, double>> Pde::get_field_jumps(
     const arma::mat &fields,
     const std::tuple<double, double> boundary_conditions) const {
 
+  return this->get_field_jumps(
+      fields,
+      boundary_conditions,
+      DG::Mesh::Trace_indices::get_chain(fields.n_rows, fields.n_cols));
+}
+//----
+std::vector<std::tuple<double, double>> Pde::get_field_jumps(
+    const arma::mat &fields,
+    const std::tuple<double, double> boundary_conditions,
+    const DG::Mesh::Trace_indices &trace_indices) const {
+
   auto [left_bc, right_bc] = boundary_conditions;
-  const size_t last_node{fields.n_rows - 1};
   const size_t num_elems{fields.n_cols};
+  const auto &interior(trace_indices.interior);
+  const auto &exterior(trace_indices.exterior);
+
+  auto get_jump = [&](const size_t face, const double boundary_jump) {
+    if (exterior[face] == DG::Mesh::Trace_indices::boundary_face) {
+      return boundary_jump;
+    }
+    return fields(interior[face]) - fields(exterior[face]);
+  };
 
   std::vector<std::tuple<double, double>> field_jumps;
-  if (num_elems == 1) {
-    field_jumps.push_back({fields.front() - left_bc, right_bc});
-  } else {
+  field_jumps.reserve(num_elems);
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    const size_t left_face{2 * elem};
     field_jumps.push_back(
-        {fields.front() - left_bc, fields(last_node, 0) - fields(0, 1)});
-    if (num_elems > 2) {
-      for (size_t elem{1}; elem < num_elems - 1; ++elem) {
-        field_jumps.push_back(
-            {-Get::right(field_jumps.back()),
-             fields(last_node, elem) - fields(0, elem + 1)});
-      }
-    }
-    field_jumps.push_back({-Get::right(field_jumps.back()), right_bc});
+        {get_jump(left_face, fields(interior[left_face]) - left_bc),
+         get_jump(left_face + 1, right_bc)});
   }
 
   return field_jumps;
@@ -106,18 +256,52 @@ arma::mat Pde::get_lifted_jumps(
     const std::vector<double> &geometric_factors,
     const double upwind_param) const {
 
-  double left_prefactor, right_prefactor;
   if (upwind_param == 0.) {
-    left_prefactor = -1.; // left face normal
-    right_prefactor = 1.; // right face normal
-  } else {
-    left_prefactor = right_prefactor = -upwind_param;
+    // Face normals
+    return this->get_lifted_jumps(
+        field_jumps,
+        flux_prefactors,
+        lift_matrix,
+        geometric_factors,
+        -1.,
+        1.);
   }
+  return this->get_lifted_jumps(
+      field_jumps,
+      flux_prefactors,
+      lift_matrix,
+      geometric_factors,
+      -upwind_param,
+      -upwind_param);
+}
+//----
+arma::mat Pde::get_lifted_jumps(
+    const std::vector<std::tuple<double, double>> &field_jumps,
+    const std::vector<std::tuple<double, double>> &flux_prefactors,
+    const arma::mat &lift_matrix,
+    const std::vector<double> &geometric_factors,
+    const double left_prefactor,
+    const double right_prefactor) const {
 
   const size_t num_nodes(lift_matrix.n_rows);
   const size_t num_elems(geometric_factors.size());
 
   arma::mat lifted_field(num_nodes, num_elems);
+  if (this->fixed_order_kernels) {
+    const auto lift_kernel{DG::Kernels::get_lift_kernel(num_nodes - 1)};
+    if (lift_kernel) {
+      lift_kernel(
+          lift_matrix.memptr(),
+          field_jumps,
+          flux_prefactors,
+          geometric_factors,
+          left_prefactor,
+          right_prefactor,
+          lifted_field.memptr());
+      return lifted_field;
+    }
+  }
+
   for (size_t elem{0}; elem < num_elems; ++elem) {
 
     auto [left_flux_prefactor, right_flux_prefactor] =
@@ -134,3 +318,68 @@ arma::mat Pde::get_lifted_jumps(
   return lifted_field;
 };
 //-------------------------------------------------------------------------
+DG::Mesh::Trace_indices Pde::get_chain(const arma::mat &fields) const {
+
+  const size_t num_trace_rows{
+      this->face_interpolation_matrix.is_empty() ? fields.n_rows : 2};
+  return DG::Mesh::Trace_indices::get_chain(num_trace_rows, fields.n_cols);
+}
+//-------------------------------------------------------------------------
+void Pde::write_face_values(
+    const arma::mat &fields,
+    Scheme_workspace &workspace) const {
+
+  const size_t num_nodes{fields.n_rows};
+  const size_t num_elems{fields.n_cols};
+  workspace.face_values.set_size(2, num_elems);
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    const double *field{fields.colptr(elem)};
+    for (size_t face{0}; face < 2; ++face) {
+      const double *interpolation{
+          this->face_interpolation_matrix.colptr(face)};
+      double face_value{0.};
+      for (size_t node{0}; node < num_nodes; ++node) {
+        face_value += interpolation[node] * field[node];
+      }
+      workspace.face_values(face, elem) = face_value;
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void Pde::write_lift_coeffs(
+    const arma::mat &trace_values,
+    const std::tuple<double, double> boundary_conditions,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace) const {
+
+  const auto [left_bc, right_bc] = boundary_conditions;
+  const auto &interior(trace_indices.interior);
+  const auto &exterior(trace_indices.exterior);
+
+  // Same jumps as in get_field_jumps(...), where the central flux and the
+  // upwinding of get_surface_fields(...) add up per face
+  const double upwind_param{this->get_upwind_param()};
+  const double left_prefactor{-1. - upwind_param};
+  const double right_prefactor{1. - upwind_param};
+  for (size_t elem{0}; elem < workspace.left_coeffs.size(); ++elem) {
+    const size_t left_face{2 * elem};
+    const size_t right_face{left_face + 1};
+    const double left_value{trace_values(interior[left_face])};
+    const double left_jump{
+        exterior[left_face] == DG::Mesh::Trace_indices::boundary_face
+            ? left_value - left_bc
+            : left_value - trace_values(exterior[left_face])};
+    const double right_jump{
+        exterior[right_face] == DG::Mesh::Trace_indices::boundary_face
+            ? right_bc
+            : trace_values(interior[right_face]) -
+                  trace_values(exterior[right_face])};
+
+    const auto [left_flux_prefactor, right_flux_prefactor] =
+        workspace.flux_prefactors[elem];
+    workspace.left_coeffs[elem] =
+        left_prefactor * left_flux_prefactor * left_jump;
+    workspace.right_coeffs[elem] =
+        right_prefactor * right_flux_prefactor * right_jump;
+  }
+}
@@ -1,9 +1,14 @@
 #ifndef PDE_H
 #define PDE_H
 
+#include "../spatial_solver/even_odd_matrix.h"
+#include "../spatial_solver/mesh/face_connectivity.h"
+#include "scheme_workspace.h"
+
 #include <armadillo>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -11,6 +16,9 @@ class Pde {
 public:
   Pde(){};
 
+  /// @brief Number of field components, which is one for scalar PDEs
+  static constexpr size_t num_components{1};
+
   /**
    * @brief Calculate the boundary condition of a field at a certain time
    */
@@ -29,6 +37,8 @@ public:
    * @brief Create the DG scheme for the PDE, where I distinguish between
    * volume fields and surface fields. The latter connect the individual
    * solution per element to a global solution via the numerical flux.
+   * The neighbouring elements are given by the trace indices, which
+   * default to elements ordered from left to right.
    */
   arma::mat get_spatial_scheme(
       const arma::mat &fields,
@@ -36,6 +46,37 @@ public:
       const std::vector<double> &geometric_factors,
       const arma::mat &diff_matrix,
       const arma::mat &lift_matrix) const;
+  arma::mat get_spatial_scheme(
+      const arma::mat &fields,
+      const double time,
+      const std::vector<double> &geometric_factors,
+      const arma::mat &diff_matrix,
+      const arma::mat &lift_matrix,
+      const DG::Mesh::Trace_indices &trace_indices) const;
+
+  /**
+   * @brief Allocation-free counterpart of get_spatial_scheme(...), which
+   * writes the scheme into the given matrix. The field jumps are turned
+   * into one lift coefficient per face first. The volume field and the
+   * lifted jumps are then computed in a single pass over the elements,
+   * with the fused kernel of the polynomial order if enabled (see
+   * use_fixed_order_kernels(...)). All intermediate values are kept in the
+   * workspace, such that repeated calls of the same size neither allocate
+   * the workspace nor the spatial scheme.
+   *
+   * @param[in,out] workspace Buffers owned by the caller, one per mesh
+   * @param[out] spatial_scheme Spatial scheme, which is resized to the
+   * size of the fields if necessary
+   */
+  void write_spatial_scheme(
+      const arma::mat &fields,
+      const double time,
+      const std::vector<double> &geometric_factors,
+      const arma::mat &diff_matrix,
+      const arma::mat &lift_matrix,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace,
+      arma::mat &spatial_scheme) const;
 
   /**
    * @brief Calculate the volume field, i.e.
@@ -83,25 +124,46 @@ public:
    * @param[in] upwind_param Upwind parameter \f$ \in [0,1]\f$, corresponds
    * to \f$(1-\alpha)\f$ in Hesthaven and Warburton's textbook
    * @cite hesthaven2008nodal (p.25, chapter 2.2).
+   * @param[in] trace_indices Gather indices of the field values at the
+   * element faces and at their neighbouring faces
    *
    * @return Matrix of surface fields, where each column represents an
    * element
    */
-  virtual arma::mat get_surface_fields(
+  arma::mat get_surface_fields(
       const arma::mat &fields,
       const double time,
       const std::vector<double> &geometric_factors,
       const arma::mat &lift_matrix) const;
+  virtual arma::mat get_surface_fields(
+      const arma::mat &fields,
+      const double time,
+      const std::vector<double> &geometric_factors,
+      const arma::mat &lift_matrix,
+      const DG::Mesh::Trace_indices &trace_indices) const;
  
   inline arma::mat
   get_flux(const arma::mat &fields, const double flux_prefactor) const {
     return flux_prefactor * fields;
   }
 
-  /// @brief Calculate field jumps at every interface within a region
+  /**
+   * @brief Calculate field jumps at every interface within a region, i.e.
+   * the interior minus the exterior field value at the left and right face
+   * of each element. At the boundary, the left jump is taken against the
+   * left boundary condition, whereas the right jump is given by the right
+   * boundary condition itself.
+   *
+   * @param[in] trace_indices Gather indices of the faces, which default to
+   * elements ordered from left to right (see Trace_indices::get_chain)
+   */
   std::vector<std::tuple<double, double>> get_field_jumps(
       const arma::mat &fields,
       const std::tuple<double, double> boundary_conditions) const;
+  std::vector<std::tuple<double, double>> get_field_jumps(
+      const arma::mat &fields,
+      const std::tuple<double, double> boundary_conditions,
+      const DG::Mesh::Trace_indices &trace_indices) const;
   
   /**
    * @brief Calculate left and right flux jump of an element multiplied by
@@ -124,11 +186,84 @@ public:
       const arma::mat &lift_matrix,
       const std::vector<double> &geometric_factors,
       const double upwind_param) const;
+  /**
+   * @brief Lifted jumps of the given prefactors of all left and all right
+   * faces, e.g. of the central flux plus the upwinding, such that each
+   * jump is lifted once
+   */
+  arma::mat get_lifted_jumps(
+      const std::vector<std::tuple<double, double>> &field_jumps,
+      const std::vector<std::tuple<double, double>> &flux_prefactors,
+      const arma::mat &lift_matrix,
+      const std::vector<double> &geometric_factors,
+      const double left_prefactor,
+      const double right_prefactor) const;
  
+  /**
+   * @brief Compute the volume fields and the lifted jumps with the kernels
+   * instantiated for the polynomial order of the given matrices, if there
+   * is such an instantiation (see fixed_order_kernels.h). Otherwise, or if
+   * disabled, the generic matrix operations are used.
+   */
+  inline void use_fixed_order_kernels(const bool use_kernels) {
+    this->fixed_order_kernels = use_kernels;
+  };
+
+  /**
+   * @brief Apply the differentiation matrix in the volume fields by its
+   * even-odd decomposition, if its size matches the given differentiation
+   * matrix and no fixed-order kernel applies. This roughly halves the
+   * flops of the volume term on symmetric nodes.
+   */
+  inline void use_even_odd_diff_matrix(
+      std::shared_ptr<const DG::Even_odd_matrix> even_odd_matrix) {
+    this->even_odd_diff_matrix = std::move(even_odd_matrix);
+  };
+
+  /**
+   * @brief Interpolate the fields to the element faces by the columns of
+   * the given \f$(N_\mathrm{p} \times 2)\f$-matrix before the field jumps
+   * are taken, which is needed for nodes which do not include the faces.
+   * The trace indices then refer to the \f$(2 \times K)\f$-matrix of face
+   * values instead of the fields.
+   */
+  inline void use_face_interpolation(const arma::mat &face_interpolation) {
+    this->face_interpolation_matrix = face_interpolation;
+  };
+
   virtual double get_volume_flux_prefactor() const = 0;
   virtual std::vector<std::tuple<double, double>>
     get_surface_flux_prefactors(const size_t num_elems) const = 0;
   virtual double get_upwind_param() const = 0;
   virtual std::list<std::string> get_field_names() const = 0;
+
+protected:
+  bool fixed_order_kernels{false};
+  std::shared_ptr<const DG::Even_odd_matrix> even_odd_diff_matrix;
+  arma::mat face_interpolation_matrix;
+
+  /**
+   * @brief Interpolate the fields to the left and right face of each
+   * element into the face values of the workspace (see
+   * use_face_interpolation(...))
+   */
+  void write_face_values(
+      const arma::mat &fields,
+      Scheme_workspace &workspace) const;
+
+private:
+  /// @brief Trace indices of elements ordered from left to right
+  DG::Mesh::Trace_indices get_chain(const arma::mat &fields) const;
+
+  /**
+   * @brief Lift coefficients of the left and right face of each element,
+   * i.e. the field jumps (see get_field_jumps(...)) times the flux
+   * prefactors and the face normals, including the upwinding
+   */
+  void write_lift_coeffs(
+      const arma::mat &trace_values,
+      const std::tuple<double, double> boundary_conditions,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace) const;
 };
 #endif
@@ -0,0 +1,65 @@
+#ifndef REGION_PDES_H
+#define REGION_PDES_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief PDEs of the regions of the global fields, e.g. of different
+ * materials per region (see Dgtd_solver). The elements of region r are the
+ * columns [region_offsets[r], region_offsets[r+1]) of the fields, as in
+ * Mesh::Ordered_mesh, and are evaluated with the PDE of their region. All
+ * regions are coupled by the numerical flux of their interfaces.
+ */
+template <class Pde_impl> class Region_pdes {
+public:
+  Region_pdes(
+      std::vector<Pde_impl> _pdes,
+      std::vector<size_t> _region_offsets)
+      : pdes(std::move(_pdes)), region_offsets(std::move(_region_offsets)) {
+
+    if (this->region_offsets.size() != this->pdes.size() + 1 ||
+        this->region_offsets.front() != 0) {
+      throw std::invalid_argument(
+          std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+          ": "
+          "Each region needs a PDE and an element offset.");
+    }
+    for (size_t region{0}; region < this->pdes.size(); ++region) {
+      this->elem_regions.insert(
+          this->elem_regions.end(),
+          this->region_offsets[region + 1] - this->region_offsets[region],
+          region);
+    }
+  };
+
+  inline size_t get_num_regions() const { return this->pdes.size(); };
+
+  inline size_t get_num_elems() const { return this->elem_regions.size(); };
+
+  inline const Pde_impl &get_pde(const size_t region) const {
+    return this->pdes[region];
+  };
+
+  /// @brief First element of the region and the one past its last element
+  inline size_t get_first_elem(const size_t region) const {
+    return this->region_offsets[region];
+  };
+  inline size_t get_last_elem(const size_t region) const {
+    return this->region_offsets[region + 1];
+  };
+
+  /// @brief PDE of the region of an element, i.e. of a field column
+  inline const Pde_impl &get_elem_pde(const size_t elem) const {
+    return this->pdes[this->elem_regions[elem]];
+  };
+
+private:
+  std::vector<Pde_impl> pdes;
+  std::vector<size_t> region_offsets;
+  std::vector<size_t> elem_regions;
+};
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef SCHEME_WORKSPACE_H
+#define SCHEME_WORKSPACE_H
+
+#include "../spatial_solver/mesh/face_connectivity.h"
+
+#include <armadillo>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Buffers of the allocation-free spatial scheme (see
+ * Pde::write_spatial_scheme). They are sized on the first call and reused
+ * by all later calls of the same size, such that a steady-state time step
+ * does not allocate. Since the surface flux prefactors and the interfaces
+ * are kept as well, a workspace belongs to a single PDE and mesh.
+ */
+struct Scheme_workspace {
+  /// @brief Field values at the left and right face of each element
+  arma::mat face_values;
+  std::vector<std::tuple<double, double>> flux_prefactors;
+  /// @brief Coefficients of the left and right lift matrix column
+  std::vector<double> left_coeffs;
+  std::vector<double> right_coeffs;
+  /// @brief Per element buffer of the volume field
+  std::vector<double> scratch;
+  /// @brief Numerical flux of each interface (see Static_pde)
+  std::vector<double> face_fluxes;
+  /// @brief Face of each interface at which its flux is evaluated
+  std::vector<size_t> interface_faces;
+  /// @brief Neighbouring face of each interface or boundary_face
+  std::vector<size_t> interface_neighbours;
+  /// @brief Number of faces, for which the interfaces are numbered
+  size_t num_interface_faces{0};
+  /// @brief Volume fluxes of all components of a system (see
+  /// Conservation_system)
+  arma::mat volume_fluxes;
+  /// @brief Geometric factor of each column of a system's fields
+  std::vector<double> column_geo_factors;
+
+  /**
+   * @brief Number the interfaces of the given trace indices, unless they
+   * are numbered already. An interface shared by two faces is evaluated at
+   * the face of the lower index.
+   */
+  void number_interfaces(const DG::Mesh::Trace_indices &trace_indices) {
+    if (this->num_interface_faces == trace_indices.interior.size()) {
+      return;
+    }
+
+    const std::vector<size_t> &neighbour_faces{trace_indices.neighbour_faces};
+    this->interface_faces.clear();
+    this->interface_neighbours.clear();
+    for (size_t face{0}; face < neighbour_faces.size(); ++face) {
+      const size_t neighbour_face{neighbour_faces[face]};
+      if (neighbour_face == DG::Mesh::Trace_indices::boundary_face ||
+          face < neighbour_face) {
+        this->interface_faces.push_back(face);
+        this->interface_neighbours.push_back(neighbour_face);
+      }
+    }
+    this->num_interface_faces = neighbour_faces.size();
+  };
+};
+
+#endif
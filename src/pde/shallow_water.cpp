@@ -0,0 +1,29 @@
+#include "shallow_water.h"
+
+#include <stdexcept>
+#include <string>
+
+Shallow_water::Shallow_water(
+    const double _gravity,
+    const double _upwind_param)
+    : gravity{_gravity}, upwind_param{_upwind_param} {
+
+  if (_gravity <= 0.) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "The gravitational acceleration needs to be positive.");
+  }
+}
+//------------------------------------------------------------------------
+arma::mat
+Shallow_water::get_initial_values(const arma::mat &phys_node_coords) const {
+
+  const size_t num_elems(phys_node_coords.n_cols);
+  arma::mat initial_values(
+      phys_node_coords.n_rows, num_components * num_elems, arma::fill::zeros);
+  initial_values.cols(0, num_elems - 1) =
+      1. + 0.1 * arma::sin(phys_node_coords);
+
+  return initial_values;
+}
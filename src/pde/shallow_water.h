@@ -0,0 +1,73 @@
+#ifndef SHALLOW_WATER_H
+#define SHALLOW_WATER_H
+
+#include "conservation_system.h"
+
+#include <array>
+#include <cmath>
+#include <list>
+#include <string>
+
+/**
+ * @brief Shallow water equations \f$\partial_t h + \partial_x (hu) = 0\f$
+ * and \f$\partial_t (hu) + \partial_x (hu^2 + g h^2/2) = 0\f$ of the water
+ * height \f$h\f$ and the discharge \f$hu\f$ with the gravitational
+ * acceleration \f$g\f$ @cite toro2009riemann. The waves travel at the
+ * speeds \f$u \pm \sqrt{g h}\f$. The boundaries are reflecting walls,
+ * i.e. \f$h^+ = h^-\f$ and \f$(hu)^+ = -(hu)^-\f$. The water height has
+ * to stay positive, since there is no limiter.
+ */
+class Shallow_water : public Conservation_system<Shallow_water> {
+public:
+  static constexpr size_t num_components{2};
+
+  Shallow_water(const double gravity, const double upwind_param);
+
+  /**
+   * @brief Water at rest with the height \f$h = 1 + \sin(x)/10\f$
+   *
+   * @return Planes of \f$h\f$ and \f$hu\f$ (see Conservation_system)
+   */
+  arma::mat get_initial_values(const arma::mat &phys_node_coords) const;
+
+  inline std::array<double, 2>
+  get_pointwise_flux(const std::array<double, 2> &state) const {
+    const double velocity{state[1] / state[0]};
+    return {
+        state[1],
+        state[1] * velocity + 0.5 * this->gravity * state[0] * state[0]};
+  };
+
+  /// @brief \f$|u| + \sqrt{g h}\f$
+  inline double get_wave_speed(const std::array<double, 2> &state) const {
+    return std::abs(state[1] / state[0]) +
+           std::sqrt(this->gravity * state[0]);
+  };
+
+  /// @brief \f$u - \sqrt{g h}\f$ and \f$u + \sqrt{g h}\f$
+  inline std::array<double, 2>
+  get_wave_speed_bounds(const std::array<double, 2> &state) const {
+    const double velocity{state[1] / state[0]};
+    const double celerity{std::sqrt(this->gravity * state[0])};
+    return {velocity - celerity, velocity + celerity};
+  };
+
+  inline double get_upwind_param() const { return this->upwind_param; };
+
+  inline std::array<double, 2> get_boundary_state(
+      const std::array<double, 2> &interior_state,
+      const double,
+      const double) const {
+    return {interior_state[0], -interior_state[1]};
+  };
+
+  inline std::list<std::string> get_field_names() const {
+    return {"h", "hu"};
+  };
+
+private:
+  const double gravity;
+  const double upwind_param;
+};
+
+#endif
@@ -0,0 +1,147 @@
+/* !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * CAUTION:
+ * Due to instantiation issues the method implementation is stored in
+ * a .tpp-file (not .cpp)
+ * For more information, see
+ * https://stackoverflow.com/questions/8752837/undefined-reference-to-template-class-constructor
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ */
+
+#ifndef STATIC_PDE_H
+#define STATIC_PDE_H
+
+#include "numerical_fluxes.h"
+#include "pde.h"
+#include "region_pdes.h"
+
+#include <concepts>
+#include <memory>
+
+/**
+ * @brief Pointwise functions of a scalar PDE, which are evaluated per node
+ * and per face:
+ * - get_pointwise_flux(u): physical flux \f$f(u)\f$
+ * - get_wave_speed(u): wave speed \f$\lambda(u) = f'(u)\f$, which
+ *   enters the numerical fluxes (see numerical_fluxes.h)
+ * - get_boundary_value(u_int, time, normal): exterior value at a boundary
+ *   face, where \f$n = -1\f$ denotes the left and \f$n = 1\f$ the right
+ *   boundary
+ */
+template <class Pde_impl>
+concept Pointwise_pde = requires(
+    const Pde_impl &pde,
+    const double value,
+    const double time) {
+  { pde.get_pointwise_flux(value) } -> std::convertible_to<double>;
+  { pde.get_wave_speed(value) } -> std::convertible_to<double>;
+  {
+    pde.get_boundary_value(value, time, value)
+  } -> std::convertible_to<double>;
+};
+
+/**
+ * @brief Compile-time interface of a PDE by the curiously recurring
+ * template pattern, where the PDE derives from Static_pde<PDE> and
+ * provides the pointwise functions of Pointwise_pde.<br>
+ * Its write_spatial_scheme(...) hides the one of Pde, such that
+ * Dgtd_solver, which is instantiated with the PDE type, calls the
+ * pointwise functions without any virtual call. Hence, the element loops
+ * are instantiated per PDE and the flux is inlined, e.g. into a single
+ * multiplication of the fixed-order kernels for linear advection. The
+ * virtual interface of Pde is kept as an adapter, i.e. the PDE is still
+ * usable via Pde references, then with the generic path of Pde.
+ */
+template <class Derived> class Static_pde : public Pde {
+public:
+  /**
+   * @brief Spatial scheme of the pointwise functions, which equals the one
+   * of Pde::write_spatial_scheme(...) up to rounding for the upwind flux.
+   * The numerical flux \f$f^*\f$ is evaluated once per interface into a
+   * contiguous array of the workspace, and scattered to both elements of
+   * the interface as the lift coefficient of their face, i.e. the normal
+   * times the difference of the physical and the numerical flux
+   * \f$n\,(f(u^-) - f^*)\f$ @cite hesthaven2008nodal (p. 25, chapter
+   * 2.2).
+   */
+  void write_spatial_scheme(
+      const arma::mat &fields,
+      const double time,
+      const std::vector<double> &geometric_factors,
+      const arma::mat &diff_matrix,
+      const arma::mat &lift_matrix,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace,
+      arma::mat &spatial_scheme) const;
+
+  /**
+   * @brief Numerical flux of the interfaces (see numerical_fluxes.h). The
+   * upwind flux, which takes the upwind parameter of the PDE, is the
+   * default.
+   */
+  inline void use_numerical_flux(
+      const DG::Fluxes::Numerical_flux _numerical_flux) {
+    this->numerical_flux = _numerical_flux;
+  };
+
+  inline DG::Fluxes::Numerical_flux get_numerical_flux() const {
+    return this->numerical_flux;
+  };
+
+  /**
+   * @brief Evaluate the elements of each region with the PDE of the region
+   * instead of this PDE, whose scheme settings apply to all regions. The
+   * interface of two regions takes the Lax-Friedrichs flux of both PDEs
+   * (see Fluxes::Lax_friedrichs), and the fixed-order kernels are skipped.
+   */
+  inline void use_region_pdes(
+      std::shared_ptr<const Region_pdes<Derived>> _region_pdes) {
+    this->region_pdes = std::move(_region_pdes);
+  };
+
+  /**
+   * @brief Largest magnitude of the wave speeds of all field values, e.g.
+   * for the time step, which is a single reduction over the fields
+   */
+  double get_max_wave_speed(const arma::mat &fields) const;
+
+private:
+  DG::Fluxes::Numerical_flux numerical_flux{
+      DG::Fluxes::Numerical_flux::upwind};
+  std::shared_ptr<const Region_pdes<Derived>> region_pdes;
+
+  inline const Derived &get_derived() const {
+    return static_cast<const Derived &>(*this);
+  };
+
+  /// @brief PDE of the region of an element (see use_region_pdes(...))
+  inline const Derived &get_elem_pde(const size_t elem) const {
+    return this->region_pdes ? this->region_pdes->get_elem_pde(elem)
+                             : this->get_derived();
+  };
+
+  /**
+   * @brief Numerical flux of each interface and the lift coefficients of
+   * its faces
+   */
+  template <class Numerical_flux>
+  void write_face_fluxes(
+      const Numerical_flux &numerical_flux,
+      const arma::mat &trace_values,
+      const double time,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace) const;
+
+  /**
+   * @brief Lift coefficients of the left and right face of each element
+   * by the selected numerical flux
+   */
+  void write_lift_coeffs(
+      const arma::mat &trace_values,
+      const double time,
+      const DG::Mesh::Trace_indices &trace_indices,
+      Scheme_workspace &workspace) const;
+};
+
+#include "static_pde.tpp"
+
+#endif
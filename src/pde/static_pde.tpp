@@ -0,0 +1,210 @@
+#include "fixed_order_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+template <class Derived>
+void Static_pde<Derived>::write_spatial_scheme(
+    const arma::mat &fields,
+    const double time,
+    const std::vector<double> &geometric_factors,
+    const arma::mat &diff_matrix,
+    const arma::mat &lift_matrix,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace,
+    arma::mat &spatial_scheme) const {
+
+  static_assert(
+      Pointwise_pde<Derived>,
+      "The PDE has to provide the pointwise functions of Pointwise_pde.");
+
+  const size_t num_nodes{fields.n_rows};
+  const size_t num_elems{fields.n_cols};
+  workspace.left_coeffs.resize(num_elems);
+  workspace.right_coeffs.resize(num_elems);
+  workspace.scratch.resize(2 * num_nodes);
+  spatial_scheme.set_size(num_nodes, num_elems);
+
+  if (this->face_interpolation_matrix.is_empty()) {
+    this->write_lift_coeffs(fields, time, trace_indices, workspace);
+  } else {
+    this->write_face_values(fields, workspace);
+    this->write_lift_coeffs(
+        workspace.face_values, time, trace_indices, workspace);
+  }
+
+  if (this->fixed_order_kernels && !this->region_pdes) {
+    const auto fused_kernel{
+        DG::Kernels::get_pointwise_fused_kernel<Derived>(num_nodes - 1)};
+    if (fused_kernel) {
+      fused_kernel(
+          diff_matrix.memptr(),
+          lift_matrix.memptr(),
+          fields.memptr(),
+          this->get_derived(),
+          geometric_factors,
+          workspace.left_coeffs,
+          workspace.right_coeffs,
+          spatial_scheme.memptr());
+      return;
+    }
+  }
+
+  const bool is_even_odd{
+      this->even_odd_diff_matrix &&
+      this->even_odd_diff_matrix->get_num_nodes() == num_nodes};
+  const double *left_lift{lift_matrix.colptr(0)};
+  const double *right_lift{lift_matrix.colptr(1)};
+  double *fluxes{workspace.scratch.data()};
+  double *even_odd_scratch{fluxes + num_nodes};
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    const Derived &pde{this->get_elem_pde(elem)};
+    const double *field{fields.colptr(elem)};
+    double *result{spatial_scheme.colptr(elem)};
+    if (is_even_odd) {
+      for (size_t node{0}; node < num_nodes; ++node) {
+        fluxes[node] = pde.get_pointwise_flux(field[node]);
+      }
+      this->even_odd_diff_matrix->apply(fluxes, even_odd_scratch, result);
+    } else {
+      for (size_t row{0}; row < num_nodes; ++row) {
+        result[row] = 0.;
+      }
+      for (size_t col{0}; col < num_nodes; ++col) {
+        const double *diff_col{diff_matrix.colptr(col)};
+        const double node_flux{pde.get_pointwise_flux(field[col])};
+        for (size_t row{0}; row < num_nodes; ++row) {
+          result[row] += diff_col[row] * node_flux;
+        }
+      }
+    }
+
+    const double geo_factor{geometric_factors[elem]};
+    const double left_coeff{workspace.left_coeffs[elem] * geo_factor};
+    const double right_coeff{workspace.right_coeffs[elem] * geo_factor};
+    for (size_t row{0}; row < num_nodes; ++row) {
+      result[row] = -geo_factor * result[row] + left_coeff * left_lift[row] +
+                    right_coeff * right_lift[row];
+    }
+  }
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+template <class Numerical_flux>
+void Static_pde<Derived>::write_face_fluxes(
+    const Numerical_flux &numerical_flux,
+    const arma::mat &trace_values,
+    const double time,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace) const {
+
+  const auto &interior(trace_indices.interior);
+  const auto &exterior(trace_indices.exterior);
+
+  // Lift coefficient n (f(u^-) - f^*) of a face, where left faces of an
+  // element have the normal -1 and right faces the normal 1
+  auto write_lift_coeff = [&workspace](
+                              const size_t face,
+                              const Derived &pde,
+                              const double value,
+                              const double face_flux) {
+    if (face % 2 == 0) {
+      workspace.left_coeffs[face / 2] =
+          face_flux - pde.get_pointwise_flux(value);
+    } else {
+      workspace.right_coeffs[face / 2] =
+          pde.get_pointwise_flux(value) - face_flux;
+    }
+  };
+
+  for (size_t interface{0}; interface < workspace.interface_faces.size();
+       ++interface) {
+    const size_t face{workspace.interface_faces[interface]};
+    const size_t neighbour_face{workspace.interface_neighbours[interface]};
+    const bool is_boundary{
+        neighbour_face == DG::Mesh::Trace_indices::boundary_face};
+    const double normal{face % 2 == 0 ? -1. : 1.};
+    const Derived &pde{this->get_elem_pde(face / 2)};
+    const Derived &neighbour_pde{
+        is_boundary ? pde : this->get_elem_pde(neighbour_face / 2)};
+    const double interior_value{trace_values(interior[face])};
+    const double exterior_value{
+        is_boundary ? pde.get_boundary_value(interior_value, time, normal)
+                    : trace_values(exterior[face])};
+    const double left_value{normal > 0. ? interior_value : exterior_value};
+    const double right_value{normal > 0. ? exterior_value : interior_value};
+    double face_flux;
+    if (&neighbour_pde == &pde) {
+      face_flux = numerical_flux.get_flux(pde, left_value, right_value);
+    } else {
+      face_flux = DG::Fluxes::Lax_friedrichs{}.get_flux(
+          normal > 0. ? pde : neighbour_pde,
+          normal > 0. ? neighbour_pde : pde,
+          left_value,
+          right_value);
+    }
+    workspace.face_fluxes[interface] = face_flux;
+
+    // Scatter to both elements of the interface
+    write_lift_coeff(face, pde, interior_value, face_flux);
+    if (!is_boundary) {
+      write_lift_coeff(
+          neighbour_face, neighbour_pde, exterior_value, face_flux);
+    }
+  }
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+void Static_pde<Derived>::write_lift_coeffs(
+    const arma::mat &trace_values,
+    const double time,
+    const DG::Mesh::Trace_indices &trace_indices,
+    Scheme_workspace &workspace) const {
+
+  workspace.number_interfaces(trace_indices);
+  workspace.face_fluxes.resize(workspace.interface_faces.size());
+
+  switch (this->numerical_flux) {
+  case DG::Fluxes::Numerical_flux::central:
+    this->write_face_fluxes(
+        DG::Fluxes::Central{}, trace_values, time, trace_indices, workspace);
+    break;
+  case DG::Fluxes::Numerical_flux::upwind:
+    this->write_face_fluxes(
+        DG::Fluxes::Upwind{this->get_upwind_param()},
+        trace_values,
+        time,
+        trace_indices,
+        workspace);
+    break;
+  case DG::Fluxes::Numerical_flux::lax_friedrichs:
+    this->write_face_fluxes(
+        DG::Fluxes::Lax_friedrichs{},
+        trace_values,
+        time,
+        trace_indices,
+        workspace);
+    break;
+  case DG::Fluxes::Numerical_flux::hll:
+    this->write_face_fluxes(
+        DG::Fluxes::Hll{}, trace_values, time, trace_indices, workspace);
+    break;
+  }
+}
+//-------------------------------------------------------------------------
+template <class Derived>
+double Static_pde<Derived>::get_max_wave_speed(const arma::mat &fields) const {
+
+  const double *field{fields.memptr()};
+  double max_wave_speed{0.};
+  for (size_t elem{0}; elem < fields.n_cols; ++elem) {
+    const Derived &pde{this->get_elem_pde(elem)};
+    for (size_t i{elem * fields.n_rows}; i < (elem + 1) * fields.n_rows;
+         ++i) {
+      max_wave_speed =
+          std::max(max_wave_speed, std::abs(pde.get_wave_speed(field[i])));
+    }
+  }
+
+  return max_wave_speed;
+}
@@ -0,0 +1,39 @@
+#include "gauss_legendre_basis.h"
+
+namespace DG {
+std::vector<double>
+Gauss_legendre_basis::get_quad_nodes(const size_t polynomial_order) const {
+  return this->get_gauss_jacobi_quadrature(0, 0, polynomial_order).nodes;
+};
+
+double Gauss_legendre_basis::get_polynomial(
+    const size_t polynomial_order,
+    const double position) const {
+  return this->get_jacobi_polynomial(0, 0, polynomial_order, position);
+};
+
+double Gauss_legendre_basis::get_polynomial_gradient(
+    const size_t polynomial_order,
+    const double position) const {
+  return this->get_jacobi_polynomial_gradient(
+      0, 0, polynomial_order, position);
+};
+
+arma::mat Gauss_legendre_basis::get_polynomials(
+    const size_t max_order,
+    const arma::vec &positions) const {
+  return this->get_jacobi_polynomials(0, 0, max_order, positions);
+};
+
+arma::mat Gauss_legendre_basis::get_polynomial_gradients(
+    const size_t max_order,
+    const arma::vec &positions) const {
+  return this->get_jacobi_polynomial_gradients(0, 0, max_order, positions);
+};
+
+arma::vec Gauss_legendre_basis::get_polynomial_expansion(
+    const arma::mat &coefficients,
+    const arma::vec &positions) const {
+  return this->get_jacobi_expansion(0, 0, coefficients, positions);
+};
+} // namespace DG
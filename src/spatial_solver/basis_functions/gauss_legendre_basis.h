@@ -0,0 +1,59 @@
+#ifndef GAUSS_LEGENDRE_BASIS_H
+#define GAUSS_LEGENDRE_BASIS_H
+
+#include "jacobi_basis.h"
+#include "polynomial.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace DG {
+/**
+ * @brief Legendre polynomials, their gradients, and Gauss-Legendre
+ * quadrature nodes for the spatial solver.
+ *
+ * Contrary to Legendre_basis, the quadrature nodes are the roots of the
+ * Legendre polynomial of order \f$n+1\f$, which do not include the element
+ * faces at \f$\pm 1\f$. Hence, the field values at the faces have to be
+ * interpolated (see Elementwise_operations::get_face_interpolation_matrix).
+ * In return, the nodes are less clustered at the element faces.
+ */
+class Gauss_legendre_basis : public Jacobi_basis, public Polynomial {
+
+public:
+  Gauss_legendre_basis(){};
+
+  /**
+   * @brief The Gauss-Legendre nodes are a special case of the
+   * Gauss-Jacobi nodes of the Jacobi_basis class, where the parameters are
+   * set to \f$\alpha=\beta=0\f$.
+   */
+  std::vector<double> get_quad_nodes(const size_t polynomial_order) const;
+
+  /// @brief See Legendre_basis::get_polynomial(...)
+  double get_polynomial(
+      const size_t polynomial_order,
+      const double position) const;
+
+  /// @brief See Legendre_basis::get_polynomial_gradient(...)
+  double get_polynomial_gradient(
+      const size_t polynomial_order,
+      const double position) const;
+
+  /// @brief See Legendre_basis::get_polynomials(...)
+  arma::mat get_polynomials(
+      const size_t max_order,
+      const arma::vec &positions) const;
+
+  /// @brief See Legendre_basis::get_polynomial_gradients(...)
+  arma::mat get_polynomial_gradients(
+      const size_t max_order,
+      const arma::vec &positions) const;
+
+  /// @brief See Legendre_basis::get_polynomial_expansion(...)
+  arma::vec get_polynomial_expansion(
+      const arma::mat &coefficients,
+      const arma::vec &positions) const;
+};
+} // namespace DG
+#endif
@@ -0,0 +1,4980 @@
+// Generated by scripts/generate_gll_tables.py, do not edit.
+#ifndef GLL_TABLES_H
+#define GLL_TABLES_H
+
+#include <array>
+#include <cstddef>
+
+namespace DG::GLL_tables {
+
+/**
+ * @brief Legendre-Gauss-Lobatto nodes, weights, differentiation
+ * matrix, and lift matrix on the reference element of a polynomial
+ * order. The matrices are stored column-major, i.e. in the memory
+ * layout of arma::mat.
+ */
+struct Table {
+  size_t polynomial_order;
+  const double *nodes;
+  const double *weights;
+  const double *diff_matrix;
+  const double *lift_matrix;
+};
+
+constexpr size_t max_order{32};
+
+// Polynomial order 1
+inline constexpr std::array<double, 2> nodes_1{
+    -1.0, 1.0};
+inline constexpr std::array<double, 2> weights_1{
+    1.0, 1.0};
+inline constexpr std::array<double, 4> diff_matrix_1{
+    -0.5, -0.5, 0.5, 0.5};
+inline constexpr std::array<double, 4> lift_matrix_1{
+    2.0, -1.0, -1.0, 2.0};
+
+// Polynomial order 2
+inline constexpr std::array<double, 3> nodes_2{
+    -1.0, 0.0, 1.0};
+inline constexpr std::array<double, 3> weights_2{
+    0.3333333333333333, 1.3333333333333333, 0.3333333333333333};
+inline constexpr std::array<double, 9> diff_matrix_2{
+    -1.5, -0.5, 0.5, 2.0, 0.0, -2.0, -0.5, 0.5, 1.5};
+inline constexpr std::array<double, 6> lift_matrix_2{
+    4.5, -0.75, 1.5, 1.5, -0.75, 4.5};
+
+// Polynomial order 3
+inline constexpr std::array<double, 4> nodes_3{
+    -1.0, -0.4472135954999579, 0.4472135954999579, 1.0};
+inline constexpr std::array<double, 4> weights_3{
+    0.16666666666666666, 0.8333333333333334, 0.8333333333333334,
+    0.16666666666666666};
+inline constexpr std::array<double, 16> diff_matrix_3{
+    -3.0, -0.8090169943749475, 0.30901699437494745, -0.5, 4.045084971874737,
+    0.0, -1.118033988749895, 1.545084971874737, -1.545084971874737,
+    1.118033988749895, 0.0, -4.045084971874737, 0.5, -0.30901699437494745,
+    0.8090169943749475, 3.0};
+inline constexpr std::array<double, 8> lift_matrix_3{
+    8.0, -0.8944271909999159, 0.8944271909999159, -2.0, -2.0,
+    0.8944271909999159, -0.8944271909999159, 8.0};
+
+// Polynomial order 4
+inline constexpr std::array<double, 5> nodes_4{
+    -1.0, -0.6546536707079772, 0.0, 0.6546536707079772, 1.0};
+inline constexpr std::array<double, 5> weights_4{
+    0.1, 0.5444444444444444, 0.7111111111111111, 0.5444444444444444, 0.1};
+inline constexpr std::array<double, 25> diff_matrix_4{
+    -5.0, -1.2409902530309829, 0.375, -0.25900974696901713, 0.5,
+    6.75650248872424, 0.0, -1.3365845776954532, 0.7637626158259734,
+    -1.4101641779424268, -2.6666666666666665, 1.7457431218879391, 0.0,
+    -1.7457431218879391, 2.6666666666666665, 1.4101641779424268,
+    -0.7637626158259734, 1.3365845776954532, 0.0, -6.75650248872424, -0.5,
+    0.25900974696901713, -0.375, 1.2409902530309829, 5.0};
+inline constexpr std::array<double, 10> lift_matrix_4{
+    12.5, -1.0714285714285714, 0.9375, -1.0714285714285714, 2.5, 2.5,
+    -1.0714285714285714, 0.9375, -1.0714285714285714, 12.5};
+
+// Polynomial order 5
+inline constexpr std::array<double, 6> nodes_5{
+    -1.0, -0.7650553239294647, -0.2852315164806451, 0.2852315164806451,
+    0.7650553239294647, 1.0};
+inline constexpr std::array<double, 6> weights_5{
+    0.06666666666666667, 0.378474956297847, 0.5548583770354863,
+    0.5548583770354863, 0.378474956297847, 0.06666666666666667};
+inline constexpr std::array<double, 36> diff_matrix_5{
+    -7.5, -1.7863649483390949, 0.4849510478535692, -0.26970061083203895,
+    0.23778117798423137, -0.5, 10.14141593631967, 0.0, -1.7212569528302333,
+    0.7863566722232407, -0.6535475074298002, 1.349913314190488,
+    -4.036187270305348, 2.5234267774294556, 0.0, -1.752961966367866,
+    1.1528281585359292, -2.244684648176167, 2.244684648176167,
+    -1.1528281585359292, 1.752961966367866, 0.0, -2.5234267774294556,
+    4.036187270305348, -1.349913314190488, 0.6535475074298002,
+    -0.7863566722232407, 1.7212569528302333, 0.0, -10.14141593631967, 0.5,
+    -0.23778117798423137, 0.26970061083203895, -0.4849510478535692,
+    1.7863649483390949, 7.5};
+inline constexpr std::array<double, 12> lift_matrix_5{
+    18.0, -1.2590908023938616, 1.0398831751662532, -1.0398831751662532,
+    1.2590908023938616, -3.0, -3.0, 1.2590908023938616, -1.0398831751662532,
+    1.0398831751662532, -1.2590908023938616, 18.0};
+
+// Polynomial order 6
+inline constexpr std::array<double, 7> nodes_6{
+    -1.0, -0.830223896278567, -0.46884879347071423, 0.0, 0.46884879347071423,
+    0.830223896278567, 1.0};
+inline constexpr std::array<double, 7> weights_6{
+    0.047619047619047616, 0.27682604736156596, 0.4317453812098626,
+    0.4876190476190476, 0.4317453812098626, 0.27682604736156596,
+    0.047619047619047616};
+inline constexpr std::array<double, 49> diff_matrix_6{
+    -10.5, -2.4429260142442897, 0.6252566655153421, -0.3125,
+    0.22609940094257466, -0.22661187039544534, 0.5, 14.201576602919816, 0.0,
+    -2.2158042831699714, 0.9075444712688209, -0.6163908355175796,
+    0.6022471796357857, -1.3173734357024345, -5.668985225545508,
+    3.4558282142942853, 0.0, -2.006969240588753, 1.0664419040063746,
+    -0.9613397972887117, 2.049964813076743, 3.2, -1.598606688098367,
+    2.266698087085999, 0.0, -2.266698087085999, 1.598606688098367, -3.2,
+    -2.049964813076743, 0.9613397972887117, -1.0664419040063746,
+    2.006969240588753, 0.0, -3.4558282142942853, 5.668985225545508,
+    1.3173734357024345, -0.6022471796357857, 0.6163908355175796,
+    -0.9075444712688209, 2.2158042831699714, 0.0, -14.201576602919816, -0.5,
+    0.22661187039544534, -0.22609940094257466, 0.3125, -0.6252566655153421,
+    2.4429260142442897, 10.5};
+inline constexpr std::array<double, 14> lift_matrix_6{
+    24.5, -1.4516266113234395, 1.1623704129763321, -1.09375,
+    1.1623704129763321, -1.4516266113234395, 3.5, 3.5, -1.4516266113234395,
+    1.1623704129763321, -1.09375, 1.1623704129763321, -1.4516266113234395,
+    24.5};
+
+// Polynomial order 7
+inline constexpr std::array<double, 8> nodes_7{
+    -1.0, -0.8717401485096066, -0.5917001814331423, -0.20929921790247888,
+    0.20929921790247888, 0.5917001814331423, 0.8717401485096066, 1.0};
+inline constexpr std::array<double, 8> weights_7{
+    0.03571428571428571, 0.21070422714350603, 0.34112269248350435,
+    0.4124587946587039, 0.4124587946587039, 0.34112269248350435,
+    0.21070422714350603, 0.03571428571428571};
+inline constexpr std::array<double, 64> diff_matrix_7{
+    -14.0, -3.20991570300299, 0.7924766813205145, -0.37215043572859485,
+    0.243330712723791, -0.20328456890059274, 0.21995751477130437, -0.5,
+    18.93759860711737, 0.0, -2.8064757947364334, 1.0789446887904528,
+    -0.6611573509003112, 0.537039586157661, -0.5735654149402641,
+    1.297687388320232, -7.569289819348487, 4.543585064566564, 0.0,
+    -2.3781872335155056, 1.1353580168811115, -0.8450225565065105,
+    0.869448098331493, -1.9416594255441224, 4.297908164265175,
+    -2.1120612143145423, 2.8755174059725053, 0.0, -2.3889243591582394,
+    1.3727858318060284, -1.2942320509135015, 2.810188989257949,
+    -2.810188989257949, 1.2942320509135015, -1.3727858318060284,
+    2.3889243591582394, 0.0, -2.8755174059725053, 2.1120612143145423,
+    -4.297908164265175, 1.9416594255441224, -0.869448098331493,
+    0.8450225565065105, -1.1353580168811115, 2.3781872335155056, 0.0,
+    -4.543585064566564, 7.569289819348487, -1.297687388320232,
+    0.5735654149402641, -0.537039586157661, 0.6611573509003112,
+    -1.0789446887904528, 2.8064757947364334, 0.0, -18.93759860711737, 0.5,
+    -0.21995751477130437, 0.20328456890059274, -0.243330712723791,
+    0.37215043572859485, -0.7924766813205145, 3.20991570300299, 14.0};
+inline constexpr std::array<double, 16> lift_matrix_7{
+    32.0, -1.6468132454553808, 1.2942723408065264, -1.1770385623541328,
+    1.1770385623541328, -1.2942723408065264, 1.6468132454553808, -4.0, -4.0,
+    1.6468132454553808, -1.2942723408065264, 1.1770385623541328,
+    -1.1770385623541328, 1.2942723408065264, -1.6468132454553808, 32.0};
+
+// Polynomial order 8
+inline constexpr std::array<double, 9> nodes_8{
+    -1.0, -0.8997579954114602, -0.6771862795107377, -0.36311746382617816, 0.0,
+    0.36311746382617816, 0.6771862795107377, 0.8997579954114602, 1.0};
+inline constexpr std::array<double, 9> weights_8{
+    0.027777777777777776, 0.16549536156080552, 0.2745387125001617,
+    0.34642851097304633, 0.37151927437641724, 0.34642851097304633,
+    0.2745387125001617, 0.16549536156080552, 0.027777777777777776};
+inline constexpr std::array<double, 81> diff_matrix_8{
+    -18.0, -4.087013702033676, 0.985360090074507, -0.44461344928109064,
+    0.2734375, -0.20773451203559717, 0.18965559197835644, -0.21565401870249898,
+    0.5, 24.349745171593067, 0.0, -3.4883587534344547, 1.2879607500639065,
+    -0.7417823979162542, 0.5473001605340514, -0.4923509383155074,
+    0.5557049812837168, -1.2848306326995884, -9.738701657211548,
+    5.786805816637312, 0.0, -2.8344589120794206, 1.2694130863581494,
+    -0.8557261850926754, 0.7383492771903861, -0.8167563817413859,
+    1.8744408734469833, 5.544963906949379, -2.696065440314056,
+    3.576680940125615, 0.0, -2.659310217573918, 1.3769648937605121,
+    -1.0798038112826305, 1.1456537384551324, -2.590745676559355,
+    -3.657142857142857, 1.6652216450053852, -1.7178321571950628,
+    2.851915968462895, 0.0, -2.851915968462895, 1.7178321571950628,
+    -1.6652216450053852, 3.657142857142857, 2.590745676559355,
+    -1.1456537384551324, 1.0798038112826305, -1.3769648937605121,
+    2.659310217573918, 0.0, -3.576680940125615, 2.696065440314056,
+    -5.544963906949379, -1.8744408734469833, 0.8167563817413859,
+    -0.7383492771903861, 0.8557261850926754, -1.2694130863581494,
+    2.8344589120794206, 0.0, -5.786805816637312, 9.738701657211548,
+    1.2848306326995884, -0.5557049812837168, 0.4923509383155074,
+    -0.5473001605340514, 0.7417823979162542, -1.2879607500639065,
+    3.4883587534344547, 0.0, -24.349745171593067, -0.5, 0.21565401870249898,
+    -0.18965559197835644, 0.20773451203559717, -0.2734375, 0.44461344928109064,
+    -0.985360090074507, 4.087013702033676, 18.0};
+inline constexpr std::array<double, 18> lift_matrix_8{
+    40.5, -1.8436070082270826, 1.4313949051436377, -1.2742494353780935,
+    1.23046875, -1.2742494353780935, 1.4313949051436377, -1.8436070082270826,
+    4.5, 4.5, -1.8436070082270826, 1.4313949051436377, -1.2742494353780935,
+    1.23046875, -1.2742494353780935, 1.4313949051436377, -1.8436070082270826,
+    40.5};
+
+// Polynomial order 9
+inline constexpr std::array<double, 10> nodes_9{
+    -1.0, -0.9195339081664589, -0.738773865105505, -0.4779249498104445,
+    -0.16527895766638703, 0.16527895766638703, 0.4779249498104445,
+    0.738773865105505, 0.9195339081664589, 1.0};
+inline constexpr std::array<double, 10> weights_9{
+    0.022222222222222223, 0.13330599085107012, 0.22488934206312644,
+    0.2920426836796838, 0.32753976118389744, 0.32753976118389744,
+    0.2920426836796838, 0.22488934206312644, 0.13330599085107012,
+    0.022222222222222223};
+inline constexpr std::array<double, 100> diff_matrix_9{
+    -22.5, -5.074064702978063, 1.203351992852207, -0.5283693768202727,
+    0.31204725560841123, -0.22352794474245385, 0.18664578939373597,
+    -0.18078658548924992, 0.2127027580091888, -0.5, 30.43814502928192, 0.0,
+    -4.259297354965219, 1.5299026381816034, -0.8458135734064249,
+    0.5880821430451695, -0.48346232633394814, 0.46427495890815756,
+    -0.5437537382357056, 1.2759548360926636, -12.17794670742982,
+    7.185502869705825, 0.0, -3.3641258682978177, 1.4448503156016608,
+    -0.9165551803364352, 0.7212373127216039, -0.676797087196086,
+    0.7832392931379083, -1.8295639319032462, 6.943788485133954,
+    -3.3516638627467734, 4.368674557010185, 0.0, -3.020217958199347,
+    1.4680555093899939, -1.0461893655024936, 0.9366032131394474,
+    -1.0591544636454413, 2.452884175442687, -4.5993547611031325,
+    2.078207994036417, -2.104350179413156, 3.3873181012024447, 0.0,
+    -3.025188487751975, 1.6464940839870597, -1.3349154838782515,
+    1.4449484487514552, -3.294643033749184, 3.294643033749184,
+    -1.4449484487514552, 1.3349154838782515, -1.6464940839870597,
+    3.025188487751975, 0.0, -3.3873181012024447, 2.104350179413156,
+    -2.078207994036417, 4.5993547611031325, -2.452884175442687,
+    1.0591544636454413, -0.9366032131394474, 1.0461893655024936,
+    -1.4680555093899939, 3.020217958199347, 0.0, -4.368674557010185,
+    3.3516638627467734, -6.943788485133954, 1.8295639319032462,
+    -0.7832392931379083, 0.676797087196086, -0.7212373127216039,
+    0.9165551803364352, -1.4448503156016608, 3.3641258682978177, 0.0,
+    -7.185502869705825, 12.17794670742982, -1.2759548360926636,
+    0.5437537382357056, -0.46427495890815756, 0.48346232633394814,
+    -0.5880821430451695, 0.8458135734064249, -1.5299026381816034,
+    4.259297354965219, 0.0, -30.43814502928192, 0.5, -0.2127027580091888,
+    0.18078658548924992, -0.18664578939373597, 0.22352794474245385,
+    -0.31204725560841123, 0.5283693768202727, -1.203351992852207,
+    5.074064702978063, 22.5};
+inline constexpr std::array<double, 20> lift_matrix_9{
+    50.0, -2.0414507817958136, 1.5717349500518496, -1.3792423446103401,
+    1.3023620522939818, -1.3023620522939818, 1.3792423446103401,
+    -1.5717349500518496, 2.0414507817958136, -5.0, -5.0, 2.0414507817958136,
+    -1.5717349500518496, 1.3792423446103401, -1.3023620522939818,
+    1.3023620522939818, -1.3792423446103401, 1.5717349500518496,
+    -2.0414507817958136, 50.0};
+
+// Polynomial order 10
+inline constexpr std::array<double, 11> nodes_10{
+    -1.0, -0.9340014304080592, -0.7844834736631444, -0.565235326996205,
+    -0.2957581355869394, 0.0, 0.2957581355869394, 0.565235326996205,
+    0.7844834736631444, 0.9340014304080592, 1.0};
+inline constexpr std::array<double, 11> weights_10{
+    0.01818181818181818, 0.10961227326699487, 0.1871698817803052,
+    0.24804810426402832, 0.28687912477900807, 0.3002175954556907,
+    0.28687912477900807, 0.24804810426402832, 0.1871698817803052,
+    0.10961227326699487, 0.01818181818181818};
+inline constexpr std::array<double, 121> diff_matrix_10{
+    -27.5, -6.17098569731789, 1.4461724827922597, -0.6227252147386684,
+    0.35747637311649516, -0.24609375, 0.19428766879641807,
+    -0.17297010851182482, 0.17465786294761076, -0.21058734631306575, 0.5,
+    37.202867381961894, 0.0, -5.118211824775777, 1.8026467998794657,
+    -0.9684871388021601, 0.6469399638321011, -0.5026433130128494,
+    0.4433956364372609, -0.445313527290914, 0.5353310859294437,
+    -1.2695626762851475, -14.887396295098673, 8.739670053520333, 0.0,
+    -3.961996577045789, 1.6527366342270542, -1.0065054085767793,
+    0.7477348246882332, -0.6435862093598302, 0.6373620564181559,
+    -0.7604009822439128, 1.7979880357947782, 8.495619494633516,
+    -4.079316193712744, 5.2506617554544395, 0.0, -3.4506147161735594,
+    1.6081279037255152, -1.0799872504956867, 0.8845873145564326,
+    -0.852916813558494, 1.0033862429739588, -2.3597699130885776,
+    -5.640387997685885, 2.534741178686501, -2.533183408609448,
+    3.990795788028894, 0.0, -3.3051768533783217, 1.6905705704687972,
+    -1.2490552915691868, 1.1460685342801609, -1.3155267144392522,
+    3.065539200881862, 4.063492063492063, -1.771907055269028,
+    1.6144191079350452, -1.9463494545710507, 3.4588513480770824, 0.0,
+    -3.4588513480770824, 1.9463494545710507, -1.6144191079350452,
+    1.771907055269028, -4.063492063492063, -3.065539200881862,
+    1.3155267144392522, -1.1460685342801609, 1.2490552915691868,
+    -1.6905705704687972, 3.3051768533783217, 0.0, -3.990795788028894,
+    2.533183408609448, -2.534741178686501, 5.640387997685885,
+    2.3597699130885776, -1.0033862429739588, 0.852916813558494,
+    -0.8845873145564326, 1.0799872504956867, -1.6081279037255152,
+    3.4506147161735594, 0.0, -5.2506617554544395, 4.079316193712744,
+    -8.495619494633516, -1.7979880357947782, 0.7604009822439128,
+    -0.6373620564181559, 0.6435862093598302, -0.7477348246882332,
+    1.0065054085767793, -1.6527366342270542, 3.961996577045789, 0.0,
+    -8.739670053520333, 14.887396295098673, 1.2695626762851475,
+    -0.5353310859294437, 0.445313527290914, -0.4433956364372609,
+    0.5026433130128494, -0.6469399638321011, 0.9684871388021601,
+    -1.8026467998794657, 5.118211824775777, 0.0, -37.202867381961894, -0.5,
+    0.21058734631306575, -0.17465786294761076, 0.17297010851182482,
+    -0.19428766879641807, 0.24609375, -0.35747637311649516, 0.6227252147386684,
+    -1.4461724827922597, 6.17098569731789, 27.5};
+inline constexpr std::array<double, 22> lift_matrix_10{
+    60.5, -2.2400192594741855, 1.7142073848643362, -1.4890640839639135,
+    1.384624051179487, -1.353515625, 1.384624051179487, -1.4890640839639135,
+    1.7142073848643362, -2.2400192594741855, 5.5, 5.5, -2.2400192594741855,
+    1.7142073848643362, -1.4890640839639135, 1.384624051179487, -1.353515625,
+    1.384624051179487, -1.4890640839639135, 1.7142073848643362,
+    -2.2400192594741855, 60.5};
+
+// Polynomial order 11
+inline constexpr std::array<double, 12> nodes_11{
+    -1.0, -0.9448992722228822, -0.8192793216440066, -0.6328761530318607,
+    -0.3995309409653489, -0.13655293285492756, 0.13655293285492756,
+    0.3995309409653489, 0.6328761530318607, 0.8192793216440066,
+    0.9448992722228822, 1.0};
+inline constexpr std::array<double, 12> weights_11{
+    0.015151515151515152, 0.09168451741319614, 0.15797470556437013,
+    0.21250841776102114, 0.2512756031992013, 0.2714052409106962,
+    0.2714052409106962, 0.2512756031992013, 0.21250841776102114,
+    0.15797470556437013, 0.09168451741319614, 0.015151515151515152};
+inline constexpr std::array<double, 144> diff_matrix_11{
+    -33.0, -7.377728946034429, 1.7136668943256343, -0.7273230777316992,
+    0.40894248916054193, -0.27364227895509946, 0.20788791826630498,
+    -0.17545686520952622, 0.16352596355196963, -0.17022951887282406,
+    0.20901762886886352, -0.5, 44.643952189487294, 0.0, -6.06450845944999,
+    2.105102072354816, -1.10759994141562, 0.7190207287273476,
+    -0.5374419426650596, 0.44929809359037837, -0.4163079892853457,
+    0.43182887243374046, -0.5291569320650935, 1.2648029086236907,
+    -17.867257522389043, 10.449299023483256, 0.0, -4.625433248921357,
+    1.8889896823631613, -1.1174754037877044, 0.7981839317491333,
+    -0.650552743618277, 0.5937349194619557, -0.6102924689917415,
+    0.7440518955831411, -1.7748692360717184, 10.201110245689414,
+    -4.879252498057882, 6.222157513608887, 0.0, -3.94106876470028,
+    1.7828481722138056, -1.1500331377515831, 0.8907625025193578,
+    -0.7900439882348177, 0.79869538514769, -0.964927935494239,
+    2.2935424893001817, -6.781979862081468, 3.0355489807328406,
+    -3.0046393831034046, 4.660024490009809, 0.0, -3.658866937080884,
+    1.794871261837639, -1.2514675303792422, 1.0532612660054195,
+    -1.0347734625083345, 1.2313709301034526, -2.909809956303667,
+    4.901684610448606, -2.128450905408188, 1.9198559674048454,
+    -2.2769655093429235, 3.951978026817746, 0.0, -3.661583750318969,
+    1.9386580353228582, -1.4687654451305368, 1.3713037255774418,
+    -1.590939932280527, 3.723843455606315, -3.723843455606315,
+    1.590939932280527, -1.3713037255774418, 1.4687654451305368,
+    -1.9386580353228582, 3.661583750318969, 0.0, -3.951978026817746,
+    2.2769655093429235, -1.9198559674048454, 2.128450905408188,
+    -4.901684610448606, 2.909809956303667, -1.2313709301034526,
+    1.0347734625083345, -1.0532612660054195, 1.2514675303792422,
+    -1.794871261837639, 3.658866937080884, 0.0, -4.660024490009809,
+    3.0046393831034046, -3.0355489807328406, 6.781979862081468,
+    -2.2935424893001817, 0.964927935494239, -0.79869538514769,
+    0.7900439882348177, -0.8907625025193578, 1.1500331377515831,
+    -1.7828481722138056, 3.94106876470028, 0.0, -6.222157513608887,
+    4.879252498057882, -10.201110245689414, 1.7748692360717184,
+    -0.7440518955831411, 0.6102924689917415, -0.5937349194619557,
+    0.650552743618277, -0.7981839317491333, 1.1174754037877044,
+    -1.8889896823631613, 4.625433248921357, 0.0, -10.449299023483256,
+    17.867257522389043, -1.2648029086236907, 0.5291569320650935,
+    -0.43182887243374046, 0.4163079892853457, -0.44929809359037837,
+    0.5374419426650596, -0.7190207287273476, 1.10759994141562,
+    -2.105102072354816, 6.06450845944999, 0.0, -44.643952189487294, 0.5,
+    -0.20901762886886352, 0.17022951887282406, -0.16352596355196963,
+    0.17545686520952622, -0.20788791826630498, 0.27364227895509946,
+    -0.40894248916054193, 0.7273230777316992, -1.7136668943256343,
+    7.377728946034429, 33.0};
+inline constexpr std::array<double, 24> lift_matrix_11{
+    72.0, -2.4391094056128306, 1.8581702617124218, -1.6021058777134107,
+    1.4733438699931116, -1.4176537392640463, 1.4176537392640463,
+    -1.4733438699931116, 1.6021058777134107, -1.8581702617124218,
+    2.4391094056128306, -6.0, -6.0, 2.4391094056128306, -1.8581702617124218,
+    1.6021058777134107, -1.4733438699931116, 1.4176537392640463,
+    -1.4176537392640463, 1.4733438699931116, -1.6021058777134107,
+    1.8581702617124218, -2.4391094056128306, 72.0};
+
+// Polynomial order 12
+inline constexpr std::array<double, 13> nodes_12{
+    -1.0, -0.9533098466421639, -0.8463475646518723, -0.6861884690817575,
+    -0.4829098210913362, -0.24928693010623998, 0.0, 0.24928693010623998,
+    0.4829098210913362, 0.6861884690817575, 0.8463475646518723,
+    0.9533098466421639, 1.0};
+inline constexpr std::array<double, 13> weights_12{
+    0.01282051282051282, 0.07780168674681892, 0.13498192668960834,
+    0.18364686520355009, 0.2207677935661101, 0.24401579030667636,
+    0.2519308493334467, 0.24401579030667636, 0.2207677935661101,
+    0.18364686520355009, 0.13498192668960834, 0.07780168674681892,
+    0.01282051282051282};
+inline constexpr std::array<double, 169> diff_matrix_12{
+    -39.0, -8.694265373076503, 2.005743710986542, -0.8419611281256956,
+    0.4660350178380064, -0.30533019593227545, 0.2255859375,
+    -0.18347696049304635, 0.1625062612197201, -0.15669488638755727,
+    0.16691733007234846, -0.2078198624250479, 0.5, 52.761423861885405, 0.0,
+    -7.097837219190502, 2.436655325410649, -1.2619998726206538,
+    0.8020450171514788, -0.5829344906221523, 0.4695323345991486,
+    -0.41333842284915123, 0.3970011563422653, -0.42185855007500644,
+    0.5244884459770831, -1.2611613952205254, -21.117653743253214,
+    12.314382672618843, 0.0, -5.35296549603412, 2.1514929403387986,
+    -1.2456912330433396, 0.864865129509092, -0.6788333167741208,
+    0.5882485573596906, -0.5594166098491019, 0.5907738391208873,
+    -0.7319028964617817, 1.7574041792619701, 12.06063470067523,
+    -5.751599107991038, 7.282866358471631, 0.0, -4.4867527492484705,
+    1.985634088368518, -1.2442500548652058, 0.927364407234521,
+    -0.7801405924556584, 0.7286627836650902, -0.7611026843454748,
+    0.937100735125418, -2.2445689249231036, -8.025070763785875,
+    3.5810139729466113, -3.518844047943388, 5.393669549602065, 0.0,
+    -4.071397442379138, 1.9384791997533273, -1.2990656395049702,
+    1.035390000704565, -0.9378320565227062, 0.962101662509045,
+    -1.1728770342146078, 2.7983396009521306, 5.811420347062709,
+    -2.515519353181015, 2.251918743226606, -2.638357430147707,
+    4.500136765905674, 0.0, -3.9479239708828473, 2.005720876689814,
+    -1.4358640069894442, 1.2322102992762634, -1.2271720543746827,
+    1.4726326445157, -3.4921594903866477, -4.432900432900433,
+    1.887609221199868, -1.6141880026437718, 1.706889865819062,
+    -2.2121103052236335, 4.075981467586103, 0.0, -4.075981467586103,
+    2.2121103052236335, -1.706889865819062, 1.6141880026437718,
+    -1.887609221199868, 4.432900432900433, 3.4921594903866477,
+    -1.4726326445157, 1.2271720543746827, -1.2322102992762634,
+    1.4358640069894442, -2.005720876689814, 3.9479239708828473, 0.0,
+    -4.500136765905674, 2.638357430147707, -2.251918743226606,
+    2.515519353181015, -5.811420347062709, -2.7983396009521306,
+    1.1728770342146078, -0.962101662509045, 0.9378320565227062,
+    -1.035390000704565, 1.2990656395049702, -1.9384791997533273,
+    4.071397442379138, 0.0, -5.393669549602065, 3.518844047943388,
+    -3.5810139729466113, 8.025070763785875, 2.2445689249231036,
+    -0.937100735125418, 0.7611026843454748, -0.7286627836650902,
+    0.7801405924556584, -0.927364407234521, 1.2442500548652058,
+    -1.985634088368518, 4.4867527492484705, 0.0, -7.282866358471631,
+    5.751599107991038, -12.06063470067523, -1.7574041792619701,
+    0.7319028964617817, -0.5907738391208873, 0.5594166098491019,
+    -0.5882485573596906, 0.6788333167741208, -0.864865129509092,
+    1.2456912330433396, -2.1514929403387986, 5.35296549603412, 0.0,
+    -12.314382672618843, 21.117653743253214, 1.2611613952205254,
+    -0.5244884459770831, 0.42185855007500644, -0.3970011563422653,
+    0.41333842284915123, -0.4695323345991486, 0.5829344906221523,
+    -0.8020450171514788, 1.2619998726206538, -2.436655325410649,
+    7.097837219190502, 0.0, -52.761423861885405, -0.5, 0.2078198624250479,
+    -0.16691733007234846, 0.15669488638755727, -0.1625062612197201,
+    0.18347696049304635, -0.2255859375, 0.30533019593227545,
+    -0.4660350178380064, 0.8419611281256956, -2.005743710986542,
+    8.694265373076503, 39.0};
+inline constexpr std::array<double, 26> lift_matrix_12{
+    84.5, -2.6385877934173285, 2.0032181382022767, -1.7174112188400383,
+    1.5663838498851208, -1.4898998966772812, 1.46630859375,
+    -1.4898998966772812, 1.5663838498851208, -1.7174112188400383,
+    2.0032181382022767, -2.6385877934173285, 6.5, 6.5, -2.6385877934173285,
+    2.0032181382022767, -1.7174112188400383, 1.5663838498851208,
+    -1.4898998966772812, 1.46630859375, -1.4898998966772812,
+    1.5663838498851208, -1.7174112188400383, 2.0032181382022767,
+    -2.6385877934173285, 84.5};
+
+// Polynomial order 13
+inline constexpr std::array<double, 14> nodes_13{
+    -1.0, -0.9599350452672609, -0.8678010538303472, -0.7288685990913262,
+    -0.5506394029286471, -0.34272401334271285, -0.11633186888370387,
+    0.11633186888370387, 0.34272401334271285, 0.5506394029286471,
+    0.7288685990913262, 0.8678010538303472, 0.9599350452672609, 1.0};
+inline constexpr std::array<double, 14> weights_13{
+    0.01098901098901099, 0.06683728449768128, 0.11658665589871166,
+    0.16002185176295214, 0.1948261493734161, 0.21912625300977076,
+    0.23161279446845706, 0.23161279446845706, 0.21912625300977076,
+    0.1948261493734161, 0.16002185176295214, 0.11658665589871166,
+    0.06683728449768128, 0.01098901098901099};
+inline constexpr std::array<double, 196> diff_matrix_13{
+    -45.5, -10.120576431103325, 2.322345804190777, -0.9665177627583873,
+    0.5285191068537477, -0.3407095695461013, 0.24649541067036743,
+    -0.1951213119926789, 0.16678052694499293, -0.15315982617936005,
+    0.15157503303462802, -0.16437064714464036, 0.20688462995776924, -0.5,
+    61.55529800476246, 0.0, -8.217980181428421, 2.796938181681225,
+    -1.4310297221351362, 0.8948052266632294, -0.6367807393627887,
+    0.4991236349675322, -0.4239663891099912, 0.387742709421884,
+    -0.38268425578884885, 0.4142585551810657, -0.5208685759157716,
+    1.2583122252323296, -24.638662334741625, 14.334915530984295, 0.0,
+    -6.1437150940128396, 2.439046776708828, -1.3891661355079663,
+    0.9441303812358735, -0.7209238423952542, 0.6025643441499152,
+    -0.545368047450496, 0.5345886155389039, -0.5761689246551073,
+    0.7226059524855154, -1.7438715911435672, 14.074420556412836,
+    -6.696430449903467, 8.432600270326462, 0.0, -5.084955703065576,
+    2.213056439048118, -1.356988717324892, 0.9834417553391386,
+    -0.7974670149633367, 0.7083094174084432, -0.685994705524899,
+    0.7337534431406024, -0.9162227896015627, 2.2072338895180956,
+    -9.370210163731938, 4.171354544066949, -4.075853175346754,
+    6.190919105411943, 0.0, -4.535130420264646, 2.111762079299294,
+    -1.3751029765613878, 1.0554757347103316, -0.9080352719777866,
+    0.8623647010599303, -0.9113560712161466, 1.1302436894620063,
+    -2.7153980647636073, 6.793915431868027, -2.9336218244933976,
+    2.6109572123449842, -3.030453402739788, 5.100784156024681, 0.0,
+    -4.296398732004207, 2.1188507980160383, -1.458899815986971,
+    1.1871221785866088, -1.0920131029770992, 1.1325281260796503,
+    -1.389975175472274, 3.325685266945078, -5.1953256709002495,
+    2.2066510872778244, -1.875623537316219, 1.9640814389985106,
+    -2.510500351272496, 4.541221797033415, 0.0, -4.298048374859742,
+    2.239589951681109, -1.6347468966952448, 1.4234161812380492,
+    -1.432198088614595, 1.729624725913195, -4.1125259021188185,
+    4.1125259021188185, -1.729624725913195, 1.432198088614595,
+    -1.4234161812380492, 1.6347468966952448, -2.239589951681109,
+    4.298048374859742, 0.0, -4.541221797033415, 2.510500351272496,
+    -1.9640814389985106, 1.875623537316219, -2.2066510872778244,
+    5.1953256709002495, -3.325685266945078, 1.389975175472274,
+    -1.1325281260796503, 1.0920131029770992, -1.1871221785866088,
+    1.458899815986971, -2.1188507980160383, 4.296398732004207, 0.0,
+    -5.100784156024681, 3.030453402739788, -2.6109572123449842,
+    2.9336218244933976, -6.793915431868027, 2.7153980647636073,
+    -1.1302436894620063, 0.9113560712161466, -0.8623647010599303,
+    0.9080352719777866, -1.0554757347103316, 1.3751029765613878,
+    -2.111762079299294, 4.535130420264646, 0.0, -6.190919105411943,
+    4.075853175346754, -4.171354544066949, 9.370210163731938,
+    -2.2072338895180956, 0.9162227896015627, -0.7337534431406024,
+    0.685994705524899, -0.7083094174084432, 0.7974670149633367,
+    -0.9834417553391386, 1.356988717324892, -2.213056439048118,
+    5.084955703065576, 0.0, -8.432600270326462, 6.696430449903467,
+    -14.074420556412836, 1.7438715911435672, -0.7226059524855154,
+    0.5761689246551073, -0.5345886155389039, 0.545368047450496,
+    -0.6025643441499152, 0.7209238423952542, -0.9441303812358735,
+    1.3891661355079663, -2.439046776708828, 6.1437150940128396, 0.0,
+    -14.334915530984295, 24.638662334741625, -1.2583122252323296,
+    0.5208685759157716, -0.4142585551810657, 0.38268425578884885,
+    -0.387742709421884, 0.4239663891099912, -0.4991236349675322,
+    0.6367807393627887, -0.8948052266632294, 1.4310297221351362,
+    -2.796938181681225, 8.217980181428421, 0.0, -61.55529800476246, 0.5,
+    -0.20688462995776924, 0.16437064714464036, -0.15157503303462802,
+    0.15315982617936005, -0.16678052694499293, 0.1951213119926789,
+    -0.24649541067036743, 0.3407095695461013, -0.5285191068537477,
+    0.9665177627583873, -2.322345804190777, 10.120576431103325, 45.5};
+inline constexpr std::array<double, 28> lift_matrix_13{
+    98.0, -2.838363056069667, 2.149081675688748, -1.834373205138592,
+    1.6624696299359278, -1.5675815294089535, 1.5247409721307925,
+    -1.5247409721307925, 1.5675815294089535, -1.6624696299359278,
+    1.834373205138592, -2.149081675688748, 2.838363056069667, -7.0, -7.0,
+    2.838363056069667, -2.149081675688748, 1.834373205138592,
+    -1.6624696299359278, 1.5675815294089535, -1.5247409721307925,
+    1.5247409721307925, -1.5675815294089535, 1.6624696299359278,
+    -1.834373205138592, 2.149081675688748, -2.838363056069667, 98.0};
+
+// Polynomial order 14
+inline constexpr std::array<double, 15> nodes_14{
+    -1.0, -0.9652459265038386, -0.8850820442229763, -0.7635196899518152,
+    -0.6062532054698457, -0.4206380547136725, -0.21535395536379423, 0.0,
+    0.21535395536379423, 0.4206380547136725, 0.6062532054698457,
+    0.7635196899518152, 0.8850820442229763, 0.9652459265038386, 1.0};
+inline constexpr std::array<double, 15> weights_14{
+    0.009523809523809525, 0.05802989302860125, 0.10166007032571807,
+    0.1405116998024281, 0.17278964725360094, 0.19698723596461334,
+    0.21197358592682092, 0.21704811634881566, 0.21197358592682092,
+    0.19698723596461334, 0.17278964725360094, 0.1405116998024281,
+    0.10166007032571807, 0.05802989302860125, 0.009523809523809525};
+inline constexpr std::array<double, 225> diff_matrix_14{
+    -52.5, -11.65664982892109, 2.6634359393255536, -1.1009158403953356,
+    0.5962514664899822, -0.3795214630744706, 0.2701411144884136,
+    -0.20947265625, 0.1744061111098307, -0.15477573080291374,
+    0.14616132927539335, -0.14762801955489385, 0.16236779424447448,
+    -0.2061401371756258, 0.5, 71.02558497763616, 0.0, -9.424795605545603,
+    3.1857174536369914, -1.61428935562363, 0.9966046918452143,
+    -0.6977282508920303, 0.5356855072902407, -0.4431821664710134,
+    0.39163361983959016, -0.36876770500261546, 0.3717350614352471,
+    -0.4083212367737012, 0.5180027040476836, -1.256040461466289,
+    -28.430333914487477, 16.51089350781764, 0.0, -6.9971286140124285,
+    2.7509243901299065, -1.5467595736419644, 1.0340363728229125,
+    -0.7732388425498723, 0.6293171107103205, -0.5501816107288385,
+    0.5143290573702838, -0.5159447608389295, 0.5649193803710658,
+    -0.71532038884579, 1.7331637450601247, 16.24261338770356,
+    -7.713792859831268, 9.671235049720094, 0.0, -5.734046440986176,
+    2.463161998496497, -1.4852634222260352, 1.053799509049798,
+    -0.831742195529993, 0.7132267788693251, -0.6583378373483215,
+    0.6548619591350086, -0.7131243871596561, 0.9001072142711416,
+    -2.1780637164430443, -10.81773845977086, 4.806703472397787,
+    -4.6756927618573965, 7.051255256799947, 0.0, -5.04575772034566,
+    2.3096870978321955, -1.4717254517469391, 1.0988888577920255,
+    -0.9120430918593154, 0.824737907344342, -0.8095693301629909,
+    0.8741951103372964, -1.098041687488835, 2.651792275399327,
+    7.849892820030034, -3.383056444705048, 2.9971639025755534,
+    -3.453174892191528, 5.752369325803379, 0.0, -4.695943448354038,
+    2.264813641904642, -1.5157462768689502, 1.1886703887035353,
+    -1.0397662742045002, 0.9998923362464726, -1.066089708858041,
+    1.3294324744833426, -3.2013285575532495, -6.012591978159575,
+    2.5486857139498196, -2.1560913466197493, 2.2406434061923863,
+    -2.8334605937231543, 5.0532003618548265, 0.0, -4.588914964624969,
+    2.321759074057207, -1.6310608760501473, 1.3480866210654852,
+    -1.2547522804225089, 1.312202561093699, -1.618871035991334,
+    3.88179632184775, 4.773892773892774, -2.0036144174072597,
+    1.6508943356566852, -1.6278018041926277, 1.84869430640976,
+    -2.4954588171632075, 4.698771051128009, 0.0, -4.698771051128009,
+    2.4954588171632075, -1.84869430640976, 1.6278018041926277,
+    -1.6508943356566852, 2.0036144174072597, -4.773892773892774,
+    -3.88179632184775, 1.618871035991334, -1.312202561093699,
+    1.2547522804225089, -1.3480866210654852, 1.6310608760501473,
+    -2.321759074057207, 4.588914964624969, 0.0, -5.0532003618548265,
+    2.8334605937231543, -2.2406434061923863, 2.1560913466197493,
+    -2.5486857139498196, 6.012591978159575, 3.2013285575532495,
+    -1.3294324744833426, 1.066089708858041, -0.9998923362464726,
+    1.0397662742045002, -1.1886703887035353, 1.5157462768689502,
+    -2.264813641904642, 4.695943448354038, 0.0, -5.752369325803379,
+    3.453174892191528, -2.9971639025755534, 3.383056444705048,
+    -7.849892820030034, -2.651792275399327, 1.098041687488835,
+    -0.8741951103372964, 0.8095693301629909, -0.824737907344342,
+    0.9120430918593154, -1.0988888577920255, 1.4717254517469391,
+    -2.3096870978321955, 5.04575772034566, 0.0, -7.051255256799947,
+    4.6756927618573965, -4.806703472397787, 10.81773845977086,
+    2.1780637164430443, -0.9001072142711416, 0.7131243871596561,
+    -0.6548619591350086, 0.6583378373483215, -0.7132267788693251,
+    0.831742195529993, -1.053799509049798, 1.4852634222260352,
+    -2.463161998496497, 5.734046440986176, 0.0, -9.671235049720094,
+    7.713792859831268, -16.24261338770356, -1.7331637450601247,
+    0.71532038884579, -0.5649193803710658, 0.5159447608389295,
+    -0.5143290573702838, 0.5501816107288385, -0.6293171107103205,
+    0.7732388425498723, -1.0340363728229125, 1.5467595736419644,
+    -2.7509243901299065, 6.9971286140124285, 0.0, -16.51089350781764,
+    28.430333914487477, 1.256040461466289, -0.5180027040476836,
+    0.4083212367737012, -0.3717350614352471, 0.36876770500261546,
+    -0.39163361983959016, 0.4431821664710134, -0.5356855072902407,
+    0.6977282508920303, -0.9966046918452143, 1.61428935562363,
+    -3.1857174536369914, 9.424795605545603, 0.0, -71.02558497763616, -0.5,
+    0.2061401371756258, -0.16236779424447448, 0.14762801955489385,
+    -0.14616132927539335, 0.15477573080291374, -0.1744061111098307,
+    0.20947265625, -0.2701411144884136, 0.3795214630744706,
+    -0.5962514664899822, 1.1009158403953356, -2.6634359393255536,
+    11.65664982892109, 52.5};
+inline constexpr std::array<double, 30> lift_matrix_14{
+    112.5, -3.0383704865500585, 2.2955746011776217, -1.9525868945523517,
+    1.7607907774825065, -1.649102198435538, 1.589738677327126, -1.571044921875,
+    1.589738677327126, -1.649102198435538, 1.7607907774825065,
+    -1.9525868945523517, 2.2955746011776217, -3.0383704865500585, 7.5, 7.5,
+    -3.0383704865500585, 2.2955746011776217, -1.9525868945523517,
+    1.7607907774825065, -1.649102198435538, 1.589738677327126, -1.571044921875,
+    1.589738677327126, -1.649102198435538, 1.7607907774825065,
+    -1.9525868945523517, 2.2955746011776217, -3.0383704865500585, 112.5};
+
+// Polynomial order 15
+inline constexpr std::array<double, 16> nodes_15{
+    -1.0, -0.969568046270218, -0.8992005330934721, -0.7920082918618151,
+    -0.6523887028824931, -0.48605942188713763, -0.2998304689007632,
+    -0.10132627352194945, 0.10132627352194945, 0.2998304689007632,
+    0.48605942188713763, 0.6523887028824931, 0.7920082918618151,
+    0.8992005330934721, 0.969568046270218, 1.0};
+inline constexpr std::array<double, 16> weights_15{
+    0.008333333333333333, 0.05085036100591991, 0.0893936973259308,
+    0.1242553821325141, 0.1540269808071643, 0.17749191339170411,
+    0.1936900238252036, 0.20195830817822988, 0.20195830817822988,
+    0.1936900238252036, 0.17749191339170411, 0.1540269808071643,
+    0.1242553821325141, 0.0893936973259308, 0.05085036100591991,
+    0.008333333333333333};
+inline constexpr std::array<double, 256> diff_matrix_15{
+    -60.0, -13.302477156027459, 3.0289889685455527, -1.2451043509090522,
+    0.6691401562492896, -0.42160638816902046, 0.29624603255148335,
+    -0.22603540502092948, 0.18444314335345394, -0.15957653760570312,
+    0.14580886045357516, -0.14076632045563425, 0.14451461074814576,
+    -0.1607626303673319, 0.2055376406366468, -0.5, 81.17229187883989, 0.0,
+    -10.718187917826407, 3.6028392047494897, -1.8115224611251695,
+    1.1070150102570635, -0.7650480756894141, 0.5779303227523526,
+    -0.4685646741023564, 0.40364112503658983, -0.36771173702731536,
+    0.35424958467724144, -0.3631515878821579, 0.4035878159912634,
+    -0.515693562636913, 1.2541995872014229, -32.492702766929334,
+    18.84231355795247, 0.0, -7.9128419979584175, 3.0866620062368706,
+    -1.7177729167547826, 1.1334562867331242, -0.8338503851077796,
+    0.6649574546252283, -0.566590660465782, 0.5123100607049246,
+    -0.49099638057415307, 0.5015319549882141, -0.5560494924084135,
+    0.7094975601639544, -1.7245399104453312, 18.565310030047225,
+    -8.803716498611168, 10.998685988182354, 0.0, -6.432989583764448,
+    2.7347615524262916, -1.6273536316343447, 1.1356606899078914,
+    -0.8780365697792823, 0.7335766015910112, -0.6546579634350803,
+    0.6218313696730233, -0.6313065218353004, 0.6971189981270699,
+    -0.8873789375669056, 2.154806181869086, -12.367876560469469,
+    5.487145613754642, -5.318375274930484, 7.97433435997535, 0.0,
+    -5.600675434354833, 2.5293790256753703, -1.5847718082544633,
+    1.1586716862186774, -0.9365001554132936, 0.8182685691305377,
+    -0.766414252409363, 0.7708222114658553, -0.8459957731846142,
+    1.0730306117920214, -2.6018173606938135, 8.979806944114197,
+    -3.8640082083387495, 3.4106521028615506, -3.9064550145002914,
+    6.45389914104786, 0.0, -5.140299899842897, 2.436681787057332,
+    -1.5960079770852675, 1.2180747959793525, -1.0286808103806275,
+    0.9429260590720848, -0.9351425471718328, 1.0171957939361398,
+    -1.2834886221155286, 3.1055872357642844, -6.885588132362262,
+    2.9140831466360226, -2.455868609860966, 2.5367284561334777,
+    -3.180712114063884, 5.609409415019565, 0.0, -4.933476619277677,
+    2.4412298315503986, -1.6676090386447289, 1.3292376635404954,
+    -1.1776556059447907, 1.1435035408626768, -1.2276364196530614,
+    1.5374769731933142, -3.7090060044950555, 5.477967358368946,
+    -2.295319598898726, 1.8838354166752118, -1.845844483047975,
+    2.077933564407948, -2.7725664898139826, 5.144078005614471, 0.0,
+    -4.934554312724125, 2.545441612930347, -1.8160098943762082,
+    1.5192362549500593, -1.4271154867330191, 1.5022723812057612,
+    -1.8609608069995576, 4.469979022408594, -4.469979022408594,
+    1.8609608069995576, -1.5022723812057612, 1.4271154867330191,
+    -1.5192362549500593, 1.8160098943762082, -2.545441612930347,
+    4.934554312724125, 0.0, -5.144078005614471, 2.7725664898139826,
+    -2.077933564407948, 1.845844483047975, -1.8838354166752118,
+    2.295319598898726, -5.477967358368946, 3.7090060044950555,
+    -1.5374769731933142, 1.2276364196530614, -1.1435035408626768,
+    1.1776556059447907, -1.3292376635404954, 1.6676090386447289,
+    -2.4412298315503986, 4.933476619277677, 0.0, -5.609409415019565,
+    3.180712114063884, -2.5367284561334777, 2.455868609860966,
+    -2.9140831466360226, 6.885588132362262, -3.1055872357642844,
+    1.2834886221155286, -1.0171957939361398, 0.9351425471718328,
+    -0.9429260590720848, 1.0286808103806275, -1.2180747959793525,
+    1.5960079770852675, -2.436681787057332, 5.140299899842897, 0.0,
+    -6.45389914104786, 3.9064550145002914, -3.4106521028615506,
+    3.8640082083387495, -8.979806944114197, 2.6018173606938135,
+    -1.0730306117920214, 0.8459957731846142, -0.7708222114658553,
+    0.766414252409363, -0.8182685691305377, 0.9365001554132936,
+    -1.1586716862186774, 1.5847718082544633, -2.5293790256753703,
+    5.600675434354833, 0.0, -7.97433435997535, 5.318375274930484,
+    -5.487145613754642, 12.367876560469469, -2.154806181869086,
+    0.8873789375669056, -0.6971189981270699, 0.6313065218353004,
+    -0.6218313696730233, 0.6546579634350803, -0.7335766015910112,
+    0.8780365697792823, -1.1356606899078914, 1.6273536316343447,
+    -2.7347615524262916, 6.432989583764448, 0.0, -10.998685988182354,
+    8.803716498611168, -18.565310030047225, 1.7245399104453312,
+    -0.7094975601639544, 0.5560494924084135, -0.5015319549882141,
+    0.49099638057415307, -0.5123100607049246, 0.566590660465782,
+    -0.6649574546252283, 0.8338503851077796, -1.1334562867331242,
+    1.7177729167547826, -3.0866620062368706, 7.9128419979584175, 0.0,
+    -18.84231355795247, 32.492702766929334, -1.2541995872014229,
+    0.515693562636913, -0.4035878159912634, 0.3631515878821579,
+    -0.35424958467724144, 0.36771173702731536, -0.40364112503658983,
+    0.4685646741023564, -0.5779303227523526, 0.7650480756894141,
+    -1.1070150102570635, 1.8115224611251695, -3.6028392047494897,
+    10.718187917826407, 0.0, -81.17229187883989, 0.5, -0.2055376406366468,
+    0.1607626303673319, -0.14451461074814576, 0.14076632045563425,
+    -0.14580886045357516, 0.15957653760570312, -0.18444314335345394,
+    0.22603540502092948, -0.29624603255148335, 0.42160638816902046,
+    -0.6691401562492896, 1.2451043509090522, -3.0289889685455527,
+    13.302477156027459, 60.0};
+inline constexpr std::array<double, 32> lift_matrix_15{
+    128.0, -3.238562954429685, 2.4425637863611644, -2.0717710460468783,
+    1.8608054213378145, -1.7334450469732978, 1.6593795656126507,
+    -1.6250566379690732, 1.6250566379690732, -1.6593795656126507,
+    1.7334450469732978, -1.8608054213378145, 2.0717710460468783,
+    -2.4425637863611644, 3.238562954429685, -8.0, -8.0, 3.238562954429685,
+    -2.4425637863611644, 2.0717710460468783, -1.8608054213378145,
+    1.7334450469732978, -1.6593795656126507, 1.6250566379690732,
+    -1.6250566379690732, 1.6593795656126507, -1.7334450469732978,
+    1.8608054213378145, -2.0717710460468783, 2.4425637863611644,
+    -3.238562954429685, 128.0};
+
+// Polynomial order 16
+inline constexpr std::array<double, 17> nodes_16{
+    -1.0, -0.9731321766314183, -0.9108799959155736, -0.8156962512217703,
+    -0.6910289806276847, -0.5413853993301015, -0.372174433565477,
+    -0.1895119735183174, 0.0, 0.1895119735183174, 0.372174433565477,
+    0.5413853993301015, 0.6910289806276847, 0.8156962512217703,
+    0.9108799959155736, 0.9731321766314183, 1.0};
+inline constexpr std::array<double, 17> weights_16{
+    0.007352941176470588, 0.04492194054325421, 0.07919827050368712,
+    0.11059290900702816, 0.13798774620192655, 0.16039466199762153,
+    0.17700425351565788, 0.18721633967761925, 0.19066187475346943,
+    0.18721633967761925, 0.17700425351565788, 0.16039466199762153,
+    0.13798774620192655, 0.11059290900702816, 0.07919827050368712,
+    0.04492194054325421, 0.007352941176470588};
+inline constexpr std::array<double, 289> diff_matrix_16{
+    -68.0, -15.058052497973241, 3.4189873913829434, -1.399048389779153,
+    0.7471237452751895, -0.46686112632396637, 0.3246382564785791,
+    -0.24451869400844664, 0.196380615234375, -0.1666056989393832,
+    0.14853519514307015, -0.1389070696468375, 0.13650835545660084,
+    -0.1420115632143528, 0.15945541893574386, -0.20504307799646734, 0.5,
+    91.99542370551701, 0.0, -12.098090695331663, 4.048198244223097,
+    -2.022558013070864, 1.2257592929160464, -0.838288421507468,
+    0.6251032473398003, -0.4987989057515318, 0.4213185380789013,
+    -0.3744692206289741, 0.3494298335413243, -0.34285746732004546,
+    0.3562844971028614, -0.39974928997635295, 0.5138048170709898,
+    -1.2526868823645874, -36.825792804916105, 21.329173403460626, 0.0,
+    -8.890607167020654, 3.4459511192916463, -1.9017560292469962,
+    1.2416938715208579, -0.9016315234013399, 0.7075624137968654,
+    -0.5910695161667344, 0.5213398433882975, -0.4838568619282817,
+    0.47293314620379573, -0.49012679524675273, 0.5489197284406533,
+    -0.7047659121208258, 1.7174887026926442, 21.04257705234942,
+    -9.96622173155443, 12.41489369889425, 0.0, -7.181099246268246,
+    3.0270925321392093, -1.7822014842955936, 1.2274098573723733,
+    -0.9336911556183042, 0.7646025331553045, -0.665430380484638,
+    0.6118749972843113, -0.5941680831870191, 0.6129732719147446,
+    -0.6844158050914373, 0.8771335007393953, -2.1359441768374614,
+    -14.020773357247332, 6.212737437679661, -6.003906719792869,
+    8.959920750271042, 0.0, -6.198223210574869, 2.7690818594380167,
+    -1.711838227622355, 1.2310964237727333, -0.9749870014906963,
+    0.8304472411230179, -0.7526075109120341, 0.7235586553053582,
+    -0.7413487483079522, 0.8239950005702438, -1.0531630782610566,
+    2.5617613217775426, 10.183956427692362, -4.3765973842649695,
+    3.8514921294753512, -4.390240639181825, 7.204711608168062, 0.0,
+    -5.625674491399288, 2.6304897331423684, -1.6941680481957597,
+    1.2663876877219142, -1.0419961336849768, 0.9235564915837943,
+    -0.8748184578140575, 0.8874120796295885, -0.9799211186133602,
+    1.2476460136173306, -3.0300735379715023, -7.814879906083719,
+    3.30307672565651, -2.775124954443095, 2.8524183528095075,
+    -3.5520492286055814, 6.208238487930323, 0.0, -5.323174144903457,
+    2.5888887352997334, -1.7311155696570795, 1.343456064969155,
+    -1.1498995385011375, 1.0652590396252521, -1.0650231449905923,
+    1.1651690020506125, -1.4755071588726192, 3.5756251418458316,
+    6.225793703001793, -2.6051755661549407, 2.131361612767743,
+    -2.0778111620780426, 2.3225546899410543, -3.0703681361027737,
+    5.630289437011792, 0.0, -5.228815178420852, 2.6383557234797737,
+    -1.8309905783222644, 1.4781568448432307, -1.3228239657254228,
+    1.294351408700848, -1.3972258561707567, 1.7558839529986057,
+    -4.242018040981331, -5.092152292152292, 2.117048670326138,
+    -1.703385382807316, 1.6096810163444217, -1.701043452186799,
+    2.013865375527395, -2.788646995744209, 5.325046448263057, 0.0,
+    -5.325046448263057, 2.788646995744209, -2.013865375527395,
+    1.701043452186799, -1.6096810163444217, 1.703385382807316,
+    -2.117048670326138, 5.092152292152292, 4.242018040981331,
+    -1.7558839529986057, 1.3972258561707567, -1.294351408700848,
+    1.3228239657254228, -1.4781568448432307, 1.8309905783222644,
+    -2.6383557234797737, 5.228815178420852, 0.0, -5.630289437011792,
+    3.0703681361027737, -2.3225546899410543, 2.0778111620780426,
+    -2.131361612767743, 2.6051755661549407, -6.225793703001793,
+    -3.5756251418458316, 1.4755071588726192, -1.1651690020506125,
+    1.0650231449905923, -1.0652590396252521, 1.1498995385011375,
+    -1.343456064969155, 1.7311155696570795, -2.5888887352997334,
+    5.323174144903457, 0.0, -6.208238487930323, 3.5520492286055814,
+    -2.8524183528095075, 2.775124954443095, -3.30307672565651,
+    7.814879906083719, 3.0300735379715023, -1.2476460136173306,
+    0.9799211186133602, -0.8874120796295885, 0.8748184578140575,
+    -0.9235564915837943, 1.0419961336849768, -1.2663876877219142,
+    1.6941680481957597, -2.6304897331423684, 5.625674491399288, 0.0,
+    -7.204711608168062, 4.390240639181825, -3.8514921294753512,
+    4.3765973842649695, -10.183956427692362, -2.5617613217775426,
+    1.0531630782610566, -0.8239950005702438, 0.7413487483079522,
+    -0.7235586553053582, 0.7526075109120341, -0.8304472411230179,
+    0.9749870014906963, -1.2310964237727333, 1.711838227622355,
+    -2.7690818594380167, 6.198223210574869, 0.0, -8.959920750271042,
+    6.003906719792869, -6.212737437679661, 14.020773357247332,
+    2.1359441768374614, -0.8771335007393953, 0.6844158050914373,
+    -0.6129732719147446, 0.5941680831870191, -0.6118749972843113,
+    0.665430380484638, -0.7646025331553045, 0.9336911556183042,
+    -1.2274098573723733, 1.7822014842955936, -3.0270925321392093,
+    7.181099246268246, 0.0, -12.41489369889425, 9.96622173155443,
+    -21.04257705234942, -1.7174887026926442, 0.7047659121208258,
+    -0.5489197284406533, 0.49012679524675273, -0.47293314620379573,
+    0.4838568619282817, -0.5213398433882975, 0.5910695161667344,
+    -0.7075624137968654, 0.9016315234013399, -1.2416938715208579,
+    1.9017560292469962, -3.4459511192916463, 8.890607167020654, 0.0,
+    -21.329173403460626, 36.825792804916105, 1.2526868823645874,
+    -0.5138048170709898, 0.39974928997635295, -0.3562844971028614,
+    0.34285746732004546, -0.3494298335413243, 0.3744692206289741,
+    -0.4213185380789013, 0.4987989057515318, -0.6251032473398003,
+    0.838288421507468, -1.2257592929160464, 2.022558013070864,
+    -4.048198244223097, 12.098090695331663, 0.0, -91.99542370551701, -0.5,
+    0.20504307799646734, -0.15945541893574386, 0.1420115632143528,
+    -0.13650835545660084, 0.1389070696468375, -0.14853519514307015,
+    0.1666056989393832, -0.196380615234375, 0.24451869400844664,
+    -0.3246382564785791, 0.46686112632396637, -0.7471237452751895,
+    1.399048389779153, -3.4189873913829434, 15.058052497973241, 68.0};
+inline constexpr std::array<double, 34> lift_matrix_16{
+    144.5, -3.43890530571819, 2.5899514474195278, -2.1917238351467723,
+    1.9621364739869673, -1.8199292966476013, 1.7324376767098288,
+    -1.684525526830667, 1.6692352294921875, -1.684525526830667,
+    1.7324376767098288, -1.8199292966476013, 1.9621364739869673,
+    -2.1917238351467723, 2.5899514474195278, -3.43890530571819, 8.5, 8.5,
+    -3.43890530571819, 2.5899514474195278, -2.1917238351467723,
+    1.9621364739869673, -1.8199292966476013, 1.7324376767098288,
+    -1.684525526830667, 1.6692352294921875, -1.684525526830667,
+    1.7324376767098288, -1.8199292966476013, 1.9621364739869673,
+    -2.1917238351467723, 2.5899514474195278, -3.43890530571819, 144.5};
+
+// Polynomial order 17
+inline constexpr std::array<double, 18> nodes_17{
+    -1.0, -0.9761055574121985, -0.9206491853475339, -0.8355935352180902,
+    -0.7236793292832426, -0.5885048343186617, -0.43441503691212396,
+    -0.266362652878281, -0.08974909348465211, 0.08974909348465211,
+    0.266362652878281, 0.43441503691212396, 0.5885048343186617,
+    0.7236793292832426, 0.8355935352180902, 0.9206491853475339,
+    0.9761055574121985, 1.0};
+inline constexpr std::array<double, 18> weights_17{
+    0.006535947712418301, 0.039970628810914066, 0.07063716688563366,
+    0.0990162717175028, 0.1242105331329671, 0.14541196157380226,
+    0.1619395172376025, 0.17326210948945622, 0.17901586343970308,
+    0.17901586343970308, 0.17326210948945622, 0.1619395172376025,
+    0.14541196157380226, 0.1242105331329671, 0.0990162717175028,
+    0.07063716688563366, 0.039970628810914066, 0.006535947712418301};
+inline constexpr std::array<double, 324> diff_matrix_17{
+    -76.5, -16.923371596330014, 3.8334187142190923, -1.5627233770638296,
+    0.8301597965104984, -0.5152161650495555, 0.35520576835841733,
+    -0.2647409079568035, 0.2099169007241458, -0.17534040663070952,
+    0.15337140348112646, -0.1400564245464639, 0.13346447339564127,
+    -0.13308177912028163, 0.13996662165438836, -0.15837608460612923,
+    0.2046320498840581, -0.5, 103.4949840588292, 0.0, -13.5644565691972,
+    4.521720578088172, -2.247277995913921, 1.3526512717955663,
+    -0.9171552039237935, 0.676733431875012, -0.5331093693407202,
+    0.4433296182531874, -0.3865746805883146, 0.3522205076564792,
+    -0.3350921186592376, 0.33373158715899975, -0.3506962634183633,
+    0.3965908366528717, -0.5122396816647317, 1.251428571436017,
+    -41.4296211311972, 23.971471325206828, 0.0, -9.930250011839858,
+    3.828579377007981, -2.098406868283028, 1.3582970570342032,
+    -0.9758809857385137, 0.7560004784516758, -0.6216962955636719,
+    0.537910209232522, -0.4873941780766709, 0.46183091876504123,
+    -0.45861561245826066, 0.4809266172690134, -0.5430950333283097,
+    0.7008659595145693, -1.7116474016095073, 23.674461505964796,
+    -11.201322738969528, 13.919815541116323, 0.0, -7.9779048870260025,
+    3.3396452152906573, -1.9491228657110238, 1.3280457375893355,
+    -0.997147187159026, 0.8037203345698276, -0.6860206015100553,
+    0.615701501107346, -0.5794463467994756, 0.5726008005281307,
+    -0.5983770564590353, 0.6741431276368627, -0.868753821042314,
+    2.1204228752901098, -15.776532409249047, 6.983517804809601,
+    -6.732289905256133, 10.007848226489404, 0.0, -6.837296141668682,
+    3.0276660179918498, -1.8514431256534432, 1.3139897815048813,
+    -1.024033373694899, 0.8552120334615362, -0.7562386052422531,
+    0.7043432457958986, -0.690913751115729, 0.7182965938051034,
+    -0.8064435797485024, 1.0370859703115756, -2.529114286426535,
+    11.462544758741323, -4.920905189847415, 4.319729575097569,
+    -4.9044904770953455, 8.00435050670556, 0.0, -6.1496409812894814,
+    2.843810624469815, -1.8070343165962695, 1.3288072539519575,
+    -1.071641361837154, 0.9263647716508643, -0.8496106927972347,
+    0.8245672118869344, -0.8509553879717666, 0.9507139481087292,
+    -1.2190551845623254, 2.9693216241618354, -8.800843149139984,
+    3.7158202253455483, -3.1139693079354154, 3.187759046417628,
+    -3.9473204159379196, 6.848610533247993, 0.0, -5.752808844258603,
+    2.7595120104346798, -1.8145267013138568, 1.3795719459302231,
+    -1.150973049998596, 1.0316555961658238, -0.9859462926406563,
+    1.0069698860835414, -1.1173774569688575, 1.4270082975401943,
+    -3.470142475893096, 7.01804393165471, -2.933460529815028,
+    2.3936860105595956, -2.3238605332433964, 2.5825904893836045,
+    -3.3884738397816805, 6.155037466138633, 0.0, -5.57034375288747,
+    2.7626110267109185, -1.877140036702081, 1.4760297524762664,
+    -1.276888372582896, 1.1929410271485694, -1.2004226629535584,
+    1.3194110363802916, -1.6756990476881226, 4.06573829408227,
+    -5.749503650759067, 2.3876290391074826, -1.9159329907720342,
+    1.8027861642278986, -1.8937606123567254, 2.2246299750689507,
+    -3.050499554691082, 5.755325844279816, 0.0, -5.571086911150856,
+    2.854352863138812, -2.0058665711192494, 1.6358872773366604,
+    -1.475866933014632, 1.4530812679713505, -1.5755657262951563,
+    1.98553379721457, -4.802473286196361, 4.802473286196361, -1.98553379721457,
+    1.5755657262951563, -1.4530812679713505, 1.475866933014632,
+    -1.6358872773366604, 2.0058665711192494, -2.854352863138812,
+    5.571086911150856, 0.0, -5.755325844279816, 3.050499554691082,
+    -2.2246299750689507, 1.8937606123567254, -1.8027861642278986,
+    1.9159329907720342, -2.3876290391074826, 5.749503650759067,
+    -4.06573829408227, 1.6756990476881226, -1.3194110363802916,
+    1.2004226629535584, -1.1929410271485694, 1.276888372582896,
+    -1.4760297524762664, 1.877140036702081, -2.7626110267109185,
+    5.57034375288747, 0.0, -6.155037466138633, 3.3884738397816805,
+    -2.5825904893836045, 2.3238605332433964, -2.3936860105595956,
+    2.933460529815028, -7.01804393165471, 3.470142475893096,
+    -1.4270082975401943, 1.1173774569688575, -1.0069698860835414,
+    0.9859462926406563, -1.0316555961658238, 1.150973049998596,
+    -1.3795719459302231, 1.8145267013138568, -2.7595120104346798,
+    5.752808844258603, 0.0, -6.848610533247993, 3.9473204159379196,
+    -3.187759046417628, 3.1139693079354154, -3.7158202253455483,
+    8.800843149139984, -2.9693216241618354, 1.2190551845623254,
+    -0.9507139481087292, 0.8509553879717666, -0.8245672118869344,
+    0.8496106927972347, -0.9263647716508643, 1.071641361837154,
+    -1.3288072539519575, 1.8070343165962695, -2.843810624469815,
+    6.1496409812894814, 0.0, -8.00435050670556, 4.9044904770953455,
+    -4.319729575097569, 4.920905189847415, -11.462544758741323,
+    2.529114286426535, -1.0370859703115756, 0.8064435797485024,
+    -0.7182965938051034, 0.690913751115729, -0.7043432457958986,
+    0.7562386052422531, -0.8552120334615362, 1.024033373694899,
+    -1.3139897815048813, 1.8514431256534432, -3.0276660179918498,
+    6.837296141668682, 0.0, -10.007848226489404, 6.732289905256133,
+    -6.983517804809601, 15.776532409249047, -2.1204228752901098,
+    0.868753821042314, -0.6741431276368627, 0.5983770564590353,
+    -0.5726008005281307, 0.5794463467994756, -0.615701501107346,
+    0.6860206015100553, -0.8037203345698276, 0.997147187159026,
+    -1.3280457375893355, 1.9491228657110238, -3.3396452152906573,
+    7.9779048870260025, 0.0, -13.919815541116323, 11.201322738969528,
+    -23.674461505964796, 1.7116474016095073, -0.7008659595145693,
+    0.5430950333283097, -0.4809266172690134, 0.45861561245826066,
+    -0.46183091876504123, 0.4873941780766709, -0.537910209232522,
+    0.6216962955636719, -0.7560004784516758, 0.9758809857385137,
+    -1.3582970570342032, 2.098406868283028, -3.828579377007981,
+    9.930250011839858, 0.0, -23.971471325206828, 41.4296211311972,
+    -1.251428571436017, 0.5122396816647317, -0.3965908366528717,
+    0.3506962634183633, -0.33373158715899975, 0.3350921186592376,
+    -0.3522205076564792, 0.3865746805883146, -0.4433296182531874,
+    0.5331093693407202, -0.676733431875012, 0.9171552039237935,
+    -1.3526512717955663, 2.247277995913921, -4.521720578088172,
+    13.5644565691972, 0.0, -103.4949840588292, 0.5, -0.2046320498840581,
+    0.15837608460612923, -0.13996662165438836, 0.13308177912028163,
+    -0.13346447339564127, 0.1400564245464639, -0.15337140348112646,
+    0.17534040663070952, -0.2099169007241458, 0.2647409079568035,
+    -0.35520576835841733, 0.5152161650495555, -0.8301597965104984,
+    1.5627233770638296, -3.8334187142190923, 16.923371596330014, 76.5};
+inline constexpr std::array<double, 36> lift_matrix_17{
+    162.0, -3.6393707790048366, 2.737664080895648, -2.3122964326960047,
+    2.0645128059648092, -1.908080650788935, 1.8080913724703649,
+    -1.7480143564922206, 1.7196934425934138, -1.7196934425934138,
+    1.7480143564922206, -1.8080913724703649, 1.908080650788935,
+    -2.0645128059648092, 2.3122964326960047, -2.737664080895648,
+    3.6393707790048366, -9.0, -9.0, 3.6393707790048366, -2.737664080895648,
+    2.3122964326960047, -2.0645128059648092, 1.908080650788935,
+    -1.8080913724703649, 1.7480143564922206, -1.7196934425934138,
+    1.7196934425934138, -1.7480143564922206, 1.8080913724703649,
+    -1.908080650788935, 2.0645128059648092, -2.3122964326960047,
+    2.737664080895648, -3.6393707790048366, 162.0};
+
+// Polynomial order 18
+inline constexpr std::array<double, 19> nodes_18{
+    -1.0, -0.9786117662220801, -0.9289015281525862, -0.8524605777966461,
+    -0.751494202552613, -0.6289081372652205, -0.4882292856807135,
+    -0.33350484782449863, -0.16918602340928157, 0.0, 0.16918602340928157,
+    0.33350484782449863, 0.4882292856807135, 0.6289081372652205,
+    0.751494202552613, 0.8524605777966461, 0.9289015281525862,
+    0.9786117662220801, 1.0};
+inline constexpr std::array<double, 19> weights_18{
+    0.005847953216374269, 0.03579336518617648, 0.06338189176262973,
+    0.08913175709920708, 0.11231534147730504, 0.13226728044875077,
+    0.14841394259593887, 0.16029092404406123, 0.16755658452714287,
+    0.17000191928482725, 0.16755658452714287, 0.16029092404406123,
+    0.14841394259593887, 0.13226728044875077, 0.11231534147730504,
+    0.08913175709920708, 0.06338189176262973, 0.03579336518617648,
+    0.005847953216374269};
+inline constexpr std::array<double, 361> diff_matrix_18{
+    -85.5, -18.89843132126581, 4.272273818811224, -1.7361115742540365,
+    0.9182181625182768, -0.5666231334979648, 0.38787265558687883,
+    -0.286583038954703, 0.2248626897522909, -0.1854705810546875,
+    0.15978557878688265, -0.14323622930253538, 0.13338123898282325,
+    -0.12908599893877326, 0.13027878503664325, -0.13827279328700187,
+    0.15747415583319727, -0.20428669940994826, 0.5, 115.67097558747821, 0.0,
+    -15.117250998571159, 5.023352856225336, -2.4855986477745695,
+    1.4875614479502977, -1.0014493026142783, 0.7325126009039649,
+    -0.5710097233766915, 0.4688823880855929, -0.40267543087528573,
+    0.36014249160309714, -0.3347964610857891, 0.323607586765192,
+    -0.32629394923277, 0.34608241163334597, -0.3939590608943157,
+    0.5109278441748606, -1.2503705423266789, -46.30420024667988,
+    26.769206012235703, 0.0, -11.031645232599585, 4.23439637130979,
+    -2.3075158867737864, 1.4829603931113506, -1.0561405648769446,
+    0.8095633881503532, -0.6573338680009653, 0.5600991079222642,
+    -0.4981142350464321, 0.4611426662593348, -0.4443671975896204,
+    0.4470452537088065, -0.4733846323289429, 0.5382701877931106,
+    -0.6976117061536932, 1.7067526929737347, 26.46099744783411,
+    -12.509029656077256, 15.513420251940676, 0.0, -8.823074128013413,
+    3.6720670834688356, -2.127657058124357, 1.4369162501414257,
+    -1.0674320460116744, 0.8494054000963954, -0.7138957392081694,
+    0.6287669989286822, -0.5780302369484612, 0.5541493822287782,
+    -0.5553983342478922, 0.5865373872095639, -0.6657043974209419,
+    0.8618059042384868, -2.107488991221293, -17.635227687037556,
+    7.799514224165355, -7.503526025619974, 11.117996725503998, 0.0,
+    -7.517132812199227, 3.3043740407622835, -2.0026260137563945,
+    1.406001879003204, -1.0816007858340868, 0.8892624941293614,
+    -0.7714996201709392, 0.7017095065244241, -0.6675559053397876,
+    0.6653411274520037, -0.6998600229270399, 0.7921827343707836,
+    -1.0238717745435826, 2.50212436509727, 12.815714855118419,
+    -5.496988232243096, 4.815395098633027, -5.449172579591383,
+    8.852492462417244, 0.0, -6.710579821339735, 3.075080000325815,
+    -1.9326360109292098, 1.4025297618959514, -1.1132464764653818,
+    0.9438658470562293, -0.8450497166613391, 0.7950286701237929,
+    -0.7861419729969735, 0.8223312782690316, -0.9273191302956016,
+    1.195827640440627, -2.919629038042759, -9.843736416977725,
+    4.152418710502794, -3.472474432911235, 3.542777375485192,
+    -4.366413107512118, 7.529780645755975, 0.0, -6.2190488955817145,
+    2.9498981679098613, -1.9137562080035853, 1.4315838433413284,
+    -1.1709856085260106, 1.024108988675014, -0.9482100162170146,
+    0.9272417556722132, -0.9624823878396205, 1.0798036993762257,
+    -1.3882031627498284, 3.385053678327001, 7.8551688821281775,
+    -3.2803599511275157, 2.670948158167098, -2.5840916975611328,
+    2.8580492213928825, -3.726601265931543, 6.716734807469962, 0.0,
+    -5.952321732841847, 2.911557710889417, -1.9456858392537968,
+    1.4992285817179987, -1.2646949602568383, 1.1438439520716894,
+    -1.1010462630506297, 1.130748978217847, -1.2597161238751355,
+    1.612800932975299, -3.926068951304865, -6.442805352304154,
+    2.6730216195971885, -2.1401645249830383, 2.006639088753331,
+    -2.0975306630940125, 2.4482690505678932, -3.330380239702477,
+    6.222128330157419, 0.0, -5.867989857766721, 2.955326864030838,
+    -2.0338798078085722, 1.6162315686712108, -1.4102639496371188,
+    1.3266378778228816, -1.3420349341600144, 1.4806799057311757,
+    -1.8850119154629248, 4.57820451833609, 5.391690662278897,
+    -2.2269743422780666, 1.7630906251518754, -1.6200796771745498,
+    1.6371246089202034, -1.8026586058733423, 2.1921271190107516,
+    -3.08795024990735, 5.953627790751754, 0.0, -5.953627790751754,
+    3.08795024990735, -2.1921271190107516, 1.8026586058733423,
+    -1.6371246089202034, 1.6200796771745498, -1.7630906251518754,
+    2.2269743422780666, -5.391690662278897, -4.57820451833609,
+    1.8850119154629248, -1.4806799057311757, 1.3420349341600144,
+    -1.3266378778228816, 1.4102639496371188, -1.6162315686712108,
+    2.0338798078085722, -2.955326864030838, 5.867989857766721, 0.0,
+    -6.222128330157419, 3.330380239702477, -2.4482690505678932,
+    2.0975306630940125, -2.006639088753331, 2.1401645249830383,
+    -2.6730216195971885, 6.442805352304154, 3.926068951304865,
+    -1.612800932975299, 1.2597161238751355, -1.130748978217847,
+    1.1010462630506297, -1.1438439520716894, 1.2646949602568383,
+    -1.4992285817179987, 1.9456858392537968, -2.911557710889417,
+    5.952321732841847, 0.0, -6.716734807469962, 3.726601265931543,
+    -2.8580492213928825, 2.5840916975611328, -2.670948158167098,
+    3.2803599511275157, -7.8551688821281775, -3.385053678327001,
+    1.3882031627498284, -1.0798036993762257, 0.9624823878396205,
+    -0.9272417556722132, 0.9482100162170146, -1.024108988675014,
+    1.1709856085260106, -1.4315838433413284, 1.9137562080035853,
+    -2.9498981679098613, 6.2190488955817145, 0.0, -7.529780645755975,
+    4.366413107512118, -3.542777375485192, 3.472474432911235,
+    -4.152418710502794, 9.843736416977725, 2.919629038042759,
+    -1.195827640440627, 0.9273191302956016, -0.8223312782690316,
+    0.7861419729969735, -0.7950286701237929, 0.8450497166613391,
+    -0.9438658470562293, 1.1132464764653818, -1.4025297618959514,
+    1.9326360109292098, -3.075080000325815, 6.710579821339735, 0.0,
+    -8.852492462417244, 5.449172579591383, -4.815395098633027,
+    5.496988232243096, -12.815714855118419, -2.50212436509727,
+    1.0238717745435826, -0.7921827343707836, 0.6998600229270399,
+    -0.6653411274520037, 0.6675559053397876, -0.7017095065244241,
+    0.7714996201709392, -0.8892624941293614, 1.0816007858340868,
+    -1.406001879003204, 2.0026260137563945, -3.3043740407622835,
+    7.517132812199227, 0.0, -11.117996725503998, 7.503526025619974,
+    -7.799514224165355, 17.635227687037556, 2.107488991221293,
+    -0.8618059042384868, 0.6657043974209419, -0.5865373872095639,
+    0.5553983342478922, -0.5541493822287782, 0.5780302369484612,
+    -0.6287669989286822, 0.7138957392081694, -0.8494054000963954,
+    1.0674320460116744, -1.4369162501414257, 2.127657058124357,
+    -3.6720670834688356, 8.823074128013413, 0.0, -15.513420251940676,
+    12.509029656077256, -26.46099744783411, -1.7067526929737347,
+    0.6976117061536932, -0.5382701877931106, 0.4733846323289429,
+    -0.4470452537088065, 0.4443671975896204, -0.4611426662593348,
+    0.4981142350464321, -0.5600991079222642, 0.6573338680009653,
+    -0.8095633881503532, 1.0561405648769446, -1.4829603931113506,
+    2.3075158867737864, -4.23439637130979, 11.031645232599585, 0.0,
+    -26.769206012235703, 46.30420024667988, 1.2503705423266789,
+    -0.5109278441748606, 0.3939590608943157, -0.34608241163334597,
+    0.32629394923277, -0.323607586765192, 0.3347964610857891,
+    -0.36014249160309714, 0.40267543087528573, -0.4688823880855929,
+    0.5710097233766915, -0.7325126009039649, 1.0014493026142783,
+    -1.4875614479502977, 2.4855986477745695, -5.023352856225336,
+    15.117250998571159, 0.0, -115.67097558747821, -0.5, 0.20428669940994826,
+    -0.15747415583319727, 0.13827279328700187, -0.13027878503664325,
+    0.12908599893877326, -0.13338123898282325, 0.14323622930253538,
+    -0.15978557878688265, 0.1854705810546875, -0.2248626897522909,
+    0.286583038954703, -0.38787265558687883, 0.5666231334979648,
+    -0.9182181625182768, 1.7361115742540365, -4.272273818811224,
+    18.89843132126581, 85.5};
+inline constexpr std::array<double, 38> lift_matrix_18{
+    180.5, -3.8399386377843707, 2.885645328396331, -2.4333765361869593,
+    2.1677340987191482, -1.997557723744585, 1.885767727138848,
+    -1.8145589585108082, 1.774781121869865, -1.7619705200195312,
+    1.774781121869865, -1.8145589585108082, 1.885767727138848,
+    -1.997557723744585, 2.1677340987191482, -2.4333765361869593,
+    2.885645328396331, -3.8399386377843707, 9.5, 9.5, -3.8399386377843707,
+    2.885645328396331, -2.4333765361869593, 2.1677340987191482,
+    -1.997557723744585, 1.885767727138848, -1.8145589585108082,
+    1.774781121869865, -1.7619705200195312, 1.774781121869865,
+    -1.8145589585108082, 1.885767727138848, -1.997557723744585,
+    2.1677340987191482, -2.4333765361869593, 2.885645328396331,
+    -3.8399386377843707, 180.5};
+
+// Polynomial order 19
+inline constexpr std::array<double, 20> nodes_19{
+    -1.0, -0.9807437048939142, -0.9359344988126654, -0.8668779780899502,
+    -0.7753682609520559, -0.6637764022903113, -0.5349928640318863,
+    -0.3923531837139093, -0.2395517059229865, -0.08054593723882184,
+    0.08054593723882184, 0.2395517059229865, 0.3923531837139093,
+    0.5349928640318863, 0.6637764022903113, 0.7753682609520559,
+    0.8668779780899502, 0.9359344988126654, 0.9807437048939142, 1.0};
+inline constexpr std::array<double, 20> weights_19{
+    0.005263157894736842, 0.03223712318848894, 0.05718180212756683,
+    0.0806317639961196, 0.10199149969945082, 0.12070922762867473,
+    0.1363004823587242, 0.14836155407091683, 0.1565801026474755,
+    0.16074328638784574, 0.16074328638784574, 0.1565801026474755,
+    0.14836155407091683, 0.1363004823587242, 0.12070922762867473,
+    0.10199149969945082, 0.0806317639961196, 0.05718180212756683,
+    0.03223712318848894, 0.005263157894736842};
+inline constexpr std::array<double, 400> diff_matrix_19{
+    -95.0, -20.983229330380155, 4.735545920835985, -1.9191999063500162,
+    1.0112769099798649, -0.621047435884014, 0.42258578639781147,
+    -0.3099640207592981, 0.24109334516765152, -0.19680074664557773,
+    0.16746094712095191, -0.1479075234780501, 0.13527361633578433,
+    -0.128017146423423, 0.12550412600747124, -0.12795367358093315,
+    0.13685295717307056, -0.15671249363037093, 0.20399370966882202, -0.5,
+    128.5234002749981, 0.0, -16.756448302648757, 5.553055784486174,
+    -2.7374590756886, 1.6303972715331665, -1.0910314555483307,
+    0.7922309131539588, -0.6121799902899573, 0.49747789290336963,
+    -0.4219663236790191, 0.37183038361937953, -0.339481622712136,
+    0.32085271193413933, -0.31424524581519736, 0.32014295436531803,
+    -0.3422252178066677, 0.3917418916389596, -0.509817190265916,
+    1.249472366171426, -51.44953946413741, 29.722376454019326, 0.0,
+    -12.194700685101466, 4.66329294621596, -2.528933589704231,
+    1.6154706271023835, -1.1420988973365171, 0.8677859232901061,
+    -0.6972669157521441, 0.5867640172349033, -0.5140946635158621,
+    0.46738641692900185, -0.4403408696661865, 0.43024633484137415,
+    -0.4375423344252416, 0.4671165810960325, -0.5342254192299828,
+    0.6948668217633132, -1.7026095323209949, 29.402210042935977,
+    -13.88934989186185, 17.195684484564175, 0.0, -9.716366292976867,
+    4.02410729692553, -2.3174832856167487, 1.55357950711085,
+    -1.1439085808893348, 0.9007010864340431, -0.747553562912474,
+    0.6485761509456371, -0.585446118647941, 0.5486512604901769,
+    -0.5339562893285925, 0.5414181563887512, -0.5767824453237158,
+    0.6586786796537824, -0.8559765967442484, 2.096592115540517,
+    -19.59691324545186, 8.660746644881982, -8.317615455025086,
+    12.290277686317209, 0.0, -8.237193007533628, 3.5986803966004604,
+    -2.16473845337634, 1.5062517842464735, -1.1464148525093372,
+    0.9306477605390326, -0.7952101331953617, 0.7100387422939743,
+    -0.6601494902653416, 0.6387152739706194, -0.6448548711370544,
+    0.6848423871423426, -0.7804160975982155, 1.01286519405028,
+    -2.4795355415089406, 14.24356969820236, -6.104887034241967,
+    5.338509962599513, -6.024262147237301, 9.74890268990778, 0.0,
+    -7.307371486089167, 3.323246472786282, -2.069693335913172,
+    1.485811148393683, -1.1642406535917458, 0.9719779767928135,
+    -0.8540677827036306, 0.7850294312553336, -0.7532657055520309,
+    0.7559338535351098, -0.7993555898817913, 0.9082383002359625,
+    -1.1766651970322266, 2.8784061617690075, -10.943742839552874,
+    4.612946161178498, -3.850690560944287, 3.917489510747219,
+    -4.8092426854879236, 8.251218882720604, 0.0, -6.719665467339872,
+    3.157980271937646, -2.0262783488551523, 1.4959836269680975,
+    -1.2045754176298409, 1.033584966944131, -0.9345919050804374,
+    0.8864267649450094, -0.8822175790843525, 0.9274438229471451,
+    -1.0496114271436519, 1.3565844305345365, -3.3152717734629955,
+    8.737481326924684, -3.646001808886973, 2.9632428676087317,
+    -2.8585691125247745, 3.148928705297938, -4.084542838596893,
+    7.3142808764785405, 0.0, -6.370372761453369, 3.0811160851700605,
+    -2.0315417813665304, 1.5404254469188416, -1.2743620308293029,
+    1.1250457027480458, -1.0497194457543884, 1.0328552042838575,
+    -1.0772143840431783, 1.212661591401558, -1.5623609101097948,
+    3.813186749430286, -7.1725799394550815, 2.9734416795776464,
+    -2.3762456566456054, 2.2213742343972513, -2.312438386387664,
+    2.684739198091731, -3.627843912080251, 6.723262149264479, 0.0,
+    -6.207103462276404, 3.083325598940732, -2.0872320573694645,
+    1.625757940524416, -1.3837995234874063, 1.2608183679666811,
+    -1.2208280557591689, 1.2594803245859745, -1.4077379898634952,
+    1.806030869881155, -4.400281289620126, 6.010535768084476,
+    -2.480563508816516, 1.9600812034128527, -1.7955907884326927,
+    1.8068024443137058, -1.9785907973763242, 2.3896514179186044,
+    -3.338255172468406, 6.372139196523713, 0.0, -6.207637742391408,
+    3.1653056895316642, -2.2010870970991605, 1.7642587936584024,
+    -1.5503692011050056, 1.466743600587908, -1.4902838595876082,
+    1.6494474282929759, -2.104041766275929, 5.114462366550183,
+    -5.114462366550183, 2.104041766275929, -1.6494474282929759,
+    1.4902838595876082, -1.466743600587908, 1.5503692011050056,
+    -1.7642587936584024, 2.2010870970991605, -3.1653056895316642,
+    6.207637742391408, 0.0, -6.372139196523713, 3.338255172468406,
+    -2.3896514179186044, 1.9785907973763242, -1.8068024443137058,
+    1.7955907884326927, -1.9600812034128527, 2.480563508816516,
+    -6.010535768084476, 4.400281289620126, -1.806030869881155,
+    1.4077379898634952, -1.2594803245859745, 1.2208280557591689,
+    -1.2608183679666811, 1.3837995234874063, -1.625757940524416,
+    2.0872320573694645, -3.083325598940732, 6.207103462276404, 0.0,
+    -6.723262149264479, 3.627843912080251, -2.684739198091731,
+    2.312438386387664, -2.2213742343972513, 2.3762456566456054,
+    -2.9734416795776464, 7.1725799394550815, -3.813186749430286,
+    1.5623609101097948, -1.212661591401558, 1.0772143840431783,
+    -1.0328552042838575, 1.0497194457543884, -1.1250457027480458,
+    1.2743620308293029, -1.5404254469188416, 2.0315417813665304,
+    -3.0811160851700605, 6.370372761453369, 0.0, -7.3142808764785405,
+    4.084542838596893, -3.148928705297938, 2.8585691125247745,
+    -2.9632428676087317, 3.646001808886973, -8.737481326924684,
+    3.3152717734629955, -1.3565844305345365, 1.0496114271436519,
+    -0.9274438229471451, 0.8822175790843525, -0.8864267649450094,
+    0.9345919050804374, -1.033584966944131, 1.2045754176298409,
+    -1.4959836269680975, 2.0262783488551523, -3.157980271937646,
+    6.719665467339872, 0.0, -8.251218882720604, 4.8092426854879236,
+    -3.917489510747219, 3.850690560944287, -4.612946161178498,
+    10.943742839552874, -2.8784061617690075, 1.1766651970322266,
+    -0.9082383002359625, 0.7993555898817913, -0.7559338535351098,
+    0.7532657055520309, -0.7850294312553336, 0.8540677827036306,
+    -0.9719779767928135, 1.1642406535917458, -1.485811148393683,
+    2.069693335913172, -3.323246472786282, 7.307371486089167, 0.0,
+    -9.74890268990778, 6.024262147237301, -5.338509962599513,
+    6.104887034241967, -14.24356969820236, 2.4795355415089406,
+    -1.01286519405028, 0.7804160975982155, -0.6848423871423426,
+    0.6448548711370544, -0.6387152739706194, 0.6601494902653416,
+    -0.7100387422939743, 0.7952101331953617, -0.9306477605390326,
+    1.1464148525093372, -1.5062517842464735, 2.16473845337634,
+    -3.5986803966004604, 8.237193007533628, 0.0, -12.290277686317209,
+    8.317615455025086, -8.660746644881982, 19.59691324545186,
+    -2.096592115540517, 0.8559765967442484, -0.6586786796537824,
+    0.5767824453237158, -0.5414181563887512, 0.5339562893285925,
+    -0.5486512604901769, 0.585446118647941, -0.6485761509456371,
+    0.747553562912474, -0.9007010864340431, 1.1439085808893348,
+    -1.55357950711085, 2.3174832856167487, -4.02410729692553,
+    9.716366292976867, 0.0, -17.195684484564175, 13.88934989186185,
+    -29.402210042935977, 1.7026095323209949, -0.6948668217633132,
+    0.5342254192299828, -0.4671165810960325, 0.4375423344252416,
+    -0.43024633484137415, 0.4403408696661865, -0.46738641692900185,
+    0.5140946635158621, -0.5867640172349033, 0.6972669157521441,
+    -0.8677859232901061, 1.1420988973365171, -1.6154706271023835,
+    2.528933589704231, -4.66329294621596, 12.194700685101466, 0.0,
+    -29.722376454019326, 51.44953946413741, -1.249472366171426,
+    0.509817190265916, -0.3917418916389596, 0.3422252178066677,
+    -0.32014295436531803, 0.31424524581519736, -0.32085271193413933,
+    0.339481622712136, -0.37183038361937953, 0.4219663236790191,
+    -0.49747789290336963, 0.6121799902899573, -0.7922309131539588,
+    1.0910314555483307, -1.6303972715331665, 2.7374590756886,
+    -5.553055784486174, 16.756448302648757, 0.0, -128.5234002749981, 0.5,
+    -0.20399370966882202, 0.15671249363037093, -0.13685295717307056,
+    0.12795367358093315, -0.12550412600747124, 0.128017146423423,
+    -0.13527361633578433, 0.1479075234780501, -0.16746094712095191,
+    0.19680074664557773, -0.24109334516765152, 0.3099640207592981,
+    -0.42258578639781147, 0.621047435884014, -1.0112769099798649,
+    1.9191999063500162, -4.735545920835985, 20.983229330380155, 95.0};
+inline constexpr std::array<double, 40> lift_matrix_19{
+    200.0, -4.04059256264476, 3.0338512281399517, -2.554877719828925,
+    2.271648909478083, -2.088108032413004, 1.965054062336794,
+    -1.883486503776232, 1.8333902304606118, -1.8094924605770977,
+    1.8094924605770977, -1.8333902304606118, 1.883486503776232,
+    -1.965054062336794, 2.088108032413004, -2.271648909478083,
+    2.554877719828925, -3.0338512281399517, 4.04059256264476, -10.0, -10.0,
+    4.04059256264476, -3.0338512281399517, 2.554877719828925,
+    -2.271648909478083, 2.088108032413004, -1.965054062336794,
+    1.883486503776232, -1.8333902304606118, 1.8094924605770977,
+    -1.8094924605770977, 1.8333902304606118, -1.883486503776232,
+    1.965054062336794, -2.088108032413004, 2.271648909478083,
+    -2.554877719828925, 3.0338512281399517, -4.04059256264476, 200.0};
+
+// Polynomial order 20
+inline constexpr std::array<double, 21> nodes_20{
+    -1.0, -0.982572296604548, -0.9419762969597455, -0.8792947553235905,
+    -0.7960019260777124, -0.6940510260622232, -0.5758319602618307,
+    -0.4441157832790021, -0.30198985650876486, -0.15278551580218547, 0.0,
+    0.15278551580218547, 0.30198985650876486, 0.4441157832790021,
+    0.5758319602618307, 0.6940510260622232, 0.7960019260777124,
+    0.8792947553235905, 0.9419762969597455, 0.982572296604548, 1.0};
+inline constexpr std::array<double, 21> weights_20{
+    0.004761904761904762, 0.029184840098505457, 0.05184316900084963,
+    0.07327391818507414, 0.09298546795788606, 0.11051708321912333,
+    0.12545812119086894, 0.13745846286004135, 0.14623686244797746,
+    0.1515875751116814, 0.15338519033217496, 0.1515875751116814,
+    0.14623686244797746, 0.13745846286004135, 0.12545812119086894,
+    0.11051708321912333, 0.09298546795788606, 0.07327391818507414,
+    0.05184316900084963, 0.029184840098505457, 0.004761904761904762};
+inline constexpr std::array<double, 441> diff_matrix_20{
+    -105.0, -23.177763842178937, 5.223229885968815, -2.111978556094345,
+    1.1093197500383445, -0.6784637436066241, 0.4593069539985943,
+    -0.3348268428741595, 0.25852359616539655, -0.20920168479320483,
+    0.17619705200195312, -0.15374819950964969, 0.1385971569234447,
+    -0.1288850654797584, 0.1236320465814912, -0.12253189721972706,
+    0.12600158668314476, -0.13565029521981659, 0.15606325385583167,
+    -0.20374298294348472, 0.5, 142.0522596307319, 0.0, -18.482029058467305,
+    6.110799878228539, -3.002814086619877, 1.7810910276868412,
+    -1.185801583488419, 0.855740886911573, -0.6564013857805031,
+    0.5287864821252134, -0.4439381104077081, 0.38646850177069747,
+    -0.3477723952352356, 0.32297126524960235, -0.3094917976376916,
+    0.3064985672765072, -0.3149917105618354, 0.3389653337652902,
+    -0.38985580701976846, 0.5088684076762985, -1.2487033394636067,
+    -56.86564583879966, 32.83098186327913, 0.0, -13.41934731866935,
+    5.115188206137476, -2.7625507602044057, 1.7556747350721424,
+    -1.2335374692684797, 0.9303504402068901, -0.7410234710968261,
+    0.6171831785953368, -0.5341882455103176, 0.47863976438574596,
+    -0.44306551263799787, 0.4235254079504153, -0.41863979650823746,
+    0.4296293074542284, -0.46184524628042095, 0.5307989188409132,
+    -0.6925294235318934, 1.6990708653387794, 32.49811822485649,
+    -15.34228896959448, 18.966590516663008, 0.0, -10.6576033514838,
+    4.395582998520879, -2.5183718968481617, 1.6777261127613106,
+    -1.2261427499361388, 0.9569775790414724, -0.7860469919465499,
+    0.6736424216597852, -0.5992274927601207, 0.5516890668671602,
+    -0.5251997414637982, 0.5175303461942548, -0.5298774515466234,
+    0.5686375324915868, -0.6527612305019853, 0.8510349225852407,
+    -2.087322013080779, -21.66162937517054, 9.567229838932032,
+    -9.174558156978367, 13.524624579842962, 0.0, -8.997083876108752,
+    3.9102099438543862, -2.3373278520575704, 1.6141413034947067,
+    -1.2176392016295257, 0.9781415492159002, -0.8254804835222977,
+    0.726239757494119, -0.663221947490109, 0.627561979802456,
+    -0.6155893972538435, 0.6281391836119575, -0.6724207468740403,
+    0.7705794798423536, -1.0035912998182634, 2.4604264652453556,
+    15.74618514279956, -6.7446312764886684, 5.8890893081315925,
+    -6.62973980478432, 10.693407145250752, 0.0, -7.93921922762743,
+    3.5875789438214563, -2.2173407874244195, 1.5775115578640984,
+    -1.2230144599780843, 1.008285018533285, -0.8727886953518161,
+    0.7878128293399971, -0.7390972950913459, 0.7204081273920253,
+    -0.7316535168261541, 0.7805771242409546, -0.8924386784453608,
+    1.1606480471337055, -2.843792255226225, -12.100995374698547,
+    5.097456017147503, -4.248653350662607, 4.311905442812994,
+    -5.275744735080613, 9.012539048336096, 0.0, -7.2531144629489095,
+    3.3823670655440603, -2.1504509321697713, 1.5705866773082993,
+    -1.2485846836309233, 1.0551509374660775, -0.936668093369085,
+    0.868308872214474, -0.8390174199183777, 0.8467209838906969,
+    -0.899236378318856, 1.0249123072932642, -1.3304256362054823,
+    3.2572352994501346, 9.665204460610134, -4.030477005333225,
+    3.270636569364267, -3.147336163706049, 3.455222636394203,
+    -4.462143522454245, 7.946890608285746, 0.0, -6.821564684221375,
+    3.268649332553417, -2.131561262389181, 1.5953332415367787,
+    -1.299442265365891, 1.1258325392274797, -1.0262624300636423,
+    0.9798624555426001, -0.9804270649938878, 1.0349430327542908,
+    -1.1747565877486639, 1.5211710435736283, -3.720432027157307,
+    -7.93919271011907, 3.2890390640845357, -2.624290373737003,
+    2.4470817598576398, -2.538536020248478, 2.933998530235976,
+    -3.942564599385501, 7.257204799548578, 0.0, -6.582868344814855,
+    3.2332877716272637, -2.159731135736926, 1.6556847497475071,
+    -1.3824275047574388, 1.2299081242363734, -1.1548791975920343,
+    1.1421464649618183, -1.1959118688381833, 1.3501253633909527,
+    -1.742587718608853, 4.256282808265852, 6.659598982486849,
+    -2.7465444493321853, 2.166726171437708, -1.979775535910867,
+    1.9850303277447712, -2.1637483075185924, 2.598330336131289,
+    -3.60462801564053, 6.823731260132304, 0.0, -6.506656850126474,
+    3.2725615211284835, -2.238754307765759, 1.7593147235019637,
+    -1.5086303119847209, 1.3829851144175882, -1.3457219450230333,
+    1.3936175889194984, -1.5619473568204425, 2.007337468450431,
+    -4.894326515705507, -5.675463855030419, 2.3331815877956252,
+    -1.826021849033014, 1.6454417950631004, -1.6135040344824672,
+    1.6974055074435819, -1.9202004154486347, 2.3785362001985457,
+    -3.391336848642849, 6.583816639638897, 0.0, -6.583816639638897,
+    3.391336848642849, -2.3785362001985457, 1.9202004154486347,
+    -1.6974055074435819, 1.6135040344824672, -1.6454417950631004,
+    1.826021849033014, -2.3331815877956252, 5.675463855030419,
+    4.894326515705507, -2.007337468450431, 1.5619473568204425,
+    -1.3936175889194984, 1.3457219450230333, -1.3829851144175882,
+    1.5086303119847209, -1.7593147235019637, 2.238754307765759,
+    -3.2725615211284835, 6.506656850126474, 0.0, -6.823731260132304,
+    3.60462801564053, -2.598330336131289, 2.1637483075185924,
+    -1.9850303277447712, 1.979775535910867, -2.166726171437708,
+    2.7465444493321853, -6.659598982486849, -4.256282808265852,
+    1.742587718608853, -1.3501253633909527, 1.1959118688381833,
+    -1.1421464649618183, 1.1548791975920343, -1.2299081242363734,
+    1.3824275047574388, -1.6556847497475071, 2.159731135736926,
+    -3.2332877716272637, 6.582868344814855, 0.0, -7.257204799548578,
+    3.942564599385501, -2.933998530235976, 2.538536020248478,
+    -2.4470817598576398, 2.624290373737003, -3.2890390640845357,
+    7.93919271011907, 3.720432027157307, -1.5211710435736283,
+    1.1747565877486639, -1.0349430327542908, 0.9804270649938878,
+    -0.9798624555426001, 1.0262624300636423, -1.1258325392274797,
+    1.299442265365891, -1.5953332415367787, 2.131561262389181,
+    -3.268649332553417, 6.821564684221375, 0.0, -7.946890608285746,
+    4.462143522454245, -3.455222636394203, 3.147336163706049,
+    -3.270636569364267, 4.030477005333225, -9.665204460610134,
+    -3.2572352994501346, 1.3304256362054823, -1.0249123072932642,
+    0.899236378318856, -0.8467209838906969, 0.8390174199183777,
+    -0.868308872214474, 0.936668093369085, -1.0551509374660775,
+    1.2485846836309233, -1.5705866773082993, 2.1504509321697713,
+    -3.3823670655440603, 7.2531144629489095, 0.0, -9.012539048336096,
+    5.275744735080613, -4.311905442812994, 4.248653350662607,
+    -5.097456017147503, 12.100995374698547, 2.843792255226225,
+    -1.1606480471337055, 0.8924386784453608, -0.7805771242409546,
+    0.7316535168261541, -0.7204081273920253, 0.7390972950913459,
+    -0.7878128293399971, 0.8727886953518161, -1.008285018533285,
+    1.2230144599780843, -1.5775115578640984, 2.2173407874244195,
+    -3.5875789438214563, 7.93921922762743, 0.0, -10.693407145250752,
+    6.62973980478432, -5.8890893081315925, 6.7446312764886684,
+    -15.74618514279956, -2.4604264652453556, 1.0035912998182634,
+    -0.7705794798423536, 0.6724207468740403, -0.6281391836119575,
+    0.6155893972538435, -0.627561979802456, 0.663221947490109,
+    -0.726239757494119, 0.8254804835222977, -0.9781415492159002,
+    1.2176392016295257, -1.6141413034947067, 2.3373278520575704,
+    -3.9102099438543862, 8.997083876108752, 0.0, -13.524624579842962,
+    9.174558156978367, -9.567229838932032, 21.66162937517054,
+    2.087322013080779, -0.8510349225852407, 0.6527612305019853,
+    -0.5686375324915868, 0.5298774515466234, -0.5175303461942548,
+    0.5251997414637982, -0.5516890668671602, 0.5992274927601207,
+    -0.6736424216597852, 0.7860469919465499, -0.9569775790414724,
+    1.2261427499361388, -1.6777261127613106, 2.5183718968481617,
+    -4.395582998520879, 10.6576033514838, 0.0, -18.966590516663008,
+    15.34228896959448, -32.49811822485649, -1.6990708653387794,
+    0.6925294235318934, -0.5307989188409132, 0.46184524628042095,
+    -0.4296293074542284, 0.41863979650823746, -0.4235254079504153,
+    0.44306551263799787, -0.47863976438574596, 0.5341882455103176,
+    -0.6171831785953368, 0.7410234710968261, -0.9303504402068901,
+    1.2335374692684797, -1.7556747350721424, 2.7625507602044057,
+    -5.115188206137476, 13.41934731866935, 0.0, -32.83098186327913,
+    56.86564583879966, 1.2487033394636067, -0.5088684076762985,
+    0.38985580701976846, -0.3389653337652902, 0.3149917105618354,
+    -0.3064985672765072, 0.3094917976376916, -0.32297126524960235,
+    0.3477723952352356, -0.38646850177069747, 0.4439381104077081,
+    -0.5287864821252134, 0.6564013857805031, -0.855740886911573,
+    1.185801583488419, -1.7810910276868412, 3.002814086619877,
+    -6.110799878228539, 18.482029058467305, 0.0, -142.0522596307319, -0.5,
+    0.20374298294348472, -0.15606325385583167, 0.13565029521981659,
+    -0.12600158668314476, 0.12253189721972706, -0.1236320465814912,
+    0.1288850654797584, -0.1385971569234447, 0.15374819950964969,
+    -0.17619705200195312, 0.20920168479320483, -0.25852359616539655,
+    0.3348268428741595, -0.4593069539985943, 0.6784637436066241,
+    -1.1093197500383445, 2.111978556094345, -5.223229885968815,
+    23.177763842178937, 105.0};
+inline constexpr std::array<double, 42> lift_matrix_20{
+    220.5, -4.24131953291892, 3.1822469680515857, -2.6767323278293293,
+    2.376140469903646, -2.1795405052095096, 2.045644968314779,
+    -1.954312051526801, 1.894746970780425, -1.8610063234915826,
+    1.8500690460205078, -1.8610063234915826, 1.894746970780425,
+    -1.954312051526801, 2.045644968314779, -2.1795405052095096,
+    2.376140469903646, -2.6767323278293293, 3.1822469680515857,
+    -4.24131953291892, 10.5, 10.5, -4.24131953291892, 3.1822469680515857,
+    -2.6767323278293293, 2.376140469903646, -2.1795405052095096,
+    2.045644968314779, -1.954312051526801, 1.894746970780425,
+    -1.8610063234915826, 1.8500690460205078, -1.8610063234915826,
+    1.894746970780425, -1.954312051526801, 2.045644968314779,
+    -2.1795405052095096, 2.376140469903646, -2.6767323278293293,
+    3.1822469680515857, -4.24131953291892, 220.5};
+
+// Polynomial order 21
+inline constexpr std::array<double, 22> nodes_21{
+    -1.0, -0.9841524384576462, -0.9472042839992287, -0.8900622901909044,
+    -0.8139489276119212, -0.7204872399612021, -0.611669438284259,
+    -0.48981487518990235, -0.35752071013891956, -0.21760658515928505,
+    -0.07305454001089834, 0.07305454001089834, 0.21760658515928505,
+    0.35752071013891956, 0.48981487518990235, 0.611669438284259,
+    0.7204872399612021, 0.8139489276119212, 0.8900622901909044,
+    0.9472042839992287, 0.9841524384576462, 1.0};
+inline constexpr std::array<double, 22> weights_21{
+    0.004329004329004329, 0.026545747682501758, 0.04721446529374075,
+    0.06686560586455308, 0.08509006039183845, 0.10150057480164767,
+    0.11574764465393907, 0.12752769665343028, 0.13658968861374143,
+    0.1427404922713614, 0.1458490194442418, 0.1458490194442418,
+    0.1427404922713614, 0.13658968861374143, 0.12752769665343028,
+    0.11574764465393907, 0.10150057480164767, 0.08509006039183845,
+    0.06686560586455308, 0.04721446529374075, 0.026545747682501758,
+    0.004329004329004329};
+inline constexpr std::array<double, 484> diff_matrix_21{
+    -115.5, -25.482033482150605, 5.735321769456578, -2.314440031247908,
+    1.2123343666306017, -0.7388531352671943, 0.4980080442478349,
+    -0.3611303262357066, 0.277093232914425, -0.22258465897009388,
+    0.18586091528268003, -0.16055375117181792, 0.1430254842125266,
+    -0.13114102950956286, 0.12366860046271877, -0.11999467072329616,
+    0.12003511232464, -0.12434534708840579, 0.13462214332639086,
+    -0.1555052142199327, 0.20352674825055914, -0.5, 156.2575548197275, 0.0,
+    -20.293978351068702, 6.696562648035059, -3.2816295288701287,
+    1.939592158763661, -1.285686083963386, 0.9229360516732096,
+    -0.7035195051342273, 0.562581889477584, -0.4682531195064365,
+    0.4035391761615596, -0.35884466523237124, 0.32858050701047214,
+    -0.30953329467466223, 0.3000937741332318, -0.3000064811449906,
+    0.31063035580113607, -0.33618376955423807, 0.38823746953241056,
+    -0.5080513754389462, 1.2480398020165613, -62.55252479609443,
+    36.095021620357635, 0.0, -14.705532523394714, 5.590021094526925,
+    -3.0082859573013376, 1.9034603197609083, -1.3302987284882992,
+    0.9970330393102561, -0.7882799623600464, 0.6508785303206372,
+    -0.5576676106666422, 0.49375161393798844, -0.45061910250722587,
+    0.4234213198009141, -0.40970429842129136, 0.40896634063401677,
+    -0.42296164141352466, 0.4573661003822141, -0.5278692341729392,
+    0.690522065914559, -1.6960240696898117, 35.74873646803687,
+    -16.86785107830878, 20.82612469759418, 0.0, -11.646651147178263,
+    4.786358086763435, -2.7301545396451115, 1.8091334286030913,
+    -1.313829206578431, 1.0178039090132591, -0.8287498425609013,
+    0.7030248284528928, -0.6178995008802314, 0.5608193454100863,
+    -0.5247575627432433, 0.5061193647479412, -0.5039565053945261,
+    0.5202229729092581, -0.5617584359098707, 0.6477265222363755,
+    -0.8468072439297333, 2.0793675617261838, -23.829406632962492,
+    10.518974946004748, -10.074353899079417, 14.820986614307062, 0.0,
+    -9.796513611380533, 4.238688350371336, -2.520069389560443,
+    1.7292507502688075, -1.2947030584984538, 1.0309351664076836,
+    -0.8611173537111537, 0.7484679642798875, -0.6737509979553681,
+    0.6265247599814459, -0.601423028380559, 0.5967004131954102,
+    -0.6142891562827792, 0.6620115619940383, -0.7622628232131885,
+    0.9956982960430948, -2.4441077645284057, 17.323618140356167,
+    -7.416243134302505, 6.467144167240842, -7.265590294614323,
+    11.685874449122664, 0.0, -8.605541861829039, 3.867554346661663,
+    -2.3749732040891107, 1.676855835554779, -1.2885102077238038,
+    1.0512661888192942, -0.8989062053402775, 0.7996562383691784,
+    -0.7371200098370341, 0.7029474557576015, -0.6939748163019858,
+    0.711780372993178, -0.764995311284404, 0.8791864609844938,
+    -1.1471076514642151, 2.814419199283531, -13.31559263043276,
+    5.605987737207469, -4.666388729255966, 4.726031468933481,
+    -5.765869605900891, 9.81345379988346, 0.0, -7.818294517839338,
+    3.6220895475846775, -2.2851619741482128, 1.6539636566453348,
+    -1.3010344239585732, 1.0858838576403715, -0.949813050870213,
+    0.8649191377128627, -0.8174349880917816, 0.8016162714193873,
+    -0.8181131692129571, 0.8761174541959508, -1.004402088466431,
+    1.3085013820925164, -3.2083822171739436, 10.638501418901088,
+    -4.433851712750225, 3.593177041180861, -3.450422920803626,
+    3.776923452369355, -4.859285757500142, 8.613990328694442, 0.0,
+    -7.3038628697580945, 3.4723805536837475, -2.2436965615597506,
+    1.661280051434371, -1.3361352826181716, 1.1403491801026515,
+    -1.0207938250265447, 0.9529450534718826, -0.9261348243137718,
+    0.9389963900465242, -1.0008302835642156, 1.1436737722692074,
+    -1.4870203913460465, 3.643140677799053, -8.742906110574692,
+    3.619921024236956, -2.88437942757035, 2.6838240661679276,
+    -2.775856785464809, 3.196009983652284, -4.2742993597394285,
+    7.8228681395296835, 0.0, -6.9915553735673015, 3.4019394141713772,
+    -2.2475436658752996, 1.7008710251390922, -1.398520381674444,
+    1.2213812646867628, -1.120840681013504, 1.0761002763809848,
+    -1.0815298354488914, 1.1456134849551174, -1.3036242709080372,
+    1.6906929755340752, -4.137790360980429, 7.339295916285633,
+    -3.0250877393789404, 2.38315671214093, -2.172743806472942,
+    2.1718935333254565, -2.3581662261809053, 2.818071556314916,
+    -3.8866012842159217, 7.306393812695744, 0.0, -6.84380454306144,
+    3.4035715739974517, -2.2977245823420596, 1.7774633640538533,
+    -1.4955230352850755, 1.3391166347490482, -1.2641338682741114,
+    1.2555718632549273, -1.3190530137203036, 1.4927278747056152,
+    -1.929561931231061, 4.715986973508397, -6.261863049054268,
+    2.5727004998521426, -2.010612528045702, 1.8076909696582038,
+    -1.76707928562675, 1.8514964147509678, -2.0840940499425127,
+    2.5660382177466725, -3.632554790930955, 6.992845309626437, 0.0,
+    -6.8442016050667025, 3.477692761014943, -2.3999032661463358,
+    1.8999485827964668, -1.6393819119593138, 1.510593837658644,
+    -1.4760022626243026, 1.5334562597475396, -1.7226770161543188,
+    2.2171458063430918, -5.409236257772523, 5.409236257772523,
+    -2.2171458063430918, 1.7226770161543188, -1.5334562597475396,
+    1.4760022626243026, -1.510593837658644, 1.6393819119593138,
+    -1.8999485827964668, 2.3999032661463358, -3.477692761014943,
+    6.8442016050667025, 0.0, -6.992845309626437, 3.632554790930955,
+    -2.5660382177466725, 2.0840940499425127, -1.8514964147509678,
+    1.76707928562675, -1.8076909696582038, 2.010612528045702,
+    -2.5727004998521426, 6.261863049054268, -4.715986973508397,
+    1.929561931231061, -1.4927278747056152, 1.3190530137203036,
+    -1.2555718632549273, 1.2641338682741114, -1.3391166347490482,
+    1.4955230352850755, -1.7774633640538533, 2.2977245823420596,
+    -3.4035715739974517, 6.84380454306144, 0.0, -7.306393812695744,
+    3.8866012842159217, -2.818071556314916, 2.3581662261809053,
+    -2.1718935333254565, 2.172743806472942, -2.38315671214093,
+    3.0250877393789404, -7.339295916285633, 4.137790360980429,
+    -1.6906929755340752, 1.3036242709080372, -1.1456134849551174,
+    1.0815298354488914, -1.0761002763809848, 1.120840681013504,
+    -1.2213812646867628, 1.398520381674444, -1.7008710251390922,
+    2.2475436658752996, -3.4019394141713772, 6.9915553735673015, 0.0,
+    -7.8228681395296835, 4.2742993597394285, -3.196009983652284,
+    2.775856785464809, -2.6838240661679276, 2.88437942757035,
+    -3.619921024236956, 8.742906110574692, -3.643140677799053,
+    1.4870203913460465, -1.1436737722692074, 1.0008302835642156,
+    -0.9389963900465242, 0.9261348243137718, -0.9529450534718826,
+    1.0207938250265447, -1.1403491801026515, 1.3361352826181716,
+    -1.661280051434371, 2.2436965615597506, -3.4723805536837475,
+    7.3038628697580945, 0.0, -8.613990328694442, 4.859285757500142,
+    -3.776923452369355, 3.450422920803626, -3.593177041180861,
+    4.433851712750225, -10.638501418901088, 3.2083822171739436,
+    -1.3085013820925164, 1.004402088466431, -0.8761174541959508,
+    0.8181131692129571, -0.8016162714193873, 0.8174349880917816,
+    -0.8649191377128627, 0.949813050870213, -1.0858838576403715,
+    1.3010344239585732, -1.6539636566453348, 2.2851619741482128,
+    -3.6220895475846775, 7.818294517839338, 0.0, -9.81345379988346,
+    5.765869605900891, -4.726031468933481, 4.666388729255966,
+    -5.605987737207469, 13.31559263043276, -2.814419199283531,
+    1.1471076514642151, -0.8791864609844938, 0.764995311284404,
+    -0.711780372993178, 0.6939748163019858, -0.7029474557576015,
+    0.7371200098370341, -0.7996562383691784, 0.8989062053402775,
+    -1.0512661888192942, 1.2885102077238038, -1.676855835554779,
+    2.3749732040891107, -3.867554346661663, 8.605541861829039, 0.0,
+    -11.685874449122664, 7.265590294614323, -6.467144167240842,
+    7.416243134302505, -17.323618140356167, 2.4441077645284057,
+    -0.9956982960430948, 0.7622628232131885, -0.6620115619940383,
+    0.6142891562827792, -0.5967004131954102, 0.601423028380559,
+    -0.6265247599814459, 0.6737509979553681, -0.7484679642798875,
+    0.8611173537111537, -1.0309351664076836, 1.2947030584984538,
+    -1.7292507502688075, 2.520069389560443, -4.238688350371336,
+    9.796513611380533, 0.0, -14.820986614307062, 10.074353899079417,
+    -10.518974946004748, 23.829406632962492, -2.0793675617261838,
+    0.8468072439297333, -0.6477265222363755, 0.5617584359098707,
+    -0.5202229729092581, 0.5039565053945261, -0.5061193647479412,
+    0.5247575627432433, -0.5608193454100863, 0.6178995008802314,
+    -0.7030248284528928, 0.8287498425609013, -1.0178039090132591,
+    1.313829206578431, -1.8091334286030913, 2.7301545396451115,
+    -4.786358086763435, 11.646651147178263, 0.0, -20.82612469759418,
+    16.86785107830878, -35.74873646803687, 1.6960240696898117,
+    -0.690522065914559, 0.5278692341729392, -0.4573661003822141,
+    0.42296164141352466, -0.40896634063401677, 0.40970429842129136,
+    -0.4234213198009141, 0.45061910250722587, -0.49375161393798844,
+    0.5576676106666422, -0.6508785303206372, 0.7882799623600464,
+    -0.9970330393102561, 1.3302987284882992, -1.9034603197609083,
+    3.0082859573013376, -5.590021094526925, 14.705532523394714, 0.0,
+    -36.095021620357635, 62.55252479609443, -1.2480398020165613,
+    0.5080513754389462, -0.38823746953241056, 0.33618376955423807,
+    -0.31063035580113607, 0.3000064811449906, -0.3000937741332318,
+    0.30953329467466223, -0.32858050701047214, 0.35884466523237124,
+    -0.4035391761615596, 0.4682531195064365, -0.562581889477584,
+    0.7035195051342273, -0.9229360516732096, 1.285686083963386,
+    -1.939592158763661, 3.2816295288701287, -6.696562648035059,
+    20.293978351068702, 0.0, -156.2575548197275, 0.5, -0.20352674825055914,
+    0.1555052142199327, -0.13462214332639086, 0.12434534708840579,
+    -0.12003511232464, 0.11999467072329616, -0.12366860046271877,
+    0.13114102950956286, -0.1430254842125266, 0.16055375117181792,
+    -0.18586091528268003, 0.22258465897009388, -0.277093232914425,
+    0.3611303262357066, -0.4980080442478349, 0.7388531352671943,
+    -1.2123343666306017, 2.314440031247908, -5.735321769456578,
+    25.482033482150605, 115.5};
+inline constexpr std::array<double, 44> lift_matrix_21{
+    242.0, -4.442109032159727, 3.3308046124459785, -2.798886601784752,
+    2.481117199050004, -2.27170767012038, 2.127309179178913,
+    -2.026676526196028, 1.9582932985898782, -1.915636485650445,
+    1.8951122477176923, -1.8951122477176923, 1.915636485650445,
+    -1.9582932985898782, 2.026676526196028, -2.127309179178913,
+    2.27170767012038, -2.481117199050004, 2.798886601784752,
+    -3.3308046124459785, 4.442109032159727, -11.0, -11.0, 4.442109032159727,
+    -3.3308046124459785, 2.798886601784752, -2.481117199050004,
+    2.27170767012038, -2.127309179178913, 2.026676526196028,
+    -1.9582932985898782, 1.915636485650445, -1.8951122477176923,
+    1.8951122477176923, -1.915636485650445, 1.9582932985898782,
+    -2.026676526196028, 2.127309179178913, -2.27170767012038,
+    2.481117199050004, -2.798886601784752, 3.3308046124459785,
+    -4.442109032159727, 242.0};
+
+// Polynomial order 22
+inline constexpr std::array<double, 23> nodes_22{
+    -1.0, -0.9855271558787326, -0.9517579557107102, -0.899458558040345,
+    -0.8296510966512859, -0.7436950411720606, -0.6432636444601362,
+    -0.5303117711368441, -0.40703793791447485, -0.27584154894579305,
+    -0.1392762040406684, 0.0, 0.1392762040406684, 0.27584154894579305,
+    0.40703793791447485, 0.5303117711368441, 0.6432636444601362,
+    0.7436950411720606, 0.8296510966512859, 0.899458558040345,
+    0.9517579557107102, 0.9855271558787326, 1.0};
+inline constexpr std::array<double, 23> weights_22{
+    0.003952569169960474, 0.024248600771531736, 0.04317587117024183,
+    0.06125247712955421, 0.07813544947557, 0.09349724616351235,
+    0.1070391017243365, 0.11849751066274913, 0.12764947470175889,
+    0.1343168726386038, 0.13836993638580738, 0.13972978001274736,
+    0.13836993638580738, 0.1343168726386038, 0.12764947470175889,
+    0.11849751066274913, 0.1070391017243365, 0.09349724616351235,
+    0.07813544947557, 0.06125247712955421, 0.04317587117024183,
+    0.024248600771531736, 0.003952569169960474};
+inline constexpr std::array<double, 529> diff_matrix_22{
+    -126.5, -27.896037175998377, 6.271818499259924, -2.526578530600419,
+    1.320311299118038, -0.8022012251947022, 0.5386679548473123,
+    -0.38884404269079864, 0.2967586013137739, -0.23688679405741933,
+    0.19636092032992455, -0.16818809509277344, 0.1483507828259769,
+    -0.13445523388195135, 0.12506172537000032, -0.11934526882698784,
+    0.11693950858474296, -0.11791520142022476, 0.12292703362696927,
+    -0.13373592575399418, 0.1550219610635626, -0.20333894525387392, 0.5,
+    171.13928675291385, 0.0, -22.19228457047299, 7.310326688678506,
+    -3.5738791811540453, 2.105862244728599, -1.3906297373161187,
+    0.9937377701278455, -0.7534224499106513, 0.598703860549515,
+    -0.49467880258399827, 0.4226980636897577, -0.37217385941203024,
+    0.3368495754033195, -0.3129812500601498, 0.2984253229674744,
+    -0.2922178937147186, 0.29450531041772027, -0.30690220210430486,
+    0.333790098879292, -0.38683810419167464, 0.5073426916929361,
+    -1.2474632809056807, -68.51018056437805, 39.51449523277222, 0.0,
+    -16.053215621683886, 6.087744782223695, -3.266077359179277,
+    2.058743148241018, -1.4322664358271362, 1.067671630957667,
+    -0.83880745287424, 0.687521158981061, -0.5840493584121292,
+    0.5119898314516947, -0.46184746520652264, 0.4280128550169299,
+    -0.40728395819574365, 0.39818303996035104, -0.40080708560422706,
+    0.41728506607009147, -0.45352529077507303, 0.5253436517130375,
+    -0.6887849863043992, 1.6933816795179724, 39.15407599639108,
+    -18.466039443956124, 22.77427637408542, 0.0, -12.683406924343432,
+    5.196329410018872, -2.9527052576189017, 1.9476374748206122,
+    -1.4067472722311203, 1.0828756565171882, -0.8752319713094335,
+    0.7360989232326149, -0.6405253049516133, 0.5745763776625887,
+    -0.5302052981368113, 0.5028528716892802, -0.4903462639465492,
+    0.4925884860055666, -0.5120533777314029, 0.5558899801780224,
+    -0.6434044466952439, 0.8431608318480296, -2.0724891536125107,
+    -26.100268551478194, 11.515990502787838, -11.017002366346,
+    16.179324451140666, 0.0, -10.635261434272842, 4.583910796979189,
+    -2.7127243650760806, 1.8512775135716921, -1.377204182523413,
+    1.0884743469149596, -0.9013305224204674, 0.7755539139254095,
+    -0.6899266390048787, 0.6326361889217187, -0.597093568495116,
+    0.580063075392781, -0.5810324250359344, 0.6026629772661617,
+    -0.6531902495943706, 0.7551615129725915, -0.988920628138467,
+    2.430054633360863, 18.975912172449167, -8.119739466080508,
+    7.072682740695439, -7.931801500331735, 12.72620382947203, 0.0,
+    -9.305906384664118, 4.162789303717831, -2.5421554960531574,
+    1.7832993386433613, -1.3600051349878342, 1.0999173088968657,
+    -0.9309620518661694, 0.81833534113047, -0.7437300580461144,
+    0.6972251525759948, -0.673852210281394, 0.6723185880223187,
+    -0.6952661312782573, 0.7518988470615263, -0.8679467890539493,
+    1.1355473977250792, -2.789260893242544, -14.587609105679068,
+    6.138571017599574, -5.103915944161291, 5.159871620600254,
+    -6.279578570115604, 10.653745441905276, 0.0, -8.414400441573905,
+    3.876453290701299, -2.4296329709823876, 1.7451414887477446,
+    -1.360622766016147, 1.123941986812306, -0.9712716715493745,
+    0.8718618850567049, -0.8098519107820972, 0.7772862718203649,
+    -0.7714509062367183, 0.7946384253271928, -0.8568832818909544,
+    0.987152170043471, -1.289919412081001, 3.1668262886140446,
+    11.657493927009545, -4.856175130317118, 3.930899427185157,
+    -3.76785075894293, 4.114023615826359, -5.27587913168491, 9.315152033075654,
+    0.0, -7.815813664009647, 3.691070656701034, -2.3665597939350436,
+    1.736516278099494, -1.3820574523356188, 1.1651227461759985,
+    -1.0278824443113905, 0.9428416022675417, -0.8965455977040447,
+    0.8836564534448652, -0.9055313813934234, 0.9728065919483275,
+    -1.1178033904346691, 1.4583380799394003, -3.5779556681397873,
+    -9.583913131445778, 3.966166166276973, -3.156571463453183,
+    2.9316455228190637, -3.0244223808873265, 3.47074194157404,
+    -4.622864152375645, 8.41945542144872, 0.0, -7.430573742248436,
+    3.58707232852712, -2.3481732636151857, 1.758110640848168,
+    -1.427579040967704, 1.2283867262148374, -1.1072692863982303,
+    1.0397388416673348, -1.0153962295687866, 1.033534429445233,
+    -1.1049418890946001, 1.2654201207216813, -1.6475957742098732,
+    4.038908077840372, 8.049927016835923, -3.3163163080353644,
+    2.6094666016530526, -2.3745728900437406, 2.367449858200234,
+    -2.5618635839409696, 3.0487989628541214, -4.183826854449287,
+    7.818688085487161, 0.0, -7.21446131751884, 3.5543575640488765,
+    -2.373411859751932, 1.8126348329716542, -1.5021444676932711,
+    1.3206660851455159, -1.2187898749464197, 1.175609424881489,
+    -1.186001861167668, 1.2599539766599794, -1.4367725648894891,
+    1.8658635994755348, -4.569080450803685, -6.874123357841694,
+    2.822788625614848, -2.2033662889395065, 1.9771574615139573,
+    -1.9275773947815704, 2.012720499634111, -2.2559523846168137,
+    2.7634397238265525, -3.888327555356156, 7.432160487006755, 0.0,
+    -7.144954399207209, 3.5899887094424323, -2.445030483510588,
+    1.9057630914796084, -1.6138330728776, 1.452924947156929,
+    -1.3777642142426434, 1.373427124997543, -1.4469528393471465,
+    1.6408238788932454, -2.123737931788715, 5.193403960751033,
+    5.945724038603296, -2.4357490977593095, 1.8901549906365434,
+    -1.6791964248787283, 1.611851169499756, -1.6438046029247728,
+    1.7761688645836822, -2.047663585254322, 2.5703962693412,
+    -3.6975965175089462, 7.215172113822963, 0.0, -7.215172113822963,
+    3.6975965175089462, -2.5703962693412, 2.047663585254322,
+    -1.7761688645836822, 1.6438046029247728, -1.611851169499756,
+    1.6791964248787283, -1.8901549906365434, 2.4357490977593095,
+    -5.945724038603296, -5.193403960751033, 2.123737931788715,
+    -1.6408238788932454, 1.4469528393471465, -1.373427124997543,
+    1.3777642142426434, -1.452924947156929, 1.6138330728776,
+    -1.9057630914796084, 2.445030483510588, -3.5899887094424323,
+    7.144954399207209, 0.0, -7.432160487006755, 3.888327555356156,
+    -2.7634397238265525, 2.2559523846168137, -2.012720499634111,
+    1.9275773947815704, -1.9771574615139573, 2.2033662889395065,
+    -2.822788625614848, 6.874123357841694, 4.569080450803685,
+    -1.8658635994755348, 1.4367725648894891, -1.2599539766599794,
+    1.186001861167668, -1.175609424881489, 1.2187898749464197,
+    -1.3206660851455159, 1.5021444676932711, -1.8126348329716542,
+    2.373411859751932, -3.5543575640488765, 7.21446131751884, 0.0,
+    -7.818688085487161, 4.183826854449287, -3.0487989628541214,
+    2.5618635839409696, -2.367449858200234, 2.3745728900437406,
+    -2.6094666016530526, 3.3163163080353644, -8.049927016835923,
+    -4.038908077840372, 1.6475957742098732, -1.2654201207216813,
+    1.1049418890946001, -1.033534429445233, 1.0153962295687866,
+    -1.0397388416673348, 1.1072692863982303, -1.2283867262148374,
+    1.427579040967704, -1.758110640848168, 2.3481732636151857,
+    -3.58707232852712, 7.430573742248436, 0.0, -8.41945542144872,
+    4.622864152375645, -3.47074194157404, 3.0244223808873265,
+    -2.9316455228190637, 3.156571463453183, -3.966166166276973,
+    9.583913131445778, 3.5779556681397873, -1.4583380799394003,
+    1.1178033904346691, -0.9728065919483275, 0.9055313813934234,
+    -0.8836564534448652, 0.8965455977040447, -0.9428416022675417,
+    1.0278824443113905, -1.1651227461759985, 1.3820574523356188,
+    -1.736516278099494, 2.3665597939350436, -3.691070656701034,
+    7.815813664009647, 0.0, -9.315152033075654, 5.27587913168491,
+    -4.114023615826359, 3.76785075894293, -3.930899427185157,
+    4.856175130317118, -11.657493927009545, -3.1668262886140446,
+    1.289919412081001, -0.987152170043471, 0.8568832818909544,
+    -0.7946384253271928, 0.7714509062367183, -0.7772862718203649,
+    0.8098519107820972, -0.8718618850567049, 0.9712716715493745,
+    -1.123941986812306, 1.360622766016147, -1.7451414887477446,
+    2.4296329709823876, -3.876453290701299, 8.414400441573905, 0.0,
+    -10.653745441905276, 6.279578570115604, -5.159871620600254,
+    5.103915944161291, -6.138571017599574, 14.587609105679068,
+    2.789260893242544, -1.1355473977250792, 0.8679467890539493,
+    -0.7518988470615263, 0.6952661312782573, -0.6723185880223187,
+    0.673852210281394, -0.6972251525759948, 0.7437300580461144,
+    -0.81833534113047, 0.9309620518661694, -1.0999173088968657,
+    1.3600051349878342, -1.7832993386433613, 2.5421554960531574,
+    -4.162789303717831, 9.305906384664118, 0.0, -12.72620382947203,
+    7.931801500331735, -7.072682740695439, 8.119739466080508,
+    -18.975912172449167, -2.430054633360863, 0.988920628138467,
+    -0.7551615129725915, 0.6531902495943706, -0.6026629772661617,
+    0.5810324250359344, -0.580063075392781, 0.597093568495116,
+    -0.6326361889217187, 0.6899266390048787, -0.7755539139254095,
+    0.9013305224204674, -1.0884743469149596, 1.377204182523413,
+    -1.8512775135716921, 2.7127243650760806, -4.583910796979189,
+    10.635261434272842, 0.0, -16.179324451140666, 11.017002366346,
+    -11.515990502787838, 26.100268551478194, 2.0724891536125107,
+    -0.8431608318480296, 0.6434044466952439, -0.5558899801780224,
+    0.5120533777314029, -0.4925884860055666, 0.4903462639465492,
+    -0.5028528716892802, 0.5302052981368113, -0.5745763776625887,
+    0.6405253049516133, -0.7360989232326149, 0.8752319713094335,
+    -1.0828756565171882, 1.4067472722311203, -1.9476374748206122,
+    2.9527052576189017, -5.196329410018872, 12.683406924343432, 0.0,
+    -22.77427637408542, 18.466039443956124, -39.15407599639108,
+    -1.6933816795179724, 0.6887849863043992, -0.5253436517130375,
+    0.45352529077507303, -0.41728506607009147, 0.40080708560422706,
+    -0.39818303996035104, 0.40728395819574365, -0.4280128550169299,
+    0.46184746520652264, -0.5119898314516947, 0.5840493584121292,
+    -0.687521158981061, 0.83880745287424, -1.067671630957667,
+    1.4322664358271362, -2.058743148241018, 3.266077359179277,
+    -6.087744782223695, 16.053215621683886, 0.0, -39.51449523277222,
+    68.51018056437805, 1.2474632809056807, -0.5073426916929361,
+    0.38683810419167464, -0.333790098879292, 0.30690220210430486,
+    -0.29450531041772027, 0.2922178937147186, -0.2984253229674744,
+    0.3129812500601498, -0.3368495754033195, 0.37217385941203024,
+    -0.4226980636897577, 0.49467880258399827, -0.598703860549515,
+    0.7534224499106513, -0.9937377701278455, 1.3906297373161187,
+    -2.105862244728599, 3.5738791811540453, -7.310326688678506,
+    22.19228457047299, 0.0, -171.13928675291385, -0.5, 0.20333894525387392,
+    -0.1550219610635626, 0.13373592575399418, -0.12292703362696927,
+    0.11791520142022476, -0.11693950858474296, 0.11934526882698784,
+    -0.12506172537000032, 0.13445523388195135, -0.1483507828259769,
+    0.16818809509277344, -0.19636092032992455, 0.23688679405741933,
+    -0.2967586013137739, 0.38884404269079864, -0.5386679548473123,
+    0.8022012251947022, -1.320311299118038, 2.526578530600419,
+    -6.271818499259924, 27.896037175998377, 126.5};
+inline constexpr std::array<double, 46> lift_matrix_22{
+    264.5, -4.642952472967014, 3.4795014768803694, -2.9212972599450326,
+    2.586506191662249, -2.364493747945382, 2.209868095170934,
+    -2.1003079017274513, 2.0236158100312633, -1.9727510993879034,
+    1.9436439423310663, -1.9341630935668945, 1.9436439423310663,
+    -1.9727510993879034, 2.0236158100312633, -2.1003079017274513,
+    2.209868095170934, -2.364493747945382, 2.586506191662249,
+    -2.9212972599450326, 3.4795014768803694, -4.642952472967014, 11.5, 11.5,
+    -4.642952472967014, 3.4795014768803694, -2.9212972599450326,
+    2.586506191662249, -2.364493747945382, 2.209868095170934,
+    -2.1003079017274513, 2.0236158100312633, -1.9727510993879034,
+    1.9436439423310663, -1.9341630935668945, 1.9436439423310663,
+    -1.9727510993879034, 2.0236158100312633, -2.1003079017274513,
+    2.209868095170934, -2.364493747945382, 2.586506191662249,
+    -2.9212972599450326, 3.4795014768803694, -4.642952472967014, 264.5};
+
+// Polynomial order 23
+inline constexpr std::array<double, 24> nodes_23{
+    -1.0, -0.9867305535051609, -0.9557482209298863, -0.9077056751135065,
+    -0.843464070154872, -0.7641704824204933, -0.6712401052641287,
+    -0.5663313579792953, -0.4513163732143226, -0.3282476133755109,
+    -0.19932125339083268, -0.06683799373722858, 0.06683799373722858,
+    0.19932125339083268, 0.3282476133755109, 0.4513163732143226,
+    0.5663313579792953, 0.6712401052641287, 0.7641704824204933,
+    0.843464070154872, 0.9077056751135065, 0.9557482209298863,
+    0.9867305535051609, 1.0};
+inline constexpr std::array<double, 24> weights_23{
+    0.0036231884057971015, 0.022236853464711208, 0.03963168133346781,
+    0.0563098487246462, 0.07198186205529399, 0.08636902996792907,
+    0.09921482768408359, 0.1102900868929686, 0.11939719370249131,
+    0.1263736420280208, 0.13109494187360393, 0.13347684386698638,
+    0.13347684386698638, 0.13109494187360393, 0.1263736420280208,
+    0.11939719370249131, 0.1102900868929686, 0.09921482768408359,
+    0.08636902996792907, 0.07198186205529399, 0.0563098487246462,
+    0.03963168133346781, 0.022236853464711208, 0.0036231884057971015};
+inline constexpr std::array<double, 576> diff_matrix_23{
+    -138.0, -30.419774074200568, 6.832717653681546, -2.748389503734867,
+    1.4332431774779584, -0.8684969055564368, 0.5812705700626587,
+    -0.4179450630047073, 0.3174873300912318, -0.25206235525905346,
+    0.20763195379685936, -0.17655720550350798, 0.1544343912337105,
+    -0.1386171487014462, 0.12747885787135183, -0.12002903222758148,
+    0.11571604372802523, -0.11434530013068211, 0.11609830699335458,
+    -0.12170242811504847, 0.13296639889549094, -0.15460063254738382,
+    0.20317479073875327, -0.5, 186.69745615086288, 0.0, -24.176938568101257,
+    7.952078353246883, -3.879542625005414, 2.2798716319230543,
+    -1.500590389711169, 1.068086808625945, -0.8060272753935862,
+    0.6370358718134856, -0.5230499434519732, 0.44370732294913634,
+    -0.3874100704351736, 0.34724822938065236, -0.31899940577330094,
+    0.3001003826289584, -0.2891210142865129, 0.28554301137487115,
+    -0.28979844208982314, 0.30368815518677755, -0.33171453086306846,
+    0.3856196326195387, -0.5067239462929886, 1.2469591816291616,
+    -74.73861647906566, 43.08940230551905, 0.0, -17.462364745705585,
+    6.6083228366390925, -3.5358772948893087, 2.221458979337685,
+    -1.5393531165260514, 1.142146177602918, -0.8924396291252276,
+    0.7268775863598612, -0.6129998682845195, 0.5328664169047543,
+    -0.47601449146220753, 0.4361434784440934, -0.40945874775558505,
+    0.39383621587012835, -0.3884619809895148, 0.39385313647793146,
+    -0.41240820854541343, 0.450205105765794, -0.5231503329543524,
+    0.6872714442337565, -1.691074908847449, 42.71414562491356,
+    -20.136856584879283, 24.811037132933983, 0.0, -13.767790833463485,
+    5.625417535921384, -3.1859281269308912, 2.0931150310328,
+    -1.5047337604147322, 1.1519719915613607, -0.9251884676520243,
+    0.7724343082748865, -0.6664812122586117, 0.5920263371801051,
+    -0.5400846970702778, 0.5053224789875919, -0.48474746452125944,
+    0.4771299429000615, -0.4829576558996482, 0.5050709574364648,
+    -0.5508393455152477, 0.6396645448228064, -0.8399927211963103,
+    2.0664997148054325, -28.47423350324306, 12.558283145317274,
+    -12.002503220626844, 17.599607227265487, 0.0, -11.513157584222498,
+    4.945721579967281, -2.9151137571851637, 1.9799982666151255,
+    -1.4648513680000654, 1.1503669679987265, -0.9455763586809985,
+    0.8067204135030401, -0.7105974761511203, 0.6441136861035863,
+    -0.599678319344219, 0.5730429860297266, -0.5623354009122328,
+    0.5678651093569832, -0.5927934783377232, 0.645641016798084,
+    -0.7490449503821068, 0.9830545013561446, -2.4178614002946035,
+    20.703100932603885, -8.855133286419347, 7.705711233283494,
+    -8.628363718715717, 13.8143168851808, 0.0, -10.039984215524102,
+    4.472996931000907, -2.7185673561520525, 1.8964487765967868,
+    -1.4369892293881186, 1.1535492922273782, -0.9679894030528073,
+    0.8424382152694989, -0.7567664750999286, 0.6997319342311801,
+    -0.665112793975152, 0.650001837660681, -0.6543042573644835,
+    0.6813655169147914, -0.7407688921277522, 0.8583212269296077,
+    -1.1255913688164492, 2.7675342910380243, -15.917102007260418,
+    6.695228584199289, -5.561249546486582, 5.613428508270417,
+    -6.816841080784728, 11.533246399363579, 0.0, -9.040830990874683,
+    4.144948460739754, -2.5833034673654716, 1.8434357135583972,
+    -1.4264591982471369, 1.1681080262292853, -0.9993001145706792,
+    0.8865078350158818, -0.8120504866495093, 0.7663898868359769,
+    -0.7448899374140542, 0.7466776035552186, -0.7750842824725725,
+    0.8406764738301767, -0.9724843158028107, 1.2740157106719545,
+    -3.1311507927103235, 12.722274459016289, -5.297484516841865,
+    4.283830089167825, -4.099635212632808, 4.466516152859013,
+    -5.7118531998710225, 10.050050570497268, 0.0, -8.356352534717027,
+    3.9238305482680866, -2.4991783517244035, 1.8198498279391666,
+    -1.435639470717228, 1.1979632729394496, -1.0442904428074977,
+    0.9444385616070907, -0.8828753572538, 0.8519412792024847,
+    -0.8493246695995459, 0.8780123064067992, -0.9494403056315763,
+    1.0959976717726017, -1.433979040193169, 3.5224037748781503,
+    -10.462358564721132, 4.327833291809173, -3.440909994617259,
+    3.1905784215733526, -3.2842473064679, 3.758167867999493, -4.98811745991855,
+    9.046370987105657, 0.0, -7.898070108353731, 3.7871452466648368,
+    -2.459926733116644, 1.825302852401711, -1.4667797883158948,
+    1.2468581284867668, -1.1078702871755959, 1.0224247442087486,
+    -0.9772384986588848, 0.9673146650164047, -0.9946937521416935,
+    1.0714659561764555, -1.2335642540017204, 1.6113405420332407,
+    -3.955391772580557, 8.79171444722029, -3.620320804439456,
+    2.8457244918209157, -2.585318543471123, 2.571739562137127,
+    -2.7748504169505246, 3.2904503818128505, -4.496041040992753,
+    8.359558994932051, 0.0, -7.6154147702298145, 3.7222344239408076,
+    -2.4628279731011045, 1.8610417861032145, -1.5232403211048076,
+    1.319712783046984, -1.196578861350518, 1.12917823285506,
+    -1.1072873651423112, 1.1308264341713705, -1.212087613769383,
+    1.3907318075654014, -1.8128966301964178, 4.446351044013943,
+    -7.512581700292179, 3.083583837193702, -2.4043889062208903,
+    2.153930993174283, -2.0950734879192496, 2.1811292724901645,
+    -2.4357760161229662, 2.9706173055156744, -4.158184715928234,
+    7.89992549573985, 0.0, -7.480471938509238, 3.7234750130029695,
+    -2.5085132242249704, 1.9305700212347512, -1.6104851808308214,
+    1.4239441644933712, -1.3203993142140484, 1.2786920138372104,
+    -1.2941556688267075, 1.3782963374628772, -1.574575945041565,
+    2.0471640251895553, -5.015473946269422, 6.504298400512953,
+    -2.6633558188395217, 2.0645424306134674, -1.8309779887223174,
+    1.7533937632097518, -1.7827237243335954, 1.9190606498186178,
+    -2.202444645645523, 2.750008155958736, -3.931453545752101,
+    7.616386801181481, 0.0, -7.480775110721215, 3.791127909667225,
+    -2.6012584551766995, 2.040547656815693, -1.7374601007266335,
+    1.5714926516149408, -1.4959548632670019, 1.4959114921859213,
+    -1.5798268104738449, 1.7946583424683797, -2.3254312291096184,
+    5.689302574885038, -5.689302574885038, 2.3254312291096184,
+    -1.7946583424683797, 1.5798268104738449, -1.4959114921859213,
+    1.4959548632670019, -1.5714926516149408, 1.7374601007266335,
+    -2.040547656815693, 2.6012584551766995, -3.791127909667225,
+    7.480775110721215, 0.0, -7.616386801181481, 3.931453545752101,
+    -2.750008155958736, 2.202444645645523, -1.9190606498186178,
+    1.7827237243335954, -1.7533937632097518, 1.8309779887223174,
+    -2.0645424306134674, 2.6633558188395217, -6.504298400512953,
+    5.015473946269422, -2.0471640251895553, 1.574575945041565,
+    -1.3782963374628772, 1.2941556688267075, -1.2786920138372104,
+    1.3203993142140484, -1.4239441644933712, 1.6104851808308214,
+    -1.9305700212347512, 2.5085132242249704, -3.7234750130029695,
+    7.480471938509238, 0.0, -7.89992549573985, 4.158184715928234,
+    -2.9706173055156744, 2.4357760161229662, -2.1811292724901645,
+    2.0950734879192496, -2.153930993174283, 2.4043889062208903,
+    -3.083583837193702, 7.512581700292179, -4.446351044013943,
+    1.8128966301964178, -1.3907318075654014, 1.212087613769383,
+    -1.1308264341713705, 1.1072873651423112, -1.12917823285506,
+    1.196578861350518, -1.319712783046984, 1.5232403211048076,
+    -1.8610417861032145, 2.4628279731011045, -3.7222344239408076,
+    7.6154147702298145, 0.0, -8.359558994932051, 4.496041040992753,
+    -3.2904503818128505, 2.7748504169505246, -2.571739562137127,
+    2.585318543471123, -2.8457244918209157, 3.620320804439456,
+    -8.79171444722029, 3.955391772580557, -1.6113405420332407,
+    1.2335642540017204, -1.0714659561764555, 0.9946937521416935,
+    -0.9673146650164047, 0.9772384986588848, -1.0224247442087486,
+    1.1078702871755959, -1.2468581284867668, 1.4667797883158948,
+    -1.825302852401711, 2.459926733116644, -3.7871452466648368,
+    7.898070108353731, 0.0, -9.046370987105657, 4.98811745991855,
+    -3.758167867999493, 3.2842473064679, -3.1905784215733526,
+    3.440909994617259, -4.327833291809173, 10.462358564721132,
+    -3.5224037748781503, 1.433979040193169, -1.0959976717726017,
+    0.9494403056315763, -0.8780123064067992, 0.8493246695995459,
+    -0.8519412792024847, 0.8828753572538, -0.9444385616070907,
+    1.0442904428074977, -1.1979632729394496, 1.435639470717228,
+    -1.8198498279391666, 2.4991783517244035, -3.9238305482680866,
+    8.356352534717027, 0.0, -10.050050570497268, 5.7118531998710225,
+    -4.466516152859013, 4.099635212632808, -4.283830089167825,
+    5.297484516841865, -12.722274459016289, 3.1311507927103235,
+    -1.2740157106719545, 0.9724843158028107, -0.8406764738301767,
+    0.7750842824725725, -0.7466776035552186, 0.7448899374140542,
+    -0.7663898868359769, 0.8120504866495093, -0.8865078350158818,
+    0.9993001145706792, -1.1681080262292853, 1.4264591982471369,
+    -1.8434357135583972, 2.5833034673654716, -4.144948460739754,
+    9.040830990874683, 0.0, -11.533246399363579, 6.816841080784728,
+    -5.613428508270417, 5.561249546486582, -6.695228584199289,
+    15.917102007260418, -2.7675342910380243, 1.1255913688164492,
+    -0.8583212269296077, 0.7407688921277522, -0.6813655169147914,
+    0.6543042573644835, -0.650001837660681, 0.665112793975152,
+    -0.6997319342311801, 0.7567664750999286, -0.8424382152694989,
+    0.9679894030528073, -1.1535492922273782, 1.4369892293881186,
+    -1.8964487765967868, 2.7185673561520525, -4.472996931000907,
+    10.039984215524102, 0.0, -13.8143168851808, 8.628363718715717,
+    -7.705711233283494, 8.855133286419347, -20.703100932603885,
+    2.4178614002946035, -0.9830545013561446, 0.7490449503821068,
+    -0.645641016798084, 0.5927934783377232, -0.5678651093569832,
+    0.5623354009122328, -0.5730429860297266, 0.599678319344219,
+    -0.6441136861035863, 0.7105974761511203, -0.8067204135030401,
+    0.9455763586809985, -1.1503669679987265, 1.4648513680000654,
+    -1.9799982666151255, 2.9151137571851637, -4.945721579967281,
+    11.513157584222498, 0.0, -17.599607227265487, 12.002503220626844,
+    -12.558283145317274, 28.47423350324306, -2.0664997148054325,
+    0.8399927211963103, -0.6396645448228064, 0.5508393455152477,
+    -0.5050709574364648, 0.4829576558996482, -0.4771299429000615,
+    0.48474746452125944, -0.5053224789875919, 0.5400846970702778,
+    -0.5920263371801051, 0.6664812122586117, -0.7724343082748865,
+    0.9251884676520243, -1.1519719915613607, 1.5047337604147322,
+    -2.0931150310328, 3.1859281269308912, -5.625417535921384,
+    13.767790833463485, 0.0, -24.811037132933983, 20.136856584879283,
+    -42.71414562491356, 1.691074908847449, -0.6872714442337565,
+    0.5231503329543524, -0.450205105765794, 0.41240820854541343,
+    -0.39385313647793146, 0.3884619809895148, -0.39383621587012835,
+    0.40945874775558505, -0.4361434784440934, 0.47601449146220753,
+    -0.5328664169047543, 0.6129998682845195, -0.7268775863598612,
+    0.8924396291252276, -1.142146177602918, 1.5393531165260514,
+    -2.221458979337685, 3.5358772948893087, -6.6083228366390925,
+    17.462364745705585, 0.0, -43.08940230551905, 74.73861647906566,
+    -1.2469591816291616, 0.5067239462929886, -0.3856196326195387,
+    0.33171453086306846, -0.30368815518677755, 0.28979844208982314,
+    -0.28554301137487115, 0.2891210142865129, -0.3001003826289584,
+    0.31899940577330094, -0.34724822938065236, 0.3874100704351736,
+    -0.44370732294913634, 0.5230499434519732, -0.6370358718134856,
+    0.8060272753935862, -1.068086808625945, 1.500590389711169,
+    -2.2798716319230543, 3.879542625005414, -7.952078353246883,
+    24.176938568101257, 0.0, -186.69745615086288, 0.5, -0.20317479073875327,
+    0.15460063254738382, -0.13296639889549094, 0.12170242811504847,
+    -0.11609830699335458, 0.11434530013068211, -0.11571604372802523,
+    0.12002903222758148, -0.12747885787135183, 0.1386171487014462,
+    -0.1544343912337105, 0.17655720550350798, -0.20763195379685936,
+    0.25206235525905346, -0.3174873300912318, 0.4179450630047073,
+    -0.5812705700626587, 0.8684969055564368, -1.4332431774779584,
+    2.748389503734867, -6.832717653681546, 30.419774074200568, 138.0};
+inline constexpr std::array<double, 48> lift_matrix_23{
+    288.0, -4.843842773552383, 3.628318944710172, -3.043929045268013,
+    2.692248641768376, -2.4578064750800266, 2.293181417122315,
+    -2.174996014950111, 2.0904011967955034, -2.031881864681508,
+    1.9949579102649828, -1.9770777132936233, 1.9770777132936233,
+    -1.9949579102649828, 2.031881864681508, -2.0904011967955034,
+    2.174996014950111, -2.293181417122315, 2.4578064750800266,
+    -2.692248641768376, 3.043929045268013, -3.628318944710172,
+    4.843842773552383, -12.0, -12.0, 4.843842773552383, -3.628318944710172,
+    3.043929045268013, -2.692248641768376, 2.4578064750800266,
+    -2.293181417122315, 2.174996014950111, -2.0904011967955034,
+    2.031881864681508, -1.9949579102649828, 1.9770777132936233,
+    -1.9770777132936233, 1.9949579102649828, -2.031881864681508,
+    2.0904011967955034, -2.174996014950111, 2.293181417122315,
+    -2.4578064750800266, 2.692248641768376, -3.043929045268013,
+    3.628318944710172, -4.843842773552383, 288.0};
+
+// Polynomial order 24
+inline constexpr std::array<double, 25> nodes_24{
+    -1.0, -0.9877899449314937, -0.9592641382525344, -0.9149827707346225,
+    -0.8556764658353165, -0.7823196592407168, -0.6961170488151344,
+    -0.5984841472799932, -0.49102411481887837, -0.37550145785922723,
+    -0.25381306416887656, -0.12795705948310698, 0.0, 0.12795705948310698,
+    0.25381306416887656, 0.37550145785922723, 0.49102411481887837,
+    0.5984841472799932, 0.6961170488151344, 0.7823196592407168,
+    0.8556764658353165, 0.9149827707346225, 0.9592641382525344,
+    0.9877899449314937, 1.0};
+inline constexpr std::array<double, 25> weights_24{
+    0.0033333333333333335, 0.020465168932974384, 0.03650473879427137,
+    0.051936228368491474, 0.06651372867531279, 0.07999877483629299,
+    0.09217013991062042, 0.10282803034795783, 0.11179746626832089,
+    0.11893117940681183, 0.1241120389379503, 0.12725497753833145,
+    0.12830838929866192, 0.12725497753833145, 0.1241120389379503,
+    0.11893117940681183, 0.11179746626832089, 0.10282803034795783,
+    0.09217013991062042, 0.07999877483629299, 0.06651372867531279,
+    0.051936228368491474, 0.03650473879427137, 0.020465168932974384,
+    0.0033333333333333335};
+inline constexpr std::array<double, 625> diff_matrix_24{
+    -150.0, -33.05324349781043, 7.418017302535164, -2.979869339460139,
+    1.5511241877168715, -0.9377314808136611, 0.6258033934988999,
+    -0.4484158109891081, 0.3392549443141678, -0.26807732479613816,
+    0.21962651801871338, -0.1855940772136374, 0.1611802577972412,
+    -0.1434859629408823, 0.1307072347473717, -0.12171117490252804,
+    0.11580804352406535, -0.11263549721703178, 0.11212137877559701,
+    -0.11452811353221806, 0.12063726022351232, -0.13229374106408562,
+    0.1542310306082022, -0.20303046824946167, 0.5, 202.93206358962826, 0.0,
+    -26.247933054682363, 8.621806815475926, -4.198603758694761,
+    2.461597114925064, -1.6155353660404583, 1.1459377781238074,
+    -0.8612712912006388, 0.6774912814613567, -0.5532460620309582,
+    0.4663975134822664, -0.40431098337247207, 0.3594219103405214,
+    -0.32705286305476217, 0.30427838896472836, -0.2893197728980692,
+    0.28123779046881064, -0.2798301098227544, 0.28573657883505743,
+    -0.3008962607985467, 0.3299024552632252, -0.38455196006456516,
+    0.5061804916779918, -1.2465158493798376, -81.2378352001295,
+    46.81974251904899, 0.0, -18.93295463240769, 7.151726550282095,
+    -3.8176484901609635, 2.391558058342128, -1.6514917964295188,
+    1.2203660275489607, -0.9490529259000966, 0.768777684388839,
+    -0.6442816387738876, 0.5560436522124679, -0.49262826014557753,
+    0.44707380709249533, -0.41507039248872146, 0.39400734035251544,
+    -0.3824913183604503, 0.380173187414365, -0.38787213346500016,
+    0.4081845463369676, -0.4473141282813461, 0.5212328701360988,
+    -0.6859444405740248, 1.6890490458971081, 46.42895235674029,
+    -21.880304491212108, 26.936400258076166, 0.0, -14.899740019879165,
+    6.073560428978984, -3.4297489475625893, 2.2454718754012624,
+    -1.6076655915262636, 1.224929052763174, -0.9783974268240444,
+    0.8117249480966456, -0.6953360737701948, 0.6125457922946455,
+    -0.5534642751797144, 0.5120762570527093, -0.4847655799901338,
+    0.4695766713572269, -0.4659267354524757, 0.4747164736966294,
+    -0.499050583132596, 0.5464583771326746, -0.6364052856205729,
+    0.8372219800379965, -2.061251384287929, -30.95131600905448,
+    13.645858098488889, -13.03085613093451, 19.08181044613902, 0.0,
+    -12.430069649980176, 5.324000444057059, -3.127100904392379,
+    2.1152448621313753, -1.5574289102334127, 1.2163281465645095,
+    -0.9934689573534538, 0.8414310482924402, -0.7349959321898509,
+    0.659820012750535, -0.6074170312844729, 0.5727546442260791,
+    -0.5530794361388394, 0.547427476045541, -0.5566742199885697,
+    0.5843330043112697, -0.6391244825524525, 0.7437356644988043,
+    -0.9779412188444572, 2.4072101983919403, 22.505210877154703,
+    -9.622434780749096, 8.366234413829797, -9.355269115138125,
+    14.950151839815302, 0.0, -10.807521970303037, 4.797958647221527,
+    -2.9039681287105794, 2.0160134710103965, -1.519092787229575,
+    1.2116740572912887, -1.0093223668232028, 0.8710254474041265,
+    -0.7748530071851802, 0.7083572428628516, -0.6643241159765745,
+    0.6387838591645139, -0.6301498068842328, 0.6391249332597327,
+    -0.6695347933270138, 0.7312186017992649, -0.8500073276844952,
+    1.1169502830679148, -2.7486326300667936, -17.304115900600394,
+    7.275978087753946, -6.038400715152012, 6.0867038344072375,
+    -7.377632792297173, 12.451825845188083, 0.0, -9.69712890147524,
+    4.42719289541472, -2.745760310252721, 1.9483515273709666,
+    -1.4979147153138528, 1.217545854833282, -1.0327411092073766,
+    0.9071863627322507, -0.8214990306829991, 0.7648508939817289,
+    -0.731313113310097, 0.7182700105550546, -0.726023567036187,
+    0.7585872580432065, -0.8268704475430638, 0.9598922504753659,
+    -1.2602867075292192, 3.1002729506155333, 13.832914386267639,
+    -5.757808548353883, 4.651989143648043, -4.445787794042569,
+    4.834394840013438, -6.167152414450697, 10.81843497184557, 0.0,
+    -8.924683235492235, 4.170006639444967, -2.640851340297573,
+    1.9104414788611008, -1.495807066877425, 1.2374221851487501,
+    -1.0679667603845187, 0.9546745767695192, -0.8802565189763848,
+    0.8354440168088216, -0.8158768890036721, 0.8210736500698889,
+    -0.8550425630434487, 0.9297102567869128, -1.0774170749133234,
+    1.4130901214660236, -3.4746258978270794, -11.378352957997278,
+    4.704967178195788, -3.737427915011408, 3.460646746702105,
+    -3.555341443534844, 4.058265636919646, -5.3699489755406775,
+    9.703161381182749, 0.0, -8.392685494558997, 4.001051193613809,
+    -2.5816166199639112, 1.9010153888193482, -1.5142624414598098,
+    1.2742295687111216, -1.1188883028133585, 1.0182799274215535,
+    -0.9570391278985184, 0.9277233614176666, -0.9283861296514415,
+    0.962696262758992, -1.0435021040124124, 1.206665868526738,
+    -1.5805008821214324, 3.88411375184458, 9.564825723068301,
+    -3.937169412376837, 3.0919816857995674, -2.805021879932568,
+    2.784791363005848, -2.997131647302579, 3.5429751151884905,
+    -4.823041014062128, 8.928216511300143, 0.0, -8.044364657552357,
+    3.905326696998428, -2.5639450238615042, 1.920201395685846,
+    -1.5555112414730805, 1.331552753085306, -1.190283732895169,
+    1.1041792104807417, -1.0600162774562953, 1.0530881567553292,
+    -1.0861039572009372, 1.1726271835798576, -1.3522850168504332,
+    1.7682818933036888, -4.342576073443925, -8.1774884868435,
+    3.355188369953725, -2.613758351681949, 2.338076971496943,
+    -2.2696211638450805, 2.3567573821575913, -2.6235598737766157,
+    3.187471774643984, -4.441769908655264, 8.394791883750758, 0.0,
+    -7.846854954696446, 3.8749442309438518, -2.586828441418557,
+    1.969953759619406, -1.6232721539720047, 1.4145868875793581,
+    -1.2890214049686153, 1.2215751140725888, -1.2021257424973244,
+    1.2311985622440098, -1.3226139407832467, 1.520001062511615,
+    -1.983428419631486, 4.866702422531281, 7.085331038120634,
+    -2.90011801497958, 2.2459562286580907, -1.9889014524591326,
+    1.9007184286748124, -1.927423954428236, 2.068100402543019,
+    -2.3642696126542537, 2.9385600224392707, -4.178654105551709,
+    8.045563988402979, 0.0, -7.782974571300737, 3.907560880343695,
+    -2.6523357284687914, 2.0545931411412495, -1.723629697587432,
+    1.5313736132422626, -1.4258570810735312, 1.3855502658828402,
+    -1.4062042935250407, 1.5008694987744764, -1.7172948019945977,
+    2.2349303480936227, -5.47779089733235, -6.204233779412134,
+    2.534867472737754, -1.9544055854557483, 1.7178269283187968,
+    -1.6231635883669684, 1.6188313812956812, -1.6949236236639376,
+    1.866461847058125, -2.1817687888021178, 2.7661010165947006,
+    -4.005959914518176, 7.847401732440989, 0.0, -7.847401732440989,
+    4.005959914518176, -2.7661010165947006, 2.1817687888021178,
+    -1.866461847058125, 1.6949236236639376, -1.6188313812956812,
+    1.6231635883669684, -1.7178269283187968, 1.9544055854557483,
+    -2.534867472737754, 6.204233779412134, 5.47779089733235,
+    -2.2349303480936227, 1.7172948019945977, -1.5008694987744764,
+    1.4062042935250407, -1.3855502658828402, 1.4258570810735312,
+    -1.5313736132422626, 1.723629697587432, -2.0545931411412495,
+    2.6523357284687914, -3.907560880343695, 7.782974571300737, 0.0,
+    -8.045563988402979, 4.178654105551709, -2.9385600224392707,
+    2.3642696126542537, -2.068100402543019, 1.927423954428236,
+    -1.9007184286748124, 1.9889014524591326, -2.2459562286580907,
+    2.90011801497958, -7.085331038120634, -4.866702422531281,
+    1.983428419631486, -1.520001062511615, 1.3226139407832467,
+    -1.2311985622440098, 1.2021257424973244, -1.2215751140725888,
+    1.2890214049686153, -1.4145868875793581, 1.6232721539720047,
+    -1.969953759619406, 2.586828441418557, -3.8749442309438518,
+    7.846854954696446, 0.0, -8.394791883750758, 4.441769908655264,
+    -3.187471774643984, 2.6235598737766157, -2.3567573821575913,
+    2.2696211638450805, -2.338076971496943, 2.613758351681949,
+    -3.355188369953725, 8.1774884868435, 4.342576073443925,
+    -1.7682818933036888, 1.3522850168504332, -1.1726271835798576,
+    1.0861039572009372, -1.0530881567553292, 1.0600162774562953,
+    -1.1041792104807417, 1.190283732895169, -1.331552753085306,
+    1.5555112414730805, -1.920201395685846, 2.5639450238615042,
+    -3.905326696998428, 8.044364657552357, 0.0, -8.928216511300143,
+    4.823041014062128, -3.5429751151884905, 2.997131647302579,
+    -2.784791363005848, 2.805021879932568, -3.0919816857995674,
+    3.937169412376837, -9.564825723068301, -3.88411375184458,
+    1.5805008821214324, -1.206665868526738, 1.0435021040124124,
+    -0.962696262758992, 0.9283861296514415, -0.9277233614176666,
+    0.9570391278985184, -1.0182799274215535, 1.1188883028133585,
+    -1.2742295687111216, 1.5142624414598098, -1.9010153888193482,
+    2.5816166199639112, -4.001051193613809, 8.392685494558997, 0.0,
+    -9.703161381182749, 5.3699489755406775, -4.058265636919646,
+    3.555341443534844, -3.460646746702105, 3.737427915011408,
+    -4.704967178195788, 11.378352957997278, 3.4746258978270794,
+    -1.4130901214660236, 1.0774170749133234, -0.9297102567869128,
+    0.8550425630434487, -0.8210736500698889, 0.8158768890036721,
+    -0.8354440168088216, 0.8802565189763848, -0.9546745767695192,
+    1.0679667603845187, -1.2374221851487501, 1.495807066877425,
+    -1.9104414788611008, 2.640851340297573, -4.170006639444967,
+    8.924683235492235, 0.0, -10.81843497184557, 6.167152414450697,
+    -4.834394840013438, 4.445787794042569, -4.651989143648043,
+    5.757808548353883, -13.832914386267639, -3.1002729506155333,
+    1.2602867075292192, -0.9598922504753659, 0.8268704475430638,
+    -0.7585872580432065, 0.726023567036187, -0.7182700105550546,
+    0.731313113310097, -0.7648508939817289, 0.8214990306829991,
+    -0.9071863627322507, 1.0327411092073766, -1.217545854833282,
+    1.4979147153138528, -1.9483515273709666, 2.745760310252721,
+    -4.42719289541472, 9.69712890147524, 0.0, -12.451825845188083,
+    7.377632792297173, -6.0867038344072375, 6.038400715152012,
+    -7.275978087753946, 17.304115900600394, 2.7486326300667936,
+    -1.1169502830679148, 0.8500073276844952, -0.7312186017992649,
+    0.6695347933270138, -0.6391249332597327, 0.6301498068842328,
+    -0.6387838591645139, 0.6643241159765745, -0.7083572428628516,
+    0.7748530071851802, -0.8710254474041265, 1.0093223668232028,
+    -1.2116740572912887, 1.519092787229575, -2.0160134710103965,
+    2.9039681287105794, -4.797958647221527, 10.807521970303037, 0.0,
+    -14.950151839815302, 9.355269115138125, -8.366234413829797,
+    9.622434780749096, -22.505210877154703, -2.4072101983919403,
+    0.9779412188444572, -0.7437356644988043, 0.6391244825524525,
+    -0.5843330043112697, 0.5566742199885697, -0.547427476045541,
+    0.5530794361388394, -0.5727546442260791, 0.6074170312844729,
+    -0.659820012750535, 0.7349959321898509, -0.8414310482924402,
+    0.9934689573534538, -1.2163281465645095, 1.5574289102334127,
+    -2.1152448621313753, 3.127100904392379, -5.324000444057059,
+    12.430069649980176, 0.0, -19.08181044613902, 13.03085613093451,
+    -13.645858098488889, 30.95131600905448, 2.061251384287929,
+    -0.8372219800379965, 0.6364052856205729, -0.5464583771326746,
+    0.499050583132596, -0.4747164736966294, 0.4659267354524757,
+    -0.4695766713572269, 0.4847655799901338, -0.5120762570527093,
+    0.5534642751797144, -0.6125457922946455, 0.6953360737701948,
+    -0.8117249480966456, 0.9783974268240444, -1.224929052763174,
+    1.6076655915262636, -2.2454718754012624, 3.4297489475625893,
+    -6.073560428978984, 14.899740019879165, 0.0, -26.936400258076166,
+    21.880304491212108, -46.42895235674029, -1.6890490458971081,
+    0.6859444405740248, -0.5212328701360988, 0.4473141282813461,
+    -0.4081845463369676, 0.38787213346500016, -0.380173187414365,
+    0.3824913183604503, -0.39400734035251544, 0.41507039248872146,
+    -0.44707380709249533, 0.49262826014557753, -0.5560436522124679,
+    0.6442816387738876, -0.768777684388839, 0.9490529259000966,
+    -1.2203660275489607, 1.6514917964295188, -2.391558058342128,
+    3.8176484901609635, -7.151726550282095, 18.93295463240769, 0.0,
+    -46.81974251904899, 81.2378352001295, 1.2465158493798376,
+    -0.5061804916779918, 0.38455196006456516, -0.3299024552632252,
+    0.3008962607985467, -0.28573657883505743, 0.2798301098227544,
+    -0.28123779046881064, 0.2893197728980692, -0.30427838896472836,
+    0.32705286305476217, -0.3594219103405214, 0.40431098337247207,
+    -0.4663975134822664, 0.5532460620309582, -0.6774912814613567,
+    0.8612712912006388, -1.1459377781238074, 1.6155353660404583,
+    -2.461597114925064, 4.198603758694761, -8.621806815475926,
+    26.247933054682363, 0.0, -202.93206358962826, -0.5, 0.20303046824946167,
+    -0.1542310306082022, 0.13229374106408562, -0.12063726022351232,
+    0.11452811353221806, -0.11212137877559701, 0.11263549721703178,
+    -0.11580804352406535, 0.12171117490252804, -0.1307072347473717,
+    0.1434859629408823, -0.1611802577972412, 0.1855940772136374,
+    -0.21962651801871338, 0.26807732479613816, -0.3392549443141678,
+    0.4484158109891081, -0.6258033934988999, 0.9377314808136611,
+    -1.5511241877168715, 2.979869339460139, -7.418017302535164,
+    33.05324349781043, 150.0};
+inline constexpr std::array<double, 50> lift_matrix_24{
+    312.5, -5.044774041262659, 3.7772415909547443, -3.1667529351718926,
+    2.7982965587452844, -2.551571353552813, 2.377137275974368,
+    -2.250575709030314, 2.158407319804696, -2.092673731452334,
+    2.0485304813455345, -2.0230750604487455, 2.014753222465515,
+    -2.0230750604487455, 2.0485304813455345, -2.092673731452334,
+    2.158407319804696, -2.250575709030314, 2.377137275974368,
+    -2.551571353552813, 2.7982965587452844, -3.1667529351718926,
+    3.7772415909547443, -5.044774041262659, 12.5, 12.5, -5.044774041262659,
+    3.7772415909547443, -3.1667529351718926, 2.7982965587452844,
+    -2.551571353552813, 2.377137275974368, -2.250575709030314,
+    2.158407319804696, -2.092673731452334, 2.0485304813455345,
+    -2.0230750604487455, 2.014753222465515, -2.0230750604487455,
+    2.0485304813455345, -2.092673731452334, 2.158407319804696,
+    -2.250575709030314, 2.377137275974368, -2.551571353552813,
+    2.7982965587452844, -3.1667529351718926, 3.7772415909547443,
+    -5.044774041262659, 312.5};
+
+// Polynomial order 25
+inline constexpr std::array<double, 26> nodes_25{
+    -1.0, -0.9887274123114757, -0.9623778747677173, -0.9214355468175573,
+    -0.8665243239591236, -0.7984771831074374, -0.7183258163626651,
+    -0.6272852994923169, -0.5267357420298785, -0.41820138706624677,
+    -0.30332751285925275, -0.1838554952700549, -0.06159641178191973,
+    0.06159641178191973, 0.1838554952700549, 0.30332751285925275,
+    0.41820138706624677, 0.5267357420298785, 0.6272852994923169,
+    0.7183258163626651, 0.7984771831074374, 0.8665243239591236,
+    0.9214355468175573, 0.9623778747677173, 0.9887274123114757, 1.0};
+inline constexpr std::array<double, 26> weights_25{
+    0.003076923076923077, 0.018896858024263465, 0.033732303685956,
+    0.04804839908118063, 0.0616350251425474, 0.07428705012229114,
+    0.08581286398000436, 0.09603780235390132, 0.10480688623073706,
+    0.11198719411986034, 0.11746988409380901, 0.12117184628844335,
+    0.12303696380008287, 0.12303696380008287, 0.12117184628844335,
+    0.11746988409380901, 0.11198719411986034, 0.10480688623073706,
+    0.09603780235390132, 0.08581286398000436, 0.07428705012229114,
+    0.0616350251425474, 0.04804839908118063, 0.033732303685956,
+    0.018896858024263465, 0.003076923076923077};
+inline constexpr std::array<double, 676> diff_matrix_25{
+    -162.5, -35.79644489892219, 8.027715891882597, -3.2210151415092447,
+    1.673949691159501, -1.0098980596770117, 0.6722566034046836,
+    -0.4802426096925187, 0.3620426236776273, -0.2849059087595635,
+    0.23230918949050403, -0.19524970937141226, 0.16851976973832314,
+    -0.14896391401953343, 0.13460424687832906, -0.12417709227433317,
+    0.11687893133135234, -0.11222756429383116, 0.1099951437516322,
+    -0.11019873423053818, 0.11316101403566536, -0.11970461023085163,
+    0.1317022023997509, -0.15390498257087323, 0.20290290241010217, -0.5,
+    219.8431095341984, 0.0, -28.405262163594376, 9.31950339514432,
+    -4.531049739566801, 2.6510203090363684, -1.735438992796027,
+    1.2272553699618503, -0.9191063054408299, 0.7200044130260698,
+    -0.5851773307128094, 0.490644757549766, -0.4227035493313649,
+    0.3731245122972044, -0.3367831682024967, 0.3104206143398139,
+    -0.2919701807969772, 0.28019121151216875, -0.2744915127508767,
+    0.27489797356132717, -0.28220452359597376, 0.29845452281653173,
+    -0.32831061137428524, 0.38361103666546953, -0.5057005538372659,
+    1.246123885355273, -88.00783887010662, 50.70551561276851, 0.0,
+    -20.46496503921253, 7.717933042095567, -4.111361435326379,
+    2.569001320313646, -1.7686304133129727, 1.3022615441981038,
+    -1.0085537438157148, 0.8130946954908251, -0.6777211463671893,
+    0.5812805048612899, -0.5113475117997447, 0.46030860145720665,
+    -0.42337684469666914, 0.39753692463751483, -0.3809783149501915,
+    0.3728179211192411, -0.3730402114165431, 0.3826862295688003,
+    -0.40450019006091475, 0.4447804121805752, -0.5195464412777379,
+    0.6847743666946654, -1.6872601235303, 50.29850181387255,
+    -23.69638475313492, 29.150360335332824, 0.0, -16.079204430126122,
+    6.5407090269318795, -3.684109525016056, 2.404634846769612,
+    -1.7154483249582089, 1.3016228552731193, -1.034693694469835,
+    0.8537474824482976, -0.7267824814664131, 0.635702649091339,
+    -0.5697206329686795, 0.5221846627269844, -0.488954184017208,
+    0.46754629386640634, -0.4567149312863636, 0.4563337747762695,
+    -0.46760214368006164, 0.49381912439982845, -0.5426315510910056,
+    0.6335466129709314, -0.8347842407263312, 2.0566259937514384,
+    -33.53152767314198, 14.7787195237298, -14.102060787983092,
+    20.625914458639055, 0.0, -13.385893027170871, 5.718653200951704,
+    -3.348579846958464, 2.256888473658305, -1.654773847016516,
+    1.286146178076015, -1.0447270825515695, 0.8793038981769496,
+    -0.7625907101016722, 0.6789949699039456, -0.6191839028698783,
+    0.5774563898124696, -0.5504104745099807, 0.5362871970824423,
+    -0.5347482694298634, 0.5470696238889867, -0.577017847249244,
+    0.6334561552577392, -0.739095070905268, 0.9734555868538841,
+    -2.3978489149086477, 24.382263027729987, -10.42165201853827,
+    9.054255999245719, -10.112511313812362, 16.133659456473957, 0.0,
+    -11.608321453120663, 5.137505258304453, -3.0981737730115397,
+    2.14177423984239, -1.6060416076098682, 1.2739365943007563,
+    -1.0544877283752205, 0.9034479552164202, -0.7970711725483792,
+    0.7217531158870031, -0.6694166593895984, 0.6352958002576208,
+    -0.6168623546946159, 0.6134104629311306, -0.6261919696366872,
+    0.659368410676119, -0.7229540327901802, 0.8427717057736548,
+    -1.1093982693944964, 2.732079324505948, -18.748685951978402,
+    7.880833419142214, -6.535378162040838, 6.579698712198448,
+    -7.961934113714273, 13.409380346277873, 0.0, -10.38294077768991,
+    4.722894921549352, -2.9166926646923197, 2.059522812758344,
+    -1.574532907208358, 1.2716627022854678, -1.0707968809739528,
+    0.9327849043598072, -0.8365836520811022, 0.7702153708092788,
+    -0.7267590770803444, 0.7024825255211232, -0.6960629683780741,
+    0.708582566312261, -0.7445162941363086, 0.8149971464854839,
+    -0.9489908907314716, 1.2483441629983063, -3.0733524221704926,
+    14.989469570260862, -6.237169613425939, 5.035392176359633,
+    -4.806317183579497, 5.217654227684519, -6.6417324927688846,
+    11.620108781037741, 0.0, -9.520199163911165, 4.429108373465496,
+    -2.7910615476960774, 2.0076840286270037, -1.5618008555360774,
+    1.2825037656452472, -1.097549206626999, 0.9716029151409208,
+    -0.885764801397459, 0.8294925122187491, -0.797085473555122,
+    0.7861860659817549, -0.7974755331137728, 0.8356262323121467,
+    -0.9128690891209116, 1.0614339938291504, -1.3950235333061174,
+    3.4331998595401703, -12.331982022899055, 5.097602461986253,
+    -4.046150502382047, 3.7418686338505514, -3.8377116411831085,
+    4.371016827516198, -5.7682716525798385, 10.389475875230323, 0.0,
+    -8.913402084385345, 4.227975606308105, -2.7123865387416854,
+    1.9842392828988134, -1.5687528297059319, 1.3088027502923165,
+    -1.1379428466666184, 1.0237827639238026, -0.949242589980989,
+    0.90523236919766, -0.8876216499016241, 0.8962985412781386,
+    -0.9359419883216961, 1.0198481565653683, -1.1837066120090283,
+    1.5540132857061477, -3.822722007941294, 10.369389325799549,
+    -4.266914312695604, 3.3482772164186807, -3.0337138000797674,
+    3.006626177270471, -3.2287092725219737, 3.806331737220442,
+    -5.164668568418469, 9.524058250284016, 0.0, -8.499622614431127,
+    4.102286374485293, -2.6753399876422543, 1.9884200228943667,
+    -1.5967826081508392, 1.3532161762583572, -1.1955962257982553,
+    1.0939220049691554, -1.032867395206563, 1.0051436841103147,
+    -1.0091408025856783, 1.04920409575759, -1.1396135598345003,
+    1.3197748118142487, -1.730283482690039, 4.253906660745944,
+    -8.869033408097271, 3.6376795086725817, -2.8315332544680074,
+    2.5296440815147343, -2.451259525194713, 2.5396286591699604,
+    -2.8192964886902248, 3.413923147661725, -4.738808892108922,
+    8.915748726499011, 0.0, -8.2413092213564, 4.042154760293108,
+    -2.677584161935743, 2.021018434186803, -1.64838327814993,
+    1.4194671866570638, -1.275431597204571, 1.1884287127502609,
+    -1.1452057429016893, 1.1413059843945903, -1.1800994829588662,
+    1.2766496486691343, -1.4743739217320757, 1.9296897685322059,
+    -4.740797306885947, 7.6890995258402, -3.14614900888361, 2.4344830800341266,
+    -2.1530406983505403, 2.0538891509744026, -2.0779563723652856,
+    2.2233153697422754, -2.533114820933546, 3.135909257180677,
+    -4.438736213609201, 8.501026981419813, 0.0, -8.117119209046114,
+    4.043120165498551, -2.719527089824421, 2.0847090889936464,
+    -1.7277430537622478, 1.5131643671883295, -1.3847887029872998,
+    1.317136660042064, -1.300126811361974, 1.3348753234633084,
+    -1.4367617295385484, 1.6535023406730078, -2.1595462186131584,
+    5.300829661566585, -6.738602262890019, 2.7522120995178927,
+    -2.120192830591894, 1.8610632523184631, -1.755282514107168,
+    1.74648163105352, -1.8232874491110151, 2.0008708093654626,
+    -2.329377253735504, 2.93931562264295, -4.233718733555188, 8.24206061783524,
+    0.0, -8.117355955250042, 4.105353220893147, -2.804479021539494,
+    2.1846173064606407, -1.8416212146106132, 1.6430547713460268,
+    -1.535289593787861, 1.496323964651099, -1.5222975147014117,
+    1.6278362093130114, -1.8651155842866827, 2.429404245588814,
+    -5.956622001440498, 5.956622001440498, -2.429404245588814,
+    1.8651155842866827, -1.6278362093130114, 1.5222975147014117,
+    -1.496323964651099, 1.535289593787861, -1.6430547713460268,
+    1.8416212146106132, -2.1846173064606407, 2.804479021539494,
+    -4.105353220893147, 8.117355955250042, 0.0, -8.24206061783524,
+    4.233718733555188, -2.93931562264295, 2.329377253735504,
+    -2.0008708093654626, 1.8232874491110151, -1.74648163105352,
+    1.755282514107168, -1.8610632523184631, 2.120192830591894,
+    -2.7522120995178927, 6.738602262890019, -5.300829661566585,
+    2.1595462186131584, -1.6535023406730078, 1.4367617295385484,
+    -1.3348753234633084, 1.300126811361974, -1.317136660042064,
+    1.3847887029872998, -1.5131643671883295, 1.7277430537622478,
+    -2.0847090889936464, 2.719527089824421, -4.043120165498551,
+    8.117119209046114, 0.0, -8.501026981419813, 4.438736213609201,
+    -3.135909257180677, 2.533114820933546, -2.2233153697422754,
+    2.0779563723652856, -2.0538891509744026, 2.1530406983505403,
+    -2.4344830800341266, 3.14614900888361, -7.6890995258402, 4.740797306885947,
+    -1.9296897685322059, 1.4743739217320757, -1.2766496486691343,
+    1.1800994829588662, -1.1413059843945903, 1.1452057429016893,
+    -1.1884287127502609, 1.275431597204571, -1.4194671866570638,
+    1.64838327814993, -2.021018434186803, 2.677584161935743,
+    -4.042154760293108, 8.2413092213564, 0.0, -8.915748726499011,
+    4.738808892108922, -3.413923147661725, 2.8192964886902248,
+    -2.5396286591699604, 2.451259525194713, -2.5296440815147343,
+    2.8315332544680074, -3.6376795086725817, 8.869033408097271,
+    -4.253906660745944, 1.730283482690039, -1.3197748118142487,
+    1.1396135598345003, -1.04920409575759, 1.0091408025856783,
+    -1.0051436841103147, 1.032867395206563, -1.0939220049691554,
+    1.1955962257982553, -1.3532161762583572, 1.5967826081508392,
+    -1.9884200228943667, 2.6753399876422543, -4.102286374485293,
+    8.499622614431127, 0.0, -9.524058250284016, 5.164668568418469,
+    -3.806331737220442, 3.2287092725219737, -3.006626177270471,
+    3.0337138000797674, -3.3482772164186807, 4.266914312695604,
+    -10.369389325799549, 3.822722007941294, -1.5540132857061477,
+    1.1837066120090283, -1.0198481565653683, 0.9359419883216961,
+    -0.8962985412781386, 0.8876216499016241, -0.90523236919766,
+    0.949242589980989, -1.0237827639238026, 1.1379428466666184,
+    -1.3088027502923165, 1.5687528297059319, -1.9842392828988134,
+    2.7123865387416854, -4.227975606308105, 8.913402084385345, 0.0,
+    -10.389475875230323, 5.7682716525798385, -4.371016827516198,
+    3.8377116411831085, -3.7418686338505514, 4.046150502382047,
+    -5.097602461986253, 12.331982022899055, -3.4331998595401703,
+    1.3950235333061174, -1.0614339938291504, 0.9128690891209116,
+    -0.8356262323121467, 0.7974755331137728, -0.7861860659817549,
+    0.797085473555122, -0.8294925122187491, 0.885764801397459,
+    -0.9716029151409208, 1.097549206626999, -1.2825037656452472,
+    1.5618008555360774, -2.0076840286270037, 2.7910615476960774,
+    -4.429108373465496, 9.520199163911165, 0.0, -11.620108781037741,
+    6.6417324927688846, -5.217654227684519, 4.806317183579497,
+    -5.035392176359633, 6.237169613425939, -14.989469570260862,
+    3.0733524221704926, -1.2483441629983063, 0.9489908907314716,
+    -0.8149971464854839, 0.7445162941363086, -0.708582566312261,
+    0.6960629683780741, -0.7024825255211232, 0.7267590770803444,
+    -0.7702153708092788, 0.8365836520811022, -0.9327849043598072,
+    1.0707968809739528, -1.2716627022854678, 1.574532907208358,
+    -2.059522812758344, 2.9166926646923197, -4.722894921549352,
+    10.38294077768991, 0.0, -13.409380346277873, 7.961934113714273,
+    -6.579698712198448, 6.535378162040838, -7.880833419142214,
+    18.748685951978402, -2.732079324505948, 1.1093982693944964,
+    -0.8427717057736548, 0.7229540327901802, -0.659368410676119,
+    0.6261919696366872, -0.6134104629311306, 0.6168623546946159,
+    -0.6352958002576208, 0.6694166593895984, -0.7217531158870031,
+    0.7970711725483792, -0.9034479552164202, 1.0544877283752205,
+    -1.2739365943007563, 1.6060416076098682, -2.14177423984239,
+    3.0981737730115397, -5.137505258304453, 11.608321453120663, 0.0,
+    -16.133659456473957, 10.112511313812362, -9.054255999245719,
+    10.42165201853827, -24.382263027729987, 2.3978489149086477,
+    -0.9734555868538841, 0.739095070905268, -0.6334561552577392,
+    0.577017847249244, -0.5470696238889867, 0.5347482694298634,
+    -0.5362871970824423, 0.5504104745099807, -0.5774563898124696,
+    0.6191839028698783, -0.6789949699039456, 0.7625907101016722,
+    -0.8793038981769496, 1.0447270825515695, -1.286146178076015,
+    1.654773847016516, -2.256888473658305, 3.348579846958464,
+    -5.718653200951704, 13.385893027170871, 0.0, -20.625914458639055,
+    14.102060787983092, -14.7787195237298, 33.53152767314198,
+    -2.0566259937514384, 0.8347842407263312, -0.6335466129709314,
+    0.5426315510910056, -0.49381912439982845, 0.46760214368006164,
+    -0.4563337747762695, 0.4567149312863636, -0.46754629386640634,
+    0.488954184017208, -0.5221846627269844, 0.5697206329686795,
+    -0.635702649091339, 0.7267824814664131, -0.8537474824482976,
+    1.034693694469835, -1.3016228552731193, 1.7154483249582089,
+    -2.404634846769612, 3.684109525016056, -6.5407090269318795,
+    16.079204430126122, 0.0, -29.150360335332824, 23.69638475313492,
+    -50.29850181387255, 1.6872601235303, -0.6847743666946654,
+    0.5195464412777379, -0.4447804121805752, 0.40450019006091475,
+    -0.3826862295688003, 0.3730402114165431, -0.3728179211192411,
+    0.3809783149501915, -0.39753692463751483, 0.42337684469666914,
+    -0.46030860145720665, 0.5113475117997447, -0.5812805048612899,
+    0.6777211463671893, -0.8130946954908251, 1.0085537438157148,
+    -1.3022615441981038, 1.7686304133129727, -2.569001320313646,
+    4.111361435326379, -7.717933042095567, 20.46496503921253, 0.0,
+    -50.70551561276851, 88.00783887010662, -1.246123885355273,
+    0.5057005538372659, -0.38361103666546953, 0.32831061137428524,
+    -0.29845452281653173, 0.28220452359597376, -0.27489797356132717,
+    0.2744915127508767, -0.28019121151216875, 0.2919701807969772,
+    -0.3104206143398139, 0.3367831682024967, -0.3731245122972044,
+    0.4227035493313649, -0.490644757549766, 0.5851773307128094,
+    -0.7200044130260698, 0.9191063054408299, -1.2272553699618503,
+    1.735438992796027, -2.6510203090363684, 4.531049739566801,
+    -9.31950339514432, 28.405262163594376, 0.0, -219.8431095341984, 0.5,
+    -0.20290290241010217, 0.15390498257087323, -0.1317022023997509,
+    0.11970461023085163, -0.11316101403566536, 0.11019873423053818,
+    -0.1099951437516322, 0.11222756429383116, -0.11687893133135234,
+    0.12417709227433317, -0.13460424687832906, 0.14896391401953343,
+    -0.16851976973832314, 0.19524970937141226, -0.23230918949050403,
+    0.2849059087595635, -0.3620426236776273, 0.4802426096925187,
+    -0.6722566034046836, 1.0098980596770117, -1.673949691159501,
+    3.2210151415092447, -8.027715891882597, 35.79644489892219, 162.5};
+inline constexpr std::array<double, 52> lift_matrix_25{
+    338.0, -5.245741332786895, 3.9262565239767064, -3.2897448127055458,
+    2.9046103669170997, -2.6457275228857804, 2.4616452894646845,
+    -2.3269152457534785, 2.2274438374285266, -2.1548522129282786,
+    2.1039644707640077, -2.0715757055967607, 2.055814235905652,
+    -2.055814235905652, 2.0715757055967607, -2.1039644707640077,
+    2.1548522129282786, -2.2274438374285266, 2.3269152457534785,
+    -2.4616452894646845, 2.6457275228857804, -2.9046103669170997,
+    3.2897448127055458, -3.9262565239767064, 5.245741332786895, -13.0, -13.0,
+    5.245741332786895, -3.9262565239767064, 3.2897448127055458,
+    -2.9046103669170997, 2.6457275228857804, -2.4616452894646845,
+    2.3269152457534785, -2.2274438374285266, 2.1548522129282786,
+    -2.1039644707640077, 2.0715757055967607, -2.055814235905652,
+    2.055814235905652, -2.0715757055967607, 2.1039644707640077,
+    -2.1548522129282786, 2.2274438374285266, -2.3269152457534785,
+    2.4616452894646845, -2.6457275228857804, 2.9046103669170997,
+    -3.2897448127055458, 3.9262565239767064, -5.245741332786895, 338.0};
+
+// Polynomial order 26
+inline constexpr std::array<double, 27> nodes_26{
+    -1.0, -0.9895609637285506, -0.9651484024508189, -0.9271834587251158,
+    -0.8762020862145224, -0.8129204868958123, -0.7382271498464599,
+    -0.6531706636968095, -0.5589450609425611, -0.4568730756140824,
+    -0.3483875819890287, -0.23501148310291814, -0.11833633389852105, 0.0,
+    0.11833633389852105, 0.23501148310291814, 0.3483875819890287,
+    0.4568730756140824, 0.5589450609425611, 0.6531706636968095,
+    0.7382271498464599, 0.8129204868958123, 0.8762020862145224,
+    0.9271834587251158, 0.9651484024508189, 0.9895609637285506, 1.0};
+inline constexpr std::array<double, 27> weights_26{
+    0.002849002849002849, 0.017501974876065578, 0.03126295173520238,
+    0.0445776579330617, 0.057265569680162734, 0.06914934236004328,
+    0.08006232197053846, 0.08985136525929056, 0.09837907458595277,
+    0.10552574782125301, 0.11119106525743704, 0.11529550025465199,
+    0.11778143658595616, 0.11861397766276302, 0.11778143658595616,
+    0.11529550025465199, 0.11119106525743704, 0.10552574782125301,
+    0.09837907458595277, 0.08985136525929056, 0.08006232197053846,
+    0.06914934236004328, 0.057265569680162734, 0.0445776579330617,
+    0.03126295173520238, 0.017501974876065578, 0.002849002849002849};
+inline constexpr std::array<double, 729> diff_matrix_26{
+    -175.5, -38.649377831434485, 8.661812159173243, -3.4718245645539727,
+    1.801715948742928, -1.0849911200034528, 0.7206223863852003,
+    -0.5134146734625117, 0.3858356792004206, -0.3025282184877611,
+    0.24565304061273488, -0.20548747076209314, 0.1764026376405169,
+    -0.15498101711273193, 0.13907068159892372, -0.12728266712490674,
+    0.11871258228979593, -0.11278348374854155, 0.10916018546095324,
+    -0.1077125758130315, 0.10852400733998561, -0.11196277603998325,
+    0.11888307625668727, -0.1311791337557658, 0.1536158750360148,
+    -0.20278959248134065, 0.5, 237.43059436324765, 0.0, -30.648921129560716,
+    10.045161065154828, -4.876870218519741, 2.848126486291027,
+    -1.8602808518530412, 1.3120117473354997, -0.9794947151748917,
+    0.7645246393673981, -0.6187754835096528, 0.5163564716445869,
+    -0.442460962661384, 0.38817989494171123, -0.3479409952840772,
+    0.31816533885375586, -0.29653036401830224, 0.28155657602000345,
+    -0.27238253796185585, 0.2686671504724596, -0.270606955629893,
+    0.27911212092869603, -0.2963058646540668, 0.3269043474246242,
+    -0.3827774492298147, 0.5052745796641555, -1.2457756418103365,
+    -95.04862923053942, 54.74672137255849, 0.0, -22.058379587725092,
+    8.306923884919904, -4.416992505173446, 2.753757716815736,
+    -1.8907279483893693, 1.3877784263273463, -1.070869976240541,
+    0.8597323468513796, -0.7131887796992459, 0.6084004514766514,
+    -0.5319281314131112, 0.47550355583134185, -0.43388007280616664,
+    0.4036807776131996, -0.3827627047616699, 0.3698724832741698,
+    -0.3644924182606852, 0.3668516608835826, -0.37815720533286906,
+    0.40126542087839145, -0.4425466573330198, 0.5180550459704859,
+    -0.683737292810335, 1.6856724761411457, 54.32279855264304,
+    -25.585098654057955, 31.452912960615365, 0.0, -17.30614378517727,
+    7.026824086498386, -3.9489636513517272, 2.570546359764982,
+    -1.82800839094141, 1.381957978566782, -1.0939519570894254,
+    0.8983352323808365, -0.760595504242001, 0.6611880771983538,
+    -0.588420698587039, 0.5350242460959493, -0.4963854320150145,
+    0.46959728177101034, -0.45295065137694585, 0.4456992156350316,
+    -0.44804662082427965, 0.4614125522016056, -0.48924145228387256,
+    0.5392676015677671, -0.6310246606624049, 0.8326277622677953,
+    -2.052528151934476, -36.214877862516126, 15.95687077014784,
+    -15.216116910165116, 22.2319033519695, 0.0, -14.38054412751757,
+    6.1296051509178175, -3.5794672903903484, 2.404828877997896,
+    -1.7567609292108106, 1.3596606439920216, -1.0991411432045075,
+    0.9200598671539899, -0.7930025335443072, 0.701111037336459,
+    -0.6342245919017822, 0.5860318989758756, -0.5526026164173573,
+    0.5316171638797206, -0.5220007232884644, 0.5238581300241569,
+    -0.5387553549692301, 0.5706446125461334, -0.6284917551805052,
+    0.7350135430007116, -0.9694976857836023, 2.389575387596468,
+    26.33427426756867, -11.252791463812143, 9.769778923276279,
+    -10.900085087258475, 17.364800084087744, 0.0, -12.442225658950804,
+    5.491503954343914, -3.3010413401781653, 2.273562907845548,
+    -1.6976282715887827, 1.34007278466315, -1.1031402551213598,
+    0.9392431220318406, -0.8227845666538264, 0.7390175604582317,
+    -0.6790654552243708, 0.637502198486899, -0.6111264925211277,
+    0.5983712441402139, -0.5991379110372376, 0.6150663048353981,
+    -0.6505580700086745, 0.7157481128623027, -0.8364316421227544,
+    1.1027566742385193, -2.717495468521348, -20.250840232800336,
+    8.50980564029737, -7.05218876387486, 7.0924138674855755,
+    -8.569729138921904, 14.405827195727952, 0.0, -11.097989594301973,
+    5.031828382261058, -3.0958624952122245, 2.1766731907115258,
+    -1.6559749314144177, 1.3300270235056935, -1.112900000080887,
+    0.962534070713686, -0.8562263159416124, 0.7809146251868658,
+    -0.7288372202887948, 0.695448681273371, -0.6784227983030067,
+    0.6772983086628451, -0.693692386667394, 0.7323999133707573,
+    -0.804700257427398, 0.9394824915401752, -1.2378843737649146,
+    3.0497280900326396, 16.191984283520593, -6.735585416451166,
+    5.4340514272486535, -5.1812300285942765, 5.616289591439411,
+    -7.135557776608834, 12.454916271955907, 0.0, -10.142430710515631,
+    4.700760854280857, -2.9494194424640936, 2.1111278021357025,
+    -1.6330693985128388, 1.3325015855943816, -1.1320980626099695,
+    0.9939261614871258, -0.8975345675552677, 0.8312717644999,
+    -0.7884368032399448, 0.7654967189893441, -0.7613720555467358,
+    0.7775124300960139, -0.8190345073970875, 0.8983577172209691,
+    -1.0475703537137844, 1.3792792208430142, -3.3970208193308973,
+    -13.323313128754952, 5.505766310550163, -4.367097466318317,
+    4.0342580156682715, -4.13136271718542, 4.696406084757708,
+    -6.1830160247455215, 11.105039355531698, 0.0, -9.45944344933979,
+    4.467306486506991, -2.8516040292019147, 2.0742440264694704,
+    -1.6293497135175092, 1.3494096058786065, -1.1634519580311,
+    1.0366923298080826, -0.9505088935008845, 0.8945422993036903,
+    -0.863266605336667, 0.8545542522595329, -0.869452358290658,
+    0.9132888209896366, -0.9996233086646573, 1.1639244089146006,
+    -1.531069619732216, 3.7694163875751237, 11.205505289026298,
+    -4.609596052348725, 3.614641253943611, -3.271417923408851,
+    3.237259523192144, -3.469583626983229, 4.080486262679937,
+    -5.52079874407438, 10.1466175420496, 0.0, -8.979922826220015,
+    4.312120755794318, -2.7959859564346234, 2.0645039551774858,
+    -1.6455641370260046, 1.382736420299685, -1.2097838772070195,
+    1.0943958545334518, -1.019557890939488, 0.9762853835153522,
+    -0.9606402964335751, 0.9728638615642908, -1.0183047976491717,
+    1.1116466551052384, -1.2919867899926953, 1.697606610047965,
+    -4.177448074022295, -9.58736256757991, 3.93111666848025,
+    -3.0577584705490506, 2.72866922779756, -2.640017662243854,
+    2.7297598138571835, -3.022977660847515, 3.649906584637777,
+    -5.0490876149906, 9.46202425088033, 0.0, -8.66178215649141,
+    4.223494453200876, -2.7791010862397845, 2.0817878347084644,
+    -1.6833058691130116, 1.4351831863391327, -1.274733046817878,
+    1.1717016548561243, -1.110699034832131, 1.0845392303459795,
+    -1.091926673037371, 1.1378828759742317, -1.238145463965422,
+    1.4357472086111587, -1.8838746649933804, 4.633122247976511,
+    8.315815038890126, -3.401534862754456, 2.630188532032963,
+    -2.3234511370977686, 2.2129532398615552, -2.234357649866241,
+    2.384722968649921, -2.708957569496386, 3.341941510008481,
+    -4.7113441976257056, 8.981517575331436, 0.0, -8.479873829311598,
+    4.195166101518914, -2.800047139573422, 2.1275556130209856,
+    -1.7454423321841095, 1.510752499653652, -1.3635092227489154,
+    1.275386452661554, -1.233027459083847, 1.232193921474498,
+    -1.2769145929312036, 1.3837848591020354, -1.6001182635734241,
+    2.095936725232058, -5.150966691749277, -7.292711583677032,
+    2.977588996926843, -2.292114954512641, 2.0096172680261253,
+    -1.8923407817947506, 1.8789686144443998, -1.9566319046341079,
+    2.14070492135919, -2.4833272959277886, 3.120709868655431,
+    -4.473823890067863, 8.662712070098108, 0.0, -8.420781101627188,
+    4.225244973608642, -2.8604201714632684, 2.2051768392670383,
+    -1.836678839571484, 1.6155407294913209, -1.484007903336702,
+    1.416004967396573, -1.4014413579909628, 1.4420159555727554,
+    -1.5547033740660525, 1.7914332716217303, -2.3415066335027492,
+    5.7493605776639765, 6.45240313058862, -2.630763768877056,
+    2.018175124090585, -1.7593151245733085, 1.642543422263771,
+    -1.611112396651849, 1.6487842533352834, -1.7590529966148256,
+    1.9644792486347566, -2.3205618636212053, 2.9646287982096493,
+    -4.315912912109226, 8.480303606778392, 0.0, -8.480303606778392,
+    4.315912912109226, -2.9646287982096493, 2.3205618636212053,
+    -1.9644792486347566, 1.7590529966148256, -1.6487842533352834,
+    1.611112396651849, -1.642543422263771, 1.7593151245733085,
+    -2.018175124090585, 2.630763768877056, -6.45240313058862,
+    -5.7493605776639765, 2.3415066335027492, -1.7914332716217303,
+    1.5547033740660525, -1.4420159555727554, 1.4014413579909628,
+    -1.416004967396573, 1.484007903336702, -1.6155407294913209,
+    1.836678839571484, -2.2051768392670383, 2.8604201714632684,
+    -4.225244973608642, 8.420781101627188, 0.0, -8.662712070098108,
+    4.473823890067863, -3.120709868655431, 2.4833272959277886,
+    -2.14070492135919, 1.9566319046341079, -1.8789686144443998,
+    1.8923407817947506, -2.0096172680261253, 2.292114954512641,
+    -2.977588996926843, 7.292711583677032, 5.150966691749277,
+    -2.095936725232058, 1.6001182635734241, -1.3837848591020354,
+    1.2769145929312036, -1.232193921474498, 1.233027459083847,
+    -1.275386452661554, 1.3635092227489154, -1.510752499653652,
+    1.7454423321841095, -2.1275556130209856, 2.800047139573422,
+    -4.195166101518914, 8.479873829311598, 0.0, -8.981517575331436,
+    4.7113441976257056, -3.341941510008481, 2.708957569496386,
+    -2.384722968649921, 2.234357649866241, -2.2129532398615552,
+    2.3234511370977686, -2.630188532032963, 3.401534862754456,
+    -8.315815038890126, -4.633122247976511, 1.8838746649933804,
+    -1.4357472086111587, 1.238145463965422, -1.1378828759742317,
+    1.091926673037371, -1.0845392303459795, 1.110699034832131,
+    -1.1717016548561243, 1.274733046817878, -1.4351831863391327,
+    1.6833058691130116, -2.0817878347084644, 2.7791010862397845,
+    -4.223494453200876, 8.66178215649141, 0.0, -9.46202425088033,
+    5.0490876149906, -3.649906584637777, 3.022977660847515,
+    -2.7297598138571835, 2.640017662243854, -2.72866922779756,
+    3.0577584705490506, -3.93111666848025, 9.58736256757991, 4.177448074022295,
+    -1.697606610047965, 1.2919867899926953, -1.1116466551052384,
+    1.0183047976491717, -0.9728638615642908, 0.9606402964335751,
+    -0.9762853835153522, 1.019557890939488, -1.0943958545334518,
+    1.2097838772070195, -1.382736420299685, 1.6455641370260046,
+    -2.0645039551774858, 2.7959859564346234, -4.312120755794318,
+    8.979922826220015, 0.0, -10.1466175420496, 5.52079874407438,
+    -4.080486262679937, 3.469583626983229, -3.237259523192144,
+    3.271417923408851, -3.614641253943611, 4.609596052348725,
+    -11.205505289026298, -3.7694163875751237, 1.531069619732216,
+    -1.1639244089146006, 0.9996233086646573, -0.9132888209896366,
+    0.869452358290658, -0.8545542522595329, 0.863266605336667,
+    -0.8945422993036903, 0.9505088935008845, -1.0366923298080826,
+    1.1634519580311, -1.3494096058786065, 1.6293497135175092,
+    -2.0742440264694704, 2.8516040292019147, -4.467306486506991,
+    9.45944344933979, 0.0, -11.105039355531698, 6.1830160247455215,
+    -4.696406084757708, 4.13136271718542, -4.0342580156682715,
+    4.367097466318317, -5.505766310550163, 13.323313128754952,
+    3.3970208193308973, -1.3792792208430142, 1.0475703537137844,
+    -0.8983577172209691, 0.8190345073970875, -0.7775124300960139,
+    0.7613720555467358, -0.7654967189893441, 0.7884368032399448,
+    -0.8312717644999, 0.8975345675552677, -0.9939261614871258,
+    1.1320980626099695, -1.3325015855943816, 1.6330693985128388,
+    -2.1111278021357025, 2.9494194424640936, -4.700760854280857,
+    10.142430710515631, 0.0, -12.454916271955907, 7.135557776608834,
+    -5.616289591439411, 5.1812300285942765, -5.4340514272486535,
+    6.735585416451166, -16.191984283520593, -3.0497280900326396,
+    1.2378843737649146, -0.9394824915401752, 0.804700257427398,
+    -0.7323999133707573, 0.693692386667394, -0.6772983086628451,
+    0.6784227983030067, -0.695448681273371, 0.7288372202887948,
+    -0.7809146251868658, 0.8562263159416124, -0.962534070713686,
+    1.112900000080887, -1.3300270235056935, 1.6559749314144177,
+    -2.1766731907115258, 3.0958624952122245, -5.031828382261058,
+    11.097989594301973, 0.0, -14.405827195727952, 8.569729138921904,
+    -7.0924138674855755, 7.05218876387486, -8.50980564029737,
+    20.250840232800336, 2.717495468521348, -1.1027566742385193,
+    0.8364316421227544, -0.7157481128623027, 0.6505580700086745,
+    -0.6150663048353981, 0.5991379110372376, -0.5983712441402139,
+    0.6111264925211277, -0.637502198486899, 0.6790654552243708,
+    -0.7390175604582317, 0.8227845666538264, -0.9392431220318406,
+    1.1031402551213598, -1.34007278466315, 1.6976282715887827,
+    -2.273562907845548, 3.3010413401781653, -5.491503954343914,
+    12.442225658950804, 0.0, -17.364800084087744, 10.900085087258475,
+    -9.769778923276279, 11.252791463812143, -26.33427426756867,
+    -2.389575387596468, 0.9694976857836023, -0.7350135430007116,
+    0.6284917551805052, -0.5706446125461334, 0.5387553549692301,
+    -0.5238581300241569, 0.5220007232884644, -0.5316171638797206,
+    0.5526026164173573, -0.5860318989758756, 0.6342245919017822,
+    -0.701111037336459, 0.7930025335443072, -0.9200598671539899,
+    1.0991411432045075, -1.3596606439920216, 1.7567609292108106,
+    -2.404828877997896, 3.5794672903903484, -6.1296051509178175,
+    14.38054412751757, 0.0, -22.2319033519695, 15.216116910165116,
+    -15.95687077014784, 36.214877862516126, 2.052528151934476,
+    -0.8326277622677953, 0.6310246606624049, -0.5392676015677671,
+    0.48924145228387256, -0.4614125522016056, 0.44804662082427965,
+    -0.4456992156350316, 0.45295065137694585, -0.46959728177101034,
+    0.4963854320150145, -0.5350242460959493, 0.588420698587039,
+    -0.6611880771983538, 0.760595504242001, -0.8983352323808365,
+    1.0939519570894254, -1.381957978566782, 1.82800839094141,
+    -2.570546359764982, 3.9489636513517272, -7.026824086498386,
+    17.30614378517727, 0.0, -31.452912960615365, 25.585098654057955,
+    -54.32279855264304, -1.6856724761411457, 0.683737292810335,
+    -0.5180550459704859, 0.4425466573330198, -0.40126542087839145,
+    0.37815720533286906, -0.3668516608835826, 0.3644924182606852,
+    -0.3698724832741698, 0.3827627047616699, -0.4036807776131996,
+    0.43388007280616664, -0.47550355583134185, 0.5319281314131112,
+    -0.6084004514766514, 0.7131887796992459, -0.8597323468513796,
+    1.070869976240541, -1.3877784263273463, 1.8907279483893693,
+    -2.753757716815736, 4.416992505173446, -8.306923884919904,
+    22.058379587725092, 0.0, -54.74672137255849, 95.04862923053942,
+    1.2457756418103365, -0.5052745796641555, 0.3827774492298147,
+    -0.3269043474246242, 0.2963058646540668, -0.27911212092869603,
+    0.270606955629893, -0.2686671504724596, 0.27238253796185585,
+    -0.28155657602000345, 0.29653036401830224, -0.31816533885375586,
+    0.3479409952840772, -0.38817989494171123, 0.442460962661384,
+    -0.5163564716445869, 0.6187754835096528, -0.7645246393673981,
+    0.9794947151748917, -1.3120117473354997, 1.8602808518530412,
+    -2.848126486291027, 4.876870218519741, -10.045161065154828,
+    30.648921129560716, 0.0, -237.43059436324765, -0.5, 0.20278959248134065,
+    -0.1536158750360148, 0.1311791337557658, -0.11888307625668727,
+    0.11196277603998325, -0.10852400733998561, 0.1077125758130315,
+    -0.10916018546095324, 0.11278348374854155, -0.11871258228979593,
+    0.12728266712490674, -0.13907068159892372, 0.15498101711273193,
+    -0.1764026376405169, 0.20548747076209314, -0.24565304061273488,
+    0.3025282184877611, -0.3858356792004206, 0.5134146734625117,
+    -0.7206223863852003, 1.0849911200034528, -1.801715948742928,
+    3.4718245645539727, -8.661812159173243, 38.649377831434485, 175.5};
+inline constexpr std::array<double, 54> lift_matrix_26{
+    364.5, -5.446740470192498, 4.075352884144473, -3.412884465504017,
+    3.011157121793357, -2.7402247411102785, 2.546631575574743,
+    -2.4039081510118496, 2.297358881675015, -2.2182014814373163,
+    2.1609527191030558, -2.1221399992395527, 2.0996252488634695,
+    -2.092243731021881, 2.0996252488634695, -2.1221399992395527,
+    2.1609527191030558, -2.2182014814373163, 2.297358881675015,
+    -2.4039081510118496, 2.546631575574743, -2.7402247411102785,
+    3.011157121793357, -3.412884465504017, 4.075352884144473,
+    -5.446740470192498, 13.5, 13.5, -5.446740470192498, 4.075352884144473,
+    -3.412884465504017, 3.011157121793357, -2.7402247411102785,
+    2.546631575574743, -2.4039081510118496, 2.297358881675015,
+    -2.2182014814373163, 2.1609527191030558, -2.1221399992395527,
+    2.0996252488634695, -2.092243731021881, 2.0996252488634695,
+    -2.1221399992395527, 2.1609527191030558, -2.2182014814373163,
+    2.297358881675015, -2.4039081510118496, 2.546631575574743,
+    -2.7402247411102785, 3.011157121793357, -3.412884465504017,
+    4.075352884144473, -5.446740470192498, 364.5};
+
+// Polynomial order 27
+inline constexpr std::array<double, 28> nodes_27{
+    -1.0, -0.9903054026184541, -0.9676242858571313, -0.9323251671215586,
+    -0.8848710172113028, -0.8258809700563382, -0.7561241940055697,
+    -0.6765101289295733, -0.5880766898371756, -0.49197675393157936,
+    -0.3894631375763628, -0.28187226662160236, -0.17060675530800437,
+    -0.0571171216935129, 0.0571171216935129, 0.17060675530800437,
+    0.28187226662160236, 0.3894631375763628, 0.49197675393157936,
+    0.5880766898371756, 0.6765101289295733, 0.7561241940055697,
+    0.8258809700563382, 0.8848710172113028, 0.9323251671215586,
+    0.9676242858571313, 0.9903054026184541, 1.0};
+inline constexpr std::array<double, 28> weights_27{
+    0.0026455026455026454, 0.016255883957504217, 0.029054220677979144,
+    0.04146691524300672, 0.05333807704732749, 0.06451365808035454,
+    0.07484812350970771, 0.08420679512151033, 0.09246768599771217,
+    0.09952311041249567, 0.10528109376105589, 0.10966657379597662,
+    0.11262238007723901, 0.11410997967262783, 0.11410997967262783,
+    0.11262238007723901, 0.10966657379597662, 0.10528109376105589,
+    0.09952311041249567, 0.09246768599771217, 0.08420679512151033,
+    0.07484812350970771, 0.06451365808035454, 0.05333807704732749,
+    0.04146691524300672, 0.029054220677979144, 0.016255883957504217,
+    0.0026455026455026454};
+inline constexpr std::array<double, 784> diff_matrix_27{
+    -189.0, -41.612041929154444, 9.320305069939872, -3.732295692628381,
+    1.9344199183146993, -1.1630061922565174, 0.7708944588085617,
+    -0.5479233947464931, 0.41062249408858376, -0.32092869092899656,
+    0.2596372589292104, -0.2162794533830679, 0.18479118724979254,
+    -0.1614858733356905, 0.1440353787976368, -0.13092745423570135,
+    0.12116361175645075, -0.11408587471519135, 0.10927732948425987,
+    -0.10650932544676198, 0.10572418577404215, -0.10705535982040107,
+    0.11090619450835745, -0.11815545756083924, 0.1307142770529693,
+    -0.15335830871657233, 0.20268848800612574, -0.5, 255.69451838768086, 0.0,
+    -32.97890604908189, 10.798774086274024, -5.236056777462739,
+    3.052903729046689, -1.990044526729465, 1.400184700330912,
+    -1.0424067892319913, 0.8110123536563615, -0.6539877695042562,
+    0.5434621354560069, -0.46348824733680727, 0.40445872173006553,
+    -0.3603475488407222, 0.3272604966639856, -0.3026358615040232,
+    0.28478942756825043, -0.27265435833524754, 0.26564286495098843,
+    -0.263599260349622, 0.26684787830201323, -0.2763879141852547,
+    0.29440452772910475, -0.3256556274794944, 0.38203538317165114,
+    -0.5048947513342412, 1.2454648443277356, -102.3602077089097,
+    58.94335962124303, 0.0, -23.713184907768227, 8.918684097981252,
+    -4.734522593261832, 2.945802298602455, -2.0177516929444694,
+    1.4768737643235401, -1.1359452438456923, 0.9086162865353921,
+    -0.7505858668537649, 0.6372713452184638, -0.55419095596909,
+    0.4924118728944824, -0.44623315960160254, 0.4119385305894068,
+    -0.3870985954912244, 0.37017618986897066, -0.3603159576497485,
+    0.357267676959907, -0.3614433683390898, 0.37417617199058795,
+    -0.39840870846205656, 0.4405667363126905, -0.5167294861322078,
+    0.6828137035477231, -1.6842569225276134, 58.50184629796673,
+    -27.546447239320248, 33.84405452173929, 0.0, -18.580525361761186,
+    7.531873895832957, -4.2242742273543525, 2.743160535432779,
+    -1.9452877047676982, 1.4658598799394564, -1.156075518324676,
+    0.9453614141293468, -0.7966068942761574, 0.6887755928114002,
+    -0.6092542709539247, 0.5501610081346741, -0.5064358206931002,
+    0.4748033402585414, -0.4531967994629357, 0.44045087631360863,
+    -0.4361799612806234, 0.44083124238428745, -0.4559899162479792,
+    0.4852107018109473, -0.536293578284162, 0.6287879381123059,
+    -0.8307105500015907, 2.0488801463952107, -39.00137420779276,
+    17.180314558751757, -16.373024244957513, 23.899764125632142, 0.0,
+    -15.413955462527367, 6.556796381722548, -3.819696947887214,
+    2.5589870399233736, -1.8632924285725692, 1.436747907195149,
+    -1.156551902058493, 0.9634904310548491, -0.8259535609788278,
+    0.7257907497772634, -0.6520144710822834, 0.597731618940513,
+    -0.5585475611709435, 0.531705044916498, -0.5156278350132696,
+    0.5097252845635315, -0.5144236246293705, 0.5315030853953714,
+    -0.5650541042419547, 0.6241169772507921, -0.7314033518159906,
+    0.9659869265890074, -2.3822258918001804, 28.36125828871223,
+    -12.11585834660424, 10.512805528007442, -11.71798611911607,
+    18.64354148899953, 0.0, -13.30910879123973, 5.859849178051078,
+    -3.512458260552912, 2.4112484469788553, -1.7936931598808814,
+    1.4098822678876404, -1.1550223946788456, 0.9780725443449171,
+    -0.8515384350135492, 0.7595240497450119, -0.6923818402456794,
+    0.6440971540925498, -0.6109354658818226, 0.5907373552568346,
+    -0.5825983668249084, 0.5868504999074026, -0.6054141191386115,
+    0.6428654765604928, -0.7094228585009786, 0.8308422342201242,
+    -1.09688254664605, 2.704576509749067, -21.810601385692248,
+    9.162903654815054, -7.588838011686547, 7.624849768906221,
+    -9.201004846344823, 15.441099578791292, 0.0, -11.842055431266742,
+    5.353815452696857, -3.2830846599081913, 2.299590357421308,
+    -1.7419842181125855, 1.392317473183778, -1.1586361500177094,
+    0.9958850435464979, -0.8796794380896275, 0.7958980634800836,
+    -0.7360156721026123, 0.6948303419641395, -0.6693161233698023,
+    0.6580843112894684, -0.6612670298926011, 0.680858286536673,
+    -0.7218790988360139, 0.7957040229193711, -0.9311334891771275,
+    1.228666678826306, -3.0288734762127327, 17.44049401051874,
+    -7.2530701191804345, 5.847976626082179, -5.570531490922921,
+    6.03029685587649, -7.648599286751004, 13.322732605165632, 0.0,
+    -10.791009127260942, 4.984673009177926, -3.1156264060746173,
+    2.2204330431304036, -1.7092029873202974, 1.386900987228092,
+    -1.1709444714441422, 1.0207464561016772, -0.9143187036892669,
+    0.8389808770493726, -0.7872048434062827, 0.7546228018822604,
+    -0.7390872340538917, 0.7403682039703403, -0.76043961500752,
+    0.8047221606322509, -0.8857499146107827, 1.0354559638938259,
+    -1.3654655119628563, 3.3652186536263136, -14.352399878158662,
+    5.929480298983741, -4.7002843755927195, 4.337825748685402,
+    -4.436298104070955, 5.034420573583635, -6.614126085678879,
+    11.84963330023614, 0.0, -10.03020770463069, 4.718575644802219,
+    -2.9987923696790446, 2.1704882564090493, -1.6953982454455518,
+    1.395220946241944, -1.1943236617296018, 1.0555142127403014,
+    -0.9587057674214458, 0.8924579826081304, -0.8502292449959853,
+    0.8286531293641173, -0.8268759486126301, 0.8467062308724028,
+    -0.8939001062483205, 0.9821679063829688, -1.1467381349235106,
+    1.5110455443723465, -3.722797585548464, 12.073252542824676,
+    -4.965246567325535, 3.8910974477277733, -3.5181525759880485,
+    3.476703105270394, -3.7197541196894495, 4.365410671374221,
+    -5.8913317095935565, 10.795527735742443, 0.0, -9.48429867067327,
+    4.534083403694592, -2.925124051696774, 2.147588462223493,
+    -1.7008012114833102, 1.4187602005767193, -1.2310298826416353,
+    1.1030471444403984, -1.0163081812388568, 0.9605538776413165,
+    -0.9303889838643422, 0.9238932600932915, -0.9424701626767832,
+    0.992104380612593, -1.0876997926472478, 1.2680114956354422,
+    -1.669266948508233, 4.110984257125283, -10.332590159249726,
+    4.2355462095912015, -3.2924688469809147, 2.9351808381774442,
+    -2.8359175939956827, 2.9271627646470284, -3.2345952934984705,
+    3.895369195669254, -5.372436862877139, 10.033019802801913, 0.0,
+    -9.106733618367803, 4.417775348928394, -2.890166768789476,
+    2.150868496548848, -1.7263172736557404, 1.4594812003453679,
+    -1.2838185485576643, 1.1668647548832416, -1.0915552898302177,
+    1.048951266378319, -1.0352769227967558, 1.0511146769384114,
+    -1.1024862802134636, 1.2054867040598667, -1.4026933979190552,
+    1.8444362979184135, -4.5401903842814075, 8.965640868025352,
+    -3.666342017395627, 2.8331229830550333, -2.500175059536633,
+    2.3779463291005527, -2.396654636795773, 2.552334405314693,
+    -2.8917771283434384, 3.5565644490806805, -4.996200280793826,
+    9.486074267671226, 0.0, -8.868786886673478, 4.361799332124799,
+    -2.8919396147222725, 2.180852724329339, -1.773853121460941,
+    1.520275835324971, -1.3564972890238467, 1.2518386942985729,
+    -1.190761380319615, 1.1661403067959737, -1.1769778127248867,
+    1.22897528983964, -1.3393588835217825, 1.5548820863238364,
+    -2.0416630757024343, 5.022712108288678, -7.8667936169900035,
+    3.211092653549765, -2.4702440464329545, 2.1635504809933663,
+    -2.034392530326119, 2.0163384778029756, -2.094990499431117,
+    2.285973574809129, -2.643578140070811, 3.310129992499763,
+    -4.725828319869849, 9.107824316944402, 0.0, -8.753754097058376,
+    4.362565569792619, -2.9307163077882032, 2.2396325143597386,
+    -1.846693961679544, 1.605497958067731, -1.4546440944772752,
+    1.3651973712536178, -1.323634947371962, 1.3259115783148354,
+    -1.376716703021227, 1.4942139244917598, -1.729725985794862,
+    2.267293254301507, -5.573746652094862, 6.96546259557833,
+    -2.8391428381062767, 2.176575975700395, -1.8953946401394322,
+    1.767021783897457, -1.7299877494861864, 1.7664029681297873,
+    -1.879411788943839, 2.0922104542508766, -2.46235547456045,
+    3.1325365215674212, -4.538528157639067, 8.869380147972825, 0.0,
+    -8.753942516273325, 4.420189558666144, -3.00911352682865,
+    2.331240602198917, -1.9500836626301192, 1.72177590578434,
+    -1.5867656480864591, 1.5182801751953867, -1.5061777056391563,
+    1.5527362868777166, -1.6765653308570796, 1.9339396306415815,
+    -2.529499569558268, 6.212760427466807, -6.212760427466807,
+    2.529499569558268, -1.9339396306415815, 1.6765653308570796,
+    -1.5527362868777166, 1.5061777056391563, -1.5182801751953867,
+    1.5867656480864591, -1.72177590578434, 1.9500836626301192,
+    -2.331240602198917, 3.00911352682865, -4.420189558666144,
+    8.753942516273325, 0.0, -8.869380147972825, 4.538528157639067,
+    -3.1325365215674212, 2.46235547456045, -2.0922104542508766,
+    1.879411788943839, -1.7664029681297873, 1.7299877494861864,
+    -1.767021783897457, 1.8953946401394322, -2.176575975700395,
+    2.8391428381062767, -6.96546259557833, 5.573746652094862,
+    -2.267293254301507, 1.729725985794862, -1.4942139244917598,
+    1.376716703021227, -1.3259115783148354, 1.323634947371962,
+    -1.3651973712536178, 1.4546440944772752, -1.605497958067731,
+    1.846693961679544, -2.2396325143597386, 2.9307163077882032,
+    -4.362565569792619, 8.753754097058376, 0.0, -9.107824316944402,
+    4.725828319869849, -3.310129992499763, 2.643578140070811,
+    -2.285973574809129, 2.094990499431117, -2.0163384778029756,
+    2.034392530326119, -2.1635504809933663, 2.4702440464329545,
+    -3.211092653549765, 7.8667936169900035, -5.022712108288678,
+    2.0416630757024343, -1.5548820863238364, 1.3393588835217825,
+    -1.22897528983964, 1.1769778127248867, -1.1661403067959737,
+    1.190761380319615, -1.2518386942985729, 1.3564972890238467,
+    -1.520275835324971, 1.773853121460941, -2.180852724329339,
+    2.8919396147222725, -4.361799332124799, 8.868786886673478, 0.0,
+    -9.486074267671226, 4.996200280793826, -3.5565644490806805,
+    2.8917771283434384, -2.552334405314693, 2.396654636795773,
+    -2.3779463291005527, 2.500175059536633, -2.8331229830550333,
+    3.666342017395627, -8.965640868025352, 4.5401903842814075,
+    -1.8444362979184135, 1.4026933979190552, -1.2054867040598667,
+    1.1024862802134636, -1.0511146769384114, 1.0352769227967558,
+    -1.048951266378319, 1.0915552898302177, -1.1668647548832416,
+    1.2838185485576643, -1.4594812003453679, 1.7263172736557404,
+    -2.150868496548848, 2.890166768789476, -4.417775348928394,
+    9.106733618367803, 0.0, -10.033019802801913, 5.372436862877139,
+    -3.895369195669254, 3.2345952934984705, -2.9271627646470284,
+    2.8359175939956827, -2.9351808381774442, 3.2924688469809147,
+    -4.2355462095912015, 10.332590159249726, -4.110984257125283,
+    1.669266948508233, -1.2680114956354422, 1.0876997926472478,
+    -0.992104380612593, 0.9424701626767832, -0.9238932600932915,
+    0.9303889838643422, -0.9605538776413165, 1.0163081812388568,
+    -1.1030471444403984, 1.2310298826416353, -1.4187602005767193,
+    1.7008012114833102, -2.147588462223493, 2.925124051696774,
+    -4.534083403694592, 9.48429867067327, 0.0, -10.795527735742443,
+    5.8913317095935565, -4.365410671374221, 3.7197541196894495,
+    -3.476703105270394, 3.5181525759880485, -3.8910974477277733,
+    4.965246567325535, -12.073252542824676, 3.722797585548464,
+    -1.5110455443723465, 1.1467381349235106, -0.9821679063829688,
+    0.8939001062483205, -0.8467062308724028, 0.8268759486126301,
+    -0.8286531293641173, 0.8502292449959853, -0.8924579826081304,
+    0.9587057674214458, -1.0555142127403014, 1.1943236617296018,
+    -1.395220946241944, 1.6953982454455518, -2.1704882564090493,
+    2.9987923696790446, -4.718575644802219, 10.03020770463069, 0.0,
+    -11.84963330023614, 6.614126085678879, -5.034420573583635,
+    4.436298104070955, -4.337825748685402, 4.7002843755927195,
+    -5.929480298983741, 14.352399878158662, -3.3652186536263136,
+    1.3654655119628563, -1.0354559638938259, 0.8857499146107827,
+    -0.8047221606322509, 0.76043961500752, -0.7403682039703403,
+    0.7390872340538917, -0.7546228018822604, 0.7872048434062827,
+    -0.8389808770493726, 0.9143187036892669, -1.0207464561016772,
+    1.1709444714441422, -1.386900987228092, 1.7092029873202974,
+    -2.2204330431304036, 3.1156264060746173, -4.984673009177926,
+    10.791009127260942, 0.0, -13.322732605165632, 7.648599286751004,
+    -6.03029685587649, 5.570531490922921, -5.847976626082179,
+    7.2530701191804345, -17.44049401051874, 3.0288734762127327,
+    -1.228666678826306, 0.9311334891771275, -0.7957040229193711,
+    0.7218790988360139, -0.680858286536673, 0.6612670298926011,
+    -0.6580843112894684, 0.6693161233698023, -0.6948303419641395,
+    0.7360156721026123, -0.7958980634800836, 0.8796794380896275,
+    -0.9958850435464979, 1.1586361500177094, -1.392317473183778,
+    1.7419842181125855, -2.299590357421308, 3.2830846599081913,
+    -5.353815452696857, 11.842055431266742, 0.0, -15.441099578791292,
+    9.201004846344823, -7.624849768906221, 7.588838011686547,
+    -9.162903654815054, 21.810601385692248, -2.704576509749067,
+    1.09688254664605, -0.8308422342201242, 0.7094228585009786,
+    -0.6428654765604928, 0.6054141191386115, -0.5868504999074026,
+    0.5825983668249084, -0.5907373552568346, 0.6109354658818226,
+    -0.6440971540925498, 0.6923818402456794, -0.7595240497450119,
+    0.8515384350135492, -0.9780725443449171, 1.1550223946788456,
+    -1.4098822678876404, 1.7936931598808814, -2.4112484469788553,
+    3.512458260552912, -5.859849178051078, 13.30910879123973, 0.0,
+    -18.64354148899953, 11.71798611911607, -10.512805528007442,
+    12.11585834660424, -28.36125828871223, 2.3822258918001804,
+    -0.9659869265890074, 0.7314033518159906, -0.6241169772507921,
+    0.5650541042419547, -0.5315030853953714, 0.5144236246293705,
+    -0.5097252845635315, 0.5156278350132696, -0.531705044916498,
+    0.5585475611709435, -0.597731618940513, 0.6520144710822834,
+    -0.7257907497772634, 0.8259535609788278, -0.9634904310548491,
+    1.156551902058493, -1.436747907195149, 1.8632924285725692,
+    -2.5589870399233736, 3.819696947887214, -6.556796381722548,
+    15.413955462527367, 0.0, -23.899764125632142, 16.373024244957513,
+    -17.180314558751757, 39.00137420779276, -2.0488801463952107,
+    0.8307105500015907, -0.6287879381123059, 0.536293578284162,
+    -0.4852107018109473, 0.4559899162479792, -0.44083124238428745,
+    0.4361799612806234, -0.44045087631360863, 0.4531967994629357,
+    -0.4748033402585414, 0.5064358206931002, -0.5501610081346741,
+    0.6092542709539247, -0.6887755928114002, 0.7966068942761574,
+    -0.9453614141293468, 1.156075518324676, -1.4658598799394564,
+    1.9452877047676982, -2.743160535432779, 4.2242742273543525,
+    -7.531873895832957, 18.580525361761186, 0.0, -33.84405452173929,
+    27.546447239320248, -58.50184629796673, 1.6842569225276134,
+    -0.6828137035477231, 0.5167294861322078, -0.4405667363126905,
+    0.39840870846205656, -0.37417617199058795, 0.3614433683390898,
+    -0.357267676959907, 0.3603159576497485, -0.37017618986897066,
+    0.3870985954912244, -0.4119385305894068, 0.44623315960160254,
+    -0.4924118728944824, 0.55419095596909, -0.6372713452184638,
+    0.7505858668537649, -0.9086162865353921, 1.1359452438456923,
+    -1.4768737643235401, 2.0177516929444694, -2.945802298602455,
+    4.734522593261832, -8.918684097981252, 23.713184907768227, 0.0,
+    -58.94335962124303, 102.3602077089097, -1.2454648443277356,
+    0.5048947513342412, -0.38203538317165114, 0.3256556274794944,
+    -0.29440452772910475, 0.2763879141852547, -0.26684787830201323,
+    0.263599260349622, -0.26564286495098843, 0.27265435833524754,
+    -0.28478942756825043, 0.3026358615040232, -0.3272604966639856,
+    0.3603475488407222, -0.40445872173006553, 0.46348824733680727,
+    -0.5434621354560069, 0.6539877695042562, -0.8110123536563615,
+    1.0424067892319913, -1.400184700330912, 1.990044526729465,
+    -3.052903729046689, 5.236056777462739, -10.798774086274024,
+    32.97890604908189, 0.0, -255.69451838768086, 0.5, -0.20268848800612574,
+    0.15335830871657233, -0.1307142770529693, 0.11815545756083924,
+    -0.11090619450835745, 0.10705535982040107, -0.10572418577404215,
+    0.10650932544676198, -0.10927732948425987, 0.11408587471519135,
+    -0.12116361175645075, 0.13092745423570135, -0.1440353787976368,
+    0.1614858733356905, -0.18479118724979254, 0.2162794533830679,
+    -0.2596372589292104, 0.32092869092899656, -0.41062249408858376,
+    0.5479233947464931, -0.7708944588085617, 1.1630061922565174,
+    -1.9344199183146993, 3.732295692628381, -9.320305069939872,
+    41.612041929154444, 189.0};
+inline constexpr std::array<double, 56> lift_matrix_27{
+    392.0, -5.647767898180209, 4.224521457361844, -3.536154821521737,
+    3.1179091647447237, -2.835021140198473, 2.632035104700093,
+    -2.48146735652219, 2.368029677891979, -2.282549294511328,
+    2.2192536440887904, -2.174427830880219, 2.145703873370282,
+    -2.1316717107922973, 2.1316717107922973, -2.145703873370282,
+    2.174427830880219, -2.2192536440887904, 2.282549294511328,
+    -2.368029677891979, 2.48146735652219, -2.632035104700093,
+    2.835021140198473, -3.1179091647447237, 3.536154821521737,
+    -4.224521457361844, 5.647767898180209, -14.0, -14.0, 5.647767898180209,
+    -4.224521457361844, 3.536154821521737, -3.1179091647447237,
+    2.835021140198473, -2.632035104700093, 2.48146735652219,
+    -2.368029677891979, 2.282549294511328, -2.2192536440887904,
+    2.174427830880219, -2.145703873370282, 2.1316717107922973,
+    -2.1316717107922973, 2.145703873370282, -2.174427830880219,
+    2.2192536440887904, -2.282549294511328, 2.368029677891979,
+    -2.48146735652219, 2.632035104700093, -2.835021140198473,
+    3.1179091647447237, -3.536154821521737, 4.224521457361844,
+    -5.647767898180209, 392.0};
+
+// Polynomial order 28
+inline constexpr std::array<double, 29> nodes_28{
+    -1.0, -0.9909729882685698, -0.9698458072879363, -0.9369427185209825,
+    -0.8926657199760882, -0.8375527362817866, -0.7722728972064687,
+    -0.697618661356368, -0.614496252203433, -0.523914674371969,
+    -0.42697347171349437, -0.324849382841911, -0.21878205828426103,
+    -0.11005901339559211, 0.0, 0.11005901339559211, 0.21878205828426103,
+    0.324849382841911, 0.42697347171349437, 0.523914674371969,
+    0.614496252203433, 0.697618661356368, 0.7722728972064687,
+    0.8375527362817866, 0.8926657199760882, 0.9369427185209825,
+    0.9698458072879363, 0.9909729882685698, 1.0};
+inline constexpr std::array<double, 29> weights_28{
+    0.0024630541871921183, 0.015138169859967597, 0.027070806296824828,
+    0.038668439979712976, 0.04979580909323756, 0.06031850382852273,
+    0.070108938000598, 0.0790483130278856, 0.08702813344113561,
+    0.09395154211479631, 0.09973450163714986, 0.10430681646367654,
+    0.10761298583356854, 0.10961287784589042, 0.11028221677968261,
+    0.10961287784589042, 0.10761298583356854, 0.10430681646367654,
+    0.09973450163714986, 0.09395154211479631, 0.08702813344113561,
+    0.0790483130278856, 0.070108938000598, 0.06031850382852273,
+    0.04979580909323756, 0.038668439979712976, 0.027070806296824828,
+    0.015138169859967597, 0.0024630541871921183};
+inline constexpr std::array<double, 841> diff_matrix_28{
+    -203.0, -44.6844368892081, 10.003193770002747, -4.002426947837093,
+    2.072059103548056, -1.24393962576352, 0.8230677173570413,
+    -0.5837618302083567, 0.4363937722651467, -0.3400949876387299,
+    0.27424552149348724, -0.2276040412459609, 0.19365665833850793,
+    -0.16843990363825714, 0.14944598078727722, -0.13503928369433588,
+    0.12413052440215015, -0.11598828584216665, 0.1101281573867181,
+    -0.10624888365299943, 0.10420057308507012, -0.10398017392576502,
+    0.10575957403176833, -0.10996940901126571, 0.11750779321407709,
+    -0.13029923922669395, 0.15312783952977027, -0.20259789479214246, 0.5,
+    274.63488186468874, 0.0, -35.39521369963573, 11.580337732980704,
+    -5.6086025102056265, 3.2653423052345425, -2.1247166875286556,
+    1.4917563170777004, -1.1078187410279359, 0.8594361620969622,
+    -0.6907728253891472, 0.5719071388722281, -0.4857129134840019,
+    0.4218639329833977, -0.37387129874233294, 0.337525006991855,
+    -0.31003227259711236, 0.2895230037723889, -0.2747604021478996,
+    0.2649746345356704, -0.2597794920389566, 0.2591586725011666,
+    -0.2635342789519647, 0.2739746193154478, -0.2927134536487,
+    0.3245415602339974, -0.3813718469932187, 0.5045546204782041,
+    -1.2451863059219306, -109.9425754843238, 63.295430211245524, 0.0,
+    -25.42936999550001, 9.553201396991108, -5.063936104861843,
+    3.1451148175636523, -2.149675281391273, 1.5695132454243843,
+    -1.2037348806261006, 0.9596882418964704, -0.7898360339419495,
+    0.667792372358242, -0.5780015930621533, 0.5108520721969718,
+    -0.46018697856078217, 0.42196103361416193, -0.3934836721993955,
+    0.37298182029253996, -0.3593500200591574, 0.3520236240145262,
+    -0.3509519858066729, 0.356686077385716, -0.37065630105463776,
+    0.3958724051552794, -0.4388031535351786, 0.5155458695008367,
+    -0.6819875515016739, 1.682989397520045, 62.83564811948353,
+    -29.58043136751594, 36.32378203335009, 0.0, -19.902322343025265,
+    8.055832590047073, -4.510011167100853, 2.922440420742874,
+    -2.06723985530837, 1.5532695498798716, -1.2209886520498805,
+    0.994727969341399, -0.8346883914608635, 0.7182954278138425,
+    -0.6319933982238666, 0.5672834787370373, -0.5186705159687643,
+    0.4825409512310262, -0.4565285372404901, 0.43915572275856823,
+    -0.4296489897142019, 0.42788867210757664, -0.43450500111238327,
+    0.451209416107356, -0.48164136045744216, 0.533650553140835,
+    -0.6267945335405105, 0.8289982183392937, -2.0456181344445095,
+    -41.89102297737468, 18.449053119466722, -17.572782567973093,
+    25.629486072500168, 0.0, -16.48607202879452, 7.000178351777369,
+    -4.069215482438155, 2.7192998741056433, -1.9742910634478432,
+    1.5173112462335376, -1.2168363298536229, 1.0094367896284009,
+    -0.8612357344135783, 0.7527569876170326, -0.6721773576208478,
+    0.6120332177063267, -0.5674997756578671, 0.5354494546861163,
+    -0.5139291048202831, 0.5018877948468541, -0.49908589938761655,
+    0.5061875692975486, -0.5251340462932949, 0.5601200861767084,
+    -0.6202402075007121, 0.7281935564182004, -0.9628576896510069,
+    2.3756666289694626, 30.463226294101617, -13.010856937243311,
+    11.28333770259108, -12.56621082152845, 19.969857240881517, 0.0,
+    -14.208869019470145, 6.242456089233523, -3.732334793662246,
+    2.554727378434372, -1.8941115696468838, 1.4832104510337556,
+    -1.209938271599423, 1.019683143032256, -0.8829993315944248,
+    0.7828238581269041, -0.7087471969152466, 0.6542030159712342,
+    -0.6149994601605072, 0.5885265687669694, -0.5733425546104309,
+    0.5690128929273693, -0.5761820806787687, 0.5969773344896336,
+    -0.6361037315915679, 0.7038369509402451, -0.8258872406342983,
+    1.0916603048429707, -2.693075228697364, -23.42798784799028,
+    9.840134698759506, -8.145330335993538, 8.17700671302399,
+    -9.855750493760665, 16.515143014432546, 0.0, -12.614961713884751,
+    5.688714559586798, -3.4782131625765254, 2.4281087139610587,
+    -1.8323631289560918, 1.4582900629451274, -1.2076959846950686,
+    1.032436041555913, -0.9064083922137751, 0.8144353507941948,
+    -0.7472661577098036, 0.699126189325318, -0.6664489450744557,
+    0.647221131197973, -0.6407005479704467, 0.6474395279293661,
+    -0.669703510654082, 0.7126758970038437, -0.7877919098861964,
+    0.9237583029820858, -1.220498157636285, 3.010364716017737,
+    18.735027482544886, -7.789635167558903, 6.277175592352288,
+    -5.974225629620115, 6.459672512427818, -8.180833271451643,
+    14.223456678026539, 0.0, -11.465641187297038, 5.280615665224906,
+    -3.289449925347664, 2.3353385298564837, -1.7898911515506963,
+    1.4453184645868176, -1.2135997265267557, 1.0514229064269165,
+    -0.9352517741512246, 0.8514128767165625, -0.7916414962251466,
+    0.7509119628200102, -0.7263477521077745, 0.7167239463288705,
+    -0.7223943040283068, 0.7457000161160503, -0.7922734688119333,
+    0.8747153418030671, -1.0248000051279544, 1.3532716343696356,
+    -3.3370996788942118, -15.419285390902122, 6.368761753541086,
+    -5.045723672310572, 4.652580400890175, -4.752520274688495,
+    5.385049526315255, -7.061556256864539, 12.623082176140366, 0.0,
+    -10.625221604315696, 4.981419192338586, -3.1535857928449453,
+    2.272562653865709, -1.7664115860622966, 1.4456323306339927,
+    -1.229780287822178, 1.0792136161313945, -0.9724069800105247,
+    0.8969339734812937, -0.8454322734086357, 0.8136746126719611,
+    -0.7996715764548317, 0.8034132106143084, -0.827224304037254,
+    0.8771492777760884, -0.9669784876067867, 1.131697319586734,
+    -1.4934516198172145, 3.681762839910656, 12.972694112993533,
+    -5.333891317454439, 4.177664569431654, -3.7739321681384435,
+    3.7249658831143666, -3.9792196697906466, 4.661081735758998,
+    -6.2761868793887565, 11.470497131966109, 0.0, -10.012000030072388,
+    4.767602808757776, -3.0621818865052606, 2.237032359082551,
+    -1.7617271611114202, 1.460326388077307, -1.258079548329228,
+    1.1181720467054788, -1.0207039891363512, 0.9543538756561147,
+    -0.9126895257851801, 0.8924837760231658, -0.8930944886084315,
+    0.9166835249822655, -0.9696485068680123, 1.0670034116543559,
+    -1.2471548934802417, 1.6445036464919205, -4.052792065672997,
+    -11.104806607423528, 4.5510047860448575, -3.5356918254704306,
+    3.1492011257940096, -3.038976245735819, 3.131846140960857,
+    -3.4541417886783776, 4.150267556616628, -5.708721317453772,
+    10.628264432001696, 0.0, -9.574986510353247, 4.6241036098361965,
+    -3.0098847584995823, 2.227250548694151, -1.7761979475886753,
+    1.4908097904765358, -1.3006212399671944, 1.1710329402748176,
+    -1.0835309499356536, 1.0278890205900082, -0.998806515623557,
+    0.9945522505738931, -1.016879742915974, 1.0724353211133133,
+    -1.1774885712665166, 1.3741428887900027, -1.8101984606679729,
+    4.459332218631865, 9.638705100393205, -3.9406225138459074,
+    3.043325763017417, -2.6832452455753066, 2.5488957009760154,
+    -2.5648673371077186, 2.726156892937116, -3.0815550399963807,
+    3.7797029706402414, -5.293084711022407, 10.013950480357922, 0.0,
+    -9.28201765575384, 4.541619544771373, -2.993791531908436,
+    2.242992198691304, -1.8110041192672335, 1.5391748496666426,
+    -1.3602480459528812, 1.2414162005772287, -1.165469973690295,
+    1.1234669440087455, -1.1117691436302803, 1.131291885337309,
+    -1.1887364824595554, 1.3016379885681681, -1.516136192159515,
+    1.9949057974544049, -4.911937750369783, -8.46102831952538,
+    3.4527962997798656, -2.6546357843350066, 2.3229101068687266,
+    -2.1814789019447045, 2.158625659072651, -2.238387178017291,
+    2.436681110038445, -2.8100941960539916, 3.507452124305296,
+    -4.989382691946003, 9.576225872480853, 0.0, -9.113389748818086,
+    4.515105404391593, -3.013113531369715, 2.2853793584406072,
+    -1.8684067565143843, 1.6085756707018866, -1.4410162256456862,
+    1.3344811038914843, -1.273211686213358, 1.2501090783407038,
+    -1.2644611059658937, 1.3226559259913437, -1.443442841669317,
+    1.6773969062740761, -2.203932104578296, 5.42337088378482,
+    7.496052128240777, -3.0546440013188656, 2.340396415251327,
+    -2.03614185179251, 1.8957926193353378, -1.85300358438028,
+    1.888190524925991, -2.004160623279557, 2.2248145484997037,
+    -2.609936454409749, 3.308004000099502, -4.772650582782307,
+    9.282754024167021, 0.0, -9.058419539466342, 4.543017282944544,
+    -3.069109577171518, 2.357092644755895, -1.952124545300155,
+    1.7037567919413523, -1.5489216088670072, 1.4579626837310051,
+    -1.4171378886579484, 1.4225746742600283, -1.4796284252297307,
+    1.6080704236172343, -1.8633511877763638, 2.443960379858672,
+    -6.009630070241415, -6.691381024314125, 2.723668448498417,
+    -2.081131176908627, 1.8024423272006556, -1.6671224105499323,
+    1.6144154367629335, -1.6240345181816254, 1.6931223829833468,
+    -1.8319080482006425, 2.06795090655299, -2.4627999719433373,
+    3.16529617055352, -4.627098013620075, 9.113733778044343, 0.0,
+    -9.113733778044343, 4.627098013620075, -3.16529617055352,
+    2.4627999719433373, -2.06795090655299, 1.8319080482006425,
+    -1.6931223829833468, 1.6240345181816254, -1.6144154367629335,
+    1.6671224105499323, -1.8024423272006556, 2.081131176908627,
+    -2.723668448498417, 6.691381024314125, 6.009630070241415,
+    -2.443960379858672, 1.8633511877763638, -1.6080704236172343,
+    1.4796284252297307, -1.4225746742600283, 1.4171378886579484,
+    -1.4579626837310051, 1.5489216088670072, -1.7037567919413523,
+    1.952124545300155, -2.357092644755895, 3.069109577171518,
+    -4.543017282944544, 9.058419539466342, 0.0, -9.282754024167021,
+    4.772650582782307, -3.308004000099502, 2.609936454409749,
+    -2.2248145484997037, 2.004160623279557, -1.888190524925991,
+    1.85300358438028, -1.8957926193353378, 2.03614185179251,
+    -2.340396415251327, 3.0546440013188656, -7.496052128240777,
+    -5.42337088378482, 2.203932104578296, -1.6773969062740761,
+    1.443442841669317, -1.3226559259913437, 1.2644611059658937,
+    -1.2501090783407038, 1.273211686213358, -1.3344811038914843,
+    1.4410162256456862, -1.6085756707018866, 1.8684067565143843,
+    -2.2853793584406072, 3.013113531369715, -4.515105404391593,
+    9.113389748818086, 0.0, -9.576225872480853, 4.989382691946003,
+    -3.507452124305296, 2.8100941960539916, -2.436681110038445,
+    2.238387178017291, -2.158625659072651, 2.1814789019447045,
+    -2.3229101068687266, 2.6546357843350066, -3.4527962997798656,
+    8.46102831952538, 4.911937750369783, -1.9949057974544049,
+    1.516136192159515, -1.3016379885681681, 1.1887364824595554,
+    -1.131291885337309, 1.1117691436302803, -1.1234669440087455,
+    1.165469973690295, -1.2414162005772287, 1.3602480459528812,
+    -1.5391748496666426, 1.8110041192672335, -2.242992198691304,
+    2.993791531908436, -4.541619544771373, 9.28201765575384, 0.0,
+    -10.013950480357922, 5.293084711022407, -3.7797029706402414,
+    3.0815550399963807, -2.726156892937116, 2.5648673371077186,
+    -2.5488957009760154, 2.6832452455753066, -3.043325763017417,
+    3.9406225138459074, -9.638705100393205, -4.459332218631865,
+    1.8101984606679729, -1.3741428887900027, 1.1774885712665166,
+    -1.0724353211133133, 1.016879742915974, -0.9945522505738931,
+    0.998806515623557, -1.0278890205900082, 1.0835309499356536,
+    -1.1710329402748176, 1.3006212399671944, -1.4908097904765358,
+    1.7761979475886753, -2.227250548694151, 3.0098847584995823,
+    -4.6241036098361965, 9.574986510353247, 0.0, -10.628264432001696,
+    5.708721317453772, -4.150267556616628, 3.4541417886783776,
+    -3.131846140960857, 3.038976245735819, -3.1492011257940096,
+    3.5356918254704306, -4.5510047860448575, 11.104806607423528,
+    4.052792065672997, -1.6445036464919205, 1.2471548934802417,
+    -1.0670034116543559, 0.9696485068680123, -0.9166835249822655,
+    0.8930944886084315, -0.8924837760231658, 0.9126895257851801,
+    -0.9543538756561147, 1.0207039891363512, -1.1181720467054788,
+    1.258079548329228, -1.460326388077307, 1.7617271611114202,
+    -2.237032359082551, 3.0621818865052606, -4.767602808757776,
+    10.012000030072388, 0.0, -11.470497131966109, 6.2761868793887565,
+    -4.661081735758998, 3.9792196697906466, -3.7249658831143666,
+    3.7739321681384435, -4.177664569431654, 5.333891317454439,
+    -12.972694112993533, -3.681762839910656, 1.4934516198172145,
+    -1.131697319586734, 0.9669784876067867, -0.8771492777760884,
+    0.827224304037254, -0.8034132106143084, 0.7996715764548317,
+    -0.8136746126719611, 0.8454322734086357, -0.8969339734812937,
+    0.9724069800105247, -1.0792136161313945, 1.229780287822178,
+    -1.4456323306339927, 1.7664115860622966, -2.272562653865709,
+    3.1535857928449453, -4.981419192338586, 10.625221604315696, 0.0,
+    -12.623082176140366, 7.061556256864539, -5.385049526315255,
+    4.752520274688495, -4.652580400890175, 5.045723672310572,
+    -6.368761753541086, 15.419285390902122, 3.3370996788942118,
+    -1.3532716343696356, 1.0248000051279544, -0.8747153418030671,
+    0.7922734688119333, -0.7457000161160503, 0.7223943040283068,
+    -0.7167239463288705, 0.7263477521077745, -0.7509119628200102,
+    0.7916414962251466, -0.8514128767165625, 0.9352517741512246,
+    -1.0514229064269165, 1.2135997265267557, -1.4453184645868176,
+    1.7898911515506963, -2.3353385298564837, 3.289449925347664,
+    -5.280615665224906, 11.465641187297038, 0.0, -14.223456678026539,
+    8.180833271451643, -6.459672512427818, 5.974225629620115,
+    -6.277175592352288, 7.789635167558903, -18.735027482544886,
+    -3.010364716017737, 1.220498157636285, -0.9237583029820858,
+    0.7877919098861964, -0.7126758970038437, 0.669703510654082,
+    -0.6474395279293661, 0.6407005479704467, -0.647221131197973,
+    0.6664489450744557, -0.699126189325318, 0.7472661577098036,
+    -0.8144353507941948, 0.9064083922137751, -1.032436041555913,
+    1.2076959846950686, -1.4582900629451274, 1.8323631289560918,
+    -2.4281087139610587, 3.4782131625765254, -5.688714559586798,
+    12.614961713884751, 0.0, -16.515143014432546, 9.855750493760665,
+    -8.17700671302399, 8.145330335993538, -9.840134698759506,
+    23.42798784799028, 2.693075228697364, -1.0916603048429707,
+    0.8258872406342983, -0.7038369509402451, 0.6361037315915679,
+    -0.5969773344896336, 0.5761820806787687, -0.5690128929273693,
+    0.5733425546104309, -0.5885265687669694, 0.6149994601605072,
+    -0.6542030159712342, 0.7087471969152466, -0.7828238581269041,
+    0.8829993315944248, -1.019683143032256, 1.209938271599423,
+    -1.4832104510337556, 1.8941115696468838, -2.554727378434372,
+    3.732334793662246, -6.242456089233523, 14.208869019470145, 0.0,
+    -19.969857240881517, 12.56621082152845, -11.28333770259108,
+    13.010856937243311, -30.463226294101617, -2.3756666289694626,
+    0.9628576896510069, -0.7281935564182004, 0.6202402075007121,
+    -0.5601200861767084, 0.5251340462932949, -0.5061875692975486,
+    0.49908589938761655, -0.5018877948468541, 0.5139291048202831,
+    -0.5354494546861163, 0.5674997756578671, -0.6120332177063267,
+    0.6721773576208478, -0.7527569876170326, 0.8612357344135783,
+    -1.0094367896284009, 1.2168363298536229, -1.5173112462335376,
+    1.9742910634478432, -2.7192998741056433, 4.069215482438155,
+    -7.000178351777369, 16.48607202879452, 0.0, -25.629486072500168,
+    17.572782567973093, -18.449053119466722, 41.89102297737468,
+    2.0456181344445095, -0.8289982183392937, 0.6267945335405105,
+    -0.533650553140835, 0.48164136045744216, -0.451209416107356,
+    0.43450500111238327, -0.42788867210757664, 0.4296489897142019,
+    -0.43915572275856823, 0.4565285372404901, -0.4825409512310262,
+    0.5186705159687643, -0.5672834787370373, 0.6319933982238666,
+    -0.7182954278138425, 0.8346883914608635, -0.994727969341399,
+    1.2209886520498805, -1.5532695498798716, 2.06723985530837,
+    -2.922440420742874, 4.510011167100853, -8.055832590047073,
+    19.902322343025265, 0.0, -36.32378203335009, 29.58043136751594,
+    -62.83564811948353, -1.682989397520045, 0.6819875515016739,
+    -0.5155458695008367, 0.4388031535351786, -0.3958724051552794,
+    0.37065630105463776, -0.356686077385716, 0.3509519858066729,
+    -0.3520236240145262, 0.3593500200591574, -0.37298182029253996,
+    0.3934836721993955, -0.42196103361416193, 0.46018697856078217,
+    -0.5108520721969718, 0.5780015930621533, -0.667792372358242,
+    0.7898360339419495, -0.9596882418964704, 1.2037348806261006,
+    -1.5695132454243843, 2.149675281391273, -3.1451148175636523,
+    5.063936104861843, -9.553201396991108, 25.42936999550001, 0.0,
+    -63.295430211245524, 109.9425754843238, 1.2451863059219306,
+    -0.5045546204782041, 0.3813718469932187, -0.3245415602339974,
+    0.2927134536487, -0.2739746193154478, 0.2635342789519647,
+    -0.2591586725011666, 0.2597794920389566, -0.2649746345356704,
+    0.2747604021478996, -0.2895230037723889, 0.31003227259711236,
+    -0.337525006991855, 0.37387129874233294, -0.4218639329833977,
+    0.4857129134840019, -0.5719071388722281, 0.6907728253891472,
+    -0.8594361620969622, 1.1078187410279359, -1.4917563170777004,
+    2.1247166875286556, -3.2653423052345425, 5.6086025102056265,
+    -11.580337732980704, 35.39521369963573, 0.0, -274.63488186468874, -0.5,
+    0.20259789479214246, -0.15312783952977027, 0.13029923922669395,
+    -0.11750779321407709, 0.10996940901126571, -0.10575957403176833,
+    0.10398017392576502, -0.10420057308507012, 0.10624888365299943,
+    -0.1101281573867181, 0.11598828584216665, -0.12413052440215015,
+    0.13503928369433588, -0.14944598078727722, 0.16843990363825714,
+    -0.19365665833850793, 0.2276040412459609, -0.27424552149348724,
+    0.3400949876387299, -0.4363937722651467, 0.5837618302083567,
+    -0.8230677173570413, 1.24393962576352, -2.072059103548056,
+    4.002426947837093, -10.003193770002747, 44.6844368892081, 203.0};
+inline constexpr std::array<double, 58> lift_matrix_28{
+    420.5, -5.848820572162881, 4.37375437381328, -3.6595413584100425,
+    3.2248430946716766, -2.930081532321163, 2.717804986810759,
+    -2.5595209131781633, 2.4393558034877865, -2.347756377549465,
+    2.2786744066532614, -2.228171629265842, 2.1936768123879804,
+    -2.1735728233970386, 2.1669667214155197, -2.1735728233970386,
+    2.1936768123879804, -2.228171629265842, 2.2786744066532614,
+    -2.347756377549465, 2.4393558034877865, -2.5595209131781633,
+    2.717804986810759, -2.930081532321163, 3.2248430946716766,
+    -3.6595413584100425, 4.37375437381328, -5.848820572162881, 14.5, 14.5,
+    -5.848820572162881, 4.37375437381328, -3.6595413584100425,
+    3.2248430946716766, -2.930081532321163, 2.717804986810759,
+    -2.5595209131781633, 2.4393558034877865, -2.347756377549465,
+    2.2786744066532614, -2.228171629265842, 2.1936768123879804,
+    -2.1735728233970386, 2.1669667214155197, -2.1735728233970386,
+    2.1936768123879804, -2.228171629265842, 2.2786744066532614,
+    -2.347756377549465, 2.4393558034877865, -2.5595209131781633,
+    2.717804986810759, -2.930081532321163, 3.2248430946716766,
+    -3.6595413584100425, 4.37375437381328, -5.848820572162881, 420.5};
+
+// Polynomial order 29
+inline constexpr std::array<double, 30> nodes_29{
+    -1.0, -0.9915739428405003, -0.9718466031662693, -0.9411047809510571,
+    -0.8996992181992769, -0.8480994871801981, -0.7868903572375471,
+    -0.7167653986370851, -0.6385191758075585, -0.5530382600950529,
+    -0.46129119016824066, -0.364317500422449, -0.2632159437195738,
+    -0.15913204262585046, -0.05324511048548667, 0.05324511048548667,
+    0.15913204262585046, 0.2632159437195738, 0.364317500422449,
+    0.46129119016824066, 0.5530382600950529, 0.6385191758075585,
+    0.7167653986370851, 0.7868903572375471, 0.8480994871801981,
+    0.8996992181992769, 0.9411047809510571, 0.9718466031662693,
+    0.9915739428405003, 1.0};
+inline constexpr std::array<double, 30> weights_29{
+    0.0022988505747126436, 0.014131799327905387, 0.0252831667405514,
+    0.03614209419940854, 0.04659069453314293, 0.05651119792308038,
+    0.06579133639779006, 0.07432600332471825, 0.08201851283340691,
+    0.08878171231976521, 0.0945389751938609, 0.09922507100429984,
+    0.10278690530723499, 0.10518412159645465, 0.10638955872366793,
+    0.10638955872366793, 0.10518412159645465, 0.10278690530723499,
+    0.09922507100429984, 0.0945389751938609, 0.08878171231976521,
+    0.08201851283340691, 0.07432600332471825, 0.06579133639779006,
+    0.05651119792308038, 0.04659069453314293, 0.03614209419940854,
+    0.0252831667405514, 0.014131799327905387, 0.0022988505747126436};
+inline constexpr std::array<double, 900> diff_matrix_29{
+    -217.5, -47.86656245933621, 10.710477548980961, -4.282217020999305,
+    2.2146314399149216, -1.327788413764118, 0.8771379800802354,
+    -0.6209243243928907, 0.4631419954977061, -0.3600172117746771,
+    0.28946485937440575, -0.23944424699628042, 0.2029767324565284,
+    -0.17581360374482738, 0.15526312071722048, -0.13956496663208215,
+    0.12754028050557503, -0.11838832545883937, 0.11156531921120222,
+    -0.10671197563556817, 0.1036123342902633, -0.1021757649971536,
+    0.10244105201303337, -0.10460997835214615, 0.10913467720003482,
+    -0.11692864991252877, 0.1299270971571652, -0.15292078208874696,
+    0.2025164030494805, -0.5, 294.2516850085151, 0.0, -37.8978414017035,
+    12.3898480852705, -5.9945017062708095, 3.485434200924735,
+    -2.2642864131148985, 1.586712010922623, -1.17571133679708,
+    0.9097708880688887, -0.7290977932676125, 0.6016485732750024,
+    -0.5090787176026879, 0.44032131250486767, -0.38841336558444434,
+    0.3488254340689365, -0.3185365460126732, 0.29550091224009,
+    -0.2783319752724386, 0.2661141602184031, -0.2582958989855064,
+    0.25464219642565145, -0.2552432102948444, 0.2605968879150784,
+    -0.2718258396066797, 0.2912023524524554, -0.3235432982748379,
+    0.38077608578155514, -0.5042488294596378, 1.2449357082994421,
+    -117.79573353769081, 67.80293301888138, 0.0, -27.20692572634555,
+    10.210465628888691, -5.40522020412939, 3.351678691999289,
+    -2.286477252475219, 1.665669136964767, -1.2742030821953965,
+    1.0129019431293285, -0.8308792978698141, 0.69988534624801,
+    -0.6032573216183068, 0.5306877756917479, -0.4755580173029222,
+    0.43349714060112127, -0.40156688072142455, 0.3777854478858532,
+    -0.3608463696276226, 0.3499588030857376, -0.34477459438381014,
+    0.3453945436056889, -0.35247676166943265, 0.36752759605275914,
+    -0.3936095958805777, 0.4372251593250625, -0.5144844858962346,
+    0.6812455402348618, -1.6818499097657125, 67.32420656554135,
+    -31.687051749310395, 38.89209301067352, 0.0, -21.27151257667571,
+    8.598678893556839, -4.8061498490826216, 3.1083559572696737,
+    -2.193827357931693, 1.6441397194089946, -1.2886312718670543,
+    1.0463579369928337, -0.8747405894563706, 0.7496179059029198,
+    -0.6564668854949269, 0.586162353560513, -0.5327769022225773,
+    0.4923745551484504, -0.4623223898879822, 0.4408903123531306,
+    -0.4270244301813975, 0.4202396246523649, -0.42061595898845805,
+    0.42892344595020077, -0.4469711316818025, 0.4784642738854127,
+    -0.5312904685222324, 0.6250100336257634, -0.827462384124424,
+    2.0426892622618364, -44.8838293604482, 19.76308829433848,
+    -18.81539168088931, 27.42106030850931, 0.0, -17.596848612886014,
+    7.4597113685260235, -4.327979547209218, 2.885716476082712,
+    -2.0896949867365904, 1.601273988522936, -1.2798979583697863,
+    1.0577759810477927, -0.8986902733972302, 0.7818018100991739,
+    -0.6944365307151474, 0.6285614546046306, -0.5789388100954693,
+    0.5421083103064055, -0.5158091984555437, 0.49865559130355896,
+    -0.4899769463752843, 0.4897934797407175, -0.49894862083962216,
+    0.5195064239455582, -0.5557412854050671, 0.6167872483156248,
+    -0.72532624711021, 0.9600560788925326, -2.3697873494576354,
+    32.6401875248357, -13.937790751627203, 12.081376985244184,
+    -13.444756193423801, 21.34372549604064, 0.0, -15.141423142789911,
+    6.639255807265501, -3.9605986066506738, 2.703916986461325,
+    -1.998784765167342, 1.559936262602127, -1.2677363977366196,
+    1.0638820064029155, -0.9169173341814822, 0.808587257336313,
+    -0.7277175560617236, 0.6672076494806402, -0.6224500910609536,
+    0.5904628347236084, -0.5694094427997136, 0.5583566989100334,
+    -0.5572114359230348, 0.5668495983800695, -0.5895534752207244,
+    0.6301243336266426, -0.6988768815943966, 0.8214724419556015,
+    -1.0869956094187911, 2.682789134432355, -25.103014762910526,
+    10.541504705067736, -8.721669345673945, 8.748884880731602,
+    -10.533957155929244, 17.627912699435374, 0.0, -13.416565214568006,
+    6.036411725877866, -3.681131455727941, 2.5620973292018387,
+    -1.926957106058854, 1.5277563721165752, -1.2598440471013999,
+    1.071886354401261, -0.9360208670825045, 0.8360030119753548,
+    -0.7618723184855574, 0.7073264518212988, -0.668345689032532,
+    0.6424523662259406, -0.6283313802826901, 0.6256991180037234,
+    -0.6354125392453622, 0.6599363309328071, -0.7045719512835639,
+    0.7807916875461741, -0.9172077784941097, 1.2132225429484174,
+    -2.9938571702042385, 20.075608178662627, -8.345289899944072,
+    6.721654672980234, -6.392315673235515, 6.90441354091325, -8.73224011064411,
+    15.157005851271583, 0.0, -12.16609106686325, 5.588406125607418,
+    -3.470706449683651, 2.4556403222940286, -1.8748945454155799,
+    1.507462626887282, -1.2596986960941254, 1.0854860185856463,
+    -0.959714464379082, 0.8677281519014558, -0.8005725288195319,
+    0.7526599243927895, -0.7205631655448546, 0.7023991053481725,
+    -0.6975783163511239, 0.7068668501249681, -0.732868892557516,
+    0.7813661540876394, -0.864994236186715, 1.0153710672326997,
+    -1.3424481381875295, 3.3121047780411343, -16.52400470011696,
+    6.8236247294466885, -5.403425405063602, 4.978528812360418,
+    -5.080031027629274, 5.748283872688518, -7.525269126821874,
+    13.425243544180615, 0.0, -11.244108322412984, 5.255550320746628,
+    -3.3156992571089132, 2.3801522889133495, -1.8420205866629382,
+    1.5001930920404354, -1.2692533094642098, 1.107051488038006,
+    -0.9906222210345185, 0.9065985647735746, -0.8469010891214774,
+    0.8066389808917479, -0.7830618389301024, 0.775095221849681,
+    -0.7833068637754432, 0.8103807344078154, -0.862558089486455,
+    0.9536644129553554, -1.11844769226422, 1.4778991528858514,
+    -3.645432367316762, 13.903880868785366, -5.715550821750966,
+    4.474357687915271, -4.038768168128388, 3.982054807457884,
+    -4.247978964368952, 4.967480093999952, -6.675298586984425,
+    12.171291040114326, 0.0, -10.56243647526823, 5.012234404466332,
+    -3.2067199966463646, 2.3323505789332533, -1.8277717285516593,
+    1.5067340344588969, -1.2900389005967126, 1.138590175771618,
+    -1.0311296066145983, 0.9553824919925176, -0.9040965807936381,
+    0.8731539682132637, -0.8607059280738628, 0.8669533753283026,
+    -0.8945686377346284, 0.9502218779387771, -1.0489696558451482,
+    1.228878569609501, -1.6227199144997577, 4.001512998245813,
+    -11.904084354552749, 4.877521721916643, -3.7874492803043815,
+    3.370747670926787, -3.2492068082792005, 3.3438162749483293,
+    -3.681610210577909, 4.414565781484652, -6.057831631406753,
+    11.247382978215073, 0.0, -10.065626600750255, 4.841794411958039,
+    -3.1375785428704632, 2.310184850863708, -1.8320609654552176,
+    1.5280666611910656, -1.3237131513888838, 1.1822803735021032,
+    -1.083914045307567, 1.0173365589731, -0.9761840137084007,
+    0.9573459454118021, -0.9603804995591, 0.9877998226265381,
+    -1.046648338390082, 1.1532624001474796, -1.3492790019972227,
+    1.7802517151474206, -4.388471755612007, 10.33510949825301,
+    -4.2244176426255775, 3.260827971952736, -2.8726874547221373,
+    2.7258225504056113, -2.739010888241333, 2.9061950423817873,
+    -3.278275091371871, 4.011295533775286, -5.601821610312027,
+    10.564558290526827, 0.0, -9.718158348821174, 4.733572567090184,
+    -3.104557726311154, 2.3128081068393347, -1.8554992875448935,
+    1.5656869709855668, -1.3724292668351605, 1.2408834955866355,
+    -1.1524209857821297, 1.0967927100162416, -1.068762781030525,
+    1.0667744607106864, -1.0929277161355455, 1.1545381780885304,
+    -1.2692671241021598, 1.4826381629933225, -1.9542812184319494,
+    4.815483373351779, -9.075557327682802, 3.7027574993107364,
+    -2.845333796550624, 2.487732936580036, -2.333631655198522,
+    2.3058562879175684, -2.3868393340395206, 2.5928288819559384,
+    -2.9828447198775283, 3.712575664850372, -5.264210477408984,
+    10.06700637097766, 0.0, -9.4975205456943, 4.681234745725521,
+    -3.1059833336946205, 2.3405793825785115, -1.8995809787749496,
+    1.6218896776651455, -1.439198786180477, 1.3182012097183984,
+    -1.2414635295270118, 1.1999984849482024, -1.1902858665599172,
+    1.21356849629655, -1.2772363504827118, 1.400296742532533,
+    -1.6325414204160174, 2.1493104720675125, -5.29341477531263,
+    8.044367771453965, -3.2773470243500324, 2.509697148390822,
+    -2.1816085291112643, 2.028901864240757, -1.9802003574243934,
+    2.0141799315591107, -2.133319769070522, 2.3622876187022315,
+    -2.7632520311895408, 3.4908718049351637, -5.017851511145606,
+    9.71902357559177, 0.0, -9.390381201709998, 4.681853214956461,
+    -3.142044755722734, 2.3951668322673383, -1.9669329606707922,
+    1.7001279014144293, -1.528373412035585, 1.4197311595717794,
+    -1.3581615908783073, 1.3365626430651403, -1.3544984838024252,
+    1.419053421170751, -1.5505374469440427, 1.8034535157959928,
+    -2.3708931899811936, 5.835617382317787, -7.185493081136632,
+    2.9241235038842466, -2.2330920353159285, 1.932406624784041,
+    -1.7852395294654362, 1.726214169135639, -1.7333211709999834,
+    1.8031211474768465, -1.9459616560795319, 2.1902689480445585,
+    -2.599769527324565, 3.3287204855724877, -4.845310765909248,
+    9.497997389090967, 0.0, -9.39053361784812, 4.735508458769056,
+    -3.214847215091496, 2.479803051876838, -2.0617121908710376,
+    1.8055606819415515, -1.6464002435246698, 1.5537547204510056,
+    -1.5136164190821588, 1.5222689424259523, -1.585741461995663,
+    1.725454916686874, -2.0011103880912393, 2.6260905027786516,
+    -6.458991017772736, 6.458991017772736, -2.6260905027786516,
+    2.0011103880912393, -1.725454916686874, 1.585741461995663,
+    -1.5222689424259523, 1.5136164190821588, -1.5537547204510056,
+    1.6464002435246698, -1.8055606819415515, 2.0617121908710376,
+    -2.479803051876838, 3.214847215091496, -4.735508458769056,
+    9.39053361784812, 0.0, -9.497997389090967, 4.845310765909248,
+    -3.3287204855724877, 2.599769527324565, -2.1902689480445585,
+    1.9459616560795319, -1.8031211474768465, 1.7333211709999834,
+    -1.726214169135639, 1.7852395294654362, -1.932406624784041,
+    2.2330920353159285, -2.9241235038842466, 7.185493081136632,
+    -5.835617382317787, 2.3708931899811936, -1.8034535157959928,
+    1.5505374469440427, -1.419053421170751, 1.3544984838024252,
+    -1.3365626430651403, 1.3581615908783073, -1.4197311595717794,
+    1.528373412035585, -1.7001279014144293, 1.9669329606707922,
+    -2.3951668322673383, 3.142044755722734, -4.681853214956461,
+    9.390381201709998, 0.0, -9.71902357559177, 5.017851511145606,
+    -3.4908718049351637, 2.7632520311895408, -2.3622876187022315,
+    2.133319769070522, -2.0141799315591107, 1.9802003574243934,
+    -2.028901864240757, 2.1816085291112643, -2.509697148390822,
+    3.2773470243500324, -8.044367771453965, 5.29341477531263,
+    -2.1493104720675125, 1.6325414204160174, -1.400296742532533,
+    1.2772363504827118, -1.21356849629655, 1.1902858665599172,
+    -1.1999984849482024, 1.2414635295270118, -1.3182012097183984,
+    1.439198786180477, -1.6218896776651455, 1.8995809787749496,
+    -2.3405793825785115, 3.1059833336946205, -4.681234745725521,
+    9.4975205456943, 0.0, -10.06700637097766, 5.264210477408984,
+    -3.712575664850372, 2.9828447198775283, -2.5928288819559384,
+    2.3868393340395206, -2.3058562879175684, 2.333631655198522,
+    -2.487732936580036, 2.845333796550624, -3.7027574993107364,
+    9.075557327682802, -4.815483373351779, 1.9542812184319494,
+    -1.4826381629933225, 1.2692671241021598, -1.1545381780885304,
+    1.0929277161355455, -1.0667744607106864, 1.068762781030525,
+    -1.0967927100162416, 1.1524209857821297, -1.2408834955866355,
+    1.3724292668351605, -1.5656869709855668, 1.8554992875448935,
+    -2.3128081068393347, 3.104557726311154, -4.733572567090184,
+    9.718158348821174, 0.0, -10.564558290526827, 5.601821610312027,
+    -4.011295533775286, 3.278275091371871, -2.9061950423817873,
+    2.739010888241333, -2.7258225504056113, 2.8726874547221373,
+    -3.260827971952736, 4.2244176426255775, -10.33510949825301,
+    4.388471755612007, -1.7802517151474206, 1.3492790019972227,
+    -1.1532624001474796, 1.046648338390082, -0.9877998226265381,
+    0.9603804995591, -0.9573459454118021, 0.9761840137084007, -1.0173365589731,
+    1.083914045307567, -1.1822803735021032, 1.3237131513888838,
+    -1.5280666611910656, 1.8320609654552176, -2.310184850863708,
+    3.1375785428704632, -4.841794411958039, 10.065626600750255, 0.0,
+    -11.247382978215073, 6.057831631406753, -4.414565781484652,
+    3.681610210577909, -3.3438162749483293, 3.2492068082792005,
+    -3.370747670926787, 3.7874492803043815, -4.877521721916643,
+    11.904084354552749, -4.001512998245813, 1.6227199144997577,
+    -1.228878569609501, 1.0489696558451482, -0.9502218779387771,
+    0.8945686377346284, -0.8669533753283026, 0.8607059280738628,
+    -0.8731539682132637, 0.9040965807936381, -0.9553824919925176,
+    1.0311296066145983, -1.138590175771618, 1.2900389005967126,
+    -1.5067340344588969, 1.8277717285516593, -2.3323505789332533,
+    3.2067199966463646, -5.012234404466332, 10.56243647526823, 0.0,
+    -12.171291040114326, 6.675298586984425, -4.967480093999952,
+    4.247978964368952, -3.982054807457884, 4.038768168128388,
+    -4.474357687915271, 5.715550821750966, -13.903880868785366,
+    3.645432367316762, -1.4778991528858514, 1.11844769226422,
+    -0.9536644129553554, 0.862558089486455, -0.8103807344078154,
+    0.7833068637754432, -0.775095221849681, 0.7830618389301024,
+    -0.8066389808917479, 0.8469010891214774, -0.9065985647735746,
+    0.9906222210345185, -1.107051488038006, 1.2692533094642098,
+    -1.5001930920404354, 1.8420205866629382, -2.3801522889133495,
+    3.3156992571089132, -5.255550320746628, 11.244108322412984, 0.0,
+    -13.425243544180615, 7.525269126821874, -5.748283872688518,
+    5.080031027629274, -4.978528812360418, 5.403425405063602,
+    -6.8236247294466885, 16.52400470011696, -3.3121047780411343,
+    1.3424481381875295, -1.0153710672326997, 0.864994236186715,
+    -0.7813661540876394, 0.732868892557516, -0.7068668501249681,
+    0.6975783163511239, -0.7023991053481725, 0.7205631655448546,
+    -0.7526599243927895, 0.8005725288195319, -0.8677281519014558,
+    0.959714464379082, -1.0854860185856463, 1.2596986960941254,
+    -1.507462626887282, 1.8748945454155799, -2.4556403222940286,
+    3.470706449683651, -5.588406125607418, 12.16609106686325, 0.0,
+    -15.157005851271583, 8.73224011064411, -6.90441354091325,
+    6.392315673235515, -6.721654672980234, 8.345289899944072,
+    -20.075608178662627, 2.9938571702042385, -1.2132225429484174,
+    0.9172077784941097, -0.7807916875461741, 0.7045719512835639,
+    -0.6599363309328071, 0.6354125392453622, -0.6256991180037234,
+    0.6283313802826901, -0.6424523662259406, 0.668345689032532,
+    -0.7073264518212988, 0.7618723184855574, -0.8360030119753548,
+    0.9360208670825045, -1.071886354401261, 1.2598440471013999,
+    -1.5277563721165752, 1.926957106058854, -2.5620973292018387,
+    3.681131455727941, -6.036411725877866, 13.416565214568006, 0.0,
+    -17.627912699435374, 10.533957155929244, -8.748884880731602,
+    8.721669345673945, -10.541504705067736, 25.103014762910526,
+    -2.682789134432355, 1.0869956094187911, -0.8214724419556015,
+    0.6988768815943966, -0.6301243336266426, 0.5895534752207244,
+    -0.5668495983800695, 0.5572114359230348, -0.5583566989100334,
+    0.5694094427997136, -0.5904628347236084, 0.6224500910609536,
+    -0.6672076494806402, 0.7277175560617236, -0.808587257336313,
+    0.9169173341814822, -1.0638820064029155, 1.2677363977366196,
+    -1.559936262602127, 1.998784765167342, -2.703916986461325,
+    3.9605986066506738, -6.639255807265501, 15.141423142789911, 0.0,
+    -21.34372549604064, 13.444756193423801, -12.081376985244184,
+    13.937790751627203, -32.6401875248357, 2.3697873494576354,
+    -0.9600560788925326, 0.72532624711021, -0.6167872483156248,
+    0.5557412854050671, -0.5195064239455582, 0.49894862083962216,
+    -0.4897934797407175, 0.4899769463752843, -0.49865559130355896,
+    0.5158091984555437, -0.5421083103064055, 0.5789388100954693,
+    -0.6285614546046306, 0.6944365307151474, -0.7818018100991739,
+    0.8986902733972302, -1.0577759810477927, 1.2798979583697863,
+    -1.601273988522936, 2.0896949867365904, -2.885716476082712,
+    4.327979547209218, -7.4597113685260235, 17.596848612886014, 0.0,
+    -27.42106030850931, 18.81539168088931, -19.76308829433848,
+    44.8838293604482, -2.0426892622618364, 0.827462384124424,
+    -0.6250100336257634, 0.5312904685222324, -0.4784642738854127,
+    0.4469711316818025, -0.42892344595020077, 0.42061595898845805,
+    -0.4202396246523649, 0.4270244301813975, -0.4408903123531306,
+    0.4623223898879822, -0.4923745551484504, 0.5327769022225773,
+    -0.586162353560513, 0.6564668854949269, -0.7496179059029198,
+    0.8747405894563706, -1.0463579369928337, 1.2886312718670543,
+    -1.6441397194089946, 2.193827357931693, -3.1083559572696737,
+    4.8061498490826216, -8.598678893556839, 21.27151257667571, 0.0,
+    -38.89209301067352, 31.687051749310395, -67.32420656554135,
+    1.6818499097657125, -0.6812455402348618, 0.5144844858962346,
+    -0.4372251593250625, 0.3936095958805777, -0.36752759605275914,
+    0.35247676166943265, -0.3453945436056889, 0.34477459438381014,
+    -0.3499588030857376, 0.3608463696276226, -0.3777854478858532,
+    0.40156688072142455, -0.43349714060112127, 0.4755580173029222,
+    -0.5306877756917479, 0.6032573216183068, -0.69988534624801,
+    0.8308792978698141, -1.0129019431293285, 1.2742030821953965,
+    -1.665669136964767, 2.286477252475219, -3.351678691999289,
+    5.40522020412939, -10.210465628888691, 27.20692572634555, 0.0,
+    -67.80293301888138, 117.79573353769081, -1.2449357082994421,
+    0.5042488294596378, -0.38077608578155514, 0.3235432982748379,
+    -0.2912023524524554, 0.2718258396066797, -0.2605968879150784,
+    0.2552432102948444, -0.25464219642565145, 0.2582958989855064,
+    -0.2661141602184031, 0.2783319752724386, -0.29550091224009,
+    0.3185365460126732, -0.3488254340689365, 0.38841336558444434,
+    -0.44032131250486767, 0.5090787176026879, -0.6016485732750024,
+    0.7290977932676125, -0.9097708880688887, 1.17571133679708,
+    -1.586712010922623, 2.2642864131148985, -3.485434200924735,
+    5.9945017062708095, -12.3898480852705, 37.8978414017035, 0.0,
+    -294.2516850085151, 0.5, -0.2025164030494805, 0.15292078208874696,
+    -0.1299270971571652, 0.11692864991252877, -0.10913467720003482,
+    0.10460997835214615, -0.10244105201303337, 0.1021757649971536,
+    -0.1036123342902633, 0.10671197563556817, -0.11156531921120222,
+    0.11838832545883937, -0.12754028050557503, 0.13956496663208215,
+    -0.15526312071722048, 0.17581360374482738, -0.2029767324565284,
+    0.23944424699628042, -0.28946485937440575, 0.3600172117746771,
+    -0.4631419954977061, 0.6209243243928907, -0.8771379800802354,
+    1.327788413764118, -2.2146314399149216, 4.282217020999305,
+    -10.710477548980961, 47.86656245933621, 217.5};
+inline constexpr std::array<double, 60> lift_matrix_29{
+    450.0, -6.049895869666947, 4.523044870728374, -3.783031642002988,
+    3.3319389723589175, -3.0253761145044122, 2.8038984238241778,
+    -2.6380088024393644, 2.5112542537596436, -2.4137087905580628,
+    2.3390590482255558, -2.2831577616009007, 2.2432503040480176,
+    -2.217540387892517, 2.2049417805046594, -2.2049417805046594,
+    2.217540387892517, -2.2432503040480176, 2.2831577616009007,
+    -2.3390590482255558, 2.4137087905580628, -2.5112542537596436,
+    2.6380088024393644, -2.8038984238241778, 3.0253761145044122,
+    -3.3319389723589175, 3.783031642002988, -4.523044870728374,
+    6.049895869666947, -15.0, -15.0, 6.049895869666947, -4.523044870728374,
+    3.783031642002988, -3.3319389723589175, 3.0253761145044122,
+    -2.8038984238241778, 2.6380088024393644, -2.5112542537596436,
+    2.4137087905580628, -2.3390590482255558, 2.2831577616009007,
+    -2.2432503040480176, 2.217540387892517, -2.2049417805046594,
+    2.2049417805046594, -2.217540387892517, 2.2432503040480176,
+    -2.2831577616009007, 2.3390590482255558, -2.4137087905580628,
+    2.5112542537596436, -2.6380088024393644, 2.8038984238241778,
+    -3.0253761145044122, 3.3319389723589175, -3.783031642002988,
+    4.523044870728374, -6.049895869666947, 450.0};
+
+// Polynomial order 30
+inline constexpr std::array<double, 31> nodes_30{
+    -1.0, -0.9921168443464811, -0.9736549358157365, -0.9448691702080392,
+    -0.9060669514412698, -0.8576599952974556, -0.800161543192463,
+    -0.7341811363090752, -0.6604182026115255, -0.5796546572080019,
+    -0.4927466190988324, -0.4006153382805618, -0.3042374312728726,
+    -0.2046345292475245, -0.10286244876068228, 0.0, 0.10286244876068228,
+    0.2046345292475245, 0.3042374312728726, 0.4006153382805618,
+    0.4927466190988324, 0.5796546572080019, 0.6604182026115255,
+    0.7341811363090752, 0.800161543192463, 0.8576599952974556,
+    0.9060669514412698, 0.9448691702080392, 0.9736549358157365,
+    0.9921168443464811, 1.0};
+inline constexpr std::array<double, 31> weights_30{
+    0.002150537634408602, 0.01322247102546467, 0.023666433230270317,
+    0.033853940405224055, 0.043681818160066915, 0.05304646549344878,
+    0.061848741290454624, 0.06999537759410057, 0.07740003234147562,
+    0.08398422051752973, 0.08967815104526082, 0.09442146837785796,
+    0.09816389301371276, 0.10086575479865051, 0.10249841359547039,
+    0.10304456295320734, 0.10249841359547039, 0.10086575479865051,
+    0.09816389301371276, 0.09442146837785796, 0.08967815104526082,
+    0.08398422051752973, 0.07740003234147562, 0.06999537759410057,
+    0.061848741290454624, 0.05304646549344878, 0.043681818160066915,
+    0.033853940405224055, 0.023666433230270317, 0.01322247102546467,
+    0.002150537634408602};
+inline constexpr std::array<double, 961> diff_matrix_30{
+    -232.5, -51.1584184280686, 11.442155812149847, -4.571664818389008,
+    2.3621352076375666, -1.4145500608406107, 0.9331017919270882,
+    -0.659406230054997, 0.49086102483674743, -0.3806873411753256,
+    0.3052848484675143, -0.2517865478462207, 0.21273383846718769,
+    -0.18358403844749333, 0.1614566422898877, -0.14446444809436798,
+    0.1313389687517632, -0.12121220305185865, 0.11348565710359922,
+    -0.10775049414465392, 0.1037394890343372, -0.10130071797195722,
+    0.10038884711083224, -0.1010751478689225, 0.10358493816747452,
+    -0.10838746747076099, 0.11640858732350906, -0.1295920974167838,
+    0.15273405893155326, -0.20244283190558296, 0.5, 314.54492799878676, 0.0,
+    -40.48678691239175, 13.227301868835603, -6.393749609599662,
+    3.7131727662480585, -2.4087446822374647, 1.6850397977084772,
+    -1.2460688740990022, 0.9619961274634129, -0.7689362672393628,
+    0.6326522868958769, -0.5335413867601188, 0.459773177141297,
+    -0.40389801572781614, 0.36106130539505255, -0.3280135872114538,
+    0.3025384001593468, -0.28311098507364724, 0.26869112754262353,
+    -0.25859877788456925, 0.2524457444099755, -0.2501123070325706,
+    0.2517710952358833, -0.25797962754934206, 0.2699036442798529,
+    -0.2898462574539367, 0.3226452043192885, -0.38023913265182957,
+    0.5039728967905548, -1.2447094328208324, -125.91968269044611,
+    72.46586793988673, 0.0, -29.04584448136754, 10.89046834080722,
+    -5.758364244290183, 3.565480230392911, -2.4281399811679902,
+    1.7653188072119907, -1.3473208429977508, 1.0682202208037312,
+    -0.8736679356396161, 0.7334887445324085, -0.6298783330304449,
+    0.55181456563202, -0.49220814328914636, 0.44636155893476953,
+    -0.4110953259940876, 0.38423439846801777, -0.36429975358924993,
+    0.35032422500371024, -0.3417507944966442, 0.3383953161161718,
+    -0.3404752461405067, 0.3487323907645451, -0.3647330705664138,
+    0.39158175953529406, -0.43580733152795265, 0.5135289532334119,
+    -0.680576575067532, 1.6808217395766762, 71.96752376619645,
+    -33.866308977124994, 41.548985371987605, 0.0, -22.68807762893884,
+    9.160395169227504, -5.112669955613373, 3.300882474938445,
+    -2.3250196419135607, 1.7384321195381365, -1.3589551394912462,
+    1.100190124228192, -0.9166853163009971, 0.7826423350489183,
+    -0.6825437315762191, 0.6066251240036942, -0.5485244496435246,
+    0.5039905205697256, -0.47014218605682, 0.4450312784593713,
+    -0.4273841933845081, 0.41645832521808096, -0.41198485580908434,
+    0.41419630851854916, -0.423970954384481, 0.4431942183521864,
+    -0.47562297869635967, 0.5291737901554255, -0.6234059558597252,
+    0.8260794444563874, -2.040049461465142, -47.979797683424984,
+    21.122421616175657, -20.100851408933366, 29.274479411438225, 0.0,
+    -18.74624775615077, 7.935362701661567, -4.595953594222204,
+    3.058195365081266, -2.209454169493792, 1.6885746327036526,
+    -1.3456601495265927, 1.1084113907203617, -0.9381939879043522,
+    0.8127662233166072, -0.7185839663041231, 0.6470398127598659,
+    -0.5924901450705325, 0.5511627529022797, -0.5205290518547477,
+    0.49893870282128083, -0.48541597582564155, 0.47957164685891235,
+    -0.48162179596630755, 0.4925470587116333, -0.5145063949218512,
+    0.551835600233135, -0.6136974372695998, 0.7227537435992585,
+    -0.957537474508012, 2.364496515837144, 34.89214966087886,
+    -14.896662706740125, 12.906924639271447, -14.353619709680755,
+    22.765128069631846, 0.0, -16.106702602739727, 7.050191894589007,
+    -4.197190815420316, 2.858750430810265, -2.1076336322744758,
+    1.6399636226359469, -1.3282978728056662, 1.1105196225501033,
+    -0.953101546680726, 0.8365666203109303, -0.7489660585083346,
+    0.6826709328884131, -0.632680646110387, 0.5956856909023681,
+    -0.5695349062599797, 0.5529393850159483, -0.5453351756310907,
+    0.5468822444073894, -0.5586309784686284, 0.5829816042971537,
+    -0.624807914917132, 0.6944505286329213, -0.8175207499106488,
+    1.0828107942361056, -2.673551004696162, -26.835694666849516,
+    11.267018577658622, -9.317858005901252, 9.340484375030577,
+    -11.23561736790668, 18.7793715010507, 0.0, -14.246748674618447,
+    6.3968142631080145, -3.8917454715663182, 2.70145142338745,
+    -2.0256436545463687, 1.6005687073607247, -1.3148980911533854,
+    1.1140065894102054, -0.9682226035239642, 0.8602161104342817,
+    -0.779319660321666, 0.718726323653489, -0.674012172590331,
+    0.6423244190767025, -0.6219354974453507, 0.6120255992667077,
+    -0.6126442853183683, 0.6248738198603165, -0.6513275209336372,
+    0.6973934898039397, -0.7745647791223303, 0.9113607955258293,
+    -1.2067120594765208, 2.97906808967316, 21.462255448179867,
+    -8.920042000814052, 7.181419066384786, -6.824804216628576,
+    7.3645173388555225, -9.302803479594122, 16.123312005414622, 0.0,
+    -12.892167165745757, 5.907897110325427, -3.659249292451484,
+    2.5811770275318846, -1.9640258473041543, 1.5731082881659524,
+    -1.3089632797995947, 1.1225841804056151, -0.9872520315453488,
+    0.8873245165170947, -0.8131793632534184, 0.7587196420863836,
+    -0.7200661020022538, 0.6948558897958869, -0.681890522478423,
+    0.6810308454853984, -0.6933409991376054, 0.7216169605406018,
+    -0.7717467103287562, 0.8563796906892601, -1.0069828935848013,
+    1.3327927014834657, -3.2897788103161227, -17.666586526853365,
+    7.294080733414165, -5.773397767284201, 5.31567650101098,
+    -5.418831681787264, 6.124115939392744, -8.005233744722721,
+    14.256000751462965, 0.0, -11.886564398496496, 5.5407401417260775,
+    -3.4849075490597072, 2.4930111120314042, -1.92194048631722,
+    1.5585606144651498, -1.3123177270106725, 1.1384861345012618,
+    -1.0126424234949287, 0.9204970039552888, -0.8533085225685558,
+    0.8056304319252808, -0.7741489347888734, 0.757096031004028,
+    -0.7540261986903543, 0.7659137468067618, -0.795697881812757,
+    0.8497554026006156, -0.9419181572996643, 1.1067070460831077,
+    -1.4640758611639106, 3.613096506092368, 14.86685426841779,
+    -6.110241780851825, 4.781189023509426, -4.312669802523722,
+    4.247975336424456, -4.526030610190294, 5.2845895173062605,
+    -7.088612859347817, 12.897718714572255, 0.0, -11.135137366164775,
+    5.267627493929477, -3.3583956714802046, 2.4331696955995477,
+    -1.898502294254157, 1.5574602725153681, -1.3262540875587598,
+    1.1634581049333916, -1.046462607241266, 0.962094569064666,
+    -0.9023981637752163, 0.8625825632253674, -0.8400034584724563,
+    0.8337254870590283, -0.8445243488438007, 0.8754246453939852,
+    -0.9332780564921914, 1.03314200364337, -1.2127587544681875,
+    1.6034415221185379, -3.956062754084538, -12.730482050005177,
+    5.215120727802639, -4.047758839651086, 3.5998345481881846,
+    -3.4666196907807927, 3.563077868902022, -3.916994327342338,
+    4.688234024019121, -6.4196786009092, 11.890073212315196, 0.0,
+    -10.577933659188302, 5.0703146783062225, -3.2727284264606076,
+    2.3991044049001835, -1.8932463527648566, 1.5704475988262392,
+    -1.3520764487242019, 1.1992723086287274, -1.090888825499693,
+    1.0147203057718246, -0.9635786143554025, 0.9334291650177968,
+    -0.9225494436560168, 0.9313441966992781, -0.9628320543889705,
+    1.0243140564793924, -1.1321288981408668, 1.3274678300283034,
+    -1.7538824791969831, 4.3259719886454535, 11.054935837925855,
+    -4.517760544627043, 3.4856544944944465, -3.068522180313572,
+    2.9087435598553886, -2.919096906742657, 3.092451750543179,
+    -3.481923142068979, 4.251291349486616, -5.922268728333098,
+    11.137428870495315, 0.0, -10.176114795906184, 4.936850290136479,
+    -3.223449111374985, 2.389435221789328, -1.906323003389155,
+    1.5985594807107242, -1.3914290868443073, 1.248080021463972,
+    -1.1485888540308085, 1.0816601186467762, -1.0409639536686468,
+    1.023487909563862, -1.0289816366942184, 1.060306602965408,
+    -1.1251618975510191, 1.2412294191823228, -1.4534390260207335,
+    1.918719334216522, -4.730891342143774, -9.7104935182556,
+    3.9610220742735693, -3.0423727117843957, 2.658048021574668,
+    -2.4908756493410453, 2.4580504858055225, -2.54035978861066,
+    2.7544165026003236, -3.161803279406514, 3.9254182674004494,
+    -5.55009020397742, 10.579448310664533, 0.0, -9.904487840104302,
+    4.859726173403106, -3.20812070612077, 2.4038996845256295,
+    -1.9386325215095401, 1.6434532657868341, -1.4465788169121803,
+    1.312752741067581, -1.2231445715286617, 1.1674358095492676,
+    -1.1404303363897492, 1.1407341923084362, -1.1707923360944152,
+    1.2385995773066032, -1.3632382730310793, 1.5937316796499783,
+    -2.1018216940127257, 5.180190164666501, 8.610564312250764,
+    -3.507314817269628, 2.6845259221896662, -2.331835199009975,
+    2.1663852083894923, -2.1116091129777956, 2.144395919468131,
+    -2.2669033344745504, 2.5046239900159706, -2.92225725722637,
+    3.681010582157781, -5.2737914310949785, 10.177098841695491, 0.0,
+    -9.747307045979786, 4.8348211564537245, -3.2260600531395904,
+    2.4433804101320726, -1.9919914192070107, 1.7076615242539175,
+    -1.52075182144662, 1.3973229638562803, -1.3196498670223085,
+    1.278665251709247, -1.27095012974669, 1.298071761885674,
+    -1.3681199229004268, 1.501609078888367, -1.752078141523877,
+    2.307871503660662, -5.685164563509351, -7.695308110111644,
+    3.130950772115959, -2.3898876956166326, 2.066514233164404,
+    -1.9071378441406535, 1.8416193354527728, -1.8461799830851056,
+    1.9167931404300373, -2.063952502891342, 2.317024223946869,
+    -2.7420770018782523, 3.499187482442752, -5.074312030520443,
+    9.905081373110843, 0.0, -9.695923316392822, 4.8608603627869105,
+    -3.2782785224837374, 2.5100461742293487, -2.0693925545195344,
+    1.7949565823816331, -1.6186247745301978, 1.5076611618453741,
+    -1.4456921375452698, 1.4255874061318627, -1.4471809218549607,
+    1.5182645122044265, -1.660748652411343, 1.9331747727112987,
+    -2.5427072036826015, 6.259846712249167, 6.922118301014612,
+    -2.8138011678827044, 2.1430932373183986, -1.8464444620381602,
+    1.69512565804054, -1.6250591056218002, 1.613130242263174,
+    -1.6526262193895302, 1.7471208027273433, -1.910928173285019,
+    2.175432262033888, -2.6076517593325215, 3.367627198904695,
+    -4.93925846307512, 9.747586772500677, 0.0, -9.747586772500677,
+    4.93925846307512, -3.367627198904695, 2.6076517593325215,
+    -2.175432262033888, 1.910928173285019, -1.7471208027273433,
+    1.6526262193895302, -1.613130242263174, 1.6250591056218002,
+    -1.69512565804054, 1.8464444620381602, -2.1430932373183986,
+    2.8138011678827044, -6.922118301014612, -6.259846712249167,
+    2.5427072036826015, -1.9331747727112987, 1.660748652411343,
+    -1.5182645122044265, 1.4471809218549607, -1.4255874061318627,
+    1.4456921375452698, -1.5076611618453741, 1.6186247745301978,
+    -1.7949565823816331, 2.0693925545195344, -2.5100461742293487,
+    3.2782785224837374, -4.8608603627869105, 9.695923316392822, 0.0,
+    -9.905081373110843, 5.074312030520443, -3.499187482442752,
+    2.7420770018782523, -2.317024223946869, 2.063952502891342,
+    -1.9167931404300373, 1.8461799830851056, -1.8416193354527728,
+    1.9071378441406535, -2.066514233164404, 2.3898876956166326,
+    -3.130950772115959, 7.695308110111644, 5.685164563509351,
+    -2.307871503660662, 1.752078141523877, -1.501609078888367,
+    1.3681199229004268, -1.298071761885674, 1.27095012974669,
+    -1.278665251709247, 1.3196498670223085, -1.3973229638562803,
+    1.52075182144662, -1.7076615242539175, 1.9919914192070107,
+    -2.4433804101320726, 3.2260600531395904, -4.8348211564537245,
+    9.747307045979786, 0.0, -10.177098841695491, 5.2737914310949785,
+    -3.681010582157781, 2.92225725722637, -2.5046239900159706,
+    2.2669033344745504, -2.144395919468131, 2.1116091129777956,
+    -2.1663852083894923, 2.331835199009975, -2.6845259221896662,
+    3.507314817269628, -8.610564312250764, -5.180190164666501,
+    2.1018216940127257, -1.5937316796499783, 1.3632382730310793,
+    -1.2385995773066032, 1.1707923360944152, -1.1407341923084362,
+    1.1404303363897492, -1.1674358095492676, 1.2231445715286617,
+    -1.312752741067581, 1.4465788169121803, -1.6434532657868341,
+    1.9386325215095401, -2.4038996845256295, 3.20812070612077,
+    -4.859726173403106, 9.904487840104302, 0.0, -10.579448310664533,
+    5.55009020397742, -3.9254182674004494, 3.161803279406514,
+    -2.7544165026003236, 2.54035978861066, -2.4580504858055225,
+    2.4908756493410453, -2.658048021574668, 3.0423727117843957,
+    -3.9610220742735693, 9.7104935182556, 4.730891342143774,
+    -1.918719334216522, 1.4534390260207335, -1.2412294191823228,
+    1.1251618975510191, -1.060306602965408, 1.0289816366942184,
+    -1.023487909563862, 1.0409639536686468, -1.0816601186467762,
+    1.1485888540308085, -1.248080021463972, 1.3914290868443073,
+    -1.5985594807107242, 1.906323003389155, -2.389435221789328,
+    3.223449111374985, -4.936850290136479, 10.176114795906184, 0.0,
+    -11.137428870495315, 5.922268728333098, -4.251291349486616,
+    3.481923142068979, -3.092451750543179, 2.919096906742657,
+    -2.9087435598553886, 3.068522180313572, -3.4856544944944465,
+    4.517760544627043, -11.054935837925855, -4.3259719886454535,
+    1.7538824791969831, -1.3274678300283034, 1.1321288981408668,
+    -1.0243140564793924, 0.9628320543889705, -0.9313441966992781,
+    0.9225494436560168, -0.9334291650177968, 0.9635786143554025,
+    -1.0147203057718246, 1.090888825499693, -1.1992723086287274,
+    1.3520764487242019, -1.5704475988262392, 1.8932463527648566,
+    -2.3991044049001835, 3.2727284264606076, -5.0703146783062225,
+    10.577933659188302, 0.0, -11.890073212315196, 6.4196786009092,
+    -4.688234024019121, 3.916994327342338, -3.563077868902022,
+    3.4666196907807927, -3.5998345481881846, 4.047758839651086,
+    -5.215120727802639, 12.730482050005177, 3.956062754084538,
+    -1.6034415221185379, 1.2127587544681875, -1.03314200364337,
+    0.9332780564921914, -0.8754246453939852, 0.8445243488438007,
+    -0.8337254870590283, 0.8400034584724563, -0.8625825632253674,
+    0.9023981637752163, -0.962094569064666, 1.046462607241266,
+    -1.1634581049333916, 1.3262540875587598, -1.5574602725153681,
+    1.898502294254157, -2.4331696955995477, 3.3583956714802046,
+    -5.267627493929477, 11.135137366164775, 0.0, -12.897718714572255,
+    7.088612859347817, -5.2845895173062605, 4.526030610190294,
+    -4.247975336424456, 4.312669802523722, -4.781189023509426,
+    6.110241780851825, -14.86685426841779, -3.613096506092368,
+    1.4640758611639106, -1.1067070460831077, 0.9419181572996643,
+    -0.8497554026006156, 0.795697881812757, -0.7659137468067618,
+    0.7540261986903543, -0.757096031004028, 0.7741489347888734,
+    -0.8056304319252808, 0.8533085225685558, -0.9204970039552888,
+    1.0126424234949287, -1.1384861345012618, 1.3123177270106725,
+    -1.5585606144651498, 1.92194048631722, -2.4930111120314042,
+    3.4849075490597072, -5.5407401417260775, 11.886564398496496, 0.0,
+    -14.256000751462965, 8.005233744722721, -6.124115939392744,
+    5.418831681787264, -5.31567650101098, 5.773397767284201,
+    -7.294080733414165, 17.666586526853365, 3.2897788103161227,
+    -1.3327927014834657, 1.0069828935848013, -0.8563796906892601,
+    0.7717467103287562, -0.7216169605406018, 0.6933409991376054,
+    -0.6810308454853984, 0.681890522478423, -0.6948558897958869,
+    0.7200661020022538, -0.7587196420863836, 0.8131793632534184,
+    -0.8873245165170947, 0.9872520315453488, -1.1225841804056151,
+    1.3089632797995947, -1.5731082881659524, 1.9640258473041543,
+    -2.5811770275318846, 3.659249292451484, -5.907897110325427,
+    12.892167165745757, 0.0, -16.123312005414622, 9.302803479594122,
+    -7.3645173388555225, 6.824804216628576, -7.181419066384786,
+    8.920042000814052, -21.462255448179867, -2.97906808967316,
+    1.2067120594765208, -0.9113607955258293, 0.7745647791223303,
+    -0.6973934898039397, 0.6513275209336372, -0.6248738198603165,
+    0.6126442853183683, -0.6120255992667077, 0.6219354974453507,
+    -0.6423244190767025, 0.674012172590331, -0.718726323653489,
+    0.779319660321666, -0.8602161104342817, 0.9682226035239642,
+    -1.1140065894102054, 1.3148980911533854, -1.6005687073607247,
+    2.0256436545463687, -2.70145142338745, 3.8917454715663182,
+    -6.3968142631080145, 14.246748674618447, 0.0, -18.7793715010507,
+    11.23561736790668, -9.340484375030577, 9.317858005901252,
+    -11.267018577658622, 26.835694666849516, 2.673551004696162,
+    -1.0828107942361056, 0.8175207499106488, -0.6944505286329213,
+    0.624807914917132, -0.5829816042971537, 0.5586309784686284,
+    -0.5468822444073894, 0.5453351756310907, -0.5529393850159483,
+    0.5695349062599797, -0.5956856909023681, 0.632680646110387,
+    -0.6826709328884131, 0.7489660585083346, -0.8365666203109303,
+    0.953101546680726, -1.1105196225501033, 1.3282978728056662,
+    -1.6399636226359469, 2.1076336322744758, -2.858750430810265,
+    4.197190815420316, -7.050191894589007, 16.106702602739727, 0.0,
+    -22.765128069631846, 14.353619709680755, -12.906924639271447,
+    14.896662706740125, -34.89214966087886, -2.364496515837144,
+    0.957537474508012, -0.7227537435992585, 0.6136974372695998,
+    -0.551835600233135, 0.5145063949218512, -0.4925470587116333,
+    0.48162179596630755, -0.47957164685891235, 0.48541597582564155,
+    -0.49893870282128083, 0.5205290518547477, -0.5511627529022797,
+    0.5924901450705325, -0.6470398127598659, 0.7185839663041231,
+    -0.8127662233166072, 0.9381939879043522, -1.1084113907203617,
+    1.3456601495265927, -1.6885746327036526, 2.209454169493792,
+    -3.058195365081266, 4.595953594222204, -7.935362701661567,
+    18.74624775615077, 0.0, -29.274479411438225, 20.100851408933366,
+    -21.122421616175657, 47.979797683424984, 2.040049461465142,
+    -0.8260794444563874, 0.6234059558597252, -0.5291737901554255,
+    0.47562297869635967, -0.4431942183521864, 0.423970954384481,
+    -0.41419630851854916, 0.41198485580908434, -0.41645832521808096,
+    0.4273841933845081, -0.4450312784593713, 0.47014218605682,
+    -0.5039905205697256, 0.5485244496435246, -0.6066251240036942,
+    0.6825437315762191, -0.7826423350489183, 0.9166853163009971,
+    -1.100190124228192, 1.3589551394912462, -1.7384321195381365,
+    2.3250196419135607, -3.300882474938445, 5.112669955613373,
+    -9.160395169227504, 22.68807762893884, 0.0, -41.548985371987605,
+    33.866308977124994, -71.96752376619645, -1.6808217395766762,
+    0.680576575067532, -0.5135289532334119, 0.43580733152795265,
+    -0.39158175953529406, 0.3647330705664138, -0.3487323907645451,
+    0.3404752461405067, -0.3383953161161718, 0.3417507944966442,
+    -0.35032422500371024, 0.36429975358924993, -0.38423439846801777,
+    0.4110953259940876, -0.44636155893476953, 0.49220814328914636,
+    -0.55181456563202, 0.6298783330304449, -0.7334887445324085,
+    0.8736679356396161, -1.0682202208037312, 1.3473208429977508,
+    -1.7653188072119907, 2.4281399811679902, -3.565480230392911,
+    5.758364244290183, -10.89046834080722, 29.04584448136754, 0.0,
+    -72.46586793988673, 125.91968269044611, 1.2447094328208324,
+    -0.5039728967905548, 0.38023913265182957, -0.3226452043192885,
+    0.2898462574539367, -0.2699036442798529, 0.25797962754934206,
+    -0.2517710952358833, 0.2501123070325706, -0.2524457444099755,
+    0.25859877788456925, -0.26869112754262353, 0.28311098507364724,
+    -0.3025384001593468, 0.3280135872114538, -0.36106130539505255,
+    0.40389801572781614, -0.459773177141297, 0.5335413867601188,
+    -0.6326522868958769, 0.7689362672393628, -0.9619961274634129,
+    1.2460688740990022, -1.6850397977084772, 2.4087446822374647,
+    -3.7131727662480585, 6.393749609599662, -13.227301868835603,
+    40.48678691239175, 0.0, -314.54492799878676, -0.5, 0.20244283190558296,
+    -0.15273405893155326, 0.1295920974167838, -0.11640858732350906,
+    0.10838746747076099, -0.10358493816747452, 0.1010751478689225,
+    -0.10038884711083224, 0.10130071797195722, -0.1037394890343372,
+    0.10775049414465392, -0.11348565710359922, 0.12121220305185865,
+    -0.1313389687517632, 0.14446444809436798, -0.1614566422898877,
+    0.18358403844749333, -0.21273383846718769, 0.2517865478462207,
+    -0.3052848484675143, 0.3806873411753256, -0.49086102483674743,
+    0.659406230054997, -0.9331017919270882, 1.4145500608406107,
+    -2.3621352076375666, 4.571664818389008, -11.442155812149847,
+    51.1584184280686, 232.5};
+inline constexpr std::array<double, 62> lift_matrix_30{
+    480.5, -6.250991519572883, 4.672387103800191, -3.9066149620117447,
+    3.4391796980002396, -3.1208794658365733, 2.89027914321738,
+    -2.716880529151005, 2.583655770771175, -2.4803123393052067,
+    2.4002799586072325, -2.3392134194978382, 2.2941897495602404,
+    -2.263254280017682, 2.245156658776721, -2.2391989454627037,
+    2.245156658776721, -2.263254280017682, 2.2941897495602404,
+    -2.3392134194978382, 2.4002799586072325, -2.4803123393052067,
+    2.583655770771175, -2.716880529151005, 2.89027914321738,
+    -3.1208794658365733, 3.4391796980002396, -3.9066149620117447,
+    4.672387103800191, -6.250991519572883, 15.5, 15.5, -6.250991519572883,
+    4.672387103800191, -3.9066149620117447, 3.4391796980002396,
+    -3.1208794658365733, 2.89027914321738, -2.716880529151005,
+    2.583655770771175, -2.4803123393052067, 2.4002799586072325,
+    -2.3392134194978382, 2.2941897495602404, -2.263254280017682,
+    2.245156658776721, -2.2391989454627037, 2.245156658776721,
+    -2.263254280017682, 2.2941897495602404, -2.3392134194978382,
+    2.4002799586072325, -2.4803123393052067, 2.583655770771175,
+    -2.716880529151005, 2.89027914321738, -3.1208794658365733,
+    3.4391796980002396, -3.9066149620117447, 4.672387103800191,
+    -6.250991519572883, 480.5};
+
+// Polynomial order 31
+inline constexpr std::array<double, 32> nodes_31{
+    -1.0, -0.9926089339727614, -0.9752946904827092, -0.9482848384172323,
+    -0.9118499390637319, -0.8663524760126755, -0.8122447317774424,
+    -0.7500644939366748, -0.6804297556155509, -0.6040325871484211,
+    -0.5216322628815653, -0.4340477172018469, -0.3421494065388815,
+    -0.2468506588502053, -0.14909859681364748, -0.049864725046593256,
+    0.049864725046593256, 0.14909859681364748, 0.2468506588502053,
+    0.3421494065388815, 0.4340477172018469, 0.5216322628815653,
+    0.6040325871484211, 0.6804297556155509, 0.7500644939366748,
+    0.8122447317774424, 0.8663524760126755, 0.9118499390637319,
+    0.9482848384172323, 0.9752946904827092, 0.9926089339727614, 1.0};
+inline constexpr std::array<double, 32> weights_31{
+    0.0020161290322580645, 0.012398106501373844, 0.022199552889291964,
+    0.031775135410915464, 0.041034201586062725, 0.049885271336221206,
+    0.05824049724805587, 0.06601687725715455, 0.07313713960267904,
+    0.07953052569210625, 0.08513349794966824, 0.08989037295735783,
+    0.09375387554681382, 0.0966856089480026, 0.09865643654076178,
+    0.09964677150127678, 0.09964677150127678, 0.09865643654076178,
+    0.0966856089480026, 0.09375387554681382, 0.08989037295735783,
+    0.08513349794966824, 0.07953052569210625, 0.07313713960267904,
+    0.06601687725715455, 0.05824049724805587, 0.049885271336221206,
+    0.041034201586062725, 0.031775135410915464, 0.022199552889291964,
+    0.012398106501373844, 0.0020161290322580645};
+inline constexpr std::array<double, 1024> diff_matrix_31{
+    -248.0, -54.560004617054936, 12.198228058529097, -4.870769420428605,
+    2.5145689645337432, -1.504222481324742, 0.9909562769107184,
+    -0.6992036975474627, 0.5195458037135738, -0.4020988112469842,
+    0.32169702246804255, -0.26462005451980064, 0.22291396471815914,
+    -0.19173312149176958, 0.16800306678199123, -0.14970699858557704,
+    0.1354859315396503, -0.12440537797261803, 0.11581473138193066,
+    -0.1092606257292739, 0.10443329195619323, -0.10113447278276695,
+    0.09926109187296159, -0.09880292758851061, 0.09985679418863562,
+    -0.10266674158611835, 0.10771577863181502, -0.11593975181998264,
+    0.12928942557213752, -0.15256508368116842, 0.20237618616268363, -0.5,
+    335.5146109870171, 0.0, -43.162048342631984, 14.092696331153427,
+    -6.806342232461454, 3.948552444135909, -2.558083986796652,
+    1.7867297516683127, -1.3188784210799074, 1.0160951860421608,
+    -0.8102668041031035, 0.6648907830271987, -0.5590656218216892,
+    0.48017404556339593, -0.4202662934604974, 0.37415555014954993,
+    -0.338361526058016, 0.31049892668159607, -0.28891120779693275,
+    0.27244599201026093, -0.2603164569987238, 0.2520184782219304,
+    -0.24728816719034466, 0.24609495548910165, -0.24867617774724454,
+    0.25563666804833146, -0.268176758801112, 0.2886244305313144,
+    -0.32183421251741945, 0.37975346213436556, -0.5037230503243896,
+    1.2445044286558584, -134.31442363471712, 77.28423488588834, 0.0,
+    -30.94611985777052, 11.593202447881891, -6.1233593314090395,
+    3.786508041904223, -2.5746488750729815, 1.8684436244887366,
+    -1.4230644399161159, 1.1256129019615013, -0.9181635375387477,
+    0.7685535320185728, -0.6578017219824976, 0.5741511832386731,
+    -0.5100314300419457, 0.46041460627989456, -0.4218821564720297,
+    0.3920742640286453, -0.36935612323591166, 0.35261355434989955,
+    -0.34113106220404715, 0.33452844424744066, -0.33274770384415336,
+    0.3360973630339224, -0.3453853784600852, 0.36222591259372894,
+    -0.3897570095793473, 0.4345284958594376, -0.5126655613725648,
+    0.6799713380917809, -1.679890815542719, 76.76560151317473,
+    -36.118203548073325, 44.294457362579806, 0.0, -24.152002056106856,
+    9.740966691165351, -5.429554592329842, 3.4999995599576796,
+    -2.46079155405861, 1.8361154685834251, -1.4319211188252488,
+    1.1561753077840122, -0.9604603008940333, 0.8172893922235502,
+    -0.7101220431425108, 0.6285395679629868, -0.5657394548644757,
+    0.5171572200919187, -0.47967340574679407, 0.45114194819296244,
+    -0.4301050854068133, 0.41562400544282047, -0.40718919548236365,
+    0.4046967638682437, -0.4084973010205424, 0.4195539786732675,
+    -0.4398126318492521, 0.473070970315104, -0.5272677361735977,
+    0.621958553160546, -0.8248296368056817, 2.0376617463580566,
+    -51.17893157719637, 22.52705436911732, -21.429161598289916,
+    31.189737140721657, 0.0, -19.93423819990677, 8.427105153522893,
+    -4.873108229618946, 3.236702436792118, -2.3335277485001344,
+    1.779163320655167, -1.4140613033489302, 1.161266114799901,
+    -0.9796499037967886, 0.8455266505707678, -0.74446033153237,
+    0.6672600742724917, -0.6078773529742724, 0.5622388406970537,
+    -0.5275711875963112, 0.5020007497923089, -0.4843178210322138,
+    0.4738496022901448, -0.4704187801882873, 0.47439144183726667,
+    -0.4868546778991418, 0.5100416343278018, -0.5483358374881171,
+    0.6109207501207308, -0.7204364781767463, 0.9552646659207299,
+    -2.3597175934175483, 37.21911912894063, -15.887475239803138,
+    13.759981710436357, -15.292799233798023, 24.23404972063528, 0.0,
+    -17.1046504659352, 7.47521772137997, -4.442063049949475,
+    3.0191731679002203, -2.220594096048061, 1.723215379303544,
+    -1.3915281458745015, 1.1594784101353999, -0.9914037362010648,
+    0.866572453091871, -0.7722467908877128, 0.7002682794587426,
+    -0.6452541854618554, 0.6035930401585218, -0.5728653477722427,
+    0.5515072670591514, -0.5386270506331672, 0.5339345316585314,
+    -0.5377807833985282, 0.5513496914857268, -0.5771323033567282,
+    0.6200575212325813, -0.690482422597657, 0.8139685526488472,
+    -1.0790414147014615, 2.6652216987432538, -28.626038013907742,
+    12.016680400093122, -9.933898772377388, 9.95180524656794,
+    -11.960724847380176, 19.969488422265783, 0.0, -15.105415282778683,
+    6.76984610390689, -4.1099785288376856, 2.8460862302213097,
+    -2.1283245259196373, 1.6766097599638115, -1.3727149618007126,
+    1.158618828878481, -1.0027886792645708, 0.8867853542214251,
+    -0.7992291363722108, 0.73281869611453, -0.6827533025746899,
+    0.6458564219096882, -0.6200782751085803, 0.6042230800656626,
+    -0.5978310142921451, 0.6011987252635067, -0.6155780153917965,
+    0.6436946082395171, -0.6910006149118972, 0.7689985274441143,
+    -0.9061180774242563, 1.200861329939473, -2.965763592083342,
+    22.894985360654772, -9.513897843555595, 7.656473065633219,
+    -7.271693365323854, 7.839981659710218, -9.892509704052252,
+    17.122318554291443, 0.0, -13.643712370483614, 6.238968690199041,
+    -3.8549599307037825, 2.7118193696248816, -2.057136477809175,
+    1.6420788122027141, -1.3611780853452147, 1.162449003226903,
+    -1.0175231809140957, 0.9097588831421886, -0.828873725404605,
+    0.768289989506042, -0.7237324370229598, 0.6924583969231405,
+    -0.6728383857765096, 0.6641594965828784, -0.6666093436522715,
+    0.6814719023403182, -0.7116851731564895, 0.763213133852043,
+    -0.84870499629997, 0.999484019904125, -1.3241396741751676,
+    3.269747927721074, -18.84705461218812, 7.780139264878342,
+    -6.155647498192778, 5.664027960694466, -5.7689232109343545,
+    6.512539206580699, -8.501424317880781, 15.11525745836026, 0.0,
+    -12.552342953759172, 5.836803940441248, -3.661030528466363,
+    2.610944262458668, -2.005948277738066, 1.6204699736022723,
+    -1.358649668191623, 1.1731116587092179, -1.0379466673518836,
+    0.9379441524393266, -0.8637288624808273, 0.8093588128058402,
+    -0.7710665648355987, 0.7465874454769775, -0.7348297100083093,
+    0.7357925403047256, -0.7507430811393934, 0.7828050912543983,
+    -0.8384489686290971, 0.9314944950829848, -1.0962479915647043,
+    1.4517282226223063, -3.584177100064367, 15.861648399967256,
+    -6.5179779097878265, 5.098168578650195, -4.595644567975128,
+    4.5227318037636035, -4.813373221531625, 5.612396329474021,
+    -7.5160849819558395, 13.649623696023038, 0.0, -11.72972328457288,
+    5.533501959640133, -3.5169379416138393, 2.5391977851348644,
+    -1.9735849645610224, 1.6121074102545927, -1.366236105208009,
+    1.1921573589199288, -1.0658989532231236, 0.9734141003539154,
+    -0.9061067886720652, 0.8586330133552161, -0.827769909501822,
+    0.8118514387693632, -0.8105683387324224, 0.825099054155652,
+    -0.8587162371058565, 0.9183926215815682, -1.019160747989561,
+    1.1984576069004766, -1.5862872231260685, 3.915566261444829,
+    -13.584047630137947, 5.563821160767732, -4.3166348511227115,
+    3.8364731434541444, -3.6912232005646524, 3.789634452397733,
+    -4.160288591169489, 4.971247308142807, -6.794188821105722,
+    12.556089180942955, 0.0, -11.111333075580966, 5.30924359605495,
+    -3.414928901714539, 2.4935725033807445, -1.9592532185718052,
+    1.617352473320573, -1.3849664032346807, 1.2210546451072524,
+    -1.1031933639879203, 1.0183126983949655, -0.9585296684640137,
+    0.9191242135753804, -0.8975411695494395, 0.89297476590803,
+    -0.9064042214088804, 0.941194495524698, -1.0048122938948105,
+    1.1135601770887882, -1.308210157634515, 1.7305234953908286,
+    -4.270525989921064, 11.798250514819497, -4.820678097546728,
+    3.7178254551701198, -3.270765907895735, 3.0976720157697906,
+    -3.1051344210887093, 3.2849287772108493, -3.692486901175707,
+    4.499648214298765, -6.25430990910314, 11.732184137528337, 0.0,
+    -10.655024397920428, 5.150823315211783, -3.3498592369319713,
+    2.472218433521129, -1.9627192692927353, 1.6368781214017718,
+    -1.416098211729301, 1.261507821006357, -1.1519470790523314,
+    1.075211408558053, -1.0241385488667787, 0.9947554133874871,
+    -0.9854537413503737, 0.9968368641341657, -1.032270214960289,
+    1.0996932529334418, -1.2167471841770132, 1.4278019052185953,
+    -1.8873804160304897, 4.656223591300996, -10.365927860493235,
+    4.227626914236027, -3.2457803340124656, 2.8338785768554566,
+    -2.653230588033684, 2.615223955161291, -2.6989581168362653,
+    2.921442596747951, -3.3469471840439735, 4.145912015726286,
+    -5.84684261002098, 11.112979048654946, 0.0, -10.333001742241267,
+    5.04963834158416, -3.3186155493259926, 2.474350822270315,
+    -1.9844086164414354, 1.67185401796179, -1.4613498969877083,
+    1.3157276286757398, -1.214899608759673, 1.14750083223897,
+    -1.1072066629777286, 1.0910871136699536, -1.0990766079165015,
+    1.1343866686930535, -1.2053809152409352, 1.3311133223463905,
+    -1.5598768219794419, 2.060223278879546, -5.080829124967517,
+    9.19476546903882, -3.7445976118351934, 2.8649207654808295,
+    -2.4868539992667262, 2.3082707556960407, -2.2472540119192415,
+    2.278857294580644, -2.40492123370204, 2.6518172819572188,
+    -3.0869138856899463, 3.87831450989605, -5.540198270743263,
+    10.656120185778507, 0.0, -10.127267433043711, 5.000507542610083,
+    -3.319779496555051, 2.5002225922004087, -2.025516165640099,
+    1.7241337796013272, -1.5231477345874993, 1.3867445220068273,
+    -1.2958180330454563, 1.239940501234651, -1.2139344393642701,
+    1.2165593569804172, -1.2506054828718243, 1.3247584353018627,
+    -1.4595536645568286, 1.7075992097451005, -2.2530501778359477,
+    5.554018443090412, -8.220993612728916, 3.3442183212744863,
+    -2.5515698472157853, 2.2048091811252735, -2.032856571379966,
+    1.960666087743153, -1.962641295443219, 2.0341613383868786,
+    -2.185890697741294, 2.448202851918802, -2.889661336187698,
+    3.6765358108552864, -5.313693132093947, 10.333700410127486, 0.0,
+    -10.0270033447587, 5.00101403021682, -3.353485617473184, 2.551186822827517,
+    -2.0881769590542403, 1.79650564566733, -1.6049598966624141,
+    1.4788535069190396, -1.4001110800420928, 1.3595549085500653,
+    -1.3538534576413652, 1.384897209605177, -1.4614884944816795,
+    1.6056859492742976, -1.8748751565054609, 2.470757744559066,
+    -6.087602073533397, 7.399238263778685, -3.007184412196758,
+    2.289369773405385, -1.9710990338314502, 1.8078350663746587,
+    -1.7309948389485423, 1.7157246093066179, -1.7546163196303666,
+    1.8511122224913614, -2.019869695908458, 2.2932601441983462,
+    -2.7405447017467277, 3.5272069918768243, -5.153656660081179,
+    10.12765660479625, 0.0, -10.02712838650576, 5.051215306543108,
+    -3.421453435802959, 2.6298760404592754, -2.1757462130137633,
+    1.8930733051904165, -1.7118083378388809, 1.5983232327095174,
+    -1.535863314328622, 1.5172483364353635, -1.5425775474996397,
+    1.6203632478020336, -1.7741579841945077, 2.0666555446687753,
+    -2.7194986321653443, 6.696364888237504, -6.696364888237504,
+    2.7194986321653443, -2.0666555446687753, 1.7741579841945077,
+    -1.6203632478020336, 1.5425775474996397, -1.5172483364353635,
+    1.535863314328622, -1.5983232327095174, 1.7118083378388809,
+    -1.8930733051904165, 2.1757462130137633, -2.6298760404592754,
+    3.421453435802959, -5.051215306543108, 10.02712838650576, 0.0,
+    -10.12765660479625, 5.153656660081179, -3.5272069918768243,
+    2.7405447017467277, -2.2932601441983462, 2.019869695908458,
+    -1.8511122224913614, 1.7546163196303666, -1.7157246093066179,
+    1.7309948389485423, -1.8078350663746587, 1.9710990338314502,
+    -2.289369773405385, 3.007184412196758, -7.399238263778685,
+    6.087602073533397, -2.470757744559066, 1.8748751565054609,
+    -1.6056859492742976, 1.4614884944816795, -1.384897209605177,
+    1.3538534576413652, -1.3595549085500653, 1.4001110800420928,
+    -1.4788535069190396, 1.6049598966624141, -1.79650564566733,
+    2.0881769590542403, -2.551186822827517, 3.353485617473184,
+    -5.00101403021682, 10.0270033447587, 0.0, -10.333700410127486,
+    5.313693132093947, -3.6765358108552864, 2.889661336187698,
+    -2.448202851918802, 2.185890697741294, -2.0341613383868786,
+    1.962641295443219, -1.960666087743153, 2.032856571379966,
+    -2.2048091811252735, 2.5515698472157853, -3.3442183212744863,
+    8.220993612728916, -5.554018443090412, 2.2530501778359477,
+    -1.7075992097451005, 1.4595536645568286, -1.3247584353018627,
+    1.2506054828718243, -1.2165593569804172, 1.2139344393642701,
+    -1.239940501234651, 1.2958180330454563, -1.3867445220068273,
+    1.5231477345874993, -1.7241337796013272, 2.025516165640099,
+    -2.5002225922004087, 3.319779496555051, -5.000507542610083,
+    10.127267433043711, 0.0, -10.656120185778507, 5.540198270743263,
+    -3.87831450989605, 3.0869138856899463, -2.6518172819572188,
+    2.40492123370204, -2.278857294580644, 2.2472540119192415,
+    -2.3082707556960407, 2.4868539992667262, -2.8649207654808295,
+    3.7445976118351934, -9.19476546903882, 5.080829124967517,
+    -2.060223278879546, 1.5598768219794419, -1.3311133223463905,
+    1.2053809152409352, -1.1343866686930535, 1.0990766079165015,
+    -1.0910871136699536, 1.1072066629777286, -1.14750083223897,
+    1.214899608759673, -1.3157276286757398, 1.4613498969877083,
+    -1.67185401796179, 1.9844086164414354, -2.474350822270315,
+    3.3186155493259926, -5.04963834158416, 10.333001742241267, 0.0,
+    -11.112979048654946, 5.84684261002098, -4.145912015726286,
+    3.3469471840439735, -2.921442596747951, 2.6989581168362653,
+    -2.615223955161291, 2.653230588033684, -2.8338785768554566,
+    3.2457803340124656, -4.227626914236027, 10.365927860493235,
+    -4.656223591300996, 1.8873804160304897, -1.4278019052185953,
+    1.2167471841770132, -1.0996932529334418, 1.032270214960289,
+    -0.9968368641341657, 0.9854537413503737, -0.9947554133874871,
+    1.0241385488667787, -1.075211408558053, 1.1519470790523314,
+    -1.261507821006357, 1.416098211729301, -1.6368781214017718,
+    1.9627192692927353, -2.472218433521129, 3.3498592369319713,
+    -5.150823315211783, 10.655024397920428, 0.0, -11.732184137528337,
+    6.25430990910314, -4.499648214298765, 3.692486901175707,
+    -3.2849287772108493, 3.1051344210887093, -3.0976720157697906,
+    3.270765907895735, -3.7178254551701198, 4.820678097546728,
+    -11.798250514819497, 4.270525989921064, -1.7305234953908286,
+    1.308210157634515, -1.1135601770887882, 1.0048122938948105,
+    -0.941194495524698, 0.9064042214088804, -0.89297476590803,
+    0.8975411695494395, -0.9191242135753804, 0.9585296684640137,
+    -1.0183126983949655, 1.1031933639879203, -1.2210546451072524,
+    1.3849664032346807, -1.617352473320573, 1.9592532185718052,
+    -2.4935725033807445, 3.414928901714539, -5.30924359605495,
+    11.111333075580966, 0.0, -12.556089180942955, 6.794188821105722,
+    -4.971247308142807, 4.160288591169489, -3.789634452397733,
+    3.6912232005646524, -3.8364731434541444, 4.3166348511227115,
+    -5.563821160767732, 13.584047630137947, -3.915566261444829,
+    1.5862872231260685, -1.1984576069004766, 1.019160747989561,
+    -0.9183926215815682, 0.8587162371058565, -0.825099054155652,
+    0.8105683387324224, -0.8118514387693632, 0.827769909501822,
+    -0.8586330133552161, 0.9061067886720652, -0.9734141003539154,
+    1.0658989532231236, -1.1921573589199288, 1.366236105208009,
+    -1.6121074102545927, 1.9735849645610224, -2.5391977851348644,
+    3.5169379416138393, -5.533501959640133, 11.72972328457288, 0.0,
+    -13.649623696023038, 7.5160849819558395, -5.612396329474021,
+    4.813373221531625, -4.5227318037636035, 4.595644567975128,
+    -5.098168578650195, 6.5179779097878265, -15.861648399967256,
+    3.584177100064367, -1.4517282226223063, 1.0962479915647043,
+    -0.9314944950829848, 0.8384489686290971, -0.7828050912543983,
+    0.7507430811393934, -0.7357925403047256, 0.7348297100083093,
+    -0.7465874454769775, 0.7710665648355987, -0.8093588128058402,
+    0.8637288624808273, -0.9379441524393266, 1.0379466673518836,
+    -1.1731116587092179, 1.358649668191623, -1.6204699736022723,
+    2.005948277738066, -2.610944262458668, 3.661030528466363,
+    -5.836803940441248, 12.552342953759172, 0.0, -15.11525745836026,
+    8.501424317880781, -6.512539206580699, 5.7689232109343545,
+    -5.664027960694466, 6.155647498192778, -7.780139264878342,
+    18.84705461218812, -3.269747927721074, 1.3241396741751676,
+    -0.999484019904125, 0.84870499629997, -0.763213133852043,
+    0.7116851731564895, -0.6814719023403182, 0.6666093436522715,
+    -0.6641594965828784, 0.6728383857765096, -0.6924583969231405,
+    0.7237324370229598, -0.768289989506042, 0.828873725404605,
+    -0.9097588831421886, 1.0175231809140957, -1.162449003226903,
+    1.3611780853452147, -1.6420788122027141, 2.057136477809175,
+    -2.7118193696248816, 3.8549599307037825, -6.238968690199041,
+    13.643712370483614, 0.0, -17.122318554291443, 9.892509704052252,
+    -7.839981659710218, 7.271693365323854, -7.656473065633219,
+    9.513897843555595, -22.894985360654772, 2.965763592083342,
+    -1.200861329939473, 0.9061180774242563, -0.7689985274441143,
+    0.6910006149118972, -0.6436946082395171, 0.6155780153917965,
+    -0.6011987252635067, 0.5978310142921451, -0.6042230800656626,
+    0.6200782751085803, -0.6458564219096882, 0.6827533025746899,
+    -0.73281869611453, 0.7992291363722108, -0.8867853542214251,
+    1.0027886792645708, -1.158618828878481, 1.3727149618007126,
+    -1.6766097599638115, 2.1283245259196373, -2.8460862302213097,
+    4.1099785288376856, -6.76984610390689, 15.105415282778683, 0.0,
+    -19.969488422265783, 11.960724847380176, -9.95180524656794,
+    9.933898772377388, -12.016680400093122, 28.626038013907742,
+    -2.6652216987432538, 1.0790414147014615, -0.8139685526488472,
+    0.690482422597657, -0.6200575212325813, 0.5771323033567282,
+    -0.5513496914857268, 0.5377807833985282, -0.5339345316585314,
+    0.5386270506331672, -0.5515072670591514, 0.5728653477722427,
+    -0.6035930401585218, 0.6452541854618554, -0.7002682794587426,
+    0.7722467908877128, -0.866572453091871, 0.9914037362010648,
+    -1.1594784101353999, 1.3915281458745015, -1.723215379303544,
+    2.220594096048061, -3.0191731679002203, 4.442063049949475,
+    -7.47521772137997, 17.1046504659352, 0.0, -24.23404972063528,
+    15.292799233798023, -13.759981710436357, 15.887475239803138,
+    -37.21911912894063, 2.3597175934175483, -0.9552646659207299,
+    0.7204364781767463, -0.6109207501207308, 0.5483358374881171,
+    -0.5100416343278018, 0.4868546778991418, -0.47439144183726667,
+    0.4704187801882873, -0.4738496022901448, 0.4843178210322138,
+    -0.5020007497923089, 0.5275711875963112, -0.5622388406970537,
+    0.6078773529742724, -0.6672600742724917, 0.74446033153237,
+    -0.8455266505707678, 0.9796499037967886, -1.161266114799901,
+    1.4140613033489302, -1.779163320655167, 2.3335277485001344,
+    -3.236702436792118, 4.873108229618946, -8.427105153522893,
+    19.93423819990677, 0.0, -31.189737140721657, 21.429161598289916,
+    -22.52705436911732, 51.17893157719637, -2.0376617463580566,
+    0.8248296368056817, -0.621958553160546, 0.5272677361735977,
+    -0.473070970315104, 0.4398126318492521, -0.4195539786732675,
+    0.4084973010205424, -0.4046967638682437, 0.40718919548236365,
+    -0.41562400544282047, 0.4301050854068133, -0.45114194819296244,
+    0.47967340574679407, -0.5171572200919187, 0.5657394548644757,
+    -0.6285395679629868, 0.7101220431425108, -0.8172893922235502,
+    0.9604603008940333, -1.1561753077840122, 1.4319211188252488,
+    -1.8361154685834251, 2.46079155405861, -3.4999995599576796,
+    5.429554592329842, -9.740966691165351, 24.152002056106856, 0.0,
+    -44.294457362579806, 36.118203548073325, -76.76560151317473,
+    1.679890815542719, -0.6799713380917809, 0.5126655613725648,
+    -0.4345284958594376, 0.3897570095793473, -0.36222591259372894,
+    0.3453853784600852, -0.3360973630339224, 0.33274770384415336,
+    -0.33452844424744066, 0.34113106220404715, -0.35261355434989955,
+    0.36935612323591166, -0.3920742640286453, 0.4218821564720297,
+    -0.46041460627989456, 0.5100314300419457, -0.5741511832386731,
+    0.6578017219824976, -0.7685535320185728, 0.9181635375387477,
+    -1.1256129019615013, 1.4230644399161159, -1.8684436244887366,
+    2.5746488750729815, -3.786508041904223, 6.1233593314090395,
+    -11.593202447881891, 30.94611985777052, 0.0, -77.28423488588834,
+    134.31442363471712, -1.2445044286558584, 0.5037230503243896,
+    -0.37975346213436556, 0.32183421251741945, -0.2886244305313144,
+    0.268176758801112, -0.25563666804833146, 0.24867617774724454,
+    -0.24609495548910165, 0.24728816719034466, -0.2520184782219304,
+    0.2603164569987238, -0.27244599201026093, 0.28891120779693275,
+    -0.31049892668159607, 0.338361526058016, -0.37415555014954993,
+    0.4202662934604974, -0.48017404556339593, 0.5590656218216892,
+    -0.6648907830271987, 0.8102668041031035, -1.0160951860421608,
+    1.3188784210799074, -1.7867297516683127, 2.558083986796652,
+    -3.948552444135909, 6.806342232461454, -14.092696331153427,
+    43.162048342631984, 0.0, -335.5146109870171, 0.5, -0.20237618616268363,
+    0.15256508368116842, -0.12928942557213752, 0.11593975181998264,
+    -0.10771577863181502, 0.10266674158611835, -0.09985679418863562,
+    0.09880292758851061, -0.09926109187296159, 0.10113447278276695,
+    -0.10443329195619323, 0.1092606257292739, -0.11581473138193066,
+    0.12440537797261803, -0.1354859315396503, 0.14970699858557704,
+    -0.16800306678199123, 0.19173312149176958, -0.22291396471815914,
+    0.26462005451980064, -0.32169702246804255, 0.4020988112469842,
+    -0.5195458037135738, 0.6992036975474627, -0.9909562769107184,
+    1.504222481324742, -2.5145689645337432, 4.870769420428605,
+    -12.198228058529097, 54.560004617054936, 248.0};
+inline constexpr std::array<double, 64> lift_matrix_31{
+    512.0, -6.45210554513757, 4.821775995975395, -4.0302820417579,
+    3.5465505192335685, -3.216569762481939, 2.9769161850911847,
+    -2.7960932798059726, 2.6565020713865897, -2.547488416002619,
+    2.462231626812412, -2.3961971828744466, 2.346305343689789,
+    -2.310458786049917, 2.2872647242305093, -2.2758704042169042,
+    2.2758704042169042, -2.2872647242305093, 2.310458786049917,
+    -2.346305343689789, 2.3961971828744466, -2.462231626812412,
+    2.547488416002619, -2.6565020713865897, 2.7960932798059726,
+    -2.9769161850911847, 3.216569762481939, -3.5465505192335685,
+    4.0302820417579, -4.821775995975395, 6.45210554513757, -16.0, -16.0,
+    6.45210554513757, -4.821775995975395, 4.0302820417579, -3.5465505192335685,
+    3.216569762481939, -2.9769161850911847, 2.7960932798059726,
+    -2.6565020713865897, 2.547488416002619, -2.462231626812412,
+    2.3961971828744466, -2.346305343689789, 2.310458786049917,
+    -2.2872647242305093, 2.2758704042169042, -2.2758704042169042,
+    2.2872647242305093, -2.310458786049917, 2.346305343689789,
+    -2.3961971828744466, 2.462231626812412, -2.547488416002619,
+    2.6565020713865897, -2.7960932798059726, 2.9769161850911847,
+    -3.216569762481939, 3.5465505192335685, -4.0302820417579,
+    4.821775995975395, -6.45210554513757, 512.0};
+
+// Polynomial order 32
+inline constexpr std::array<double, 33> nodes_32{
+    -1.0, -0.9930563584336584, -0.9767861633169063, -0.9513934513969957,
+    -0.9171173034509412, -0.8742781007505622, -0.8232759230040675,
+    -0.7645870017935287, -0.6987593166181626, -0.6264074912812683,
+    -0.5482070599191117, -0.4648881616321068, -0.37722872425339365,
+    -0.28604720148767404, -0.19219493146747724, -0.09654818817610701, 0.0,
+    0.09654818817610701, 0.19219493146747724, 0.28604720148767404,
+    0.37722872425339365, 0.4648881616321068, 0.5482070599191117,
+    0.6264074912812683, 0.6987593166181626, 0.7645870017935287,
+    0.8232759230040675, 0.8742781007505622, 0.9171173034509412,
+    0.9513934513969957, 0.9767861633169063, 0.9930563584336584, 1.0};
+inline constexpr std::array<double, 33> weights_32{
+    0.001893939393939394, 0.011648448392267734, 0.02086460901760336,
+    0.02988104591674648, 0.03861781477181397, 0.046993850461024174,
+    0.05493105944262697, 0.06235536785246531, 0.06919746949401614,
+    0.07539348692397382, 0.08088557219345509, 0.08562244853181314,
+    0.0895598897470774, 0.09266113344224146, 0.09489722439459182,
+    0.09624728497298546, 0.09669871010271656, 0.09624728497298546,
+    0.09489722439459182, 0.09266113344224146, 0.0895598897470774,
+    0.08562244853181314, 0.08088557219345509, 0.07539348692397382,
+    0.06919746949401614, 0.06235536785246531, 0.05493105944262697,
+    0.046993850461024174, 0.03861781477181397, 0.02988104591674648,
+    0.02086460901760336, 0.011648448392267734, 0.001893939393939394};
+inline constexpr std::array<double, 1089> diff_matrix_32{
+    -264.0, -58.07132087502716, 12.978693863671593, -5.179530049357926,
+    2.671931493704222, -1.5968039206327367, 1.050699024463748,
+    -0.7403135142859367, 0.54919213383198, -0.4242462035995199,
+    0.33869444015389755, -0.2779359073167012, 0.23350580964788842,
+    -0.200246407934336, 0.17488385174362556, -0.15526865888517538,
+    0.13994993409141898, -0.12792666359934646, 0.11849745214828139,
+    -0.11116736864041944, 0.10558936827831077, -0.10152774676462963,
+    0.09883675179350662, -0.09745110273212126, 0.09738814208997305,
+    -0.0987649936408258, 0.10184076527097778, -0.10710962346009577,
+    0.11551556432875698, -0.1290150271359185, 0.15241166965960926,
+    -0.20231562230237077, 0.5, 357.160734101727, 0.0, -45.92362409216148,
+    14.986029144527816, -7.232276210533113, 4.191568560338668,
+    -2.712298034631874, 1.8917735907992472, -1.3941292423924219,
+    1.0720542863884335, -0.853071825787858, 0.6983416929422193,
+    -0.585622954919576, 0.5014875979522655, -0.43747164405896755,
+    0.38804808488906634, -0.34950211080949634, 0.31927939327921845,
+    -0.2955948397639203, 0.27719125718710685, -0.26318815216361996,
+    0.25298759152782924, -0.24621904261494226, 0.2427145809394724,
+    -0.2425134829963085, 0.2459044337315539, -0.253530230146059,
+    0.2666191951353873, -0.28751952336103925, 0.321099334084409,
+    -0.379312719772051, 0.5034960964236178, -1.244318109058832,
+    -142.97995695702878, 82.25803378159621, 0.0, -32.907746442505335,
+    12.31866197471438, -6.500197986919262, 4.014752583605482,
+    -2.725991762432136, 1.9750281268969632, -1.5014143012177272,
+    1.1850552604118487, -0.9643348671405597, 0.805040175582585,
+    -0.6869772699855108, 0.5976334812343238, -0.5289453222887762,
+    0.47554901449666404, -0.43378632092042996, 0.40111682843133417,
+    -0.375759763318815, 0.3564715797783097, -0.3424081867183752,
+    0.333044051111528, -0.3281347499892866, 0.3277206431208111,
+    -0.3321821984497213, 0.3423802093212762, -0.3599673522261122,
+    0.38810875422275426, -0.43337089499931575, 0.5118827628578735,
+    -0.6794219562067222, 1.6790452257046342, 81.71844132251309,
+    -38.442735881852386, 47.12850749494191, 0.0, -25.663272838054837,
+    10.340381082656501, -5.756789612571112, 3.705690193477609,
+    -2.6011222311687905, 1.9371639722506064, -1.5074971550357439,
+    1.2142734775838535, -1.0060153642623486, 0.8534957834735334,
+    -0.7391214219572226, 0.651802683546098, -0.584288581562773,
+    0.5316998729156588, -0.49068344695193133, 0.45890703325750504,
+    -0.4347500348179919, 0.41711370438699114, -0.4053095031080025,
+    0.39900539820620085, -0.3982251080399842, 0.4034118378719536,
+    -0.41559609202678094, 0.4367719440382422, -0.47076964063218163,
+    0.5255449249370131, -0.6206478923966695, 0.8236963089420546,
+    -2.0354948854937, -54.48123410761461, 23.976987635740468,
+    -22.80032211362052, 33.16682821812133, 0.0, -21.16079368489411,
+    8.934915963402672, -5.159418963773138, 3.421209422657972,
+    -2.4618820519576285, 1.8729992439909198, -1.485051384463752,
+    1.2162782258042328, -1.0229806953844298, 0.8799856491115304,
+    -0.7719415844644822, 0.6890625066293384, -0.6248919670641491,
+    0.5750601715055034, -0.5365621484783104, 0.5073254826632494,
+    -0.48594852199991667, 0.4715465220591066, -0.4636746175707912,
+    0.4623177245011316, -0.46795844457738384, 0.4817674738314037,
+    -0.5060365388020784, 0.5451865297040993, -0.6084156101088214,
+    0.7183413774611628, -0.9532064119206896, 2.355386175917015,
+    39.62110134142614, -16.910230400508976, 14.640549070754755,
+    -16.262292948588748, 25.75047759538953, 0.0, -18.135219114121202,
+    7.9142944656291245, -4.695175248947419, 3.1851402909398594,
+    -2.337613757212842, 1.80962892006057, -1.457351145980443,
+    1.210664693435637, -1.0317071182908963, 0.8984573559626441,
+    -0.7973712536426358, 0.7197550878821367, -0.6598479659182797,
+    0.6137506266145837, -0.5788026593020965, 0.5532127669438671,
+    -0.5358426027569029, 0.52609465257245, -0.5238854727068569,
+    0.529712699389834, -0.5448637603204386, 0.5719004051122328,
+    -0.6157936582583619, 0.6869102065868666, -0.8107629482581045,
+    1.0756336092408751, -2.6576846354891432, -30.474053580499746,
+    12.790493596158544, -10.569793693781133, 10.582847511024232,
+    -12.709274276668102, 21.19823741595883, 0.0, -15.99248449045912,
+    7.155444300070033, -4.335767554015085, 2.995932499341296,
+    -2.234920070065328, 1.755785249711196, -1.4331807309781484,
+    1.205583049977846, -1.039544318087596, 0.9154892154953622,
+    -0.8213153779669682, 0.7492293286503627, -0.694068152737812,
+    0.6523615664716986, -0.6217903528821034, 0.6008734754525498,
+    -0.5888014929758594, 0.5853817429675455, -0.5910974099612283,
+    0.6073297979801721, -0.6368906423430574, 0.6852795244611402,
+    -0.7640004870931327, 0.9013975586285111, -1.195582765503827,
+    2.953748757053266, 24.373811356990082, -10.12686275248211,
+    8.146820243112854, -7.732984842811991, 8.33080455981346,
+    -10.501347258325493, 18.153978157275, 0.0, -14.420596759581272,
+    6.581522313264326, -4.057741642785076, 2.847462668614467,
+    -2.1541071722080467, 1.71423380278192, -1.4161738120536873,
+    1.2048721972059244, -1.0502668834753026, 0.934698061997029,
+    -0.847221955226674, 0.7807942089633686, -0.7307757502624117,
+    0.6941020726347674, -0.6688131264562546, 0.6537995198399984,
+    -0.6487011936866437, 0.6539478160459514, -0.6709882679992457,
+    0.7028670752138155, -0.7556025923193279, 0.841834439685627,
+    -0.992750123469712, 1.3163522647412516, -3.2517025249738074,
+    -20.06542872955741, 8.281808226510458, -6.550180185282709,
+    6.023586883236765, -6.130306338042841, 6.9135481104609635,
+    -9.013819207098635, 16.002933487901494, 0.0, -13.241241281008403,
+    6.143591143549602, -3.843922512931687, 2.733795540164158,
+    -2.0938669625817705, 1.6857132429472552, -1.4079981560151569,
+    1.2106180770981443, -1.0661437912591547, 0.9584356259468264,
+    -0.8774964899613944, 0.8169225549395059, -0.7725557908035863,
+    0.7417453495948757, -0.7229489681572988, 0.71555396559131,
+    -0.7198815852882289, 0.7374140552242291, -0.7714104858476605,
+    0.828405667869625, -0.922195623343444, 1.086885413753924,
+    -1.4406484689123178, 3.558198859432705, 16.8882915187145,
+    -6.93877056417822, 5.425304609869393, -4.887698610630546,
+    4.806327685535035, -5.110005469229707, 5.950888945268694,
+    -7.957677639541306, 14.426876570439006, 0.0, -12.345885224190656,
+    5.809631546624288, -3.6821299127285925, 2.6502035171089697,
+    -2.052758118124242, 1.6703677915657706, -1.4096121406490028,
+    1.2242243046387586, -1.0888476901354656, 0.9885685768768663,
+    -0.9141844201002518, 0.8598657846883792, -0.8219322237177755,
+    0.7982024591967898, -0.7876826129051013, 0.7905049276043754,
+    -0.8081365644851065, 0.8440276742675138, -0.9052310811309005,
+    1.0067387987712588, -1.1857026873470933, 1.570947302858369,
+    -3.8793102160882156, -14.464820615831487, 5.923638962659566,
+    -4.594089097878849, 4.080672755056908, -3.9230240360127477,
+    4.023488700426281, -4.411488089271047, 5.263584610172498,
+    -7.181301405994688, 13.245228882971919, 0.0, -11.665361204717694,
+    5.558244803708613, -3.5638591619048388, 2.593247586732224,
+    -2.029694813813347, 1.6683246489958021, -1.4218258359243008,
+    1.2469274849269756, -1.1199233334200323, 1.0269101995126402,
+    -0.9593817274242351, 0.9120641388196923, -0.8818063858313329,
+    0.8670331077497582, -0.8675649633228645, 0.8847816767235681,
+    -0.9222895145731748, 0.987661018054879, -1.0971400119552883,
+    1.291107761331852, -1.7097185372821246, 4.221078693511829,
+    12.565107941425794, -5.133192305788608, 3.957357286662436,
+    -3.479432032856019, 3.2926186135770505, -3.297130529835497,
+    3.483627124864595, -3.909955697263395, 4.756330830164712,
+    -6.597849474600442, 12.348516085996982, 0.0, -11.154198463901336,
+    5.374994505545038, -3.4833146806282835, 2.5606529716414896,
+    -2.024114118156373, 1.6799604228095428, -1.4455954534755369,
+    1.2800957650324347, -1.161086754278718, 1.0755274951390983,
+    -1.015565697950151, 0.976527507846792, -0.9559326218100276,
+    0.9530970794785476, -0.9692005402304646, 1.0079495763829538,
+    -1.077432852166899, 1.1952157493179787, -1.4051462608012566,
+    1.85959677249013, -4.5899326555660815, -11.041934411569738,
+    4.502602021293259, -3.4555792205985902, 3.0152433538715977,
+    -2.8207122657883454, 2.7773890982829, -2.8626415543271637,
+    3.093905264143413, -3.538256947233111, 4.374000493582781,
+    -6.154321201027353, 11.667136385066769, 0.0, -10.782044755084607,
+    5.2502377351579455, -3.4367681436752044, 2.551183396564799,
+    -2.0360509337475112, 1.706060841350479, -1.4822236434984832,
+    1.3254557987056625, -1.2144805887133385, 1.1370379383425209,
+    -1.0859592680099246, 1.0573145880516592, -1.0496000244628783,
+    1.0636137471453428, -1.1030699090172242, 1.1765558088068173,
+    -1.3030388994521809, 1.5301295776008312, -2.0235400541549704,
+    4.993070111815666, 9.79707121902064, -3.9892359624763283,
+    3.050912309557675, -2.6466907117367255, 2.454580904796263,
+    -2.3871540980727093, 2.4175785485936094, -2.547380484172646,
+    2.803861000247533, -3.2571893377947028, 4.082696337744891,
+    -5.816851674646645, 11.155401046747238, 0.0, -10.52876100452425,
+    5.177827853451914, -3.422163543454448, 2.5645715966116174,
+    -2.0662088358229105, 1.7479632641032683, -1.5335494852587201,
+    1.3853274057964717, -1.282965090423263, 1.2149840597128057,
+    -1.1750403583536033, 1.1602734276039337, -1.1707974026246595,
+    1.2101759731342054, -1.2874487366512661, 1.4230708645451193,
+    -1.668774408460458, 2.2050023493503947, -5.438872232646735,
+    -8.76268384036603, 3.5639806585821754, -2.7181797907914595,
+    2.3473265169414597, -2.1624267478932464, 2.0833819947388736,
+    -2.0827285397536612, 2.155242902939429, -2.3117826280444276,
+    2.583791461454647, -3.042470881707804, 3.860633520212159,
+    -5.563126416136481, 10.782840210627974, 0.0, -10.381552969582915,
+    5.154356869382214, -3.4389104511759143, 2.601525421000027,
+    -2.1160704197666242, 1.807733785176369, -1.6021849232832814,
+    1.4629303364249915, -1.3705245346526285, 1.3143960513052029,
+    -1.289367936813347, 1.294345757124954, -1.3324666924238513,
+    1.4131202000476852, -1.558328891895069, 1.8243751245940036,
+    -2.4081430328163327, 5.937401873939113, 7.890530661602026,
+    -3.2063132660939875, 2.439995454815538, -2.099465955917537,
+    1.9239121141747875, -1.8401148304953572, 1.821434344071334,
+    -1.8597545281888812, 1.9583953106138887, -2.132390626880603,
+    2.415172568552231, -2.8784028079613897, 3.6933900191763014,
+    -5.378219048689773, 10.529246703474021, 0.0, -10.333317532301631,
+    5.178761087551264, -3.487834299711816, 2.663825102534077,
+    -2.1880819080207132, 1.8884256679182734, -1.6918576787076558,
+    1.5628440907400745, -1.4829074827421616, 1.4427330610827036,
+    -1.4390651853064218, 1.4741178340260321, -1.5574199520799943,
+    1.7126130501320012, -2.001032255710455, 2.638100261606115,
+    -6.501049656863279, -7.145412439757018, 2.901365242420538,
+    -2.20397018959944, 1.89082913370182, -1.7254071978157084,
+    1.6407417341589872, -1.6115951002876896, 1.6287202913461216,
+    -1.691755599423254, 1.8079502793568782, -1.9944822941305116,
+    2.2859568685856426, -2.7545382690841653, 3.571279436365397,
+    -5.252204833787966, 10.381783514577196, 0.0, -10.381783514577196,
+    5.252204833787966, -3.571279436365397, 2.7545382690841653,
+    -2.2859568685856426, 1.9944822941305116, -1.8079502793568782,
+    1.691755599423254, -1.6287202913461216, 1.6115951002876896,
+    -1.6407417341589872, 1.7254071978157084, -1.89082913370182,
+    2.20397018959944, -2.901365242420538, 7.145412439757018, 6.501049656863279,
+    -2.638100261606115, 2.001032255710455, -1.7126130501320012,
+    1.5574199520799943, -1.4741178340260321, 1.4390651853064218,
+    -1.4427330610827036, 1.4829074827421616, -1.5628440907400745,
+    1.6918576787076558, -1.8884256679182734, 2.1880819080207132,
+    -2.663825102534077, 3.487834299711816, -5.178761087551264,
+    10.333317532301631, 0.0, -10.529246703474021, 5.378219048689773,
+    -3.6933900191763014, 2.8784028079613897, -2.415172568552231,
+    2.132390626880603, -1.9583953106138887, 1.8597545281888812,
+    -1.821434344071334, 1.8401148304953572, -1.9239121141747875,
+    2.099465955917537, -2.439995454815538, 3.2063132660939875,
+    -7.890530661602026, -5.937401873939113, 2.4081430328163327,
+    -1.8243751245940036, 1.558328891895069, -1.4131202000476852,
+    1.3324666924238513, -1.294345757124954, 1.289367936813347,
+    -1.3143960513052029, 1.3705245346526285, -1.4629303364249915,
+    1.6021849232832814, -1.807733785176369, 2.1160704197666242,
+    -2.601525421000027, 3.4389104511759143, -5.154356869382214,
+    10.381552969582915, 0.0, -10.782840210627974, 5.563126416136481,
+    -3.860633520212159, 3.042470881707804, -2.583791461454647,
+    2.3117826280444276, -2.155242902939429, 2.0827285397536612,
+    -2.0833819947388736, 2.1624267478932464, -2.3473265169414597,
+    2.7181797907914595, -3.5639806585821754, 8.76268384036603,
+    5.438872232646735, -2.2050023493503947, 1.668774408460458,
+    -1.4230708645451193, 1.2874487366512661, -1.2101759731342054,
+    1.1707974026246595, -1.1602734276039337, 1.1750403583536033,
+    -1.2149840597128057, 1.282965090423263, -1.3853274057964717,
+    1.5335494852587201, -1.7479632641032683, 2.0662088358229105,
+    -2.5645715966116174, 3.422163543454448, -5.177827853451914,
+    10.52876100452425, 0.0, -11.155401046747238, 5.816851674646645,
+    -4.082696337744891, 3.2571893377947028, -2.803861000247533,
+    2.547380484172646, -2.4175785485936094, 2.3871540980727093,
+    -2.454580904796263, 2.6466907117367255, -3.050912309557675,
+    3.9892359624763283, -9.79707121902064, -4.993070111815666,
+    2.0235400541549704, -1.5301295776008312, 1.3030388994521809,
+    -1.1765558088068173, 1.1030699090172242, -1.0636137471453428,
+    1.0496000244628783, -1.0573145880516592, 1.0859592680099246,
+    -1.1370379383425209, 1.2144805887133385, -1.3254557987056625,
+    1.4822236434984832, -1.706060841350479, 2.0360509337475112,
+    -2.551183396564799, 3.4367681436752044, -5.2502377351579455,
+    10.782044755084607, 0.0, -11.667136385066769, 6.154321201027353,
+    -4.374000493582781, 3.538256947233111, -3.093905264143413,
+    2.8626415543271637, -2.7773890982829, 2.8207122657883454,
+    -3.0152433538715977, 3.4555792205985902, -4.502602021293259,
+    11.041934411569738, 4.5899326555660815, -1.85959677249013,
+    1.4051462608012566, -1.1952157493179787, 1.077432852166899,
+    -1.0079495763829538, 0.9692005402304646, -0.9530970794785476,
+    0.9559326218100276, -0.976527507846792, 1.015565697950151,
+    -1.0755274951390983, 1.161086754278718, -1.2800957650324347,
+    1.4455954534755369, -1.6799604228095428, 2.024114118156373,
+    -2.5606529716414896, 3.4833146806282835, -5.374994505545038,
+    11.154198463901336, 0.0, -12.348516085996982, 6.597849474600442,
+    -4.756330830164712, 3.909955697263395, -3.483627124864595,
+    3.297130529835497, -3.2926186135770505, 3.479432032856019,
+    -3.957357286662436, 5.133192305788608, -12.565107941425794,
+    -4.221078693511829, 1.7097185372821246, -1.291107761331852,
+    1.0971400119552883, -0.987661018054879, 0.9222895145731748,
+    -0.8847816767235681, 0.8675649633228645, -0.8670331077497582,
+    0.8818063858313329, -0.9120641388196923, 0.9593817274242351,
+    -1.0269101995126402, 1.1199233334200323, -1.2469274849269756,
+    1.4218258359243008, -1.6683246489958021, 2.029694813813347,
+    -2.593247586732224, 3.5638591619048388, -5.558244803708613,
+    11.665361204717694, 0.0, -13.245228882971919, 7.181301405994688,
+    -5.263584610172498, 4.411488089271047, -4.023488700426281,
+    3.9230240360127477, -4.080672755056908, 4.594089097878849,
+    -5.923638962659566, 14.464820615831487, 3.8793102160882156,
+    -1.570947302858369, 1.1857026873470933, -1.0067387987712588,
+    0.9052310811309005, -0.8440276742675138, 0.8081365644851065,
+    -0.7905049276043754, 0.7876826129051013, -0.7982024591967898,
+    0.8219322237177755, -0.8598657846883792, 0.9141844201002518,
+    -0.9885685768768663, 1.0888476901354656, -1.2242243046387586,
+    1.4096121406490028, -1.6703677915657706, 2.052758118124242,
+    -2.6502035171089697, 3.6821299127285925, -5.809631546624288,
+    12.345885224190656, 0.0, -14.426876570439006, 7.957677639541306,
+    -5.950888945268694, 5.110005469229707, -4.806327685535035,
+    4.887698610630546, -5.425304609869393, 6.93877056417822, -16.8882915187145,
+    -3.558198859432705, 1.4406484689123178, -1.086885413753924,
+    0.922195623343444, -0.828405667869625, 0.7714104858476605,
+    -0.7374140552242291, 0.7198815852882289, -0.71555396559131,
+    0.7229489681572988, -0.7417453495948757, 0.7725557908035863,
+    -0.8169225549395059, 0.8774964899613944, -0.9584356259468264,
+    1.0661437912591547, -1.2106180770981443, 1.4079981560151569,
+    -1.6857132429472552, 2.0938669625817705, -2.733795540164158,
+    3.843922512931687, -6.143591143549602, 13.241241281008403, 0.0,
+    -16.002933487901494, 9.013819207098635, -6.9135481104609635,
+    6.130306338042841, -6.023586883236765, 6.550180185282709,
+    -8.281808226510458, 20.06542872955741, 3.2517025249738074,
+    -1.3163522647412516, 0.992750123469712, -0.841834439685627,
+    0.7556025923193279, -0.7028670752138155, 0.6709882679992457,
+    -0.6539478160459514, 0.6487011936866437, -0.6537995198399984,
+    0.6688131264562546, -0.6941020726347674, 0.7307757502624117,
+    -0.7807942089633686, 0.847221955226674, -0.934698061997029,
+    1.0502668834753026, -1.2048721972059244, 1.4161738120536873,
+    -1.71423380278192, 2.1541071722080467, -2.847462668614467,
+    4.057741642785076, -6.581522313264326, 14.420596759581272, 0.0,
+    -18.153978157275, 10.501347258325493, -8.33080455981346, 7.732984842811991,
+    -8.146820243112854, 10.12686275248211, -24.373811356990082,
+    -2.953748757053266, 1.195582765503827, -0.9013975586285111,
+    0.7640004870931327, -0.6852795244611402, 0.6368906423430574,
+    -0.6073297979801721, 0.5910974099612283, -0.5853817429675455,
+    0.5888014929758594, -0.6008734754525498, 0.6217903528821034,
+    -0.6523615664716986, 0.694068152737812, -0.7492293286503627,
+    0.8213153779669682, -0.9154892154953622, 1.039544318087596,
+    -1.205583049977846, 1.4331807309781484, -1.755785249711196,
+    2.234920070065328, -2.995932499341296, 4.335767554015085,
+    -7.155444300070033, 15.99248449045912, 0.0, -21.19823741595883,
+    12.709274276668102, -10.582847511024232, 10.569793693781133,
+    -12.790493596158544, 30.474053580499746, 2.6576846354891432,
+    -1.0756336092408751, 0.8107629482581045, -0.6869102065868666,
+    0.6157936582583619, -0.5719004051122328, 0.5448637603204386,
+    -0.529712699389834, 0.5238854727068569, -0.52609465257245,
+    0.5358426027569029, -0.5532127669438671, 0.5788026593020965,
+    -0.6137506266145837, 0.6598479659182797, -0.7197550878821367,
+    0.7973712536426358, -0.8984573559626441, 1.0317071182908963,
+    -1.210664693435637, 1.457351145980443, -1.80962892006057,
+    2.337613757212842, -3.1851402909398594, 4.695175248947419,
+    -7.9142944656291245, 18.135219114121202, 0.0, -25.75047759538953,
+    16.262292948588748, -14.640549070754755, 16.910230400508976,
+    -39.62110134142614, -2.355386175917015, 0.9532064119206896,
+    -0.7183413774611628, 0.6084156101088214, -0.5451865297040993,
+    0.5060365388020784, -0.4817674738314037, 0.46795844457738384,
+    -0.4623177245011316, 0.4636746175707912, -0.4715465220591066,
+    0.48594852199991667, -0.5073254826632494, 0.5365621484783104,
+    -0.5750601715055034, 0.6248919670641491, -0.6890625066293384,
+    0.7719415844644822, -0.8799856491115304, 1.0229806953844298,
+    -1.2162782258042328, 1.485051384463752, -1.8729992439909198,
+    2.4618820519576285, -3.421209422657972, 5.159418963773138,
+    -8.934915963402672, 21.16079368489411, 0.0, -33.16682821812133,
+    22.80032211362052, -23.976987635740468, 54.48123410761461, 2.0354948854937,
+    -0.8236963089420546, 0.6206478923966695, -0.5255449249370131,
+    0.47076964063218163, -0.4367719440382422, 0.41559609202678094,
+    -0.4034118378719536, 0.3982251080399842, -0.39900539820620085,
+    0.4053095031080025, -0.41711370438699114, 0.4347500348179919,
+    -0.45890703325750504, 0.49068344695193133, -0.5316998729156588,
+    0.584288581562773, -0.651802683546098, 0.7391214219572226,
+    -0.8534957834735334, 1.0060153642623486, -1.2142734775838535,
+    1.5074971550357439, -1.9371639722506064, 2.6011222311687905,
+    -3.705690193477609, 5.756789612571112, -10.340381082656501,
+    25.663272838054837, 0.0, -47.12850749494191, 38.442735881852386,
+    -81.71844132251309, -1.6790452257046342, 0.6794219562067222,
+    -0.5118827628578735, 0.43337089499931575, -0.38810875422275426,
+    0.3599673522261122, -0.3423802093212762, 0.3321821984497213,
+    -0.3277206431208111, 0.3281347499892866, -0.333044051111528,
+    0.3424081867183752, -0.3564715797783097, 0.375759763318815,
+    -0.40111682843133417, 0.43378632092042996, -0.47554901449666404,
+    0.5289453222887762, -0.5976334812343238, 0.6869772699855108,
+    -0.805040175582585, 0.9643348671405597, -1.1850552604118487,
+    1.5014143012177272, -1.9750281268969632, 2.725991762432136,
+    -4.014752583605482, 6.500197986919262, -12.31866197471438,
+    32.907746442505335, 0.0, -82.25803378159621, 142.97995695702878,
+    1.244318109058832, -0.5034960964236178, 0.379312719772051,
+    -0.321099334084409, 0.28751952336103925, -0.2666191951353873,
+    0.253530230146059, -0.2459044337315539, 0.2425134829963085,
+    -0.2427145809394724, 0.24621904261494226, -0.25298759152782924,
+    0.26318815216361996, -0.27719125718710685, 0.2955948397639203,
+    -0.31927939327921845, 0.34950211080949634, -0.38804808488906634,
+    0.43747164405896755, -0.5014875979522655, 0.585622954919576,
+    -0.6983416929422193, 0.853071825787858, -1.0720542863884335,
+    1.3941292423924219, -1.8917735907992472, 2.712298034631874,
+    -4.191568560338668, 7.232276210533113, -14.986029144527816,
+    45.92362409216148, 0.0, -357.160734101727, -0.5, 0.20231562230237077,
+    -0.15241166965960926, 0.1290150271359185, -0.11551556432875698,
+    0.10710962346009577, -0.10184076527097778, 0.0987649936408258,
+    -0.09738814208997305, 0.09745110273212126, -0.09883675179350662,
+    0.10152774676462963, -0.10558936827831077, 0.11116736864041944,
+    -0.11849745214828139, 0.12792666359934646, -0.13994993409141898,
+    0.15526865888517538, -0.17488385174362556, 0.200246407934336,
+    -0.23350580964788842, 0.2779359073167012, -0.33869444015389755,
+    0.4242462035995199, -0.54919213383198, 0.7403135142859367,
+    -1.050699024463748, 1.5968039206327367, -2.671931493704222,
+    5.179530049357926, -12.978693863671593, 58.07132087502716, 264.0};
+inline constexpr std::array<double, 66> lift_matrix_32{
+    544.5, -6.653236217763341, 4.971207115233855, -4.154024804899812,
+    3.654038638677245, -3.3124281569097866, 3.0637829524315627,
+    -2.8756104961785587, 2.72974372610734, -2.615170858032851,
+    2.5248259889519677, -2.453992106159358, 2.399441730982885,
+    -2.358946975056541, 2.3309890204093513, -2.314582894623082,
+    2.309173912508413, -2.314582894623082, 2.3309890204093513,
+    -2.358946975056541, 2.399441730982885, -2.453992106159358,
+    2.5248259889519677, -2.615170858032851, 2.72974372610734,
+    -2.8756104961785587, 3.0637829524315627, -3.3124281569097866,
+    3.654038638677245, -4.154024804899812, 4.971207115233855,
+    -6.653236217763341, 16.5, 16.5, -6.653236217763341, 4.971207115233855,
+    -4.154024804899812, 3.654038638677245, -3.3124281569097866,
+    3.0637829524315627, -2.8756104961785587, 2.72974372610734,
+    -2.615170858032851, 2.5248259889519677, -2.453992106159358,
+    2.399441730982885, -2.358946975056541, 2.3309890204093513,
+    -2.314582894623082, 2.309173912508413, -2.314582894623082,
+    2.3309890204093513, -2.358946975056541, 2.399441730982885,
+    -2.453992106159358, 2.5248259889519677, -2.615170858032851,
+    2.72974372610734, -2.8756104961785587, 3.0637829524315627,
+    -3.3124281569097866, 3.654038638677245, -4.154024804899812,
+    4.971207115233855, -6.653236217763341, 544.5};
+
+inline constexpr std::array<Table, max_order> tables{{
+    {1, nodes_1.data(), weights_1.data(), diff_matrix_1.data(),
+     lift_matrix_1.data()},
+    {2, nodes_2.data(), weights_2.data(), diff_matrix_2.data(),
+     lift_matrix_2.data()},
+    {3, nodes_3.data(), weights_3.data(), diff_matrix_3.data(),
+     lift_matrix_3.data()},
+    {4, nodes_4.data(), weights_4.data(), diff_matrix_4.data(),
+     lift_matrix_4.data()},
+    {5, nodes_5.data(), weights_5.data(), diff_matrix_5.data(),
+     lift_matrix_5.data()},
+    {6, nodes_6.data(), weights_6.data(), diff_matrix_6.data(),
+     lift_matrix_6.data()},
+    {7, nodes_7.data(), weights_7.data(), diff_matrix_7.data(),
+     lift_matrix_7.data()},
+    {8, nodes_8.data(), weights_8.data(), diff_matrix_8.data(),
+     lift_matrix_8.data()},
+    {9, nodes_9.data(), weights_9.data(), diff_matrix_9.data(),
+     lift_matrix_9.data()},
+    {10, nodes_10.data(), weights_10.data(), diff_matrix_10.data(),
+     lift_matrix_10.data()},
+    {11, nodes_11.data(), weights_11.data(), diff_matrix_11.data(),
+     lift_matrix_11.data()},
+    {12, nodes_12.data(), weights_12.data(), diff_matrix_12.data(),
+     lift_matrix_12.data()},
+    {13, nodes_13.data(), weights_13.data(), diff_matrix_13.data(),
+     lift_matrix_13.data()},
+    {14, nodes_14.data(), weights_14.data(), diff_matrix_14.data(),
+     lift_matrix_14.data()},
+    {15, nodes_15.data(), weights_15.data(), diff_matrix_15.data(),
+     lift_matrix_15.data()},
+    {16, nodes_16.data(), weights_16.data(), diff_matrix_16.data(),
+     lift_matrix_16.data()},
+    {17, nodes_17.data(), weights_17.data(), diff_matrix_17.data(),
+     lift_matrix_17.data()},
+    {18, nodes_18.data(), weights_18.data(), diff_matrix_18.data(),
+     lift_matrix_18.data()},
+    {19, nodes_19.data(), weights_19.data(), diff_matrix_19.data(),
+     lift_matrix_19.data()},
+    {20, nodes_20.data(), weights_20.data(), diff_matrix_20.data(),
+     lift_matrix_20.data()},
+    {21, nodes_21.data(), weights_21.data(), diff_matrix_21.data(),
+     lift_matrix_21.data()},
+    {22, nodes_22.data(), weights_22.data(), diff_matrix_22.data(),
+     lift_matrix_22.data()},
+    {23, nodes_23.data(), weights_23.data(), diff_matrix_23.data(),
+     lift_matrix_23.data()},
+    {24, nodes_24.data(), weights_24.data(), diff_matrix_24.data(),
+     lift_matrix_24.data()},
+    {25, nodes_25.data(), weights_25.data(), diff_matrix_25.data(),
+     lift_matrix_25.data()},
+    {26, nodes_26.data(), weights_26.data(), diff_matrix_26.data(),
+     lift_matrix_26.data()},
+    {27, nodes_27.data(), weights_27.data(), diff_matrix_27.data(),
+     lift_matrix_27.data()},
+    {28, nodes_28.data(), weights_28.data(), diff_matrix_28.data(),
+     lift_matrix_28.data()},
+    {29, nodes_29.data(), weights_29.data(), diff_matrix_29.data(),
+     lift_matrix_29.data()},
+    {30, nodes_30.data(), weights_30.data(), diff_matrix_30.data(),
+     lift_matrix_30.data()},
+    {31, nodes_31.data(), weights_31.data(), diff_matrix_31.data(),
+     lift_matrix_31.data()},
+    {32, nodes_32.data(), weights_32.data(), diff_matrix_32.data(),
+     lift_matrix_32.data()},
+}};
+
+/**
+ * @brief Get the table of a polynomial order
+ *
+ * @return Table, or nullptr if the order is not tabulated
+ */
+constexpr const Table *get_table(const size_t polynomial_order) {
+  if (polynomial_order < 1 || polynomial_order > max_order) {
+    return nullptr;
+  }
+  return &tables[polynomial_order - 1];
+}
+} // namespace DG::GLL_tables
+
+#endif
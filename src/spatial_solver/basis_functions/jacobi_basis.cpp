@@ -1,31 +1,115 @@
 #include "jacobi_basis.h"
 
+#include <algorithm>
 #include <boost/log/trivial.hpp>
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
 
 namespace DG {
 
+std::mutex Jacobi_basis::recurrence_mutex;
+
+std::map<std::pair<double, double>,
+         std::shared_ptr<const Recurrence_coefficients>>
+    Jacobi_basis::recurrence_tables;
+//-------------------------------------------------------------------------
 std::vector<double> Jacobi_basis::get_gauss_lobatto_nodes(
     const double alpha,
     const double beta,
     const size_t polynomial_order) const {
 
+  return this->get_gauss_lobatto_quadrature(alpha, beta, polynomial_order)
+      .nodes;
+}
+//----
+Quadrature Jacobi_basis::get_gauss_lobatto_quadrature(
+    const double alpha,
+    const double beta,
+    const size_t polynomial_order) const {
+
   if (polynomial_order < 1) {
     throw std::invalid_argument(
         std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
         ": "
         "To calculate the Gauss-Lobatto quadrature nodes the polynomial "
         "order must be >= 1.");
-  } else {
-    std::vector<double> gl_nodes(polynomial_order + 1);
-    gl_nodes.front() = -1.0;
+  }
+
+  const size_t num_nodes{polynomial_order + 1};
+  Quadrature gl_quad;
+  gl_quad.nodes.resize(num_nodes);
+  gl_quad.weights.resize(num_nodes);
+
+  if (polynomial_order > 1) {
+    const Quadrature inner_quad{this->get_gauss_jacobi_quadrature(
+        alpha + 1.0, beta + 1.0, polynomial_order - 2)};
     for (size_t i{1}; i < polynomial_order; ++i) {
-      gl_nodes[i] = this->get_gauss_jacobi_nodes(
-          alpha + 1.0, beta + 1.0, polynomial_order - 2)(i - 1);
+      const double node{inner_quad.nodes[i - 1]};
+      gl_quad.nodes[i] = node;
+      gl_quad.weights[i] = inner_quad.weights[i - 1] / (1. - node * node);
     }
-    gl_nodes.back() = 1.0;
-    return gl_nodes;
   }
+
+  // Outer weights with Q=n+1 nodes (see Karniadakis & Sherwin, (B.2.9))
+  const double q(num_nodes);
+  const double log_prefactor{
+      (alpha + beta + 1.) * std::log(2.) + std::lgamma(q) -
+      std::log(q - 1.) - std::lgamma(alpha + beta + q + 1.)};
+  gl_quad.nodes.front() = -1.0;
+  gl_quad.weights.front() =
+      (beta + 1.) * std::exp(
+                        log_prefactor + std::lgamma(alpha + q) +
+                        2. * std::lgamma(beta + 1.) - std::lgamma(beta + q));
+  gl_quad.nodes.back() = 1.0;
+  gl_quad.weights.back() =
+      (alpha + 1.) *
+      std::exp(
+          log_prefactor + std::lgamma(beta + q) +
+          2. * std::lgamma(alpha + 1.) - std::lgamma(alpha + q));
+
+  return gl_quad;
+}
+//----
+Quadrature Jacobi_basis::get_gauss_jacobi_quadrature(
+    const double alpha,
+    const double beta,
+    const size_t polynomial_order) const {
+
+  const arma::vec gj_nodes{
+      this->get_gauss_jacobi_nodes(alpha, beta, polynomial_order)};
+
+  Quadrature gj_quad;
+  for (const double node : gj_nodes) {
+    const double polished_node{this->polish_jacobi_root(
+        alpha, beta, polynomial_order + 1, node)};
+    const auto [polynomial, gradient, sum_of_squares] =
+        this->get_jacobi_recurrence_sweep(
+            alpha, beta, polynomial_order + 1, polished_node);
+    gj_quad.nodes.push_back(polished_node);
+    gj_quad.weights.push_back(1. / sum_of_squares);
+  }
+
+  // Symmetric weight functions yield nodes symmetric to the origin, which
+  // I enforce against rounding
+  if (alpha == beta) {
+    const size_t num_nodes{gj_quad.nodes.size()};
+    for (size_t i{0}; i < num_nodes / 2; ++i) {
+      const double node{
+          0.5 * (gj_quad.nodes[num_nodes - 1 - i] - gj_quad.nodes[i])};
+      const double weight{
+          0.5 * (gj_quad.weights[num_nodes - 1 - i] + gj_quad.weights[i])};
+      gj_quad.nodes[i] = -node;
+      gj_quad.nodes[num_nodes - 1 - i] = node;
+      gj_quad.weights[i] = gj_quad.weights[num_nodes - 1 - i] = weight;
+    }
+    if (num_nodes % 2 == 1) {
+      gj_quad.nodes[num_nodes / 2] = 0.;
+    }
+  }
+
+  return gj_quad;
 }
 //-------------------------------------------------------------------------
 double Jacobi_basis::get_jacobi_polynomial(
@@ -33,46 +117,26 @@ double Jacobi_basis::get_jacobi_polynomial(
     const double beta,
     const size_t polynomial_order,
     const double position) const {
-  if (alpha <= -1.0) {
-    throw std::invalid_argument(
-        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
-        ": "
-        "Parameter alpha must greater than -1.");
-  }
-  if (beta <= -1.0) {
-    throw std::invalid_argument(
-        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
-        ": "
-        "Parameter beta must be greater than -1.");
-  }
-  if ((alpha + beta) == -1.0) {
-    throw std::invalid_argument(
-        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
-        ": "
-        "To calculate the Jacobi polynomials the "
-        "sum alpha+beta must not be -1.");
-  };
 
-  arma::vec jacobi_poly(polynomial_order + 1);
+  const auto recurrence{
+      this->get_recurrence_coefficients(alpha, beta, polynomial_order)};
+  const std::vector<double> &a{recurrence->a};
+  const std::vector<double> &b{recurrence->b};
 
   if (polynomial_order == 0) {
-    return get_recurrence_initiation(
-               alpha, beta, polynomial_order, position)
-        .front();
-  } else if (polynomial_order == 1) {
-    return get_recurrence_initiation(
-               alpha, beta, polynomial_order, position)
-        .back();
-  } else {
-    std::vector<double> initial_jacobi_poly{
-        get_recurrence_initiation(alpha, beta, polynomial_order, position)};
-    jacobi_poly[0] = initial_jacobi_poly.front();
-    jacobi_poly[1] = initial_jacobi_poly.back();
-
-    this->apply_reccurence(
-        jacobi_poly, alpha, beta, polynomial_order, position);
-  }
-  return jacobi_poly[polynomial_order];
+    return recurrence->initial_polynomial;
+  }
+
+  double poly_old{recurrence->initial_polynomial};
+  double poly{recurrence->initial_slope * (position - b[0])};
+  for (size_t n{1}; n < polynomial_order; ++n) {
+    const double poly_new{
+        1. / a[n + 1] * (-a[n] * poly_old + (position - b[n]) * poly)};
+    poly_old = poly;
+    poly = poly_new;
+  }
+
+  return poly;
 }
 //-------------------------------------------------------------------------
 double Jacobi_basis::get_jacobi_polynomial_gradient(
@@ -91,159 +155,356 @@ double Jacobi_basis::get_jacobi_polynomial_gradient(
              alpha + 1., beta + 1., polynomial_order - 1, position);
 }
 //-------------------------------------------------------------------------
-arma::vec Jacobi_basis::get_gauss_jacobi_nodes(
+arma::mat Jacobi_basis::get_jacobi_polynomials(
     const double alpha,
     const double beta,
-    const size_t polynomial_order) const {
-  arma::vec gj_nodes{arma::eig_sym(
-      this->get_jacobi_polynomial_matrix(alpha, beta, polynomial_order))};
+    const size_t max_order,
+    const arma::vec &positions) const {
+
+  const auto recurrence{
+      this->get_recurrence_coefficients(alpha, beta, max_order)};
+  const std::vector<double> &a{recurrence->a};
+  const std::vector<double> &b{recurrence->b};
+
+  arma::mat jacobi_polys(positions.n_elem, max_order + 1);
+  jacobi_polys.col(0).fill(recurrence->initial_polynomial);
+  if (max_order == 0) {
+    return jacobi_polys;
+  }
 
-  if (gj_nodes.size() != polynomial_order + 1) {
-    throw std::invalid_argument(
-        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
-        ": "
-        "The number of Gauss Jacobi quadrature nodes must be equal to "
-        "polynomial_order+1.");
-  };
-  return gj_nodes;
+  // Same recurrence as in get_jacobi_polynomial(...), applied to all
+  // positions
+  jacobi_polys.col(1) = recurrence->initial_slope * (positions - b[0]);
+  for (size_t n{1}; n < max_order; ++n) {
+    jacobi_polys.col(n + 1) =
+        1. / a[n + 1] *
+        (-a[n] * jacobi_polys.col(n - 1) +
+         (positions - b[n]) % jacobi_polys.col(n));
+  }
+
+  return jacobi_polys;
 }
-//-------------------------------------------------------------------------
-arma::mat Jacobi_basis::get_jacobi_polynomial_matrix(
+//----
+arma::mat Jacobi_basis::get_jacobi_polynomial_gradients(
     const double alpha,
     const double beta,
-    const size_t polynomial_order) const {
+    const size_t max_order,
+    const arma::vec &positions) const {
 
-  if (alpha <= -1.0) {
-    throw std::invalid_argument(
-        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
-        ": "
-        "Parameter alpha must be >= 0.");
-  }
-  if (beta <= -1.0) {
-    throw std::invalid_argument(
-        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
-        ": "
-        "Parameter beta must be >= 0.");
+  arma::mat jacobi_grads(positions.n_elem, max_order + 1, arma::fill::zeros);
+  if (max_order == 0) {
+    return jacobi_grads;
   }
-  if (polynomial_order < 0) {
-    throw std::invalid_argument(
-        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
-        ": "
-        "Polynomial order must be a positive integer.");
+
+  const arma::mat jacobi_polys{this->get_jacobi_polynomials(
+      alpha + 1., beta + 1., max_order - 1, positions)};
+  for (size_t n{1}; n <= max_order; ++n) {
+    jacobi_grads.col(n) =
+        std::sqrt(double(n) * (double(n) + alpha + beta + 1.)) *
+        jacobi_polys.col(n - 1);
   }
 
-  arma::vec diagonal{get_matrix_diagonal(alpha, beta, polynomial_order)};
-  arma::vec subdiagonal{
-      get_matrix_subdiagonal(alpha, beta, polynomial_order)};
+  return jacobi_grads;
+}
+//-------------------------------------------------------------------------
+std::shared_ptr<const Recurrence_coefficients>
+Jacobi_basis::get_recurrence_coefficients(
+    const double alpha,
+    const double beta,
+    const size_t max_order) const {
 
-  return get_tridiagonal_matrix(diagonal, subdiagonal, polynomial_order);
-};
-//----
-arma::mat Jacobi_basis::get_tridiagonal_matrix(
-    const arma::vec diagonal,
-    const arma::vec subdiagonal,
-    const size_t polynomial_order) const {
+  this->check_jacobi_parameters(alpha, beta);
 
-  arma::mat tridiag_matrix(
-      polynomial_order + 1, polynomial_order + 1, arma::fill::zeros);
-  tridiag_matrix.diag(0) = diagonal;
+  const std::lock_guard<std::mutex> lock(recurrence_mutex);
 
-  if (polynomial_order > 0) {
-    tridiag_matrix.diag(-1) = subdiagonal;
-    tridiag_matrix.diag(1) = subdiagonal;
+  auto &recurrence{recurrence_tables[{alpha, beta}]};
+  if (!recurrence || recurrence->b.size() <= max_order) {
+    recurrence = std::make_shared<const Recurrence_coefficients>(
+        this->build_recurrence_coefficients(
+            alpha, beta, std::max(max_order, min_tabulated_order)));
   }
 
-  return tridiag_matrix;
+  return recurrence;
 }
 //----
-arma::vec Jacobi_basis::get_matrix_diagonal(
+Recurrence_coefficients Jacobi_basis::build_recurrence_coefficients(
     const double alpha,
     const double beta,
-    const size_t polynomial_order) const {
-
-  arma::vec diagonal(polynomial_order + 1);
-  diagonal(0) = (beta - alpha) / (2 + beta + alpha);
+    const size_t max_order) const {
+
+  Recurrence_coefficients recurrence;
+  const double aux0{this->get_initial_squared_norm(alpha, beta)};
+  const double aux1{(alpha + 1.) * (beta + 1.) / (alpha + beta + 3.) * aux0};
+  recurrence.initial_polynomial = 1. / std::sqrt(aux0);
+  recurrence.initial_slope = (alpha + beta + 2.) / 2. / std::sqrt(aux1);
+
+  recurrence.a.resize(max_order + 3, 0.);
+  recurrence.a[1] = 2. / (2. + alpha + beta) *
+                    std::sqrt((alpha + 1) * (beta + 1) / (alpha + beta + 3));
+  for (size_t n{2}; n < recurrence.a.size(); ++n) {
+    const double aux{2. * double(n) + alpha + beta};
+    recurrence.a[n] =
+        2. / aux *
+        std::sqrt(
+            double(n) * (double(n) + alpha + beta) * (double(n) + alpha) *
+            (double(n) + beta) / (aux - 1.) / (aux + 1.));
+  }
 
-  for (size_t j{1}; j < polynomial_order + 1; ++j) {
-    const double aux(2. * j + alpha + beta);
-    diagonal(j) = (beta * beta - alpha * alpha) / aux / (aux + 2.);
+  recurrence.b.resize(max_order + 1);
+  recurrence.b[0] = (beta - alpha) / (alpha + beta + 2.);
+  for (size_t n{1}; n <= max_order; ++n) {
+    const double aux{2. * double(n) + alpha + beta};
+    recurrence.b[n] = (beta * beta - alpha * alpha) / (aux * aux + 2 * aux);
   }
 
-  return diagonal;
+  return recurrence;
 }
 //----
-arma::vec Jacobi_basis::get_matrix_subdiagonal(
+arma::vec Jacobi_basis::get_jacobi_expansion(
     const double alpha,
     const double beta,
-    const size_t polynomial_order) const {
+    const arma::mat &coefficients,
+    const arma::vec &positions) const {
+
+  if (coefficients.n_rows != positions.n_elem || coefficients.n_cols < 1) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "The expansion needs at least one coefficient per position.");
+  }
 
-  arma::vec subdiagonal(polynomial_order);
+  const size_t num_positions{positions.n_elem};
+  const size_t max_order{coefficients.n_cols - 1};
+  const auto recurrence{
+      this->get_recurrence_coefficients(alpha, beta, max_order)};
+
+  // With y_{n+1} = y_{n+2} = 0, the backward recurrence
+  // y_k = c_k + (x - b_k)/a_{k+1} y_{k+1} - a_{k+1}/a_{k+2} y_{k+2}
+  // yields the expansion p_0 y_0. The buffer of y_{k+2} is overwritten by
+  // y_k, such that both buffers swap their roles in every step.
+  arma::vec sums_1(num_positions, arma::fill::zeros);
+  arma::vec sums_2(num_positions, arma::fill::zeros);
+  double *sum_1{sums_1.memptr()};
+  double *sum_2{sums_2.memptr()};
+  const double *x{positions.memptr()};
+  for (size_t k{max_order + 1}; k-- > 0;) {
+    const double inverse_a{1. / recurrence->a[k + 1]};
+    const double a_ratio{recurrence->a[k + 1] / recurrence->a[k + 2]};
+    const double b{recurrence->b[k]};
+    const double *c{coefficients.colptr(k)};
+    for (size_t i{0}; i < num_positions; ++i) {
+      sum_2[i] =
+          c[i] + (x[i] - b) * inverse_a * sum_1[i] - a_ratio * sum_2[i];
+    }
+    std::swap(sum_1, sum_2);
+  }
 
-  for (size_t j{1}; j < polynomial_order + 1; ++j) {
-    const double aux(2. * j + alpha + beta);
-    subdiagonal(j - 1) = 2. / aux *
-                         std::sqrt(
-                             j * (j + alpha + beta) * (j + alpha) *
-                             (j + beta) / (aux + 1.) / (aux - 1.));
-  };
+  arma::vec expansion(num_positions);
+  for (size_t i{0}; i < num_positions; ++i) {
+    expansion[i] = recurrence->initial_polynomial * sum_1[i];
+  }
 
-  return subdiagonal;
+  return expansion;
 }
 //-------------------------------------------------------------------------
-std::vector<double> Jacobi_basis::get_recurrence_initiation(
+arma::vec Jacobi_basis::get_gauss_jacobi_nodes(
     const double alpha,
     const double beta,
-    const size_t polynomial_order,
-    const double position) const {
+    const size_t polynomial_order) const {
 
-  std::vector<double> jacobi_ini;
+  if (alpha <= -1.0) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Parameter alpha must be >= 0.");
+  }
+  if (beta <= -1.0) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Parameter beta must be >= 0.");
+  }
+
+  // The Jacobi matrix holds the recurrence coefficients, i.e. b_j on the
+  // diagonal and a_j on the subdiagonal
+  const auto recurrence{
+      this->get_recurrence_coefficients(alpha, beta, polynomial_order)};
+  arma::vec gj_nodes{this->get_tridiagonal_eigenvalues(
+      arma::vec(recurrence->b.data(), polynomial_order + 1),
+      arma::vec(recurrence->a.data() + 1, polynomial_order))};
 
-  const double aux0{
-      std::pow(2., alpha + beta + 1.) / (alpha + beta + 1.) *
-      std::tgamma(alpha + 1.) * std::tgamma(beta + 1.) /
-      std::tgamma(alpha + beta + 1.)};
-  jacobi_ini.push_back(1. / std::sqrt(aux0));
+  if (gj_nodes.size() != polynomial_order + 1) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "The number of Gauss Jacobi quadrature nodes must be equal to "
+        "polynomial_order+1.");
+  };
+  return gj_nodes;
+}
+//-------------------------------------------------------------------------
+arma::vec Jacobi_basis::get_tridiagonal_eigenvalues(
+    arma::vec diagonal,
+    const arma::vec &subdiagonal) const {
+
+  const size_t n{diagonal.size()};
+  arma::vec offdiagonal(n, arma::fill::zeros);
+  offdiagonal.head(n - 1) = subdiagonal;
+
+  const size_t max_iterations{60};
+  for (size_t l{0}; l < n; ++l) {
+    for (size_t iteration{0};; ++iteration) {
+      // Find a negligible offdiagonal element to split the matrix at
+      size_t m{l};
+      for (; m + 1 < n; ++m) {
+        const double diagonal_sum{
+            std::fabs(diagonal(m)) + std::fabs(diagonal(m + 1))};
+        if (std::fabs(offdiagonal(m)) <=
+            std::numeric_limits<double>::epsilon() * diagonal_sum) {
+          break;
+        }
+      }
+      if (m == l) {
+        break;
+      }
+      if (iteration == max_iterations) {
+        throw std::runtime_error(
+            std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+            ": "
+            "The tridiagonal eigenvalue problem did not converge.");
+      }
+
+      // Implicit QL step with Wilkinson shift
+      double g{
+          (diagonal(l + 1) - diagonal(l)) / (2. * offdiagonal(l))};
+      double r{std::hypot(g, 1.)};
+      g = diagonal(m) - diagonal(l) +
+          offdiagonal(l) / (g + std::copysign(r, g));
+      double s{1.}, c{1.}, p{0.};
+      bool is_deflated{false};
+      for (size_t i{m}; i-- > l;) {
+        const double f{s * offdiagonal(i)};
+        const double b{c * offdiagonal(i)};
+        r = std::hypot(f, g);
+        offdiagonal(i + 1) = r;
+        if (r == 0.) {
+          diagonal(i + 1) -= p;
+          offdiagonal(m) = 0.;
+          is_deflated = true;
+          break;
+        }
+        s = f / r;
+        c = g / r;
+        g = diagonal(i + 1) - p;
+        r = (diagonal(i) - g) * s + 2. * c * b;
+        p = s * r;
+        diagonal(i + 1) = g + p;
+        g = c * r - b;
+      }
+      if (is_deflated) {
+        continue;
+      }
+      diagonal(l) -= p;
+      offdiagonal(l) = g;
+      offdiagonal(m) = 0.;
+    }
+  }
 
-  if (polynomial_order >= 1) {
-    const double aux1{
-        (alpha + 1.) * (beta + 1.) / (alpha + beta + 3.) * aux0};
-    jacobi_ini.push_back(
-        ((alpha + beta + 2.) * position + (alpha - beta)) / 2. /
-        std::sqrt(aux1));
+  return arma::sort(diagonal);
+}
+//-------------------------------------------------------------------------
+double Jacobi_basis::polish_jacobi_root(
+    const double alpha,
+    const double beta,
+    const size_t polynomial_order,
+    const double root) const {
+
+  const size_t max_iterations{10};
+  double polished_root{root};
+  for (size_t iteration{0}; iteration < max_iterations; ++iteration) {
+    const auto [polynomial, gradient, sum_of_squares] =
+        this->get_jacobi_recurrence_sweep(
+            alpha, beta, polynomial_order, polished_root);
+    const double step{polynomial / gradient};
+    polished_root -= step;
+    if (std::fabs(step) <=
+        std::numeric_limits<double>::epsilon() * std::fabs(polished_root)) {
+      break;
+    }
   }
 
-  return jacobi_ini;
+  return polished_root;
 }
 //----
-void Jacobi_basis::apply_reccurence(
-    arma::vec &jacobi_polynomial,
+std::tuple<double, double, double> Jacobi_basis::get_jacobi_recurrence_sweep(
     const double alpha,
     const double beta,
     const size_t polynomial_order,
     const double position) const {
 
-  double a_old{
-      2. / (2. + alpha + beta) *
-      sqrt((alpha + 1) * (beta + 1) / (alpha + beta + 3))};
-  double a_new, b_new, aux;
-
-  for (size_t i{0}; i < polynomial_order - 1; ++i) {
-    aux = 2. * double(i + 1) + alpha + beta;
+  const auto recurrence{
+      this->get_recurrence_coefficients(alpha, beta, polynomial_order)};
+  const std::vector<double> &a{recurrence->a};
+  const std::vector<double> &b{recurrence->b};
 
-    a_new = 2. / (aux + 2.) *
-            std::sqrt(
-                (double(i) + 2.) * (double(i) + 2. + alpha + beta) *
-                (double(i) + 2. + alpha) * (double(i) + 2. + beta) /
-                (aux + 1.) / (aux + 3.));
+  // Same recurrence as in get_jacobi_polynomial(...), including the
+  // gradient
+  if (polynomial_order == 0) {
+    return {recurrence->initial_polynomial, 0., 0.};
+  }
 
-    b_new = -(alpha * alpha - beta * beta) / (aux * aux + 2 * aux);
+  double poly_old{recurrence->initial_polynomial};
+  double poly{recurrence->initial_slope * (position - b[0])};
+  double grad_old{0.};
+  double grad{recurrence->initial_slope};
+  double sum_of_squares{poly_old * poly_old};
+  for (size_t n{1}; n < polynomial_order; ++n) {
+    const double poly_new{
+        1. / a[n + 1] * (-a[n] * poly_old + (position - b[n]) * poly)};
+    const double grad_new{
+        1. / a[n + 1] * (-a[n] * grad_old + poly + (position - b[n]) * grad)};
+
+    sum_of_squares += poly * poly;
+    poly_old = poly;
+    poly = poly_new;
+    grad_old = grad;
+    grad = grad_new;
+  }
 
-    jacobi_polynomial[i + 2] =
-        1. / a_new *
-        (-a_old * jacobi_polynomial[i] +
-         (position - b_new) * jacobi_polynomial[i + 1]);
+  return {poly, grad, sum_of_squares};
+}
+//-------------------------------------------------------------------------
+void Jacobi_basis::check_jacobi_parameters(
+    const double alpha,
+    const double beta) const {
 
-    a_old = a_new;
+  if (alpha <= -1.0) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Parameter alpha must greater than -1.");
+  }
+  if (beta <= -1.0) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Parameter beta must be greater than -1.");
   }
+  if ((alpha + beta) == -1.0) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "To calculate the Jacobi polynomials the "
+        "sum alpha+beta must not be -1.");
+  };
+}
+//----
+double Jacobi_basis::get_initial_squared_norm(
+    const double alpha,
+    const double beta) const {
+
+  return std::pow(2., alpha + beta + 1.) / (alpha + beta + 1.) *
+         std::tgamma(alpha + 1.) * std::tgamma(beta + 1.) /
+         std::tgamma(alpha + beta + 1.);
 }
 } // namespace DG
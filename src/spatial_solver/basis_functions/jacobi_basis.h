@@ -3,9 +3,36 @@
 
 #include <armadillo>
 #include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace DG {
+
+/// @brief Quadrature nodes in ascending order and their weights
+struct Quadrature {
+  std::vector<double> nodes;
+  std::vector<double> weights;
+};
+
+/**
+ * @brief Coefficients of the three-term recurrence
+ * \f$x p_n = a_{n+1} p_{n+1} + b_n p_n + a_n p_{n-1}\f$ of the
+ * orthonormalized Jacobi polynomials \f$p_n\f$, where a[n] holds
+ * \f$a_n\f$ for \f$n \geq 1\f$ and b[n] holds \f$b_n\f$. The recurrence
+ * starts with the constant \f$p_0\f$ and \f$p_1(x) = s (x - b_0)\f$,
+ * where the slope \f$s = p_0/a_1\f$ is computed directly for accuracy.
+ */
+struct Recurrence_coefficients {
+  std::vector<double> a;
+  std::vector<double> b;
+  double initial_polynomial;
+  double initial_slope;
+};
+
 /**
  * @brief Create quadrature nodes for the spatial solver.
  *
@@ -18,7 +45,13 @@ namespace DG {
  * is of tridiagonal form. The matrix elements I have implemented here can
  * be found in \cite gil2007numerical [chapter 5.3, (5.109)]. One can show
  * that the eigenvalues of the tridiagonal matrix are identical to the
- * quadrature nodes. (The eigenvectors contain the quadrature weights.)
+ * quadrature nodes. (The eigenvectors contain the quadrature weights.)<br>
+ * The tridiagonal eigenvalue problem is solved once per quadrature rule
+ * by the implicit QL algorithm, which needs \f$\mathcal{O}(n^2)\f$
+ * operations instead of the \f$\mathcal{O}(n^3)\f$ of a dense solver.
+ * Each eigenvalue is polished by a Newton step on the orthonormal Jacobi
+ * polynomial afterwards, such that high-order nodes are accurate to
+ * machine precision.
  */
 class Jacobi_basis {
 
@@ -44,6 +77,36 @@ public:
       const double beta,
       const size_t polynomial_order) const;
 
+  /**
+   * @brief Compute Gauss-Lobatto quadrature nodes and weights for the
+   * weight function \f$(1-x)^\alpha(1+x)^\beta\f$, which integrate
+   * polynomials up to order \f$2n-1\f$ exactly.
+   *
+   * The inner weights follow from the Gauss-Jacobi weights \f$\tilde
+   * w_i\f$ of \f$P_{n-2}^{\alpha+1,\beta+1}\f$ as \f$\tilde
+   * w_i/(1-x_i^2)\f$, the outer weights are given in closed form in
+   * @cite karniadakis2005spectral (Appendix B).
+   */
+  Quadrature get_gauss_lobatto_quadrature(
+      const double alpha,
+      const double beta,
+      const size_t polynomial_order) const;
+
+  /**
+   * @brief Compute the \f$n+1\f$ Gauss-Jacobi quadrature nodes and
+   * weights for the weight function \f$(1-x)^\alpha(1+x)^\beta\f$.
+   *
+   * The weights are given by the Christoffel function
+   * \f$w_i = 1/\sum_{k=0}^{n} p_k(x_i)^2\f$ of the orthonormal
+   * Jacobi polynomials \f$p_k\f$ at the polished nodes. This is
+   * equivalent to the first eigenvector components of Golub and Welsch,
+   * but keeps the small weights at the interval ends accurate.
+   */
+  Quadrature get_gauss_jacobi_quadrature(
+      const double alpha,
+      const double beta,
+      const size_t polynomial_order) const;
+
   /**
    * @brief Compute the orthonormalized Jacobi polynomials
    *
@@ -70,6 +133,64 @@ public:
       const size_t order,
       const double position) const;
 
+  /**
+   * @brief Evaluate all orthonormalized Jacobi polynomials of order
+   * \f$0,\dots,n\f$ at all given positions in a single sweep of the
+   * recurrence relation. Column \f$k\f$ of the returned matrix holds
+   * \f$p_k\f$ at all positions, i.e. the matrix is the Vandermonde matrix
+   * of the positions. Each recurrence step operates on whole columns, and
+   * the values are identical to those of get_jacobi_polynomial(...).
+   */
+  arma::mat get_jacobi_polynomials(
+      const double alpha,
+      const double beta,
+      const size_t max_order,
+      const arma::vec &positions) const;
+
+  /**
+   * @brief Evaluate the gradients of all orthonormalized Jacobi
+   * polynomials of order \f$0,\dots,n\f$ at all given positions, i.e.
+   * the gradient Vandermonde matrix (see get_jacobi_polynomials(...))
+   */
+  arma::mat get_jacobi_polynomial_gradients(
+      const double alpha,
+      const double beta,
+      const size_t max_order,
+      const arma::vec &positions) const;
+
+  /**
+   * @brief Coefficients of the recurrence relation of the orthonormalized
+   * Jacobi polynomials up to order \f$n\f$, i.e. \f$a_1,\dots,a_{n+2}\f$
+   * and \f$b_0,\dots,b_n\f$ @cite gil2007numerical (chapter 5.3)
+   *
+   * The table of each \f$(\alpha,\beta)\f$ is computed on the first
+   * request and rebuilt only if a higher order is requested, where it
+   * covers at least min_tabulated_order. Requests are thread-safe.
+   *
+   * @return Table of at least the requested order
+   */
+  std::shared_ptr<const Recurrence_coefficients> get_recurrence_coefficients(
+      const double alpha,
+      const double beta,
+      const size_t max_order) const;
+
+  /**
+   * @brief Evaluate the expansions \f$\sum_{k=0}^n c_k p_k(x)\f$ in the
+   * orthonormalized Jacobi polynomials at all given positions by
+   * Clenshaw's backward recurrence @cite press2007numerical (chap. 5.4).
+   * Row \f$i\f$ of the coefficients holds the expansion at position
+   * \f$i\f$, i.e. column \f$k\f$ holds \f$c_k\f$ as in
+   * get_jacobi_polynomials(...).<br>
+   * Contrary to summing up the Vandermonde matrix, no polynomial is
+   * stored. Each recurrence step is a single loop over contiguous arrays of
+   * the positions, which the compiler vectorizes.
+   */
+  arma::vec get_jacobi_expansion(
+      const double alpha,
+      const double beta,
+      const arma::mat &coefficients,
+      const arma::vec &positions) const;
+
 private:
   /**
    * @brief Compute Gauss-Jacobi quadrature nodes.
@@ -89,45 +210,58 @@ private:
       const size_t polynomial_order) const;
 
   /**
-   * @brief Compute the symmetric tridiagonal Jacobi matrix for the
-   * Gauss-Jacobi quadrature.
+   * @brief Compute the eigenvalues of a symmetric tridiagonal matrix by
+   * the implicit QL algorithm with Wilkinson shifts (see tqli in
+   * @cite press2007numerical, chap. 11.4)
    *
-   * Since the Jacobi matrix is symmetric and tridiagonal, all
-   * nonzero elements can be stored in two vectors: the diagonal and the
-   * subdiagonal (which is identical to the superdiagonal)
+   * @param[in] diagonal Diagonal of the matrix
+   * @param[in] subdiagonal Subdiagonal (and superdiagonal) of the matrix
+   *
+   * @return Eigenvalues in ascending order
    */
-  arma::mat get_jacobi_polynomial_matrix(
-      const double alpha,
-      const double beta,
-      const size_t polynomial_order) const;
-
-  arma::mat get_tridiagonal_matrix(
-      const arma::vec diagonal,
-      const arma::vec subdiagonal,
-      const size_t polynomial_order) const;
+  arma::vec get_tridiagonal_eigenvalues(
+      arma::vec diagonal,
+      const arma::vec &subdiagonal) const;
 
-  arma::vec get_matrix_diagonal(
-      const double alpha,
-      const double beta,
-      const size_t polynomial_order) const;
-
-  arma::vec get_matrix_subdiagonal(
+  /**
+   * @brief Improve a root of the orthonormal Jacobi polynomial of a given
+   * order by Newton's method
+   */
+  double polish_jacobi_root(
       const double alpha,
       const double beta,
-      const size_t polynomial_order) const;
+      const size_t polynomial_order,
+      const double root) const;
 
-  std::vector<double> get_recurrence_initiation(
+  /**
+   * @brief Evaluate the orthonormal Jacobi polynomial of a given order,
+   * its gradient, and the sum of squares of all polynomials of lower order
+   * in a single pass of the recurrence relation
+   */
+  std::tuple<double, double, double> get_jacobi_recurrence_sweep(
       const double alpha,
       const double beta,
       const size_t polynomial_order,
       const double position) const;
 
-  void apply_reccurence(
-      arma::vec& jacobi_polynomial,
+  Recurrence_coefficients build_recurrence_coefficients(
       const double alpha,
       const double beta,
-      const size_t polynomial_order,
-      const double position) const;
+      const size_t max_order) const;
+
+  void check_jacobi_parameters(const double alpha, const double beta) const;
+
+  /// @brief Squared norm of the Jacobi polynomial of order zero
+  double get_initial_squared_norm(const double alpha, const double beta) const;
+
+  /// @brief Smallest order of a recurrence table
+  static constexpr size_t min_tabulated_order{32};
+
+  static std::mutex recurrence_mutex;
+  static std::map<
+      std::pair<double, double>,
+      std::shared_ptr<const Recurrence_coefficients>>
+      recurrence_tables;
 };
 } // namespace DG
 #endif
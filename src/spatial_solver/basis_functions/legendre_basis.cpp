@@ -5,6 +5,9 @@
 namespace DG {
 std::vector<double>
 Legendre_basis::get_quad_nodes(const size_t polynomial_order) const {
+  if (const auto table{this->get_gll_table(polynomial_order)}) {
+    return {table->nodes, table->nodes + polynomial_order + 1};
+  }
   return this->get_gauss_lobatto_nodes(0, 0, polynomial_order);
 };
 
@@ -20,4 +23,22 @@ double Legendre_basis::get_polynomial_gradient(
   return this->get_jacobi_polynomial_gradient(
       0, 0, polynomial_order, position);
 };
+
+arma::mat Legendre_basis::get_polynomials(
+    const size_t max_order,
+    const arma::vec &positions) const {
+  return this->get_jacobi_polynomials(0, 0, max_order, positions);
+};
+
+arma::mat Legendre_basis::get_polynomial_gradients(
+    const size_t max_order,
+    const arma::vec &positions) const {
+  return this->get_jacobi_polynomial_gradients(0, 0, max_order, positions);
+};
+
+arma::vec Legendre_basis::get_polynomial_expansion(
+    const arma::mat &coefficients,
+    const arma::vec &positions) const {
+  return this->get_jacobi_expansion(0, 0, coefficients, positions);
+};
 } // namespace DG
@@ -1,6 +1,7 @@
 #ifndef LEGENDRE_BASIS_H
 #define LEGENDRE_BASIS_H
 
+#include "gll_tables.h"
 #include "jacobi_basis.h"
 #include "polynomial.h"
 
@@ -25,10 +26,23 @@ public:
    * @brief The Gaussian quadrature nodes for the Legendre polynomials are
    * a special case of the Gauss-Lobatto nodes of the Jacobi_basis class,
    * where the parameters of the Gauss-Lobatto nodes are set to
-   * \f$\alpha=\beta=0\f$.
+   * \f$\alpha=\beta=0\f$. For the orders in gll_tables.h the nodes are
+   * taken from the table instead of being computed.
    */
   std::vector<double> get_quad_nodes(const size_t polynomial_order) const;
 
+  /**
+   * @brief Get the precomputed Legendre-Gauss-Lobatto table of a
+   * polynomial order, which holds the nodes, weights, differentiation
+   * matrix, and lift matrix (see gll_tables.h)
+   *
+   * @return Table, or nullptr if the order is not tabulated
+   */
+  inline const GLL_tables::Table *
+  get_gll_table(const size_t polynomial_order) const {
+    return GLL_tables::get_table(polynomial_order);
+  };
+
   /**
    * @brief The Legendre polynomials are derived from the Jacobi
    * polynomials by setting the Jacobi polynomial parameters to
@@ -46,6 +60,28 @@ public:
   double get_polynomial_gradient(
       const size_t polynomial_order,
       const double position) const;
+
+  /**
+   * @brief All Legendre polynomials up to a given order at all positions,
+   * evaluated in a single sweep of the Jacobi recurrence with
+   * \f$\alpha=\beta=0\f$.
+   */
+  arma::mat get_polynomials(
+      const size_t max_order,
+      const arma::vec &positions) const;
+
+  /// @brief All Legendre polynomial gradients up to a given order
+  arma::mat get_polynomial_gradients(
+      const size_t max_order,
+      const arma::vec &positions) const;
+
+  /**
+   * @brief Legendre expansions at all positions by the Clenshaw recurrence
+   * of the Jacobi polynomials with \f$\alpha=\beta=0\f$
+   */
+  arma::vec get_polynomial_expansion(
+      const arma::mat &coefficients,
+      const arma::vec &positions) const;
 };
 } // namespace DG
 #endif
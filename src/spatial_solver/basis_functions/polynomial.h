@@ -1,6 +1,7 @@
 #ifndef POLYNOMIAL_H
 #define POLYNOMIAL_H
 
+#include <armadillo>
 #include <cstddef>
 #include <vector>
 #include <cmath>
@@ -31,6 +32,30 @@ public:
       const size_t polynomial_order,
       const double position) const = 0;
 
+  /**
+   * @brief Evaluate the polynomials of order \f$0,\dots,n\f$ at all given
+   * positions at once, where column \f$k\f$ of the returned matrix holds
+   * the polynomial of order \f$k\f$. This is the Vandermonde matrix of
+   * the positions.
+   */
+  virtual arma::mat get_polynomials(
+      const size_t max_order,
+      const arma::vec &positions) const = 0;
+
+  /// @brief Gradient counterpart of get_polynomials(...)
+  virtual arma::mat get_polynomial_gradients(
+      const size_t max_order,
+      const arma::vec &positions) const = 0;
+
+  /**
+   * @brief Evaluate the expansion \f$\sum_k c_k p_k\f$ at all given
+   * positions, where row \f$i\f$ of the coefficients belongs to position
+   * \f$i\f$ and column \f$k\f$ to the polynomial of order \f$k\f$
+   */
+  virtual arma::vec get_polynomial_expansion(
+      const arma::mat &coefficients,
+      const arma::vec &positions) const = 0;
+
   /**
    * @brief Depending on the type of finite element, the number of
    *quadrature nodes might vary. However, in 1D I always have a fixed
@@ -36,7 +36,9 @@ public:
    * @brief Compute the Vandermonde matrix from some orthonormalized
    * polynomials. For example one can compute the Vandermonde matrix from
    * the orthonormalized Jacobi polynomials -- a function of two doubles
-   * alpha and beta, an unsigned integer n, and a double pos.<br> The
+   * alpha and beta, an unsigned integer n, and a double pos. All orders
+   * are evaluated at all nodes in one sweep of the basis recurrence (see
+   * Polynomial::get_polynomials(...)).<br> The
    * function is adapted from [Vandermonde1D.m]
    * (https://github.com/tcew/nodal-dg/blob/master/Codes1.1/Codes1D/Vandermonde1D.m)
    * @cite hesthaven2008nodal
@@ -58,18 +60,22 @@ public:
    * @brief Compute the lift matrix
    * \f[
    *  \mathcal L = \mathcal M^{-1} \mathcal E
-   * \f] where \f$\mathcal M = \mathcal V \mathcal V^{\mathrm{T}}\f$
-   * denotes the mass matrix which is composed of the Vandermonde matrix
-   * \f$ \mathcal V \f$ and its transposed. Furthermore, the matrix \f$
-   * \mathcal E=(\hat{\mathbf e}_{1}, \hat{\mathbf e}_{N_\mathrm p})\f$
-   * denotes a matrix which is composed of the unit vectors \f$\hat{\mathbf
-   * e}_{1}
+   * \f] where \f$\mathcal M^{-1} = \mathcal V \mathcal V^{\mathrm{T}}\f$
+   * denotes the inverse mass matrix which is composed of the Vandermonde
+   * matrix \f$ \mathcal V \f$ and its transposed. Furthermore, the matrix
+   * \f$\mathcal E\f$ denotes the face interpolation matrix (see
+   * get_face_interpolation_matrix()), which is composed of the unit vectors
+   * \f$\hat{\mathbf e}_{1}
    * =(1,\underbrace{0,\dots,0}_{(N_\mathrm{p}-1)\text{-times}})^\mathrm{T}\f$
    * and
    * \f$\hat{\mathbf e}_{N_\mathrm{p}}
    * =(\underbrace{0,\dots,0}_{(N_\mathrm{p}-1)\text{-times}},1)^\mathrm{T}\f$
-   * where each of the unit vectors has a length of
-   * \f$N_\mathrm{p} = n + 1 \f$ (\f$n\f$: polynomial order).<br>
+   * if the nodes include the element faces, where each of the unit
+   * vectors has a length of \f$N_\mathrm{p} = n + 1 \f$ (\f$n\f$:
+   * polynomial order). As \f$\mathcal E = \mathcal V^{-\mathrm T}
+   * \mathcal P\f$ with the polynomials \f$\mathcal P\f$ at the faces,
+   * the lift matrix is given by \f$\mathcal V \mathcal P\f$ for any
+   * nodes.<br>
    * The function is adapted from [Lift1D.m]
    * (https://github.com/tcew/nodal-dg/blob/master/Codes1.1/Codes1D/Lift1D.m)
    * \cite hesthaven2008nodal (chapter 3.2, Lift1D.m)
@@ -84,7 +90,8 @@ public:
    * a function of two doubles alpha and beta, an unsigned integer n, and a
    * double pos. Within the gradient Vandermonde matrix routine the
    * position pos is set to the nodal points initalized in the
-   * constructor.<br> The function is adapted from [GradVandermonde1D.m]
+   * constructor. As for the Vandermonde matrix, all orders are evaluated
+   * at once.<br> The function is adapted from [GradVandermonde1D.m]
    * (https://github.com/tcew/nodal-dg/blob/master/Codes1.1/Codes1D/GradVandermonde1D.m)
    * \cite hesthaven2008nodal (chapter 3.2, GradVandermonde1D.m)
    *
@@ -92,10 +99,26 @@ public:
    */
   arma::mat get_grad_vandermonde_matrix() const;
 
+  /**
+   * @brief Compute the \f$(N_\mathrm{p} \times 2)\f$-matrix whose
+   * columns interpolate the nodal values of an element to its left and
+   * right face, i.e. the Lagrange polynomials of the nodes at \f$\mp
+   * 1\f$. If the nodes include the faces, the columns are unit vectors.
+   */
+  arma::mat get_face_interpolation_matrix() const;
+
+  /// @brief Check whether the first and last node lie on the faces
+  inline bool has_face_nodes() const {
+    return this->nodes.front() == -1. && this->nodes.back() == 1.;
+  };
+
 private:
   mutable Basis basis;
   const size_t polynomial_order;
   const arma::vec nodes;
+
+  /// @brief Polynomials at the left and right face (one column per face)
+  arma::mat get_face_polynomials() const;
 };
 } // namespace DG
 
@@ -9,16 +9,7 @@ Elementwise_operations<Basis>::Elementwise_operations(
 template <class Basis>
 arma::mat Elementwise_operations<Basis>::get_vandermonde_matrix() const {
 
-  arma::mat vand_mat(this->nodes.size(), this->polynomial_order + 1);
-
-  for (size_t node_idx{0}; node_idx < this->nodes.size(); ++node_idx) {
-    for (size_t n{0}; n <= this->polynomial_order; ++n) {
-      vand_mat(node_idx, n) =
-          this->basis.get_polynomial(n, this->nodes[node_idx]);
-    }
-  }
-
-  return vand_mat;
+  return this->basis.get_polynomials(this->polynomial_order, this->nodes);
 }
 //-------------------------------------------------------------------------
 template <class Basis>
@@ -30,8 +21,11 @@ Elementwise_operations<Basis>::get_diff_matrix() const {
   if (this->polynomial_order == 0) {
     diff_mat.zeros();
   } else {
-    diff_mat = this->get_grad_vandermonde_matrix() *
-               arma::inv(this->get_vandermonde_matrix());
+    // D = V_r V^{-1}, solved as V^T D^T = V_r^T instead of inverting V
+    diff_mat = arma::solve(
+                   this->get_vandermonde_matrix().t(),
+                   this->get_grad_vandermonde_matrix().t())
+                   .t();
   }
   return diff_mat;
 }
@@ -39,32 +33,38 @@ Elementwise_operations<Basis>::get_diff_matrix() const {
 template <class Basis>
 arma::mat Elementwise_operations<Basis>::get_lift_matrix() const {
 
-  arma::mat inverse_mass_matrix(
-      this->get_vandermonde_matrix() *
-      arma::trans(this->get_vandermonde_matrix()));
-
-  arma::mat lift_matrix(this->polynomial_order + 1, 2, arma::fill::zeros);
-
-  lift_matrix.col(0) = inverse_mass_matrix.col(0);
-  lift_matrix.col(1) = inverse_mass_matrix.col(this->polynomial_order);
-
-  return lift_matrix;
+  return this->get_vandermonde_matrix() * this->get_face_polynomials();
 }
 //-------------------------------------------------------------------------
 template <class Basis>
 arma::mat
 Elementwise_operations<Basis>::get_grad_vandermonde_matrix() const {
 
-  arma::mat grad_vand_mat(
-      this->nodes.size(), this->polynomial_order + 1, arma::fill::zeros);
+  return this->basis.get_polynomial_gradients(
+      this->polynomial_order, this->nodes);
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::mat
+Elementwise_operations<Basis>::get_face_interpolation_matrix() const {
 
-  for (size_t node_idx{0}; node_idx < this->nodes.size(); ++node_idx) {
-    for (size_t n{0}; n <= this->polynomial_order; ++n) {
-      grad_vand_mat(node_idx, n) =
-          this->basis.get_polynomial_gradient(n, this->nodes[node_idx]);
-    }
+  const size_t num_nodes{this->polynomial_order + 1};
+  if (this->has_face_nodes()) {
+    arma::mat face_interpolation(num_nodes, 2, arma::fill::zeros);
+    face_interpolation(0, 0) = 1.;
+    face_interpolation(num_nodes - 1, 1) = 1.;
+    return face_interpolation;
   }
 
-  return grad_vand_mat;
+  // The Lagrange polynomials l(x) = V^{-T} p(x) at the faces
+  return arma::solve(
+      this->get_vandermonde_matrix().t(), this->get_face_polynomials());
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::mat Elementwise_operations<Basis>::get_face_polynomials() const {
+
+  const arma::vec faces{-1., 1.};
+  return this->basis.get_polynomials(this->polynomial_order, faces).t();
 }
 } // namespace DG
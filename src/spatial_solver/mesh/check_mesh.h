@@ -2,50 +2,57 @@
 #define CHECK_MESH_H
 
 #include "mesh.h"
+#include "mesh_model.h"
+#include "mesh_section_index.h"
 
 #include <cstddef>
 #include <fstream>
 #include <string>
-#include <vector>
 
 namespace Mesh {
 
 /**
  * @brief Class to check the mesh file in general, more detailed checks can
- * be found in the classes Import_mesh_data and Process_mesh_data
+ * be found in the classes Import_mesh_data and Process_mesh_data.<br>
+ * Apart from the existence of the file, the checks for empty lines, the
+ * section specifiers, and the mesh format are done by the mesh reader
+ * while importing the mesh model (see DG::Mesh::Gmsh_reader). Hence, the
+ * mesh file is read only once, and the validated mesh model can be handed
+ * on to DG::Mesh::Process_mesh_data.
  */
 class Check_mesh {
 
 public:
-  Check_mesh(const std::string &filename);
+  /**
+   * @param[in] filename Name of the mesh file
+   * @param[in] num_threads Number of threads to import the mesh with (see
+   * DG::Mesh::Import_mesh_data::import_mesh_model())
+   */
+  Check_mesh(const std::string &filename, const size_t num_threads = 1);
 
   void check_mesh_existence();
 
-  void check_empty_lines();
-
-  void check_mesh_format();
-
   /**
-   * @brief In Gmsh the mesh file is ordered in sections, which are
-   * enclosed by so-called specifiers. Hence, the check for these
-   * specifiers.
+   * @brief Get the section index built while checking the mesh, so that
+   * it can be passed on to Import_mesh_data instead of scanning the mesh
+   * file once more.
    */
-  void check_specifiers();
+  inline const DG::Mesh::Mesh_section_index &get_section_index() const {
+    return this->section_index;
+  };
 
-private:
   /**
-   * @brief Use vector of pairs to build a map of specific order. I did not
-   * std::map for that matter as the internal ordering differs from the
-   * aspired one.
+   * @brief Hand over the mesh model imported while checking the mesh. The
+   * mesh model of this class is empty afterwards.
    */
-  typedef std::vector<std::pair<std::string, bool>> specifier_table;
-  specifier_table begin_specifier;
-  specifier_table end_specifier;
+  inline DG::Mesh::Mesh_model release_mesh_model() {
+    return std::move(this->mesh_model);
+  };
 
+private:
   const std::string mesh_name;
-
-  void check_unfound_specifiers();
-  std::string get_unfound_specifiers() const;
+  DG::Mesh::Mesh_section_index section_index;
+  DG::Mesh::Mesh_model mesh_model;
 };
 
 } // namespace Mesh
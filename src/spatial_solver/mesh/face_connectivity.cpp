@@ -0,0 +1,150 @@
+#include "face_connectivity.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace DG::Mesh {
+
+Face_connectivity::Face_connectivity(
+    const Mesh_model &mesh_model,
+    std::span<const size_t> elem_tags,
+    const std::vector<std::pair<size_t, size_t>> &periodic_contours)
+    : neighbour_faces(2 * elem_tags.size(), boundary_face),
+      face_nodes(2 * elem_tags.size()) {
+
+  for (size_t elem{0}; elem < elem_tags.size(); ++elem) {
+    const size_t elem_idx{mesh_model.get_elem_index(elem_tags[elem])};
+    if (elem_idx == invalid_index) {
+      throw std::invalid_argument(
+          std::string() + __FILE__ + ":" + std::to_string(__LINE__) +
+          ": "
+          "Did not find element for given element tag.");
+    }
+    this->face_nodes[2 * elem] = mesh_model.get_node_index(
+        mesh_model.elem_node_tags[mesh_model.elem_node_offsets[elem_idx]]);
+    this->face_nodes[2 * elem + 1] = mesh_model.get_node_index(
+        mesh_model.elem_node_tags
+            [mesh_model.elem_node_offsets[elem_idx + 1] - 1]);
+  }
+
+  // In 1D, a node is shared by at most two faces
+  std::vector<size_t> node_to_face(
+      mesh_model.get_number_of_nodes(), boundary_face);
+  for (size_t face{0}; face < this->face_nodes.size(); ++face) {
+    size_t &other_face(node_to_face[this->face_nodes[face]]);
+    if (other_face == boundary_face) {
+      other_face = face;
+    } else {
+      this->neighbour_faces[face] = other_face;
+      this->neighbour_faces[other_face] = face;
+    }
+  }
+
+  for (const auto &periodic_contour : periodic_contours) {
+    this->connect_periodic_contours(mesh_model, periodic_contour);
+  }
+}
+//-------------------------------------------------------------------------
+void Face_connectivity::connect_periodic_contours(
+    const Mesh_model &mesh_model,
+    const std::pair<size_t, size_t> &periodic_contour) {
+
+  const auto [first_contour, second_contour] = periodic_contour;
+  std::vector<size_t> faces{
+      this->get_boundary_faces(mesh_model, first_contour)};
+  if (first_contour != second_contour) {
+    const std::vector<size_t> second_faces{
+        this->get_boundary_faces(mesh_model, second_contour)};
+    if (faces.size() != 1 || second_faces.size() != 1) {
+      faces.clear();
+    } else {
+      faces.push_back(second_faces.front());
+    }
+  }
+
+  if (faces.size() != 2) {
+    throw std::invalid_argument(
+        std::string() + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Periodic contours need to contain exactly one boundary face "
+        "each.");
+  }
+  this->neighbour_faces[faces[0]] = faces[1];
+  this->neighbour_faces[faces[1]] = faces[0];
+}
+//-------------------------------------------------------------------------
+std::vector<size_t> Face_connectivity::get_boundary_faces(
+    const Mesh_model &mesh_model,
+    const size_t contour_tag) const {
+
+  // Contour nodes are given by the point elements of the point entities
+  // belonging to the contour
+  const Entity_table &points(mesh_model.entities[Entity.point]);
+  std::vector<size_t> contour_nodes;
+  for (const auto &elem_block : mesh_model.elem_blocks) {
+    if (elem_block.entity_dim != Entity.point) {
+      continue;
+    }
+    const size_t entity_idx{
+        mesh_model.get_entity_index(Entity.point, elem_block.entity_tag)};
+    if (entity_idx == invalid_index) {
+      continue;
+    }
+    const auto first_tag{
+        points.phys_tags.begin() + points.phys_tag_offsets[entity_idx]};
+    const auto last_tag{
+        points.phys_tags.begin() + points.phys_tag_offsets[entity_idx + 1]};
+    if (std::find(first_tag, last_tag, contour_tag) == last_tag) {
+      continue;
+    }
+    for (size_t elem_idx{elem_block.first_elem};
+         elem_idx < elem_block.first_elem + elem_block.num_elems;
+         ++elem_idx) {
+      for (size_t node{mesh_model.elem_node_offsets[elem_idx]};
+           node < mesh_model.elem_node_offsets[elem_idx + 1];
+           ++node) {
+        contour_nodes.push_back(
+            mesh_model.get_node_index(mesh_model.elem_node_tags[node]));
+      }
+    }
+  }
+
+  std::vector<size_t> boundary_faces;
+  for (size_t face{0}; face < this->face_nodes.size(); ++face) {
+    if (this->neighbour_faces[face] == boundary_face &&
+        std::find(
+            contour_nodes.begin(),
+            contour_nodes.end(),
+            this->face_nodes[face]) != contour_nodes.end()) {
+      boundary_faces.push_back(face);
+    }
+  }
+
+  return boundary_faces;
+}
+//-------------------------------------------------------------------------
+Trace_indices
+Face_connectivity::get_trace_indices(const size_t num_nodes) const {
+
+  // Linear index of the field value at a face
+  auto get_face_index = [num_nodes](const size_t face) {
+    const size_t elem{face / 2};
+    return face % 2 == 0 ? elem * num_nodes : (elem + 1) * num_nodes - 1;
+  };
+
+  Trace_indices trace_indices;
+  trace_indices.interior.reserve(this->neighbour_faces.size());
+  trace_indices.exterior.reserve(this->neighbour_faces.size());
+  trace_indices.neighbour_faces = this->neighbour_faces;
+  for (size_t face{0}; face < this->neighbour_faces.size(); ++face) {
+    trace_indices.interior.push_back(get_face_index(face));
+    trace_indices.exterior.push_back(
+        this->neighbour_faces[face] == boundary_face
+            ? boundary_face
+            : get_face_index(this->neighbour_faces[face]));
+  }
+
+  return trace_indices;
+}
+} // namespace DG::Mesh
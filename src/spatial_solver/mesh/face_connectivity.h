@@ -0,0 +1,119 @@
+#ifndef FACE_CONNECTIVITY_H
+#define FACE_CONNECTIVITY_H
+
+#include "mesh_model.h"
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace DG::Mesh {
+
+/**
+ * @brief Gather indices of the field values at the faces of all elements,
+ * where the fields are stored column-major with one column per element.
+ * The faces of the element in column k are the left face 2k and the right
+ * face 2k+1. interior[f] is the index of the field value at face f of the
+ * element itself and exterior[f] is the one of the neighbouring element,
+ * or boundary_face if face f lies on the boundary. The neighbouring face
+ * itself is kept as well, since the indices of both faces of an element
+ * coincide for a single node per element.
+ */
+struct Trace_indices {
+  static constexpr size_t boundary_face{std::numeric_limits<size_t>::max()};
+
+  std::vector<size_t> interior;
+  std::vector<size_t> exterior;
+  /**
+   * @brief Face of the neighbouring element or boundary_face per face,
+   * e.g. to evaluate a numerical flux once per interface instead of once
+   * per face
+   */
+  std::vector<size_t> neighbour_faces;
+
+  /**
+   * @brief Trace indices of elements which are ordered from left to right
+   * in a single interval, i.e. column k+1 is the right neighbour of
+   * column k. If periodic, the first and the last element are neighbours.
+   */
+  static Trace_indices get_chain(
+      const size_t num_nodes,
+      const size_t num_elems,
+      const bool periodic = false) {
+    Trace_indices trace_indices;
+    for (size_t elem{0}; elem < num_elems; ++elem) {
+      trace_indices.interior.push_back(elem * num_nodes);
+      trace_indices.interior.push_back((elem + 1) * num_nodes - 1);
+      trace_indices.exterior.push_back(
+          elem == 0 ? boundary_face : elem * num_nodes - 1);
+      trace_indices.exterior.push_back(
+          elem + 1 == num_elems ? boundary_face : (elem + 1) * num_nodes);
+      trace_indices.neighbour_faces.push_back(
+          elem == 0 ? boundary_face : 2 * elem - 1);
+      trace_indices.neighbour_faces.push_back(
+          elem + 1 == num_elems ? boundary_face : 2 * elem + 2);
+    }
+    if (periodic && num_elems > 0) {
+      trace_indices.exterior.front() = trace_indices.interior.back();
+      trace_indices.exterior.back() = trace_indices.interior.front();
+      trace_indices.neighbour_faces.front() = 2 * num_elems - 1;
+      trace_indices.neighbour_faces.back() = 0;
+    }
+    return trace_indices;
+  };
+};
+
+/**
+ * @brief Face connectivity of a set of 1D elements, which is found through
+ * the node tags shared by the elements. Hence, the elements may be given
+ * in any order, and the fields of the DG scheme need not be sorted by
+ * coordinate. The elements are referred to by their position in the given
+ * list of element tags, i.e. by the field column.<br>
+ * Periodic boundaries are created by pairs of contour physical tags: the
+ * boundary faces on the nodes of the first contour are connected to those
+ * on the nodes of the second one. A contour paired with itself connects
+ * its two boundary faces, e.g. both end points of a single interval.
+ */
+class Face_connectivity {
+public:
+  static constexpr size_t boundary_face{Trace_indices::boundary_face};
+
+  Face_connectivity(
+      const Mesh_model &mesh_model,
+      std::span<const size_t> elem_tags,
+      const std::vector<std::pair<size_t, size_t>> &periodic_contours = {});
+
+  inline size_t get_num_elems() const {
+    return this->neighbour_faces.size() / 2;
+  };
+
+  /// @brief Face of the neighbouring element or boundary_face per face
+  inline const std::vector<size_t> &get_neighbour_faces() const {
+    return this->neighbour_faces;
+  };
+
+  /**
+   * @brief Get the gather indices of fields with num_nodes nodes per
+   * element
+   */
+  Trace_indices get_trace_indices(const size_t num_nodes) const;
+
+private:
+  std::vector<size_t> neighbour_faces;
+  /// @brief Node index of each face
+  std::vector<size_t> face_nodes;
+
+  void connect_periodic_contours(
+      const Mesh_model &mesh_model,
+      const std::pair<size_t, size_t> &periodic_contour);
+
+  /// @brief Get the boundary faces on the nodes of a contour
+  std::vector<size_t> get_boundary_faces(
+      const Mesh_model &mesh_model,
+      const size_t contour_tag) const;
+};
+} // namespace DG::Mesh
+
+#endif
@@ -0,0 +1,351 @@
+#include "gmsh_ascii_reader.h"
+#include "../../tools/parallel.h"
+
+#include <algorithm>
+
+namespace DG::Mesh {
+
+namespace {
+enum class Line_content { node_tags, node_coords, elements };
+
+/// @brief Consecutive lines of an entity block parsed by a single task
+struct Line_chunk {
+  Line_content content;
+  std::string_view lines;
+  size_t line_number;
+  size_t num_lines;
+  /// Index of the first node or element of the chunk in the mesh model
+  size_t first_entry;
+  /// Index of the first element node of the chunk in the mesh model
+  size_t first_elem_node;
+  size_t num_elem_nodes;
+};
+
+/**
+ * @brief Split the next num_lines lines of the reader into chunks of at
+ * most chunk_size lines
+ */
+void split_lines(
+    Import::Token_reader &reader,
+    Line_chunk chunk,
+    size_t num_lines,
+    const size_t chunk_size,
+    std::vector<Line_chunk> &chunks) {
+
+  while (num_lines > 0) {
+    chunk.num_lines = std::min(num_lines, chunk_size);
+    chunk.line_number = reader.get_line_number();
+    const char *chunk_begin{reader.get_position()};
+    reader.skip_lines(chunk.num_lines);
+    chunk.lines = {chunk_begin, size_t(reader.get_position() - chunk_begin)};
+    chunks.push_back(chunk);
+
+    chunk.first_entry += chunk.num_lines;
+    chunk.first_elem_node += chunk.num_lines * chunk.num_elem_nodes;
+    num_lines -= chunk.num_lines;
+  }
+}
+
+void parse_chunk(const Line_chunk &chunk, Mesh_model &mesh_model) {
+
+  Import::Token_reader reader(chunk.lines, chunk.line_number);
+
+  if (chunk.content == Line_content::node_tags) {
+    size_t *node_tag{mesh_model.node_tags.data() + chunk.first_entry};
+    for (size_t line{0}; line < chunk.num_lines; ++line) {
+      node_tag[line] = reader.next<size_t>();
+    }
+  } else if (chunk.content == Line_content::node_coords) {
+    double *node_coord{mesh_model.node_coords.data() + 3 * chunk.first_entry};
+    for (size_t coord{0}; coord < 3 * chunk.num_lines; ++coord) {
+      node_coord[coord] = reader.next<double>();
+    }
+  } else {
+    size_t *elem_tag{mesh_model.elem_tags.data() + chunk.first_entry};
+    size_t *elem_node_tag{
+        mesh_model.elem_node_tags.data() + chunk.first_elem_node};
+    for (size_t line{0}; line < chunk.num_lines; ++line) {
+      const size_t line_number{reader.get_line_number()};
+      Import::Token_reader elem_reader(reader.next_line(), line_number);
+      elem_tag[line] = elem_reader.next<size_t>();
+      for (size_t node{0}; node < chunk.num_elem_nodes; ++node) {
+        *elem_node_tag++ = elem_reader.next<size_t>();
+      }
+      if (elem_reader.has_next()) {
+        throw std::invalid_argument(
+            "Too many nodes for the element type of the entity block. "
+            "(line " +
+            std::to_string(line_number) + ")");
+      }
+    }
+  }
+}
+} // namespace
+//-------------------------------------------------------------------------
+Gmsh_ascii_reader::Gmsh_ascii_reader(
+    const std::string &_mesh_name,
+    const Import::Mapped_file &_mesh_file,
+    const size_t _num_threads)
+    : Gmsh_reader(_mesh_name, _mesh_file),
+      num_threads{Parallel::get_num_threads(_num_threads)} {}
+//-------------------------------------------------------------------------
+void Gmsh_ascii_reader::read_entities(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  size_t number_of_each_entity[4];
+  for (auto &num_entities : number_of_each_entity) {
+    num_entities = reader.next<size_t>();
+  }
+  reader.skip_lines();
+
+  for (size_t entity_type{0}; entity_type < 4; ++entity_type) {
+    // Points carry a single coordinate triple, all other entities a
+    // bounding box of two triples
+    const size_t num_coords{entity_type == Entity.point ? 3ul : 6ul};
+
+    Entity_table &entity_table(mesh_model.entities[entity_type]);
+    entity_table.tags.reserve(number_of_each_entity[entity_type]);
+    for (size_t entity{0}; entity < number_of_each_entity[entity_type];
+         ++entity) {
+      entity_table.tags.push_back(reader.next<size_t>());
+      for (size_t coord{0}; coord < num_coords; ++coord) {
+        reader.next<double>();
+      }
+
+      const size_t num_phys_tags{reader.next<size_t>()};
+      for (size_t phys_tag{0}; phys_tag < num_phys_tags; ++phys_tag) {
+        entity_table.phys_tags.push_back(reader.next<size_t>());
+      }
+      entity_table.phys_tag_offsets.push_back(
+          entity_table.phys_tags.size());
+
+      // Skip the bounding entities
+      reader.skip_lines();
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void Gmsh_ascii_reader::read_nodes(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  if (this->num_threads > 1) {
+    this->read_nodes_in_parallel(reader, mesh_model);
+    return;
+  }
+
+  const size_t num_entity_blocks{reader.next<size_t>()};
+  const size_t num_nodes{reader.next<size_t>()};
+  reader.skip_lines();
+
+  const size_t first_node{mesh_model.node_tags.size()};
+  mesh_model.node_tags.resize(first_node + num_nodes);
+  mesh_model.node_coords.resize(3 * (first_node + num_nodes));
+  size_t *node_tag{mesh_model.node_tags.data() + first_node};
+  double *node_coord{mesh_model.node_coords.data() + 3 * first_node};
+
+  for (size_t entity_block{1}; entity_block <= num_entity_blocks;
+       ++entity_block) {
+    reader.next<size_t>(); // entity dimension
+    reader.next<size_t>(); // entity tag
+    const size_t parametric_flag{reader.next<size_t>()};
+    const size_t block_num_nodes{reader.next<size_t>()};
+
+    this->check_parametric_flag(parametric_flag, entity_block);
+    const size_t num_read_nodes(
+        node_tag - (mesh_model.node_tags.data() + first_node));
+    if (num_read_nodes + block_num_nodes > num_nodes) {
+      throw std::invalid_argument(
+          "More nodes in entity blocks than stated in $Nodes. (line " +
+          std::to_string(reader.get_line_number()) + ")");
+    }
+
+    for (size_t node{0}; node < block_num_nodes; ++node) {
+      *node_tag++ = reader.next<size_t>();
+    }
+    for (size_t coord{0}; coord < 3 * block_num_nodes; ++coord) {
+      *node_coord++ = reader.next<double>();
+    }
+  }
+  const size_t num_read_nodes(node_tag - mesh_model.node_tags.data());
+  mesh_model.node_tags.resize(num_read_nodes);
+  mesh_model.node_coords.resize(3 * num_read_nodes);
+}
+//-------------------------------------------------------------------------
+void Gmsh_ascii_reader::read_elements(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  if (this->num_threads > 1) {
+    this->read_elements_in_parallel(reader, mesh_model);
+    return;
+  }
+
+  const size_t num_entity_blocks{reader.next<size_t>()};
+  const size_t num_elems{reader.next<size_t>()};
+  reader.skip_lines();
+
+  mesh_model.elem_blocks.reserve(num_entity_blocks);
+  mesh_model.elem_tags.reserve(num_elems);
+  mesh_model.elem_node_offsets.reserve(num_elems + 1);
+
+  for (size_t entity_block{0}; entity_block < num_entity_blocks;
+       ++entity_block) {
+    Element_block elem_block;
+    elem_block.entity_dim = reader.next<size_t>();
+    elem_block.entity_tag = reader.next<size_t>();
+    elem_block.elem_type = reader.next<size_t>();
+    elem_block.num_elems = reader.next<size_t>();
+    elem_block.first_elem = mesh_model.elem_tags.size();
+    mesh_model.elem_blocks.push_back(elem_block);
+    reader.skip_lines();
+    get_num_elem_nodes(elem_block.elem_type, reader.get_line_number());
+
+    // The number of nodes depends on the element type, hence each element
+    // is read line by line
+    for (size_t elem{0}; elem < elem_block.num_elems; ++elem) {
+      const size_t line_number{reader.get_line_number()};
+      Import::Token_reader elem_reader(reader.next_line(), line_number);
+      mesh_model.elem_tags.push_back(elem_reader.next<size_t>());
+      while (elem_reader.has_next()) {
+        mesh_model.elem_node_tags.push_back(elem_reader.next<size_t>());
+      }
+      mesh_model.elem_node_offsets.push_back(
+          mesh_model.elem_node_tags.size());
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void Gmsh_ascii_reader::read_nodes_in_parallel(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  const size_t num_entity_blocks{reader.next<size_t>()};
+  const size_t num_nodes{reader.next<size_t>()};
+  reader.skip_lines();
+
+  const size_t first_node{mesh_model.node_tags.size()};
+  mesh_model.node_tags.resize(first_node + num_nodes);
+  mesh_model.node_coords.resize(3 * (first_node + num_nodes));
+
+  // Each entity block consists of a line for each node tag followed by a
+  // line for each node coordinate triple
+  const size_t chunk_size{this->get_chunk_size(2 * num_nodes)};
+  std::vector<Line_chunk> chunks;
+  Line_chunk chunk{Line_content::node_tags, {}, 0, 0, first_node, 0, 0};
+  for (size_t entity_block{1}; entity_block <= num_entity_blocks;
+       ++entity_block) {
+    reader.next<size_t>(); // entity dimension
+    reader.next<size_t>(); // entity tag
+    const size_t parametric_flag{reader.next<size_t>()};
+    const size_t block_num_nodes{reader.next<size_t>()};
+    reader.skip_lines();
+
+    this->check_parametric_flag(parametric_flag, entity_block);
+    if (chunk.first_entry + block_num_nodes > first_node + num_nodes) {
+      throw std::invalid_argument(
+          "More nodes in entity blocks than stated in $Nodes. (line " +
+          std::to_string(reader.get_line_number()) + ")");
+    }
+
+    chunk.content = Line_content::node_tags;
+    split_lines(reader, chunk, block_num_nodes, chunk_size, chunks);
+    chunk.content = Line_content::node_coords;
+    split_lines(reader, chunk, block_num_nodes, chunk_size, chunks);
+    chunk.first_entry += block_num_nodes;
+  }
+  mesh_model.node_tags.resize(chunk.first_entry);
+  mesh_model.node_coords.resize(3 * chunk.first_entry);
+
+  Parallel::run_tasks(
+      chunks.size(), this->num_threads, [&chunks, &mesh_model](size_t n) {
+        parse_chunk(chunks[n], mesh_model);
+      });
+}
+//-------------------------------------------------------------------------
+void Gmsh_ascii_reader::read_elements_in_parallel(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  const size_t num_entity_blocks{reader.next<size_t>()};
+  const size_t num_elems{reader.next<size_t>()};
+  reader.skip_lines();
+
+  const size_t first_elem{mesh_model.elem_tags.size()};
+  mesh_model.elem_blocks.reserve(num_entity_blocks);
+  mesh_model.elem_tags.resize(first_elem + num_elems);
+  mesh_model.elem_node_offsets.reserve(first_elem + num_elems + 1);
+
+  // Contrary to the sequential import, the number of nodes of each element
+  // is given by its type, so that the position of each chunk in the node
+  // tag array is known before parsing
+  const size_t chunk_size{this->get_chunk_size(num_elems)};
+  std::vector<Line_chunk> chunks;
+  Line_chunk chunk{
+      Line_content::elements,
+      {},
+      0,
+      0,
+      first_elem,
+      mesh_model.elem_node_tags.size(),
+      0};
+  for (size_t entity_block{0}; entity_block < num_entity_blocks;
+       ++entity_block) {
+    Element_block elem_block;
+    elem_block.entity_dim = reader.next<size_t>();
+    elem_block.entity_tag = reader.next<size_t>();
+    elem_block.elem_type = reader.next<size_t>();
+    elem_block.num_elems = reader.next<size_t>();
+    elem_block.first_elem = chunk.first_entry;
+    mesh_model.elem_blocks.push_back(elem_block);
+    reader.skip_lines();
+
+    chunk.num_elem_nodes = get_num_elem_nodes(
+        elem_block.elem_type, reader.get_line_number());
+    if (chunk.first_entry + elem_block.num_elems > first_elem + num_elems) {
+      throw std::invalid_argument(
+          "More elements in entity blocks than stated in $Elements. (line " +
+          std::to_string(reader.get_line_number()) + ")");
+    }
+
+    for (size_t elem{0}; elem < elem_block.num_elems; ++elem) {
+      mesh_model.elem_node_offsets.push_back(
+          chunk.first_elem_node + (elem + 1) * chunk.num_elem_nodes);
+    }
+    split_lines(reader, chunk, elem_block.num_elems, chunk_size, chunks);
+    chunk.first_entry += elem_block.num_elems;
+    chunk.first_elem_node += elem_block.num_elems * chunk.num_elem_nodes;
+  }
+  mesh_model.elem_tags.resize(chunk.first_entry);
+  mesh_model.elem_node_tags.resize(chunk.first_elem_node);
+
+  Parallel::run_tasks(
+      chunks.size(), this->num_threads, [&chunks, &mesh_model](size_t n) {
+        parse_chunk(chunks[n], mesh_model);
+      });
+}
+//-------------------------------------------------------------------------
+size_t Gmsh_ascii_reader::get_num_elem_nodes(
+    const size_t elem_type,
+    const size_t line_number) {
+
+  const auto num_elem_nodes{elem_type_to_num_nodes.find(elem_type)};
+  if (num_elem_nodes == elem_type_to_num_nodes.end()) {
+    throw std::invalid_argument(
+        "Unknown element type " + std::to_string(elem_type) + ". (line " +
+        std::to_string(line_number - 1) + ")");
+  }
+  return num_elem_nodes->second;
+}
+//-------------------------------------------------------------------------
+size_t Gmsh_ascii_reader::get_chunk_size(const size_t num_lines) const {
+  // A few chunks per thread balance the load, while a minimal size keeps
+  // the overhead per chunk negligible
+  const size_t chunks_per_thread{8};
+  return std::max(
+      size_t(1024),
+      (num_lines + chunks_per_thread * this->num_threads - 1) /
+          (chunks_per_thread * this->num_threads));
+}
+} // namespace DG::Mesh
@@ -0,0 +1,63 @@
+#ifndef GMSH_ASCII_READER_H
+#define GMSH_ASCII_READER_H
+
+#include "gmsh_reader.h"
+
+namespace DG::Mesh {
+
+/**
+ * @brief Reader for ASCII Gmsh files of format 4.1. The sections are
+ * tokenized in place, i.e. without per-line heap allocations or stream
+ * construction. The mesh model arrays are sized from the counts given in
+ * the section headers.<br>
+ * With more than one thread, the sections '$Nodes' and '$Elements' are
+ * first split into chunks of lines, which only requires looking for line
+ * breaks. As each entity block states its number of lines, I know the
+ * position of every chunk within the mesh model arrays beforehand. The
+ * chunks are then parsed concurrently straight into these arrays.
+ */
+class Gmsh_ascii_reader : public Gmsh_reader {
+public:
+  /**
+   * @param[in] num_threads Number of threads to parse '$Nodes' and
+   * '$Elements' with, where zero means all hardware threads
+   */
+  Gmsh_ascii_reader(
+      const std::string &mesh_name,
+      const Import::Mapped_file &mesh_file,
+      const size_t num_threads = 1);
+
+private:
+  const size_t num_threads;
+
+  void read_entities(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const override;
+
+  void read_nodes(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const override;
+
+  void read_elements(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const override;
+
+  void read_nodes_in_parallel(
+      Import::Token_reader &reader,
+      Mesh_model &mesh_model) const;
+
+  void read_elements_in_parallel(
+      Import::Token_reader &reader,
+      Mesh_model &mesh_model) const;
+
+  /**
+   * @brief Number of nodes of the element type of an entity block, whose
+   * header is the line before the given one
+   */
+  static size_t get_num_elem_nodes(
+      const size_t elem_type,
+      const size_t line_number);
+
+  /// @brief Number of lines per chunk, such that each thread gets a few
+  size_t get_chunk_size(const size_t num_lines) const;
+};
+} // namespace DG::Mesh
+
+#endif
@@ -0,0 +1,309 @@
+#include "gmsh_binary_reader.h"
+#include "../../tools/custom_errors.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace DG::Mesh {
+
+namespace {
+template <typename T> T get_swapped_bytes(T value) {
+  char *bytes{reinterpret_cast<char *>(&value)};
+  std::reverse(bytes, bytes + sizeof(T));
+  return value;
+}
+} // namespace
+//-------------------------------------------------------------------------
+Gmsh_binary_reader::Gmsh_binary_reader(
+    const std::string &_mesh_name,
+    const Import::Mapped_file &_mesh_file)
+    : Gmsh_reader(_mesh_name, _mesh_file) {
+
+  this->data_size = this->mesh_format.data_size;
+  if (this->data_size != 4 && this->data_size != 8) {
+    throw Mesh_error(
+        "Unsupported data size of " + std::to_string(this->data_size) +
+            " bytes in binary mesh.",
+        this->mesh_name);
+  }
+
+  // The binary integer 1 follows the format line of '$MeshFormat'
+  const std::string_view file_content{_mesh_file.view()};
+  Import::Token_reader reader(
+      file_content.substr(file_content.find("$MeshFormat")));
+  reader.skip_lines(2);
+  const char *position{reader.get_position()};
+  this->check_bounds(position, sizeof(int32_t));
+
+  int32_t one;
+  std::memcpy(&one, position, sizeof(int32_t));
+  if (one == 1) {
+    this->swap_bytes = false;
+  } else if (get_swapped_bytes(one) == 1) {
+    this->swap_bytes = true;
+  } else {
+    throw Mesh_error(
+        "Could not detect the byte order of the binary mesh.",
+        this->mesh_name);
+  }
+}
+//-------------------------------------------------------------------------
+void Gmsh_binary_reader::read_entities(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  const char *position{reader.get_position()};
+
+  size_t number_of_each_entity[4];
+  for (auto &num_entities : number_of_each_entity) {
+    num_entities = this->read_size(position);
+  }
+
+  for (size_t entity_type{0}; entity_type < 4; ++entity_type) {
+    // Points carry a single coordinate triple, all other entities a
+    // bounding box of two triples
+    const size_t num_coords{entity_type == Entity.point ? 3ul : 6ul};
+
+    Entity_table &entity_table(mesh_model.entities[entity_type]);
+    entity_table.tags.reserve(number_of_each_entity[entity_type]);
+    for (size_t entity{0}; entity < number_of_each_entity[entity_type];
+         ++entity) {
+      entity_table.tags.push_back(this->read<int32_t>(position));
+      this->check_bounds(position, num_coords, sizeof(double));
+      position += num_coords * sizeof(double);
+
+      const size_t num_phys_tags{this->read_size(position)};
+      for (size_t phys_tag{0}; phys_tag < num_phys_tags; ++phys_tag) {
+        entity_table.phys_tags.push_back(this->read<int32_t>(position));
+      }
+      entity_table.phys_tag_offsets.push_back(
+          entity_table.phys_tags.size());
+
+      // Skip the bounding entities
+      if (entity_type != Entity.point) {
+        const size_t num_bounding_entities{this->read_size(position)};
+        this->check_bounds(
+            position, num_bounding_entities, sizeof(int32_t));
+        position += num_bounding_entities * sizeof(int32_t);
+      }
+    }
+  }
+
+  reader.set_position(position);
+}
+//-------------------------------------------------------------------------
+void Gmsh_binary_reader::read_nodes(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  const char *position{reader.get_position()};
+
+  const size_t num_entity_blocks{this->read_size(position)};
+  const size_t num_nodes{this->read_size(position)};
+  this->read_size(position); // minimal node tag
+  this->read_size(position); // maximal node tag
+
+  // A node takes at least its tag and its coordinates, such that a corrupt
+  // count cannot force an allocation beyond the size of the file
+  if (num_nodes > size_t(this->mesh_file.end() - position) /
+                      (this->data_size + 3 * sizeof(double))) {
+    throw Mesh_error(
+        "More nodes stated in $Nodes than contained in binary mesh.",
+        this->mesh_name);
+  }
+
+  const size_t first_node{mesh_model.node_tags.size()};
+  mesh_model.node_tags.resize(first_node + num_nodes);
+  mesh_model.node_coords.resize(3 * (first_node + num_nodes));
+  size_t *node_tag{mesh_model.node_tags.data() + first_node};
+  double *node_coord{mesh_model.node_coords.data() + 3 * first_node};
+
+  for (size_t entity_block{1}; entity_block <= num_entity_blocks;
+       ++entity_block) {
+    this->read<int32_t>(position); // entity dimension
+    this->read<int32_t>(position); // entity tag
+    const size_t parametric_flag(this->read<int32_t>(position));
+    const size_t block_num_nodes{this->read_size(position)};
+    this->check_parametric_flag(parametric_flag, entity_block);
+    const size_t num_read_nodes(
+        node_tag - (mesh_model.node_tags.data() + first_node));
+    if (num_read_nodes + block_num_nodes > num_nodes) {
+      throw Mesh_error(
+          "More nodes in entity blocks than stated in $Nodes.",
+          this->mesh_name);
+    }
+
+    this->read_sizes(position, node_tag, block_num_nodes);
+    this->read_doubles(position, node_coord, 3 * block_num_nodes);
+    node_tag += block_num_nodes;
+    node_coord += 3 * block_num_nodes;
+  }
+  const size_t num_read_nodes(node_tag - mesh_model.node_tags.data());
+  mesh_model.node_tags.resize(num_read_nodes);
+  mesh_model.node_coords.resize(3 * num_read_nodes);
+
+  reader.set_position(position);
+}
+//-------------------------------------------------------------------------
+void Gmsh_binary_reader::read_elements(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  const char *position{reader.get_position()};
+
+  const size_t num_entity_blocks{this->read_size(position)};
+  const size_t num_elems{this->read_size(position)};
+  this->read_size(position); // minimal element tag
+  this->read_size(position); // maximal element tag
+
+  // An element takes at least its tag and a node tag
+  if (num_elems >
+      size_t(this->mesh_file.end() - position) / (2 * this->data_size)) {
+    throw Mesh_error(
+        "More elements stated in $Elements than contained in binary mesh.",
+        this->mesh_name);
+  }
+
+  const size_t first_elem{mesh_model.elem_tags.size()};
+  mesh_model.elem_blocks.reserve(num_entity_blocks);
+  mesh_model.elem_tags.reserve(num_elems);
+  mesh_model.elem_node_offsets.reserve(num_elems + 1);
+
+  for (size_t entity_block{0}; entity_block < num_entity_blocks;
+       ++entity_block) {
+    Element_block elem_block;
+    elem_block.entity_dim = this->read<int32_t>(position);
+    elem_block.entity_tag = this->read<int32_t>(position);
+    elem_block.elem_type = this->read<int32_t>(position);
+    elem_block.num_elems = this->read_size(position);
+    elem_block.first_elem = mesh_model.elem_tags.size();
+    if (elem_block.first_elem - first_elem + elem_block.num_elems >
+        num_elems) {
+      throw Mesh_error(
+          "More elements in entity blocks than stated in $Elements.",
+          this->mesh_name);
+    }
+    mesh_model.elem_blocks.push_back(elem_block);
+
+    if (!elem_type_to_num_nodes.contains(elem_block.elem_type)) {
+      throw Mesh_error(
+          "Unknown element type " + std::to_string(elem_block.elem_type) +
+              " in binary mesh.",
+          this->mesh_name);
+    }
+    const size_t num_elem_nodes{
+        elem_type_to_num_nodes[elem_block.elem_type]};
+
+    // Each element is given by its tag followed by its node tags. The
+    // whole block is copied behind the node tags read so far and then
+    // compacted in place by moving the element tags out.
+    const size_t first_node{mesh_model.elem_node_tags.size()};
+    mesh_model.elem_node_tags.resize(
+        first_node + elem_block.num_elems * (num_elem_nodes + 1));
+    size_t *block{mesh_model.elem_node_tags.data() + first_node};
+    this->read_sizes(
+        position, block, elem_block.num_elems * (num_elem_nodes + 1));
+
+    for (size_t elem{0}; elem < elem_block.num_elems; ++elem) {
+      const size_t *elem_data{block + elem * (num_elem_nodes + 1)};
+      mesh_model.elem_tags.push_back(elem_data[0]);
+      std::memmove(
+          block + elem * num_elem_nodes,
+          elem_data + 1,
+          num_elem_nodes * sizeof(size_t));
+      mesh_model.elem_node_offsets.push_back(
+          first_node + (elem + 1) * num_elem_nodes);
+    }
+    mesh_model.elem_node_tags.resize(
+        first_node + elem_block.num_elems * num_elem_nodes);
+  }
+
+  reader.set_position(position);
+}
+//-------------------------------------------------------------------------
+void Gmsh_binary_reader::skip_section(
+    Import::Token_reader &reader,
+    const std::string_view specifier) const {
+
+  const std::string end_specifier{
+      "\n$End" + std::string(specifier.substr(1))};
+  const std::string_view remainder{
+      reader.get_position(),
+      size_t(this->mesh_file.end() - reader.get_position())};
+
+  const size_t section_end{remainder.find(end_specifier)};
+  if (section_end == std::string_view::npos) {
+    reader.set_position(this->mesh_file.end());
+  } else {
+    reader.set_position(reader.get_position() + section_end + 1);
+  }
+}
+//-------------------------------------------------------------------------
+template <typename T>
+T Gmsh_binary_reader::read(const char *&position) const {
+
+  this->check_bounds(position, sizeof(T));
+  T value;
+  std::memcpy(&value, position, sizeof(T));
+  position += sizeof(T);
+
+  return this->swap_bytes ? get_swapped_bytes(value) : value;
+}
+//----
+size_t Gmsh_binary_reader::read_size(const char *&position) const {
+  if (this->data_size == sizeof(uint64_t)) {
+    return this->read<uint64_t>(position);
+  } else {
+    return this->read<uint32_t>(position);
+  }
+}
+//----
+void Gmsh_binary_reader::read_sizes(
+    const char *&position,
+    size_t *sizes,
+    const size_t num_sizes) const {
+
+  if (this->data_size == sizeof(size_t)) {
+    this->check_bounds(position, num_sizes, sizeof(size_t));
+    std::memcpy(sizes, position, num_sizes * sizeof(size_t));
+    position += num_sizes * sizeof(size_t);
+    if (this->swap_bytes) {
+      std::transform(sizes, sizes + num_sizes, sizes, [](size_t size) {
+        return get_swapped_bytes(size);
+      });
+    }
+  } else {
+    for (size_t n{0}; n < num_sizes; ++n) {
+      sizes[n] = this->read_size(position);
+    }
+  }
+}
+//----
+void Gmsh_binary_reader::read_doubles(
+    const char *&position,
+    double *doubles,
+    const size_t num_doubles) const {
+
+  this->check_bounds(position, num_doubles, sizeof(double));
+  std::memcpy(doubles, position, num_doubles * sizeof(double));
+  position += num_doubles * sizeof(double);
+  if (this->swap_bytes) {
+    std::transform(
+        doubles, doubles + num_doubles, doubles, [](double value) {
+          return get_swapped_bytes(value);
+        });
+  }
+}
+//----
+void Gmsh_binary_reader::check_bounds(
+    const char *position,
+    const size_t num_entries,
+    const size_t entry_size) const {
+
+  if (num_entries > size_t(this->mesh_file.end() - position) / entry_size) {
+    throw std::invalid_argument(
+        "Unexpected end of file while reading binary mesh data.");
+  }
+}
+} // namespace DG::Mesh
@@ -0,0 +1,68 @@
+#ifndef GMSH_BINARY_READER_H
+#define GMSH_BINARY_READER_H
+
+#include "gmsh_reader.h"
+
+namespace DG::Mesh {
+
+/**
+ * @brief Reader for binary Gmsh files of format 4.1 (file type 1 in
+ * '$MeshFormat'). Gmsh writes an integer 1 in binary right after the
+ * format line, from which I detect whether the byte order of the file
+ * differs from the one of this machine. The node coordinates and the
+ * element connectivity of each entity block are bulk-copied from the
+ * mapped file into the contiguous arrays of the mesh model.
+ */
+class Gmsh_binary_reader : public Gmsh_reader {
+public:
+  Gmsh_binary_reader(
+      const std::string &mesh_name,
+      const Import::Mapped_file &mesh_file);
+
+private:
+  /// @brief Size of the "size_t" entries in the file, i.e. 4 or 8 bytes
+  size_t data_size;
+  /// @brief Whether the byte order of the file needs to be reversed
+  bool swap_bytes;
+
+  void read_entities(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const override;
+
+  void read_nodes(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const override;
+
+  void read_elements(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const override;
+
+  /// @brief Jump to the end specifier of a section which is not imported
+  void skip_section(
+      Import::Token_reader &reader,
+      const std::string_view specifier) const override;
+
+  template <typename T> T read(const char *&position) const;
+
+  size_t read_size(const char *&position) const;
+
+  void read_sizes(
+      const char *&position,
+      size_t *sizes,
+      const size_t num_sizes) const;
+
+  void read_doubles(
+      const char *&position,
+      double *doubles,
+      const size_t num_doubles) const;
+
+  /**
+   * @brief Throw if fewer than num_entries of the given size are left
+   * behind the position. The counts are read from the file and are not
+   * multiplied, so that a corrupt count cannot overflow the check.
+   */
+  void check_bounds(
+      const char *position,
+      const size_t num_entries,
+      const size_t entry_size = 1) const;
+};
+} // namespace DG::Mesh
+
+#endif
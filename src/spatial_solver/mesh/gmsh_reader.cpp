@@ -0,0 +1,220 @@
+#include "gmsh_reader.h"
+#include "../../tools/custom_errors.h"
+
+#include <algorithm>
+
+namespace DG::Mesh {
+
+Gmsh_reader::Gmsh_reader(
+    const std::string &_mesh_name,
+    const Import::Mapped_file &_mesh_file)
+    : mesh_name{_mesh_name}, mesh_file{_mesh_file},
+      mesh_format{Gmsh_reader::read_mesh_format(_mesh_file)} {}
+//-------------------------------------------------------------------------
+Mesh_model Gmsh_reader::read_mesh_model() const {
+  Mesh_section_index section_index;
+  return this->read_mesh_model(section_index);
+}
+//----
+Mesh_model
+Gmsh_reader::read_mesh_model(Mesh_section_index &section_index) const {
+
+  if (this->mesh_file.size() == 0) {
+    throw Mesh_error("File seems to be empty.", this->mesh_name);
+  }
+
+  Import::Token_reader reader(this->mesh_file.begin(), this->mesh_file.end());
+
+  Mesh_model mesh_model;
+  try {
+    while (!reader.is_at_end()) {
+      const size_t line_number{reader.get_line_number()};
+      const std::string_view line{reader.next_line()};
+      if (!line.starts_with('$')) {
+        continue;
+      }
+
+      const std::string_view specifier{get_first_word(line)};
+      section_index.add_section(
+          std::string(specifier),
+          size_t(reader.get_position() - this->mesh_file.begin()),
+          line_number);
+      this->check_section_content(reader, specifier);
+
+      if (specifier == "$MeshFormat") {
+        this->read_format_version(reader);
+      } else if (specifier == "$PhysicalNames") {
+        this->read_physical_names(reader, mesh_model);
+      } else if (specifier == "$Entities") {
+        this->read_entities(reader, mesh_model);
+      } else if (specifier == "$Nodes") {
+        this->read_nodes(reader, mesh_model);
+      } else if (specifier == "$Elements") {
+        this->read_elements(reader, mesh_model);
+      } else if (!specifier.starts_with("$End")) {
+        this->skip_section(reader, specifier);
+      }
+    }
+  } catch (std::invalid_argument &ia) {
+    // An empty line is the more helpful diagnostic, since it most likely
+    // caused the failed conversion
+    this->check_empty_lines(reader);
+    throw Mesh_error(ia.what(), this->mesh_name);
+  }
+
+  this->check_empty_lines(reader);
+  this->check_unfound_specifiers(section_index);
+
+  if (mesh_model.node_tags.empty()) {
+    throw Mesh_error("No nodes found.", this->mesh_name);
+  }
+
+  mesh_model.build_lookup_tables();
+  return mesh_model;
+}
+//-------------------------------------------------------------------------
+Mesh_format
+Gmsh_reader::read_mesh_format(const Import::Mapped_file &mesh_file) {
+
+  const std::string_view file_content{mesh_file.view()};
+  const size_t section_begin{file_content.find("$MeshFormat")};
+  if (section_begin == std::string_view::npos) {
+    return {0., false, 0};
+  }
+
+  Import::Token_reader reader(file_content.substr(section_begin));
+  reader.skip_lines();
+
+  Mesh_format mesh_format{0., false, 0};
+  try {
+    mesh_format.version = reader.next<double>();
+    mesh_format.is_binary = (reader.next<size_t>() == 1);
+    mesh_format.data_size = reader.next<size_t>();
+  } catch (std::invalid_argument &) {
+    return {0., false, 0};
+  }
+  return mesh_format;
+}
+//-------------------------------------------------------------------------
+void Gmsh_reader::read_format_version(Import::Token_reader &reader) const {
+
+  const double mesh_version{reader.next<double>()};
+  reader.skip_lines();
+
+  if (mesh_version != 4.1) {
+    throw Mesh_error(
+        "Mesh format '" + std::to_string(mesh_version) +
+            "' is not supported. "
+            "Only meshes of format 4.1 produced by gmsh are currently "
+            "supported. "
+            "Try to export your gmsh mesh by using 'gmsh -format msh41'.",
+        this->mesh_name);
+  }
+}
+//-------------------------------------------------------------------------
+void Gmsh_reader::check_section_content(
+    const Import::Token_reader &reader,
+    const std::string_view specifier) const {
+
+  if (std::find(specifier_list.begin(), specifier_list.end(), specifier) ==
+      specifier_list.end()) {
+    return;
+  }
+
+  const std::string end_specifier{
+      "$End" + std::string(specifier.substr(1))};
+  Import::Token_reader next_line_reader(
+      reader.get_position(), this->mesh_file.end());
+  if (next_line_reader.next_line() == end_specifier) {
+    throw Mesh_error(
+        "Missing content between " + std::string(specifier) +
+            " specifiers.",
+        this->mesh_name);
+  }
+}
+//----
+void Gmsh_reader::check_unfound_specifiers(
+    const Mesh_section_index &section_index) const {
+
+  std::string unfound_specifiers;
+  for (const auto &specifier : specifier_list) {
+    if (!section_index.contains(specifier))
+      unfound_specifiers.append(specifier + '\n');
+  }
+  for (const auto &specifier : specifier_list) {
+    const std::string end_specifier{"$End" + specifier.substr(1)};
+    if (!section_index.contains(end_specifier))
+      unfound_specifiers.append(end_specifier + '\n');
+  }
+
+  if (!unfound_specifiers.empty()) {
+    throw Mesh_error(
+        "The following specifiers are missing in the mesh file:\n" +
+            unfound_specifiers,
+        this->mesh_name);
+  }
+}
+//----
+void Gmsh_reader::check_empty_lines(const Import::Token_reader &reader) const {
+
+  // Binary section data may contain line feeds anywhere
+  if (this->mesh_format.is_binary) {
+    return;
+  }
+
+  if (reader.get_first_empty_line() != 0) {
+    throw Mesh_error(
+        "Detected empty line in mesh file. (line " +
+            std::to_string(reader.get_first_empty_line()) + ")",
+        this->mesh_name);
+  }
+}
+//-------------------------------------------------------------------------
+void Gmsh_reader::read_physical_names(
+    Import::Token_reader &reader,
+    Mesh_model &mesh_model) const {
+
+  const size_t num_phys_groups{reader.next<size_t>()};
+  reader.skip_lines();
+
+  for (size_t phys_group{0}; phys_group < num_phys_groups; ++phys_group) {
+    const size_t phys_group_dim{reader.next<size_t>()};
+    if (phys_group_dim > 3) {
+      throw Mesh_error(
+          std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+              ": "
+              "Invalid dimension.",
+          this->mesh_name);
+    }
+    mesh_model.dimension = std::max(mesh_model.dimension, phys_group_dim);
+    mesh_model.phys_group_dims.push_back(phys_group_dim);
+    mesh_model.phys_group_tags.push_back(reader.next<size_t>());
+
+    const std::string_view name{reader.next_line()};
+    const size_t name_begin{name.find('"')};
+    const size_t name_end{name.rfind('"')};
+    mesh_model.phys_group_names.emplace_back(
+        name.substr(name_begin + 1, name_end - name_begin - 1));
+  }
+}
+//-------------------------------------------------------------------------
+void Gmsh_reader::check_parametric_flag(
+    const size_t parametric_flag,
+    const size_t entity_block) const {
+
+  if (parametric_flag == 1) {
+    throw Mesh_error(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+            ": Non-trivial parametric flag in $Nodes section entity "
+            "block #" +
+            std::to_string(entity_block) +
+            " detected. Mesh parametrization is currently not "
+            "supported in miniDGTD. Regenerate mesh.",
+        this->mesh_name);
+  }
+}
+//-------------------------------------------------------------------------
+std::string_view Gmsh_reader::get_first_word(const std::string_view line) {
+  return line.substr(0, line.find_first_of(" \t\r"));
+}
+} // namespace DG::Mesh
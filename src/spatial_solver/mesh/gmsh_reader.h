@@ -0,0 +1,115 @@
+#ifndef GMSH_READER_H
+#define GMSH_READER_H
+
+#include "../../tools/mapped_file.h"
+#include "../../tools/token_reader.h"
+#include "mesh_model.h"
+#include "mesh_section_index.h"
+
+#include <string>
+#include <string_view>
+
+namespace DG::Mesh {
+
+/// @brief Content of the '$MeshFormat' section
+struct Mesh_format {
+  double version;
+  bool is_binary;
+  size_t data_size;
+};
+
+/**
+ * @brief Base class of the readers for Gmsh files of format 4.1, which
+ * import the sections '$PhysicalNames', '$Entities', '$Nodes', and
+ * '$Elements' into a Mesh_model in a single pass over the memory mapped
+ * mesh file. The section headers and '$PhysicalNames' are always written
+ * as text by Gmsh, whereas the content of the remaining sections depends
+ * on the file type and is read by the derived classes.<br>
+ * The mesh file is validated within the same pass, i.e. I check for empty
+ * lines, missing section specifiers and content, and the mesh format
+ * version while importing. The errors are the same as the ones formerly
+ * raised by separate passes of Check_mesh.
+ */
+class Gmsh_reader {
+public:
+  Gmsh_reader(
+      const std::string &mesh_name,
+      const Import::Mapped_file &mesh_file);
+
+  Mesh_model read_mesh_model() const;
+
+  /**
+   * @brief Read the mesh model and record the location of all section
+   * specifiers found on the way
+   *
+   * @param[out] section_index Index of the specifier lines in the file
+   */
+  Mesh_model read_mesh_model(Mesh_section_index &section_index) const;
+
+  /**
+   * @brief Parse the '$MeshFormat' section of a mapped mesh file. A
+   * missing or invalid section yields a version of zero and is reported
+   * by read_mesh_model().
+   */
+  static Mesh_format
+  read_mesh_format(const Import::Mapped_file &mesh_file);
+
+protected:
+  const std::string mesh_name;
+  const Import::Mapped_file &mesh_file;
+  const Mesh_format mesh_format;
+
+  virtual void
+  read_entities(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const = 0;
+
+  virtual void
+  read_nodes(Import::Token_reader &reader, Mesh_model &mesh_model) const = 0;
+
+  virtual void
+  read_elements(Import::Token_reader &reader, Mesh_model &mesh_model)
+      const = 0;
+
+  /**
+   * @brief Skip the content of a section which is not imported. In text
+   * mode nothing needs to be done, since the content is skipped line by
+   * line while looking for the next section.
+   */
+  virtual void skip_section(
+      Import::Token_reader & /*reader*/,
+      const std::string_view /*specifier*/) const {};
+
+  /// @brief Throw a Mesh_error for a non-trivial parametric flag
+  void check_parametric_flag(
+      const size_t parametric_flag,
+      const size_t entity_block) const;
+
+private:
+  /// @brief Read and check the version in '$MeshFormat'
+  void read_format_version(Import::Token_reader &reader) const;
+
+  /**
+   * @brief Throw a Mesh_error if a begin specifier is directly followed by
+   * its end specifier
+   */
+  void check_section_content(
+      const Import::Token_reader &reader,
+      const std::string_view specifier) const;
+
+  /// @brief Throw a Mesh_error listing the missing section specifiers
+  void check_unfound_specifiers(
+      const Mesh_section_index &section_index) const;
+
+  /// @brief Throw a Mesh_error for an empty line in a text mesh file
+  void check_empty_lines(const Import::Token_reader &reader) const;
+
+  void read_physical_names(
+      Import::Token_reader &reader,
+      Mesh_model &mesh_model) const;
+
+  /// @brief The first word of a line, e.g. a section specifier
+  static std::string_view get_first_word(const std::string_view line);
+};
+} // namespace DG::Mesh
+
+#endif
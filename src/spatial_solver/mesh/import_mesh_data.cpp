@@ -1,6 +1,8 @@
 #include "import_mesh_data.h"
 #include "../../tools/custom_errors.h"
 #include "../../tools/import.h"
+#include "gmsh_ascii_reader.h"
+#include "gmsh_binary_reader.h"
 #include "mesh.h"
 
 #include <boost/lexical_cast.hpp>
@@ -11,7 +13,21 @@
 namespace DG::Mesh {
 
 Import_mesh_data::Import_mesh_data(const std::string &filename)
-    : mesh_name(filename), dimension(this->get_dimension()) {}
+    : mesh_name(filename), section_index(filename),
+      dimension(this->get_dimension()) {}
+//----
+Import_mesh_data::Import_mesh_data(
+    const std::string &filename,
+    const Mesh_section_index &_section_index)
+    : mesh_name(filename), section_index(_section_index),
+      dimension(this->get_dimension()) {}
+//----
+Import_mesh_data::Import_mesh_data(
+    const std::string &filename,
+    const Mesh_model &mesh_model,
+    const Mesh_section_index &_section_index)
+    : mesh_name(filename), section_index(_section_index),
+      dimension(mesh_model.dimension) {}
 //-----------------------------------------------------------------------
 size_t Import_mesh_data::get_dimension() const {
 
@@ -327,45 +343,32 @@ Import_mesh_data::import_gmsh_elements(
   return element_info;
 }
 //-----------------------------------------------------------------------
-std::vector<Import_mesh_data::mesh_section_info>
-Import_mesh_data::get_mesh_section_info() const {
-
-  std::vector<mesh_section_info> mesh_section_info;
-
-  std::fstream mesh_file{this->mesh_name.c_str()};
-  std::string line;
-
-  for (size_t line_number{1}; std::getline(mesh_file, line);
-      ++line_number) {
+Mesh_model Import_mesh_data::import_mesh_model() const {
+  Mesh_section_index section_index;
+  return Import_mesh_data::import_mesh_model(this->mesh_name, section_index);
+}
+//----
+Mesh_model Import_mesh_data::import_mesh_model(
+    const std::string &mesh_name,
+    Mesh_section_index &section_index,
+    const size_t num_threads) {
 
-    const std::string first_word{Import::get_entry<std::string>(line)};
+  const Import::Mapped_file mesh_file(mesh_name);
 
-    for (const auto &specifier : Mesh::specifier_list) {
-      if (first_word == specifier) {
-        mesh_section_info.push_back(
-            {specifier, mesh_file.tellg(), line_number});
-      }
-    }
+  if (Gmsh_reader::read_mesh_format(mesh_file).is_binary) {
+    return Gmsh_binary_reader(mesh_name, mesh_file)
+        .read_mesh_model(section_index);
   }
-
-  return mesh_section_info;
+  return Gmsh_ascii_reader(mesh_name, mesh_file, num_threads)
+      .read_mesh_model(section_index);
 }
 //-----------------------------------------------------------------------
 void Import_mesh_data::goto_mesh_section(
     const std::string &specifier,
     std::ifstream &mesh_file) const {
 
-  std::vector<mesh_section_info> section_info{
-      this->get_mesh_section_info()};
-  std::string cur_specifier;
-  size_t cur_mesh_pos;
-
-  for (const auto &list_entry : section_info) {
-    std::tie(cur_specifier, cur_mesh_pos, std::ignore) = list_entry;
-    if (cur_specifier == specifier) {
-      mesh_file.seekg(cur_mesh_pos);
-      break;
-    }
+  if (this->section_index.contains(specifier)) {
+    mesh_file.seekg(this->section_index.get_section(specifier).position);
   }
 }
 //-----------------------------------------
@@ -374,19 +377,11 @@ void Import_mesh_data::goto_mesh_section(
     std::ifstream &mesh_file,
     size_t &line_number) const {
 
-  std::vector<mesh_section_info> section_info{
-      this->get_mesh_section_info()};
-  std::string cur_specifier;
-  size_t cur_mesh_pos;
-  size_t cur_line_num;
-
-  for (const auto &list_entry : section_info) {
-    std::tie(cur_specifier, cur_mesh_pos, cur_line_num) = list_entry;
-    if (cur_specifier == specifier) {
-      mesh_file.seekg(cur_mesh_pos);
-      line_number = cur_line_num;
-      break;
-    }
+  if (this->section_index.contains(specifier)) {
+    const Section_location &section{
+        this->section_index.get_section(specifier)};
+    mesh_file.seekg(section.position);
+    line_number = section.line_number;
   }
 }
 
@@ -2,10 +2,11 @@
 #define IMPORT_MESH_DATA_H
 
 #include "mesh.h"
+#include "mesh_model.h"
+#include "mesh_section_index.h"
 
 #include <armadillo>
 #include <fstream>
-#include <tuple>
 #include <vector>
 
 namespace DG::Mesh {
@@ -13,13 +14,24 @@ namespace DG::Mesh {
  * @brief Class to import the mesh data from Gmsh files. The Gmsh sections
  * of interest, i.e. Meshformat, PhysicalNames, Entities, Nodes, and
  * Elements, are imported as maps as this is the data format, which
- * resembles the Gmsh file structure the closest.
+ * resembles the Gmsh file structure the closest. Note that the
+ * import_gmsh_... methods only support ASCII mesh files, whereas
+ * import_mesh_model() reads ASCII and binary mesh files alike.
  */
 class Import_mesh_data {
 
 public:
   Import_mesh_data(const std::string &filename);
 
+  /**
+   * @brief Construct from an already built section index of the mesh
+   * file, e.g. the one of Check_mesh, such that the file is not scanned
+   * for its sections again.
+   */
+  Import_mesh_data(
+      const std::string &filename,
+      const Mesh_section_index &section_index);
+
   /**
    * @brief Extract the overall dimension of the mesh from the section
    * '$PhysicalNames' in the mesh file. The highest dimension found under
@@ -84,26 +96,35 @@ public:
   std::map<size_t, std::vector<size_t>>
   import_gmsh_elements(const size_t entity_type, const size_t entity_tag);
 
-private:
   /**
-   * @brief Mesh section information is given by: the mesh specifier name
-   * from the specifier_list in mesh.h the position in the mesh, where the
-   * specifier is found the line number in the mesh, where the specifier is
-   * found
+   * @brief Import the sections '$PhysicalNames', '$Entities', '$Nodes',
+   * and '$Elements' in a single pass over the mesh file. Contrary to the
+   * import_gmsh_... methods, which read a section each time they are
+   * called, the returned mesh model holds all data in memory. The file is
+   * memory mapped once and read by the Gmsh_ascii_reader or the
+   * Gmsh_binary_reader depending on the file type in '$MeshFormat'.
    */
-  typedef std::tuple<std::string, size_t, size_t> mesh_section_info;
+  Mesh_model import_mesh_model() const;
+
+  inline const Mesh_section_index &get_section_index() const {
+    return this->section_index;
+  };
 
   /**
-   * @brief Extract the mesh section information from the mesh. The
-   * sections are given according to the specifier_list in mesh.h. More
-   * specifically, the sections are specified by "$MeshFormat",
-   * "$PhysicalNames", "$Entities", "$Nodes", and "$Elements"
+   * @brief Import the mesh model of a mesh file, which is validated within
+   * the same pass (see Gmsh_reader)
    *
-   * @return Mesh specifier name, position of this specifier in the mesh,
-   * line number for each mesh section
+   * @param[in] mesh_name Name of the mesh file
+   * @param[out] section_index Index of the specifier lines in the file
+   * @param[in] num_threads Number of threads to parse ASCII mesh files
+   * with, where zero means all hardware threads
    */
-  std::vector<mesh_section_info> get_mesh_section_info() const;
+  static Mesh_model import_mesh_model(
+      const std::string &mesh_name,
+      Mesh_section_index &section_index,
+      const size_t num_threads = 1);
 
+private:
   /**
    * @brief Go to a specific section in the mesh, given by one of the
    * specfiers "$MeshFormat", "$PhysicalNames", "$Entities", "$Nodes", or
@@ -133,8 +154,19 @@ private:
 
   const std::string mesh_name;
   const std::string mesh_error;
+  const Mesh_section_index section_index;
 
 protected:
+  /**
+   * @brief Construct from an already imported mesh model, e.g. in derived
+   * classes which import the mesh model before anything else. The mesh
+   * file is not accessed.
+   */
+  Import_mesh_data(
+      const std::string &filename,
+      const Mesh_model &mesh_model,
+      const Mesh_section_index &section_index);
+
   const size_t dimension;
 };
 } // namespace DG::Mesh
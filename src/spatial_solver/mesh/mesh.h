@@ -94,6 +94,20 @@ static std::map<size_t, size_t> dimension_to_finite_elem_type{
     {2, Element.triangle_3nodes},
     {3, Element.tetrahedron_4nodes}};
 
+/**
+ * @brief Number of nodes of the Gmsh element types (see
+ * https://gmsh.info/doc/texinfo/gmsh.html#MSH-file-format). The number is
+ * not part of the element data in the mesh file, but it is needed to read
+ * element blocks which are not separated into lines, i.e. in binary mode.
+ */
+static std::map<size_t, size_t> elem_type_to_num_nodes{
+    {1, 2},   {2, 3},   {3, 4},   {4, 4},   {5, 8},   {6, 6},
+    {7, 5},   {8, 3},   {9, 6},   {10, 9},  {11, 10}, {12, 27},
+    {13, 18}, {14, 14}, {15, 1},  {16, 8},  {17, 20}, {18, 15},
+    {19, 13}, {20, 9},  {21, 10}, {22, 12}, {23, 15}, {24, 15},
+    {25, 21}, {26, 4},  {27, 5},  {28, 6},  {29, 20}, {30, 35},
+    {31, 56}};
+
 } // namespace DG::Mesh
 
 #endif
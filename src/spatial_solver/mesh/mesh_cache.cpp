@@ -0,0 +1,275 @@
+#include "mesh_cache.h"
+#include "../../tools/custom_errors.h"
+#include "../../tools/mapped_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+#include <unistd.h>
+
+namespace DG::Mesh {
+
+namespace {
+constexpr char cache_magic[8]{'D', 'G', 'T', 'D', 'M', 'E', 'S', 'H'};
+constexpr size_t header_size{4 * sizeof(uint64_t)};
+
+/// @brief Sequential writer of the 8 byte aligned cache entries
+class Cache_writer {
+public:
+  Cache_writer(const std::string &filename)
+      : file(filename, std::ios::binary | std::ios::trunc) {}
+
+  inline bool good() const { return this->file.good(); };
+
+  void write_value(const uint64_t value) {
+    this->file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+
+  template <typename T> void write_array(const std::vector<T> &array) {
+    static_assert(std::is_trivially_copyable_v<T> && sizeof(T) % 8 == 0);
+    this->write_value(array.size());
+    this->file.write(
+        reinterpret_cast<const char *>(array.data()),
+        std::streamsize(array.size() * sizeof(T)));
+  };
+
+  void write_string(const std::string &text) {
+    this->write_value(text.size());
+    this->file.write(text.data(), std::streamsize(text.size()));
+    const char padding[8]{};
+    this->file.write(padding, std::streamsize((8 - text.size() % 8) % 8));
+  };
+
+  void write_raw(const char *data, const size_t size) {
+    this->file.write(data, std::streamsize(size));
+  };
+
+private:
+  std::ofstream file;
+};
+
+/// @brief Sequential reader of the cache entries from the mapped file
+class Cache_reader {
+public:
+  Cache_reader(const char *_position, const char *_end)
+      : position{_position}, end{_end} {}
+
+  uint64_t read_value() {
+    uint64_t value;
+    this->read_raw(reinterpret_cast<char *>(&value), sizeof(value));
+    return value;
+  };
+
+  template <typename T> std::vector<T> read_array() {
+    const uint64_t size{this->read_value()};
+    this->check_bounds(size, sizeof(T));
+    std::vector<T> array(size);
+    this->read_raw(reinterpret_cast<char *>(array.data()), size * sizeof(T));
+    return array;
+  };
+
+  std::string read_string() {
+    const uint64_t size{this->read_value()};
+    this->check_bounds(size, 1);
+    std::string text(this->position, size);
+    this->position += size;
+    this->position += std::min<size_t>(
+        (8 - size % 8) % 8, size_t(this->end - this->position));
+    return text;
+  };
+
+  void read_raw(char *data, const size_t size) {
+    this->check_bounds(size, 1);
+    if (size == 0) {
+      return;
+    }
+    std::memcpy(data, this->position, size);
+    this->position += size;
+  };
+
+private:
+  const char *position;
+  const char *const end;
+
+  void check_bounds(const uint64_t count, const size_t entry_size) const {
+    if (count > size_t(this->end - this->position) / entry_size) {
+      throw std::invalid_argument("Unexpected end of mesh cache.");
+    }
+  };
+};
+
+/// @brief Finaliser of splitmix64, i.e. a bijective avalanche of a word
+inline uint64_t get_mixed_word(uint64_t word) {
+  word = (word ^ (word >> 30)) * 0xbf58476d1ce4e5b9ull;
+  word = (word ^ (word >> 27)) * 0x94d049bb133111ebull;
+  return word ^ (word >> 31);
+}
+} // namespace
+//-------------------------------------------------------------------------
+Mesh_cache::Mesh_cache(const std::string &_mesh_name)
+    : mesh_name{_mesh_name}, cache_name{_mesh_name + ".dgtd_cache"} {
+
+  const Import::Mapped_file mesh_file(this->mesh_name);
+  this->mesh_size = mesh_file.size();
+  this->content_hash = Mesh_cache::get_content_hash(mesh_file.view());
+}
+//-------------------------------------------------------------------------
+bool Mesh_cache::is_valid() const {
+
+  std::ifstream cache_file(this->cache_name, std::ios::binary);
+  char header[header_size];
+  if (!cache_file.read(header, header_size)) {
+    return false;
+  }
+
+  Cache_reader reader(header + sizeof(cache_magic), header + header_size);
+  return std::memcmp(header, cache_magic, sizeof(cache_magic)) == 0 &&
+         reader.read_value() == Mesh_cache::format_version &&
+         reader.read_value() == this->content_hash &&
+         reader.read_value() == this->mesh_size;
+}
+//-------------------------------------------------------------------------
+Mesh_cache_content Mesh_cache::load() const {
+
+  const Import::Mapped_file cache_file(this->cache_name);
+  Cache_reader reader(cache_file.begin(), cache_file.end());
+
+  Mesh_cache_content content;
+  try {
+    char magic[sizeof(cache_magic)];
+    reader.read_raw(magic, sizeof(magic));
+    if (std::memcmp(magic, cache_magic, sizeof(cache_magic)) != 0 ||
+        reader.read_value() != Mesh_cache::format_version ||
+        reader.read_value() != this->content_hash ||
+        reader.read_value() != this->mesh_size) {
+      throw std::invalid_argument(
+          "Mesh cache does not belong to the mesh file.");
+    }
+
+    Mesh_model &mesh_model(content.mesh_model);
+    mesh_model.dimension = reader.read_value();
+    mesh_model.phys_group_dims = reader.read_array<size_t>();
+    mesh_model.phys_group_tags = reader.read_array<size_t>();
+    mesh_model.phys_group_names.resize(reader.read_value());
+    for (auto &name : mesh_model.phys_group_names) {
+      name = reader.read_string();
+    }
+    for (auto &entity_table : mesh_model.entities) {
+      entity_table.tags = reader.read_array<size_t>();
+      entity_table.phys_tag_offsets = reader.read_array<size_t>();
+      entity_table.phys_tags = reader.read_array<size_t>();
+    }
+    mesh_model.node_tags = reader.read_array<size_t>();
+    mesh_model.node_coords = reader.read_array<double>();
+    mesh_model.elem_blocks = reader.read_array<Element_block>();
+    mesh_model.elem_tags = reader.read_array<size_t>();
+    mesh_model.elem_node_offsets = reader.read_array<size_t>();
+    mesh_model.elem_node_tags = reader.read_array<size_t>();
+    mesh_model.build_lookup_tables();
+
+    const size_t num_sections{reader.read_value()};
+    for (size_t section{0}; section < num_sections; ++section) {
+      const std::string specifier{reader.read_string()};
+      const size_t position{reader.read_value()};
+      content.section_index.add_section(
+          specifier, position, reader.read_value());
+    }
+
+    Ordered_mesh &ordered_mesh(content.ordered_mesh);
+    ordered_mesh.region_tags = reader.read_array<size_t>();
+    ordered_mesh.region_offsets = reader.read_array<size_t>();
+    ordered_mesh.elem_tags = reader.read_array<size_t>();
+    ordered_mesh.elem_coords = reader.read_array<double>();
+    ordered_mesh.geo_factors = reader.read_array<double>();
+    ordered_mesh.left_neighbours = reader.read_array<size_t>();
+    ordered_mesh.right_neighbours = reader.read_array<size_t>();
+  } catch (std::invalid_argument &ia) {
+    throw Mesh_error(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) + ": " +
+            ia.what() + " Delete '" + this->cache_name + "'.",
+        this->mesh_name);
+  }
+
+  return content;
+}
+//-------------------------------------------------------------------------
+void Mesh_cache::store(
+    const Mesh_model &mesh_model,
+    const Mesh_section_index &section_index,
+    const Ordered_mesh &ordered_mesh) const {
+
+  const std::string temp_name{
+      this->cache_name + "." + std::to_string(::getpid())};
+  {
+    Cache_writer writer(temp_name);
+    writer.write_raw(cache_magic, sizeof(cache_magic));
+    writer.write_value(Mesh_cache::format_version);
+    writer.write_value(this->content_hash);
+    writer.write_value(this->mesh_size);
+
+    writer.write_value(mesh_model.dimension);
+    writer.write_array(mesh_model.phys_group_dims);
+    writer.write_array(mesh_model.phys_group_tags);
+    writer.write_value(mesh_model.phys_group_names.size());
+    for (const auto &name : mesh_model.phys_group_names) {
+      writer.write_string(name);
+    }
+    for (const auto &entity_table : mesh_model.entities) {
+      writer.write_array(entity_table.tags);
+      writer.write_array(entity_table.phys_tag_offsets);
+      writer.write_array(entity_table.phys_tags);
+    }
+    writer.write_array(mesh_model.node_tags);
+    writer.write_array(mesh_model.node_coords);
+    writer.write_array(mesh_model.elem_blocks);
+    writer.write_array(mesh_model.elem_tags);
+    writer.write_array(mesh_model.elem_node_offsets);
+    writer.write_array(mesh_model.elem_node_tags);
+
+    writer.write_value(section_index.get_sections().size());
+    for (const auto &section : section_index.get_sections()) {
+      writer.write_string(section.specifier);
+      writer.write_value(section.position);
+      writer.write_value(section.line_number);
+    }
+
+    writer.write_array(ordered_mesh.region_tags);
+    writer.write_array(ordered_mesh.region_offsets);
+    writer.write_array(ordered_mesh.elem_tags);
+    writer.write_array(ordered_mesh.elem_coords);
+    writer.write_array(ordered_mesh.geo_factors);
+    writer.write_array(ordered_mesh.left_neighbours);
+    writer.write_array(ordered_mesh.right_neighbours);
+
+    if (!writer.good()) {
+      std::filesystem::remove(temp_name);
+      throw std::ofstream::failure(
+          "Error writing mesh cache '" + this->cache_name + "'.");
+    }
+  }
+  std::filesystem::rename(temp_name, this->cache_name);
+}
+//-------------------------------------------------------------------------
+uint64_t Mesh_cache::get_content_hash(const std::string_view content) {
+
+  const uint64_t fnv_offset_basis{14695981039346656037ull};
+  const uint64_t fnv_prime{1099511628211ull};
+
+  uint64_t hash{fnv_offset_basis};
+  const size_t num_words{content.size() / sizeof(uint64_t)};
+  for (size_t word_idx{0}; word_idx < num_words; ++word_idx) {
+    uint64_t word;
+    std::memcpy(
+        &word, content.data() + word_idx * sizeof(uint64_t), sizeof(word));
+    hash = (hash ^ get_mixed_word(word)) * fnv_prime;
+  }
+  for (size_t byte{num_words * sizeof(uint64_t)}; byte < content.size();
+       ++byte) {
+    hash = (hash ^ uint8_t(content[byte])) * fnv_prime;
+  }
+
+  return hash;
+}
+} // namespace DG::Mesh
@@ -0,0 +1,81 @@
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+#include "mesh_model.h"
+#include "mesh_section_index.h"
+#include "ordered_mesh.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace DG::Mesh {
+
+/// @brief Everything needed to set up Process_mesh_data without parsing
+struct Mesh_cache_content {
+  Mesh_model mesh_model;
+  Mesh_section_index section_index;
+  Ordered_mesh ordered_mesh;
+};
+
+/**
+ * @brief On-disk cache of a preprocessed mesh file, which is stored next to
+ * the mesh file with the extension '.dgtd_cache'. Parameter sweeps run
+ * the same mesh over and over again, hence I store the imported mesh model
+ * and the ordered elements once and load them in later runs without any
+ * parsing or sorting.<br>
+ * The cache is keyed by the size and a hash of the mesh file content and
+ * by the format version of the cache, so that a modified mesh file or a
+ * changed cache layout invalidates it. All arrays are stored as 8 byte entries behind a
+ * count, such that the cache file can be memory mapped and copied into the
+ * arrays directly.
+ */
+class Mesh_cache {
+public:
+  Mesh_cache(const std::string &mesh_name);
+
+  /// @brief Increase on any change of the cache layout
+  static constexpr uint64_t format_version{3};
+
+  /**
+   * @brief Check whether a cache file exists which belongs to the current
+   * content of the mesh file and to the current cache format
+   */
+  bool is_valid() const;
+
+  Mesh_cache_content load() const;
+
+  /**
+   * @brief Write the cache file. The file is written under a temporary
+   * name first and renamed afterwards, so that concurrent runs on the same
+   * mesh never read an incomplete cache.
+   */
+  void store(
+      const Mesh_model &mesh_model,
+      const Mesh_section_index &section_index,
+      const Ordered_mesh &ordered_mesh) const;
+
+  inline const std::string &get_cache_name() const {
+    return this->cache_name;
+  };
+
+  /**
+   * @brief FNV-1a hash of a character range, which is applied to 64 bit
+   * words instead of single bytes to keep up with the speed of reading
+   * the file. Since the multiplication only carries the bits of a word
+   * upwards, each word is mixed by the finaliser of splitmix64 first, i.e.
+   * any changed bit of the word changes about half of the bits of the
+   * mixed word.
+   */
+  static uint64_t get_content_hash(const std::string_view content);
+
+private:
+  const std::string mesh_name;
+  const std::string cache_name;
+  uint64_t mesh_size;
+  uint64_t content_hash;
+};
+} // namespace DG::Mesh
+
+#endif
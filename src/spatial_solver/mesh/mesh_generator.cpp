@@ -0,0 +1,207 @@
+#include "mesh_generator.h"
+#include "../../tools/custom_errors.h"
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cmath>
+
+namespace DG::Mesh {
+
+namespace pt = boost::property_tree;
+
+Mesh_generator::Mesh_generator(const std::string &_spec_name)
+    : spec_name{_spec_name} {
+
+  pt::ptree root;
+  try {
+    pt::read_json(this->spec_name, root);
+
+    this->contour_name =
+        root.get<std::string>("contour_name", "outer_bc");
+    for (auto &&region_tree : root.get_child("regions")) {
+      const pt::ptree &region_params = region_tree.second;
+
+      Region_spec region;
+      region.name = region_params.get<std::string>("name");
+      region.left_bound = region_params.get<double>("left_bound");
+      region.right_bound = region_params.get<double>("right_bound");
+      region.num_elems = region_params.get<size_t>("num_elems");
+      region.grading = region_params.get<double>("grading", 1.);
+      this->region_specs.push_back(region);
+    }
+  } catch (pt::ptree_error &error) {
+    throw Mesh_error(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+            ": "
+            "Invalid mesh specification. " +
+            error.what(),
+        this->spec_name);
+  }
+
+  this->check_region_specs();
+}
+//----
+Mesh_generator::Mesh_generator(
+    const std::vector<Region_spec> &_region_specs,
+    const std::string &_contour_name)
+    : spec_name{"generated mesh"}, region_specs{_region_specs},
+      contour_name{_contour_name} {
+
+  this->check_region_specs();
+}
+//-------------------------------------------------------------------------
+void Mesh_generator::check_region_specs() const {
+
+  auto throw_error = [this](const std::string &message, const size_t line) {
+    throw Mesh_error(
+        std::string{} + __FILE__ + ":" + std::to_string(line) + ": " +
+            message,
+        this->spec_name);
+  };
+
+  if (this->region_specs.empty()) {
+    throw_error("No regions specified.", __LINE__);
+  }
+
+  for (size_t r{0}; r < this->region_specs.size(); ++r) {
+    const Region_spec &region(this->region_specs[r]);
+    if (region.num_elems == 0) {
+      throw_error(
+          "Region '" + region.name + "' needs at least one element.",
+          __LINE__);
+    }
+    if (!(region.left_bound < region.right_bound)) {
+      throw_error(
+          "Left bound of region '" + region.name +
+              "' needs to be smaller than its right bound.",
+          __LINE__);
+    }
+    if (!(region.grading > 0.)) {
+      throw_error(
+          "Grading of region '" + region.name + "' needs to be positive.",
+          __LINE__);
+    }
+    if (r > 0 && region.left_bound != this->region_specs[r - 1].right_bound) {
+      throw_error(
+          "Region '" + region.name +
+              "' does not start at the right bound of the previous region.",
+          __LINE__);
+    }
+  }
+}
+//-------------------------------------------------------------------------
+Mesh_model Mesh_generator::generate_mesh_model() const {
+
+  const size_t num_regions{this->region_specs.size()};
+  const size_t contour_tag{1};
+
+  Mesh_model mesh_model;
+  mesh_model.dimension = 1;
+
+  // $PhysicalNames
+  mesh_model.phys_group_dims.push_back(0);
+  mesh_model.phys_group_tags.push_back(contour_tag);
+  mesh_model.phys_group_names.push_back(this->contour_name);
+  for (size_t r{0}; r < num_regions; ++r) {
+    mesh_model.phys_group_dims.push_back(1);
+    mesh_model.phys_group_tags.push_back(contour_tag + 1 + r);
+    mesh_model.phys_group_names.push_back(this->region_specs[r].name);
+  }
+
+  // $Entities, where the points are the region bounds from left to right
+  // and only the outer points belong to the contour
+  Entity_table &points(mesh_model.entities[Entity.point]);
+  for (size_t p{0}; p <= num_regions; ++p) {
+    points.tags.push_back(p + 1);
+    if (p == 0 || p == num_regions) {
+      points.phys_tags.push_back(contour_tag);
+    }
+    points.phys_tag_offsets.push_back(points.phys_tags.size());
+  }
+  Entity_table &curves(mesh_model.entities[Entity.curve]);
+  for (size_t r{0}; r < num_regions; ++r) {
+    curves.tags.push_back(r + 1);
+    curves.phys_tags.push_back(contour_tag + 1 + r);
+    curves.phys_tag_offsets.push_back(curves.phys_tags.size());
+  }
+
+  // $Nodes, where neighbouring regions share their bound node
+  size_t num_nodes{1};
+  for (const auto &region : this->region_specs) {
+    num_nodes += region.num_elems;
+  }
+  mesh_model.node_tags.reserve(num_nodes);
+  mesh_model.node_coords.reserve(3 * num_nodes);
+  for (size_t r{0}; r < num_regions; ++r) {
+    const std::vector<double> coords{
+        Mesh_generator::get_node_coords(this->region_specs[r])};
+    for (size_t n{r == 0 ? 0u : 1u}; n < coords.size(); ++n) {
+      mesh_model.node_tags.push_back(mesh_model.node_tags.size() + 1);
+      mesh_model.node_coords.insert(
+          mesh_model.node_coords.end(), {coords[n], 0., 0.});
+    }
+  }
+
+  // $Elements, the point elements of the contour first
+  auto add_elem = [&mesh_model](const size_t left_node, const size_t num) {
+    mesh_model.elem_tags.push_back(mesh_model.elem_tags.size() + 1);
+    for (size_t node{left_node}; node < left_node + num; ++node) {
+      mesh_model.elem_node_tags.push_back(node);
+    }
+    mesh_model.elem_node_offsets.push_back(
+        mesh_model.elem_node_tags.size());
+  };
+
+  for (const size_t p : {size_t(0), num_regions}) {
+    mesh_model.elem_blocks.push_back(
+        {0, p + 1, Element.point, mesh_model.elem_tags.size(), 1});
+    add_elem(p == 0 ? 1 : num_nodes, 1);
+  }
+
+  mesh_model.elem_tags.reserve(mesh_model.elem_tags.size() + num_nodes - 1);
+  mesh_model.elem_node_offsets.reserve(
+      mesh_model.elem_node_offsets.size() + num_nodes - 1);
+  mesh_model.elem_node_tags.reserve(
+      mesh_model.elem_node_tags.size() + 2 * (num_nodes - 1));
+  size_t left_node{1};
+  for (size_t r{0}; r < num_regions; ++r) {
+    const size_t num_elems{this->region_specs[r].num_elems};
+    mesh_model.elem_blocks.push_back(
+        {1,
+         r + 1,
+         Element.line_2nodes,
+         mesh_model.elem_tags.size(),
+         num_elems});
+    for (size_t elem{0}; elem < num_elems; ++elem, ++left_node) {
+      add_elem(left_node, 2);
+    }
+  }
+
+  mesh_model.build_lookup_tables();
+  return mesh_model;
+}
+//-------------------------------------------------------------------------
+std::vector<double>
+Mesh_generator::get_node_coords(const Region_spec &region) {
+
+  const double length{region.right_bound - region.left_bound};
+  const double num_elems(region.num_elems);
+
+  std::vector<double> coords(region.num_elems + 1);
+  for (size_t n{0}; n < region.num_elems; ++n) {
+    if (region.grading == 1.) {
+      coords[n] = region.left_bound + length * double(n) / num_elems;
+    } else {
+      // Sum of the first n sizes of the geometric sequence divided by the
+      // sum of all sizes
+      const double log_grading{std::log(region.grading)};
+      coords[n] = region.left_bound +
+                  length * std::expm1(double(n) * log_grading) /
+                      std::expm1(num_elems * log_grading);
+    }
+  }
+  coords.back() = region.right_bound;
+
+  return coords;
+}
+} // namespace DG::Mesh
@@ -0,0 +1,75 @@
+#ifndef MESH_GENERATOR_H
+#define MESH_GENERATOR_H
+
+#include "mesh_model.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace DG::Mesh {
+
+/// @brief Specification of a single region of a generated 1D mesh
+struct Region_spec {
+  std::string name;
+  double left_bound;
+  double right_bound;
+  size_t num_elems;
+  /// @brief Ratio of the sizes of neighbouring elements (right to left)
+  double grading{1.};
+};
+
+/**
+ * @brief Generator of 1D meshes from a JSON specification, which builds the
+ * Mesh_model directly in memory. Scaling runs with millions of elements
+ * then neither need a Gmsh file on disk nor its import. The specification
+ * lists the regions from left to right, where each region starts at the
+ * right bound of its predecessor, e.g.
+ *
+ *     {
+ *       "contour_name": "outer_bc",
+ *       "regions": [
+ *         {"name": "left_pml", "left_bound": 0, "right_bound": 1,
+ *          "num_elems": 10, "grading": 0.9},
+ *         {"name": "domain", "left_bound": 1, "right_bound": 9,
+ *          "num_elems": 80}
+ *       ]
+ *     }
+ *
+ * "contour_name" (default "outer_bc") and "grading" (default 1) are
+ * optional. The element sizes of a region form a geometric sequence with
+ * the ratio "grading".<br>
+ * The generated Mesh_model looks like the import of an equivalent Gmsh
+ * mesh: the outer boundary points form the contour with physical tag 1,
+ * the regions get the physical tags 2, 3, ... in the given order, and all
+ * nodes and elements are numbered from left to right.
+ */
+class Mesh_generator {
+public:
+  Mesh_generator(const std::string &spec_name);
+  Mesh_generator(
+      const std::vector<Region_spec> &region_specs,
+      const std::string &contour_name = "outer_bc");
+
+  Mesh_model generate_mesh_model() const;
+
+  /**
+   * @brief Get the node coordinates of a region from its left to its right
+   * bound, i.e. num_elems+1 coordinates
+   */
+  static std::vector<double> get_node_coords(const Region_spec &region);
+
+  inline const std::vector<Region_spec> &get_region_specs() const {
+    return this->region_specs;
+  };
+
+private:
+  const std::string spec_name;
+  std::vector<Region_spec> region_specs;
+  std::string contour_name;
+
+  void check_region_specs() const;
+};
+} // namespace DG::Mesh
+
+#endif
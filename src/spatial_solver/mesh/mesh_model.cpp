@@ -0,0 +1,90 @@
+#include "mesh_model.h"
+
+#include <algorithm>
+
+namespace DG::Mesh {
+
+namespace {
+/**
+ * Gmsh tags are (mostly) consecutive, hence a vector indexed by the tag
+ * itself serves as a lookup table with constant access time.
+ */
+std::vector<size_t> get_tag_index(const std::vector<size_t> &tags) {
+
+  if (tags.empty())
+    return {};
+
+  std::vector<size_t> tag_index(
+      *std::max_element(tags.begin(), tags.end()) + 1, invalid_index);
+  for (size_t idx{0}; idx < tags.size(); ++idx) {
+    tag_index[tags[idx]] = idx;
+  }
+
+  return tag_index;
+}
+//----
+size_t lookup(const std::vector<size_t> &tag_index, const size_t tag) {
+  return tag < tag_index.size() ? tag_index[tag] : invalid_index;
+}
+} // namespace
+//-------------------------------------------------------------------------
+void Mesh_model::build_lookup_tables() {
+
+  this->node_index = get_tag_index(this->node_tags);
+  this->elem_index = get_tag_index(this->elem_tags);
+  for (size_t entity_type{0}; entity_type < this->entities.size();
+       ++entity_type) {
+    this->entity_index[entity_type] =
+        get_tag_index(this->entities[entity_type].tags);
+  }
+}
+//-------------------------------------------------------------------------
+size_t Mesh_model::get_node_index(const size_t node_tag) const {
+  return lookup(this->node_index, node_tag);
+}
+//----
+size_t Mesh_model::get_elem_index(const size_t elem_tag) const {
+  return lookup(this->elem_index, elem_tag);
+}
+//----
+size_t Mesh_model::get_entity_index(
+    const size_t entity_type,
+    const size_t entity_tag) const {
+  return lookup(this->entity_index[entity_type], entity_tag);
+}
+//-------------------------------------------------------------------------
+std::vector<size_t> Mesh_model::get_regions() const {
+  return this->get_physical_groups(Physical_group.region);
+}
+//----
+std::vector<size_t> Mesh_model::get_contours() const {
+  return this->get_physical_groups(Physical_group.contour);
+}
+//----
+std::vector<size_t>
+Mesh_model::get_physical_groups(const size_t phys_group) const {
+
+  const size_t phys_group_dim{
+      physgroup_entity_table(this->dimension)[phys_group]};
+
+  std::vector<size_t> phys_groups;
+  for (size_t idx{0}; idx < this->phys_group_tags.size(); ++idx) {
+    if (this->phys_group_dims[idx] == phys_group_dim) {
+      phys_groups.push_back(this->phys_group_tags[idx]);
+    }
+  }
+
+  return phys_groups;
+}
+//-------------------------------------------------------------------------
+std::map<std::string, size_t> Mesh_model::get_physical_names() const {
+
+  std::map<std::string, size_t> physical_names;
+  for (size_t idx{0}; idx < this->phys_group_tags.size(); ++idx) {
+    physical_names[this->phys_group_names[idx]] =
+        this->phys_group_tags[idx];
+  }
+
+  return physical_names;
+}
+} // namespace DG::Mesh
@@ -0,0 +1,111 @@
+#ifndef MESH_MODEL_H
+#define MESH_MODEL_H
+
+#include "mesh.h"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace DG::Mesh {
+
+/// @brief Tag index which marks a tag as not being part of the mesh
+constexpr size_t invalid_index{std::numeric_limits<size_t>::max()};
+
+/**
+ * @brief Entities of one entity type (point, curve, surface, or volume)
+ * together with their physical tags. The physical tags of all entities
+ * are stored back to back, where the physical tags of the entity at index
+ * i are found in the range [phys_tag_offsets[i], phys_tag_offsets[i+1]).
+ */
+struct Entity_table {
+  std::vector<size_t> tags;
+  std::vector<size_t> phys_tag_offsets{0};
+  std::vector<size_t> phys_tags;
+};
+
+/**
+ * @brief Gmsh writes the elements in blocks, where all elements of a block
+ * belong to the same entity and are of the same element type. The
+ * elements of a block are stored contiguously in the Mesh_model starting
+ * at first_elem.
+ */
+struct Element_block {
+  size_t entity_dim;
+  size_t entity_tag;
+  size_t elem_type;
+  size_t first_elem;
+  size_t num_elems;
+};
+
+/**
+ * @brief In-memory representation of a Gmsh mesh, which is built in a
+ * single pass over the mesh file. Instead of the maps returned by
+ * Import_mesh_data, all sections are stored in flat, contiguous arrays,
+ * so that the data can be queried without touching the mesh file again.
+ * Node and element tags are resolved in constant time by lookup tables,
+ * which are created by build_lookup_tables() once the arrays are filled.
+ */
+struct Mesh_model {
+  size_t dimension{0};
+
+  // $PhysicalNames
+  std::vector<size_t> phys_group_dims;
+  std::vector<size_t> phys_group_tags;
+  std::vector<std::string> phys_group_names;
+
+  // $Entities, indexed by Entity.point, Entity.curve, ...
+  std::array<Entity_table, 4> entities;
+
+  // $Nodes, where the x, y, and z coordinate of each node are stored
+  // consecutively in node_coords
+  std::vector<size_t> node_tags;
+  std::vector<double> node_coords;
+
+  // $Elements, where the node tags of the element at index i are found in
+  // the range [elem_node_offsets[i], elem_node_offsets[i+1]) of
+  // elem_node_tags
+  std::vector<Element_block> elem_blocks;
+  std::vector<size_t> elem_tags;
+  std::vector<size_t> elem_node_offsets{0};
+  std::vector<size_t> elem_node_tags;
+
+  /// @brief Create the tag lookup tables after all arrays are filled
+  void build_lookup_tables();
+
+  /// @return Index of a node tag or invalid_index if there is none
+  size_t get_node_index(const size_t node_tag) const;
+
+  /// @return Index of an element tag or invalid_index if there is none
+  size_t get_elem_index(const size_t elem_tag) const;
+
+  /// @return Index of an entity tag or invalid_index if there is none
+  size_t get_entity_index(
+      const size_t entity_type,
+      const size_t entity_tag) const;
+
+  inline size_t get_number_of_nodes() const { return node_tags.size(); };
+  inline size_t get_number_of_elems() const { return elem_tags.size(); };
+
+  /// @brief Gmsh "physicalTags" of all regions
+  std::vector<size_t> get_regions() const;
+
+  /// @brief Gmsh "physicalTags" of all contours
+  std::vector<size_t> get_contours() const;
+
+  /// @brief Gmsh "name" (key) to "physicalTag" (value)
+  std::map<std::string, size_t> get_physical_names() const;
+
+private:
+  std::vector<size_t> node_index;
+  std::vector<size_t> elem_index;
+  std::array<std::vector<size_t>, 4> entity_index;
+
+  std::vector<size_t> get_physical_groups(const size_t phys_group) const;
+};
+} // namespace DG::Mesh
+
+#endif
@@ -0,0 +1,63 @@
+#include "mesh_section_index.h"
+#include "../../tools/mapped_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+namespace DG::Mesh {
+
+Mesh_section_index::Mesh_section_index(const std::string &mesh_name) {
+
+  const Import::Mapped_file mesh_file(mesh_name);
+
+  const char *line_begin{mesh_file.begin()};
+  for (size_t line_number{1}; line_begin < mesh_file.end(); ++line_number) {
+    const char *line_end{static_cast<const char *>(std::memchr(
+        line_begin, '\n', size_t(mesh_file.end() - line_begin)))};
+    if (line_end == nullptr) {
+      line_end = mesh_file.end();
+    }
+
+    if (*line_begin == '$') {
+      const std::string_view line(line_begin, line_end - line_begin);
+      const std::string specifier{
+          line.substr(0, line.find_first_of(" \t\r"))};
+
+      this->add_section(
+          specifier,
+          size_t(std::min(line_end + 1, mesh_file.end()) -
+                 mesh_file.begin()),
+          line_number);
+    }
+
+    line_begin = line_end + 1;
+  }
+}
+//-------------------------------------------------------------------------
+void Mesh_section_index::add_section(
+    const std::string &specifier,
+    const size_t position,
+    const size_t line_number) {
+
+  this->first_occurrence.emplace(specifier, this->sections.size());
+  this->sections.push_back({specifier, position, line_number});
+}
+//-------------------------------------------------------------------------
+bool Mesh_section_index::contains(const std::string &specifier) const {
+  return this->first_occurrence.contains(specifier);
+}
+//-------------------------------------------------------------------------
+const Section_location &
+Mesh_section_index::get_section(const std::string &specifier) const {
+
+  const auto section{this->first_occurrence.find(specifier)};
+  if (section == this->first_occurrence.end()) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": Specifier '" + specifier + "' not found in mesh file.");
+  }
+  return this->sections[section->second];
+}
+} // namespace DG::Mesh
@@ -0,0 +1,64 @@
+#ifndef MESH_SECTION_INDEX_H
+#define MESH_SECTION_INDEX_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace DG::Mesh {
+
+/**
+ * @brief Location of a specifier line, e.g. "$Nodes", in the mesh file.
+ * The position is the byte offset of the line following the specifier,
+ * i.e. of the first line of the section content.
+ */
+struct Section_location {
+  std::string specifier;
+  size_t position;
+  size_t line_number;
+};
+
+/**
+ * @brief Index of all specifier lines in a mesh file. The file is scanned
+ * once on construction, such that going to a section afterwards is a
+ * single seek instead of another pass over the file. The index is meant to
+ * be built once per mesh and shared by Check_mesh and Import_mesh_data.
+ */
+class Mesh_section_index {
+public:
+  Mesh_section_index() = default;
+  Mesh_section_index(const std::string &mesh_name);
+
+  /**
+   * @brief Add a specifier line, e.g. while a mesh reader passes over the
+   * file anyway. Specifier lines need to be added in file order.
+   */
+  void add_section(
+      const std::string &specifier,
+      const size_t position,
+      const size_t line_number);
+
+  bool contains(const std::string &specifier) const;
+
+  /**
+   * @brief Get the location of the first occurrence of a specifier
+   *
+   * @param[in] specifier Specifier of the mesh section, e.g. "$Nodes"
+   *
+   * @return Location of the specifier line
+   */
+  const Section_location &get_section(const std::string &specifier) const;
+
+  /// @brief Get all specifier lines in the order of the mesh file
+  inline const std::vector<Section_location> &get_sections() const {
+    return this->sections;
+  };
+
+private:
+  std::vector<Section_location> sections;
+  std::map<std::string, size_t> first_occurrence;
+};
+} // namespace DG::Mesh
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef ORDERED_MESH_H
+#define ORDERED_MESH_H
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace DG::Mesh {
+
+/**
+ * @brief Finite elements of all regions ordered from left to right, which
+ * is the order the DG scheme operates on. The regions are ordered from
+ * left to right by their first element, and the elements of each region
+ * are stored contiguously, i.e. the elements of the region region_tags[r]
+ * are given by the indices [region_offsets[r], region_offsets[r+1]).
+ * Since a region may consist of several intervals, the ordered elements
+ * are only sorted within each region.<br>
+ * All per element arrays are indexed by this ordered index, which is also
+ * used for the neighbour links. An element without a neighbour on one
+ * side, i.e. at the domain boundary, is linked to no_neighbour.
+ */
+struct Ordered_mesh {
+  std::vector<size_t> region_tags;
+  std::vector<size_t> region_offsets{0};
+
+  std::vector<size_t> elem_tags;
+  /// @brief Left and right node coordinate of each element
+  std::vector<double> elem_coords;
+  std::vector<double> geo_factors;
+
+  /// @brief Ordered index of the left and right neighbour of each element
+  std::vector<size_t> left_neighbours;
+  std::vector<size_t> right_neighbours;
+
+  static constexpr size_t no_neighbour{std::numeric_limits<size_t>::max()};
+};
+} // namespace DG::Mesh
+
+#endif
@@ -1,4 +1,6 @@
 #include "process_mesh_data.h"
+#include "../../tools/custom_errors.h"
+#include "../geometric_operations.h"
 
 #include <algorithm>
 #include <set>
@@ -6,14 +8,59 @@
 namespace DG::Mesh {
 
 Process_mesh_data::Process_mesh_data(const std::string &_mesh_name)
-    : Import_mesh_data(_mesh_name), 
+    : Process_mesh_data(_mesh_name, Mesh_section_index()) {}
+//----
+Process_mesh_data::Process_mesh_data(
+    const std::string &_mesh_name,
+    Mesh_section_index &&section_index)
+    : Process_mesh_data(
+          _mesh_name,
+          Import_mesh_data::import_mesh_model(_mesh_name, section_index),
+          section_index) {}
+//----
+Process_mesh_data::Process_mesh_data(
+    const std::string &_mesh_name,
+    Mesh_model _mesh_model,
+    const Mesh_section_index &section_index)
+    : Import_mesh_data(_mesh_name, _mesh_model, section_index),
+      mesh_name{_mesh_name},
+      dimension{_mesh_model.dimension},
+      mesh_model{std::move(_mesh_model)} {
+  this->build_ordered_mesh();
+}
+//----
+Process_mesh_data::Process_mesh_data(
+    const std::string &_mesh_name,
+    Mesh_cache_content cache_content)
+    : Import_mesh_data(
+          _mesh_name, cache_content.mesh_model, cache_content.section_index),
       mesh_name{_mesh_name},
-      dimension{Import_mesh_data::get_dimension()} {}
+      dimension{cache_content.mesh_model.dimension},
+      mesh_model{std::move(cache_content.mesh_model)},
+      ordered_mesh{std::move(cache_content.ordered_mesh)} {}
+//-------------------------------------------------------------------------
+void Process_mesh_data::store_cache(const Mesh_cache &mesh_cache) const {
+  mesh_cache.store(
+      this->mesh_model, this->get_section_index(), this->ordered_mesh);
+}
+//-------------------------------------------------------------------------
+std::vector<size_t> Process_mesh_data::get_regions() const {
+  return this->mesh_model.get_regions();
+}
+//----
+std::vector<size_t> Process_mesh_data::get_contours() const {
+  return this->mesh_model.get_contours();
+}
+//----
+std::map<std::string, size_t>
+Process_mesh_data::get_physical_names() const {
+  return this->mesh_model.get_physical_names();
+}
 //-------------------------------------------------------------------------
 std::vector<size_t>
 Process_mesh_data::get_finite_elems(const std::string &region_name) {
 
-  auto phys_name_map(Import_mesh_data::import_gmsh_physical_names());
+  auto phys_name_map(this->get_physical_names());
   if (phys_name_map.contains(region_name)) {
     const size_t region_tag{phys_name_map[region_name]};
     if (this->is_region(region_tag) == false) {
@@ -37,49 +84,206 @@ Process_mesh_data::get_finite_elems(const size_t region_tag) {
 
   std::vector<size_t> element_tags;
   for (const auto entity_tag : this->get_entity_tags(region_tag)) {
-    for (const auto [element_tag, node_tags] :
-         Import_mesh_data::import_gmsh_elements(
-             Entity.curve, entity_tag)) {
-      element_tags.push_back(element_tag);
+    for (const auto &elem_block : this->mesh_model.elem_blocks) {
+      if (elem_block.entity_dim == Entity.curve &&
+          elem_block.entity_tag == entity_tag) {
+        const auto first_elem{
+            this->mesh_model.elem_tags.begin() + elem_block.first_elem};
+        element_tags.insert(
+            element_tags.end(),
+            first_elem,
+            first_elem + elem_block.num_elems);
+      }
     }
   }
   return element_tags;
 }
 //-------------------------------------------------------------------------
-std::vector<size_t> Process_mesh_data::get_ordered_regions() {
+const std::vector<size_t> &Process_mesh_data::get_ordered_regions() const {
+  return this->ordered_mesh.region_tags;
+}
+//-------------------------------------------------------------------------
+void Process_mesh_data::build_ordered_mesh() {
 
+  // Regions are ordered by the left coordinate of their first element
   std::vector<size_t> first_elems;
+  std::map<size_t, std::vector<size_t>> first_elem_to_region_elems;
   std::map<size_t, size_t> first_elem_to_region;
-
-  std::vector regions{Import_mesh_data::import_gmsh_regions()};
-  for (const auto region : regions) {
-    const size_t first_elem(
-        this->get_ordered_elems(this->get_finite_elems(region)).front());
+  for (const auto region : this->get_regions()) {
+    std::vector elem_tags{
+        this->get_ordered_elems(this->get_finite_elems(region))};
+    // Regions of higher dimensional meshes contain no line elements
+    if (elem_tags.empty()) {
+      continue;
+    }
+    const size_t first_elem{elem_tags.front()};
     first_elems.push_back(first_elem);
     first_elem_to_region[first_elem] = region;
+    first_elem_to_region_elems[first_elem] = std::move(elem_tags);
+  }
+
+  Geometric_operations geop(*this);
+  for (const auto first_elem : this->get_ordered_elems(first_elems)) {
+    this->ordered_mesh.region_tags.push_back(first_elem_to_region[first_elem]);
+    for (const auto elem_tag : first_elem_to_region_elems[first_elem]) {
+      const auto [left_coord, right_coord] = this->get_elem_coords(elem_tag);
+      this->ordered_mesh.elem_tags.push_back(elem_tag);
+      this->ordered_mesh.elem_coords.push_back(left_coord);
+      this->ordered_mesh.elem_coords.push_back(right_coord);
+      this->ordered_mesh.geo_factors.push_back(
+          geop.get_geometric_factor(elem_tag));
+    }
+    this->ordered_mesh.region_offsets.push_back(
+        this->ordered_mesh.elem_tags.size());
+  }
+
+  this->link_neighbours();
+}
+//-------------------------------------------------------------------------
+void Process_mesh_data::link_neighbours() {
+
+  Ordered_mesh &ordered(this->ordered_mesh);
+  const size_t num_elems{ordered.elem_tags.size()};
+  ordered.left_neighbours.assign(num_elems, Ordered_mesh::no_neighbour);
+  ordered.right_neighbours.assign(num_elems, Ordered_mesh::no_neighbour);
+
+  // Regions need not be intervals, hence neighbours are not necessarily
+  // adjacent in the ordered mesh. Instead, elements are neighbours if the
+  // right node of one is the left node of the other.
+  const std::vector<size_t> &node_tags(this->mesh_model.elem_node_tags);
+  const std::vector<size_t> &node_offsets(
+      this->mesh_model.elem_node_offsets);
+  std::vector<size_t> left_node_to_elem(
+      this->mesh_model.get_number_of_nodes(), Ordered_mesh::no_neighbour);
+  std::vector<size_t> right_node_idx(num_elems);
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    const size_t elem_idx{
+        this->mesh_model.get_elem_index(ordered.elem_tags[elem])};
+    const size_t left_node_idx{this->mesh_model.get_node_index(
+        node_tags[node_offsets[elem_idx]])};
+    right_node_idx[elem] = this->mesh_model.get_node_index(
+        node_tags[node_offsets[elem_idx + 1] - 1]);
+    if (left_node_idx == invalid_index ||
+        right_node_idx[elem] == invalid_index) {
+      throw Mesh_error(
+          "Element " + std::to_string(ordered.elem_tags[elem]) +
+              " refers to a node which is not in $Nodes.",
+          this->mesh_name);
+    }
+    left_node_to_elem[left_node_idx] = elem;
+  }
+
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    const size_t right_neighbour{left_node_to_elem[right_node_idx[elem]]};
+    if (right_neighbour != Ordered_mesh::no_neighbour) {
+      ordered.right_neighbours[elem] = right_neighbour;
+      ordered.left_neighbours[right_neighbour] = elem;
+    }
+  }
+}
+//-------------------------------------------------------------------------
+std::span<const size_t>
+Process_mesh_data::get_ordered_finite_elems(const size_t region_tag) const {
+
+  const auto [first_elem, last_elem] =
+      this->get_ordered_region_range(region_tag);
+  return std::span<const size_t>(this->ordered_mesh.elem_tags)
+      .subspan(first_elem, last_elem - first_elem);
+}
+//----
+Face_connectivity Process_mesh_data::get_face_connectivity(
+    const size_t region_tag,
+    const std::vector<std::pair<std::string, std::string>>
+        &periodic_contours) const {
+
+  return Face_connectivity(
+      this->mesh_model,
+      this->get_ordered_finite_elems(region_tag),
+      this->get_periodic_contour_tags(periodic_contours));
+}
+//----
+Face_connectivity Process_mesh_data::get_face_connectivity(
+    const std::vector<std::pair<std::string, std::string>>
+        &periodic_contours) const {
+
+  return Face_connectivity(
+      this->mesh_model,
+      this->ordered_mesh.elem_tags,
+      this->get_periodic_contour_tags(periodic_contours));
+}
+//----
+std::vector<std::pair<size_t, size_t>>
+Process_mesh_data::get_periodic_contour_tags(
+    const std::vector<std::pair<std::string, std::string>>
+        &periodic_contours) const {
+
+  const auto phys_name_map(this->get_physical_names());
+  const std::vector contours(this->get_contours());
+  auto get_contour_tag = [&](const std::string &contour_name) {
+    const auto contour{phys_name_map.find(contour_name)};
+    if (contour == phys_name_map.end() ||
+        std::find(contours.begin(), contours.end(), contour->second) ==
+            contours.end()) {
+      throw std::invalid_argument(
+          std::string() + __FILE__ + ":" + std::to_string(__LINE__) +
+          ": "
+          "Invalid contour name '" +
+          contour_name + "'.");
+    }
+    return contour->second;
+  };
+
+  std::vector<std::pair<size_t, size_t>> periodic_contour_tags;
+  for (const auto &[first_contour, second_contour] : periodic_contours) {
+    periodic_contour_tags.emplace_back(
+        get_contour_tag(first_contour), get_contour_tag(second_contour));
   }
 
-  std::vector<size_t> ordered_regions;
-  std::vector<size_t> ordered_first_elems{
-      this->get_ordered_elems(first_elems)};
-  for (const auto elem : ordered_first_elems) {
-    ordered_regions.push_back(first_elem_to_region[elem]);
+  return periodic_contour_tags;
+}
+//----
+std::span<const double>
+Process_mesh_data::get_geometric_factors(const size_t region_tag) const {
+
+  const auto [first_elem, last_elem] =
+      this->get_ordered_region_range(region_tag);
+  return std::span<const double>(this->ordered_mesh.geo_factors)
+      .subspan(first_elem, last_elem - first_elem);
+}
+//----
+std::tuple<size_t, size_t>
+Process_mesh_data::get_ordered_region_range(const size_t region_tag) const {
+
+  const auto &region_tags(this->ordered_mesh.region_tags);
+  const auto region{
+      std::find(region_tags.begin(), region_tags.end(), region_tag)};
+  if (region == region_tags.end()) {
+    throw std::invalid_argument(
+        std::string() + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Invalid region tag.");
   }
 
-  return ordered_regions;
+  const size_t region_idx(region - region_tags.begin());
+  return {
+      this->ordered_mesh.region_offsets[region_idx],
+      this->ordered_mesh.region_offsets[region_idx + 1]};
 }
 //-------------------------------------------------------------------------
 std::vector<size_t> Process_mesh_data::get_ordered_elems(
     const std::vector<size_t> &elem_tags) {
 
-  std::vector<size_t> ordered_elem_tags;
-  std::map<double, size_t> coord_elemtag_map;
+  std::vector<std::pair<double, size_t>> coord_elem_tags;
+  coord_elem_tags.reserve(elem_tags.size());
   for (const auto elem_tag : elem_tags) {
     auto [left_coord, right_coord] = this->get_elem_coords(elem_tag);
-    coord_elemtag_map[left_coord] = elem_tag;
+    coord_elem_tags.emplace_back(left_coord, elem_tag);
   };
+  std::sort(coord_elem_tags.begin(), coord_elem_tags.end());
 
-  for (const auto [coord, elem_tag] : coord_elemtag_map) {
+  std::vector<size_t> ordered_elem_tags;
+  ordered_elem_tags.reserve(coord_elem_tags.size());
+  for (const auto &[coord, elem_tag] : coord_elem_tags) {
     ordered_elem_tags.push_back(elem_tag);
   }
   return ordered_elem_tags;
@@ -94,33 +298,28 @@ double Process_mesh_data::get_elem_size(const size_t elem_tag) {
 std::tuple<double, double>
 Process_mesh_data::get_elem_coords(const size_t elem_tag) {
 
-  double left_coord;
-  double right_coord;
-  for (const auto region_tag : Import_mesh_data::import_gmsh_regions()) {
-    for (const auto entity_tag : this->get_entity_tags(region_tag)) {
-      std::vector<size_t> node_tags(Import_mesh_data::import_gmsh_elements(
-          Entity.curve, entity_tag)[elem_tag]);
-      if (!node_tags.empty()) {
-        try {
-          left_coord = this->get_coord(node_tags.front(), entity_tag);
-          right_coord = this->get_coord(node_tags.back(), entity_tag);
-        } catch (std::invalid_argument &ia) {
-          std::cerr << __FILE__ << ":" << __LINE__ << ": "
-                    << "Could not find node coordinates for element "
-                    << elem_tag << '\n'
-                    << ia.what() << std::endl;
-        }
-      }
-    }
+  const size_t elem_idx{this->mesh_model.get_elem_index(elem_tag)};
+  if (elem_idx == invalid_index) {
+    throw std::invalid_argument(
+        std::string() + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "Did not find element for given element tag.");
   }
 
-  return {left_coord, right_coord};
+  const std::vector<size_t> &node_tags(this->mesh_model.elem_node_tags);
+  const size_t first_node{this->mesh_model.elem_node_offsets[elem_idx]};
+  const size_t last_node{
+      this->mesh_model.elem_node_offsets[elem_idx + 1] - 1};
+
+  return {
+      this->get_coord(node_tags[first_node]),
+      this->get_coord(node_tags[last_node])};
 }
 //-------------------------------------------------------------------------
 double Process_mesh_data::get_min_elem_size() {
 
   std::vector<double> elem_sizes;
-  for (const auto region_tag : Import_mesh_data::import_gmsh_regions()) {
+  for (const auto region_tag : this->get_regions()) {
     elem_sizes.push_back(get_min_elem_size(region_tag));
   }
 
@@ -130,7 +329,7 @@ double Process_mesh_data::get_min_elem_size() {
 double
 Process_mesh_data::get_min_elem_size(const std::string &region_name) {
 
-  auto phys_name_map(Import_mesh_data::import_gmsh_physical_names());
+  auto phys_name_map(this->get_physical_names());
   if (phys_name_map.contains(region_name)) {
     const size_t region_tag{phys_name_map[region_name]};
     if (this->is_region(region_tag) == false) {
@@ -161,29 +360,32 @@ double Process_mesh_data::get_min_elem_size(const size_t region_tag) {
   return *std::min_element(elem_sizes.begin(), elem_sizes.end());
 }
 //-------------------------------------------------------------------------
-double Process_mesh_data::get_coord(
-    const size_t node_tag,
-    const size_t entity_tag) {
-  auto curve_node(Import_mesh_data::import_gmsh_nodes());
-  if (curve_node.contains(node_tag)) {
-    return curve_node[node_tag].front();
+double Process_mesh_data::get_coord(const size_t node_tag) const {
+
+  const size_t node_idx{this->mesh_model.get_node_index(node_tag)};
+  if (node_idx != invalid_index) {
+    return this->mesh_model.node_coords[3 * node_idx];
   } else {
     throw std::invalid_argument(
         std::string() + __FILE__ + ":" + std::to_string(__LINE__) +
         ": "
-        "Did not find coordinate for given node and entity.");
+        "Did not find coordinate for given node.");
   }
 }
 //-------------------------------------------------------------------------
 std::vector<size_t>
-Process_mesh_data::get_entity_tags(const size_t region_tag) {
+Process_mesh_data::get_entity_tags(const size_t region_tag) const {
+
+  const Entity_table &curves(this->mesh_model.entities[Entity.curve]);
 
   std::vector<size_t> entity_tags;
-  for (const auto [entity_tag, physical_tags] :
-       Import_mesh_data::import_gmsh_entities(Entity.curve)) {
-    for (const auto physical_tag : physical_tags) {
-      if (physical_tag == region_tag) {
-        entity_tags.push_back(entity_tag);
+  for (size_t entity_idx{0}; entity_idx < curves.tags.size();
+       ++entity_idx) {
+    for (size_t phys_tag_idx{curves.phys_tag_offsets[entity_idx]};
+         phys_tag_idx < curves.phys_tag_offsets[entity_idx + 1];
+         ++phys_tag_idx) {
+      if (curves.phys_tags[phys_tag_idx] == region_tag) {
+        entity_tags.push_back(curves.tags[entity_idx]);
       }
     }
   }
@@ -192,7 +394,7 @@ Process_mesh_data::get_entity_tags(const size_t region_tag) {
 //-------------------------------------------------------------------------
 bool Process_mesh_data::is_region(const size_t physical_tag) {
 
-  std::vector regions(Import_mesh_data::import_gmsh_regions());
+  std::vector regions(this->get_regions());
   auto it = std::find(regions.begin(), regions.end(), physical_tag);
   if (it != regions.end()) {
     return true;
@@ -203,7 +405,7 @@ bool Process_mesh_data::is_region(const size_t physical_tag) {
 //-------------------------------------------------------------------------
 bool Process_mesh_data::is_contour(const size_t physical_tag) {
 
-  std::vector contours(Import_mesh_data::import_gmsh_contours());
+  std::vector contours(this->get_contours());
   auto it = std::find(contours.begin(), contours.end(), physical_tag);
   if (it != contours.end()) {
     return true;
@@ -1,9 +1,13 @@
 #ifndef PROCESS_MESH_DATA_H
 #define PROCESS_MESH_DATA_H
 
+#include "face_connectivity.h"
 #include "import_mesh_data.h"
+#include "mesh_cache.h"
+#include "ordered_mesh.h"
 
 #include <map>
+#include <span>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -12,7 +16,11 @@ namespace DG::Mesh {
 
 /**
  * @brief Processing the mesh data imported from a Gmsh file, so that we
- * have access to the data which is relevant to the DG scheme.<br>
+ * have access to the data which is relevant to the DG scheme. The mesh
+ * file is imported once on construction into a Mesh_model, from which all
+ * of the following queries are answered. The finite elements are ordered
+ * from left to right once on construction as well (see Ordered_mesh).
+ * Both can be stored in and restored from a Mesh_cache.<br>
  * Note, that in DGTD the strong formulation of a given PDE is solved on
  * size independent unit integrals on each finite elements. Some of the
  * following methods are implemented with regards to the conversion from
@@ -23,6 +31,37 @@ class Process_mesh_data : public Import_mesh_data {
 public:
   Process_mesh_data(const std::string &mesh_name);
 
+  /**
+   * @brief Construct from a mesh model which has already been imported and
+   * validated, e.g. by Check_mesh, such that the mesh file is not read
+   * again
+   */
+  Process_mesh_data(
+      const std::string &mesh_name,
+      Mesh_model mesh_model,
+      const Mesh_section_index &section_index);
+
+  /// @brief Construct from the content of a Mesh_cache without any parsing
+  Process_mesh_data(
+      const std::string &mesh_name,
+      Mesh_cache_content cache_content);
+
+  /// @brief Write the imported and ordered mesh to the cache file
+  void store_cache(const Mesh_cache &mesh_cache) const;
+
+  inline const Ordered_mesh &get_ordered_mesh() const {
+    return this->ordered_mesh;
+  };
+
+  /// @brief Get Gmsh "physicalTags" of all regions
+  std::vector<size_t> get_regions() const;
+
+  /// @brief Get Gmsh "physicalTags" of all contours
+  std::vector<size_t> get_contours() const;
+
+  /// @brief Get Gmsh "name" (key) to "physicalTag" (value) map
+  std::map<std::string, size_t> get_physical_names() const;
+
   /// @brief Get finite element tags for a given region
   std::vector<size_t> get_finite_elems(const std::string &region_name);
   std::vector<size_t> get_finite_elems(const size_t region_tag);
@@ -30,9 +69,10 @@ public:
   /**
    * @brief Order the regions from left to right. This is useful when
    * operating different solution scheme parameters for different regions
-   * and assembling the global solution afterwards.
+   * and assembling the global solution afterwards. The order is computed
+   * once on construction.
    */
-  std::vector<size_t> get_ordered_regions();
+  const std::vector<size_t> &get_ordered_regions() const;
 
   /**
    * @brief Order a given set of finite elements from left to right. Use
@@ -40,10 +80,50 @@ public:
    * example, you can apply this method to a collection of element tags of
    * a certain region. This method is also utilized to figure out the
    * neighboring regions, i.e. the region ordering from left to right.
+   * The elements are sorted by their left coordinate in O(N log N). For
+   * the elements of a whole region, get_ordered_finite_elems(...) returns
+   * the precomputed order instead.
    */
   std::vector<size_t>
   get_ordered_elems(const std::vector<size_t> &elem_tags);
 
+  /**
+   * @brief Get the finite elements of a region ordered from left to right,
+   * which is a slice of the ordered mesh
+   */
+  std::span<const size_t>
+  get_ordered_finite_elems(const size_t region_tag) const;
+
+  /**
+   * @brief Get the face connectivity of the ordered finite elements of a
+   * region (see get_ordered_finite_elems(...))
+   *
+   * @param[in] region_tag Gmsh "physicalTag" of the region
+   * @param[in] periodic_contours Pairs of contour names, whose boundary
+   * faces are connected to each other
+   */
+  Face_connectivity get_face_connectivity(
+      const size_t region_tag,
+      const std::vector<std::pair<std::string, std::string>>
+          &periodic_contours = {}) const;
+  /**
+   * @brief Get the face connectivity of the ordered finite elements of all
+   * regions, i.e. of the columns of the global solution. The faces which
+   * two regions share connect them, such that only the faces on the outer
+   * boundary of the mesh remain boundary faces, unless they are connected
+   * periodically.
+   */
+  Face_connectivity get_face_connectivity(
+      const std::vector<std::pair<std::string, std::string>>
+          &periodic_contours = {}) const;
+
+  /**
+   * @brief Get the geometric factors of the finite elements of a region
+   * ordered from left to right (see Geometric_operations)
+   */
+  std::span<const double>
+  get_geometric_factors(const size_t region_tag) const;
+
   /**
    * @brief The element size is needed to convert physical coordinate
    * information to reference coordinate information and vice versa.
@@ -75,9 +155,29 @@ public:
 private:
   const std::string &mesh_name;
   const size_t dimension;
+  const Mesh_model mesh_model;
+  Ordered_mesh ordered_mesh;
+
+  Process_mesh_data(
+      const std::string &mesh_name,
+      Mesh_section_index &&section_index);
+
+  void build_ordered_mesh();
+
+  /// @brief Link the ordered elements which share a node
+  void link_neighbours();
+
+  /// @brief Get the physical tags of pairs of contour names
+  std::vector<std::pair<size_t, size_t>> get_periodic_contour_tags(
+      const std::vector<std::pair<std::string, std::string>>
+          &periodic_contours) const;
+
+  /// @brief Get the range of a region in the ordered mesh
+  std::tuple<size_t, size_t>
+  get_ordered_region_range(const size_t region_tag) const;
 
-  double get_coord(const size_t node_tag, const size_t entity_tag);
-  std::vector<size_t> get_entity_tags(const size_t region_tag);
+  double get_coord(const size_t node_tag) const;
+  std::vector<size_t> get_entity_tags(const size_t region_tag) const;
   bool is_region(const size_t physical_tag);
   bool is_contour(const size_t physical_tag);
 };
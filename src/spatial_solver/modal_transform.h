@@ -0,0 +1,74 @@
+/* !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * CAUTION:
+ * Due to instantiation issues the method implementation is stored in
+ * a .tpp-file (not .cpp)
+ * For more information, see
+ * https://stackoverflow.com/questions/8752837/undefined-reference-to-template-class-constructor
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ */
+
+#ifndef MODAL_TRANSFORM_H
+#define MODAL_TRANSFORM_H
+
+#include "reference_operators.h"
+
+#include <armadillo>
+#include <memory>
+
+namespace DG {
+/**
+ * @brief Transformation of the fields between the nodal representation,
+ * i.e. the field values at the quadrature nodes, and the modal
+ * representation, i.e. the coefficients of the orthonormal polynomials of
+ * the basis @cite hesthaven2008nodal (chapter 3.1). As for the fields,
+ * each column of the modal fields represents an element, and row \f$k\f$
+ * holds the coefficient of the polynomial of order \f$k\f$.<br>
+ * Since the polynomials are orthonormal and hierarchical, the modal
+ * coefficients of an element change their polynomial order by truncation
+ * (\f$L^2\f$-projection) or zero-padding (exact prolongation), without
+ * evaluating any polynomial.
+ */
+template <class Basis> class Modal_transform {
+public:
+  Modal_transform(const size_t polynomial_order);
+
+  /// @brief \f$\hat u = \mathcal V^{-1} u\f$ for all elements at once
+  arma::mat get_modal_fields(const arma::mat &nodal_fields) const;
+
+  /// @brief \f$u = \mathcal V \hat u\f$ for all elements at once
+  arma::mat get_nodal_fields(const arma::mat &modal_fields) const;
+
+  /**
+   * @brief Interpolate nodal fields of the transform's polynomial order to
+   * the nodes of another polynomial order via the modal fields
+   */
+  arma::mat project_nodal_fields(
+      const arma::mat &nodal_fields,
+      const size_t polynomial_order) const;
+
+  /**
+   * @brief Restrict the modal fields to a lower polynomial order by
+   * truncation, or prolong them to a higher one by zero-padding
+   */
+  static arma::mat change_order(
+      const arma::mat &modal_fields,
+      const size_t polynomial_order);
+
+  /**
+   * @brief Estimate the smoothness of the fields in each element from the
+   * decay of their modal coefficients, i.e. the share of the highest mode
+   * in the element's \f$L^2\f$-norm \f$ \hat u_N^2 / \sum_{k=0}^N \hat u_k^2
+   * \f$ @cite persson2006sub. It is close to zero for well resolved fields
+   * and approximates the relative error of a restriction by one order.
+   */
+  static arma::rowvec get_decay_indicator(const arma::mat &modal_fields);
+
+private:
+  const size_t polynomial_order;
+  const std::shared_ptr<const Reference_operators> operators;
+};
+} // namespace DG
+
+#include "modal_transform.tpp"
+
+#endif
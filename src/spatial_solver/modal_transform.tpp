@@ -0,0 +1,64 @@
+namespace DG {
+
+template <class Basis>
+Modal_transform<Basis>::Modal_transform(const size_t _polynomial_order)
+    : polynomial_order{_polynomial_order},
+      operators{Operator_registry<Basis>::get_operators(_polynomial_order)} {}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::mat Modal_transform<Basis>::get_modal_fields(
+    const arma::mat &nodal_fields) const {
+
+  return this->operators->inverse_vandermonde_matrix * nodal_fields;
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::mat Modal_transform<Basis>::get_nodal_fields(
+    const arma::mat &modal_fields) const {
+
+  return this->operators->vandermonde_matrix * modal_fields;
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::mat Modal_transform<Basis>::project_nodal_fields(
+    const arma::mat &nodal_fields,
+    const size_t polynomial_order) const {
+
+  const auto target_operators{
+      Operator_registry<Basis>::get_operators(polynomial_order)};
+  return target_operators->vandermonde_matrix *
+         change_order(this->get_modal_fields(nodal_fields), polynomial_order);
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::mat Modal_transform<Basis>::change_order(
+    const arma::mat &modal_fields,
+    const size_t polynomial_order) {
+
+  const size_t num_modes{polynomial_order + 1};
+  if (num_modes <= modal_fields.n_rows) {
+    return modal_fields.rows(0, polynomial_order);
+  }
+
+  arma::mat padded_fields(num_modes, modal_fields.n_cols, arma::fill::zeros);
+  padded_fields.rows(0, modal_fields.n_rows - 1) = modal_fields;
+  return padded_fields;
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::rowvec
+Modal_transform<Basis>::get_decay_indicator(const arma::mat &modal_fields) {
+
+  const arma::rowvec norms{arma::sum(arma::square(modal_fields), 0)};
+  const arma::rowvec highest_modes{arma::square(modal_fields.tail_rows(1))};
+
+  arma::rowvec indicator(modal_fields.n_cols, arma::fill::zeros);
+  for (size_t elem{0}; elem < modal_fields.n_cols; ++elem) {
+    if (norms[elem] > 0.) {
+      indicator[elem] = highest_modes[elem] / norms[elem];
+    }
+  }
+
+  return indicator;
+}
+} // namespace DG
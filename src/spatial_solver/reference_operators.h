@@ -0,0 +1,90 @@
+/* !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * CAUTION:
+ * Due to instantiation issues the method implementation is stored in
+ * a .tpp-file (not .cpp)
+ * For more information, see
+ * https://stackoverflow.com/questions/8752837/undefined-reference-to-template-class-constructor
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ */
+
+#ifndef REFERENCE_OPERATORS_H
+#define REFERENCE_OPERATORS_H
+
+#include "even_odd_matrix.h"
+
+#include <armadillo>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace DG {
+/**
+ * @brief Immutable bundle of the operators on the reference element
+ * \f$[-1,1]\f$ for a given basis and polynomial order
+ */
+struct Reference_operators {
+  arma::vec nodes;
+  /// @brief Quadrature weights, i.e. the row sums of the mass matrix
+  arma::vec weights;
+  arma::mat vandermonde_matrix;
+  arma::mat inverse_vandermonde_matrix;
+  arma::mat diff_matrix;
+  arma::mat lift_matrix;
+  /// @brief See Elementwise_operations::get_face_interpolation_matrix()
+  arma::mat face_interpolation_matrix;
+  /// @brief Whether the first and last node lie on the element faces
+  bool has_face_nodes;
+  /**
+   * @brief Even-odd decomposition of the differentiation matrix if the
+   * nodes are symmetric, otherwise nullptr
+   */
+  std::shared_ptr<const Even_odd_matrix> even_odd_diff_matrix;
+
+  /**
+   * @brief Spectral radius of the reference operator of the advection
+   * equation with upwinding at the inflow face, i.e. \f$\boldsymbol{\mathcal
+   * D} + \mathcal L_{:,1} \mathcal E_{:,1}^\mathrm{T}\f$. It bounds the
+   * stable time step of explicit time integration of a basis and order
+   * @cite hesthaven2008nodal (chapter 4.8).
+   */
+  double get_upwind_spectral_radius() const;
+};
+
+/**
+ * @brief Process-wide registry of the reference operators, such that
+ * solvers and regions with the same basis and polynomial order share a
+ * single bundle instead of recomputing it. The registry is keyed by the
+ * basis type (template parameter) and the polynomial order. A bundle is
+ * built once on its first request, where the Vandermonde matrix is
+ * factorized instead of inverted explicitly. Requests are thread-safe.
+ */
+template <class Basis> class Operator_registry {
+public:
+  /**
+   * @brief Get the reference operators of a polynomial order, which are
+   * built on the first request
+   */
+  static std::shared_ptr<const Reference_operators>
+  get_operators(const size_t polynomial_order);
+
+  /**
+   * @brief Build the reference operators of a polynomial order without
+   * looking them up in the registry. The differentiation matrix
+   * \f$\boldsymbol{\mathcal D} = \mathcal V_r \mathcal V^{-1}\f$ is
+   * computed by an LU solve of \f$\mathcal V^T \boldsymbol{\mathcal D}^T =
+   * \mathcal V_r^T\f$ @cite hesthaven2008nodal (chapter 3.2). If the
+   * basis provides a precomputed table of the order, the weights,
+   * differentiation matrix, and lift matrix are copied from it instead.
+   */
+  static Reference_operators build_operators(const size_t polynomial_order);
+
+private:
+  static std::mutex registry_mutex;
+  static std::map<size_t, std::shared_ptr<const Reference_operators>>
+      registry;
+};
+} // namespace DG
+
+#include "reference_operators.tpp"
+
+#endif
@@ -0,0 +1,91 @@
+#include "elementwise_operations.h"
+
+namespace DG {
+
+template <class Basis> std::mutex Operator_registry<Basis>::registry_mutex;
+
+template <class Basis>
+std::map<size_t, std::shared_ptr<const Reference_operators>>
+    Operator_registry<Basis>::registry;
+//-------------------------------------------------------------------------
+template <class Basis>
+std::shared_ptr<const Reference_operators>
+Operator_registry<Basis>::get_operators(const size_t polynomial_order) {
+
+  const std::lock_guard<std::mutex> lock(registry_mutex);
+
+  auto &operators{registry[polynomial_order]};
+  if (!operators) {
+    operators = std::make_shared<const Reference_operators>(
+        build_operators(polynomial_order));
+  }
+
+  return operators;
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+Reference_operators
+Operator_registry<Basis>::build_operators(const size_t polynomial_order) {
+
+  const Elementwise_operations<Basis> eop(polynomial_order);
+  const Basis basis;
+
+  Reference_operators operators;
+  operators.nodes = arma::vec(basis.get_quad_nodes(polynomial_order));
+  operators.vandermonde_matrix = eop.get_vandermonde_matrix();
+
+  const arma::mat &vand_mat{operators.vandermonde_matrix};
+  const size_t num_nodes{vand_mat.n_rows};
+
+  operators.inverse_vandermonde_matrix =
+      arma::solve(vand_mat, arma::eye(num_nodes, num_nodes));
+
+  // Bases with precomputed tables (see Legendre_basis::get_gll_table)
+  bool is_tabulated{false};
+  if constexpr (requires { basis.get_gll_table(polynomial_order); }) {
+    if (const auto table{basis.get_gll_table(polynomial_order)}) {
+      operators.weights = arma::vec(table->weights, num_nodes);
+      operators.diff_matrix =
+          arma::mat(table->diff_matrix, num_nodes, num_nodes);
+      operators.lift_matrix = arma::mat(table->lift_matrix, num_nodes, 2);
+      is_tabulated = true;
+    }
+  }
+
+  if (!is_tabulated) {
+    // The inverse mass matrix is V V^T, its inverse's row sums are the
+    // quadrature weights
+    const arma::mat inverse_mass_matrix{vand_mat * vand_mat.t()};
+    operators.weights = arma::solve(
+        inverse_mass_matrix, arma::vec(num_nodes, arma::fill::ones));
+
+    if (polynomial_order == 0) {
+      operators.diff_matrix.zeros(num_nodes, num_nodes);
+    } else {
+      operators.diff_matrix =
+          arma::solve(vand_mat.t(), eop.get_grad_vandermonde_matrix().t())
+              .t();
+    }
+
+    operators.lift_matrix = eop.get_lift_matrix();
+  }
+
+  operators.has_face_nodes = eop.has_face_nodes();
+  operators.face_interpolation_matrix = eop.get_face_interpolation_matrix();
+
+  if (Even_odd_matrix::is_centro_antisymmetric(operators.diff_matrix)) {
+    operators.even_odd_diff_matrix =
+        std::make_shared<const Even_odd_matrix>(operators.diff_matrix);
+  }
+
+  return operators;
+}
+//-------------------------------------------------------------------------
+inline double Reference_operators::get_upwind_spectral_radius() const {
+
+  const arma::mat upwind_operator{
+      this->diff_matrix +
+      this->lift_matrix.col(0) * this->face_interpolation_matrix.col(0).t()};
+  return arma::max(arma::abs(arma::eig_gen(upwind_operator)));
+}
+} // namespace DG
@@ -0,0 +1,91 @@
+/* !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * CAUTION:
+ * Due to instantiation issues the method implementation is stored in
+ * a .tpp-file (not .cpp)
+ * For more information, see
+ * https://stackoverflow.com/questions/8752837/undefined-reference-to-template-class-constructor
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ */
+
+#ifndef SOLUTION_EVALUATOR_H
+#define SOLUTION_EVALUATOR_H
+
+#include "mesh/ordered_mesh.h"
+#include "modal_transform.h"
+
+#include <armadillo>
+#include <cstddef>
+#include <vector>
+
+namespace DG {
+
+/**
+ * @brief Positions at which the fields are sampled, given by the ordered
+ * index of the element containing each position and the position in the
+ * reference coordinates of that element
+ */
+struct Sampling_points {
+  std::vector<size_t> elems;
+  arma::vec ref_positions;
+};
+
+/**
+ * @brief Evaluate the fields of the DG solution at arbitrary positions,
+ * e.g. for probes or for resampling the output.<br>
+ * The element containing a position is found by a binary search over the
+ * elements of the Ordered_mesh sorted by their left coordinate, such that
+ * regions consisting of several intervals are supported as well. The
+ * fields are then evaluated from their modal coefficients (see
+ * Modal_transform) by the Clenshaw recurrence of the basis (see
+ * Jacobi_basis::get_jacobi_expansion(...)), which runs over all positions
+ * at once without evaluating a single polynomial.<br>
+ * As for the global solution, the columns of the fields are the elements
+ * in the order of the Ordered_mesh.
+ */
+template <class Basis> class Solution_evaluator {
+public:
+  Solution_evaluator(
+      const Mesh::Ordered_mesh &ordered_mesh,
+      const size_t polynomial_order);
+
+  /**
+   * @brief Locate the elements of the given physical positions. For
+   * positions on a face shared by two elements, the right element is
+   * chosen. Since fixed probes are located only once, the result can be
+   * reused in every time step.
+   */
+  Sampling_points locate_positions(const arma::vec &positions) const;
+
+  /// @brief Evaluate nodal fields at located positions
+  arma::vec get_values(
+      const arma::mat &nodal_fields,
+      const Sampling_points &points) const;
+  /// @brief Evaluate nodal fields at physical positions
+  arma::vec get_values(
+      const arma::mat &nodal_fields,
+      const arma::vec &positions) const;
+
+  /// @brief Evaluate modal fields at located positions
+  arma::vec get_values_from_modal(
+      const arma::mat &modal_fields,
+      const Sampling_points &points) const;
+
+private:
+  const Basis basis;
+  const size_t polynomial_order;
+  const Modal_transform<Basis> modal_transform;
+
+  /// @brief Element coordinates in ascending order of the left coordinate
+  std::vector<double> left_coords;
+  std::vector<double> right_coords;
+  /// @brief Ordered index of the elements in left_coords
+  std::vector<size_t> elems;
+
+  /// @brief Number of positions evaluated at once
+  static constexpr size_t block_size{256};
+};
+} // namespace DG
+
+#include "solution_evaluator.tpp"
+
+#endif
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace DG {
+
+template <class Basis>
+Solution_evaluator<Basis>::Solution_evaluator(
+    const Mesh::Ordered_mesh &ordered_mesh,
+    const size_t _polynomial_order)
+    : polynomial_order{_polynomial_order},
+      modal_transform(_polynomial_order) {
+
+  const size_t num_elems{ordered_mesh.elem_coords.size() / 2};
+  this->elems.resize(num_elems);
+  std::iota(this->elems.begin(), this->elems.end(), 0);
+  std::sort(
+      this->elems.begin(),
+      this->elems.end(),
+      [&ordered_mesh](const size_t lhs, const size_t rhs) {
+        return ordered_mesh.elem_coords[2 * lhs] <
+               ordered_mesh.elem_coords[2 * rhs];
+      });
+
+  for (const auto elem : this->elems) {
+    this->left_coords.push_back(ordered_mesh.elem_coords[2 * elem]);
+    this->right_coords.push_back(ordered_mesh.elem_coords[2 * elem + 1]);
+  }
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+Sampling_points Solution_evaluator<Basis>::locate_positions(
+    const arma::vec &positions) const {
+
+  Sampling_points points;
+  points.elems.reserve(positions.n_elem);
+  points.ref_positions.set_size(positions.n_elem);
+
+  for (size_t i{0}; i < positions.n_elem; ++i) {
+    const double position{positions[i]};
+    // Last element whose left coordinate is not larger than the position
+    const size_t elem{size_t(
+        std::upper_bound(
+            this->left_coords.begin(), this->left_coords.end(), position) -
+        this->left_coords.begin())};
+
+    if (elem == 0 || position > this->right_coords[elem - 1]) {
+      throw std::invalid_argument(
+          std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+          ": "
+          "The position " +
+          std::to_string(position) + " is not inside the mesh.");
+    }
+
+    const double left{this->left_coords[elem - 1]};
+    const double right{this->right_coords[elem - 1]};
+    points.elems.push_back(this->elems[elem - 1]);
+    points.ref_positions[i] = std::clamp(
+        2. * (position - left) / (right - left) - 1., -1., 1.);
+  }
+
+  return points;
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::vec Solution_evaluator<Basis>::get_values(
+    const arma::mat &nodal_fields,
+    const Sampling_points &points) const {
+
+  return this->get_values_from_modal(
+      this->modal_transform.get_modal_fields(nodal_fields), points);
+}
+//----
+template <class Basis>
+arma::vec Solution_evaluator<Basis>::get_values(
+    const arma::mat &nodal_fields,
+    const arma::vec &positions) const {
+
+  return this->get_values(nodal_fields, this->locate_positions(positions));
+}
+//-------------------------------------------------------------------------
+template <class Basis>
+arma::vec Solution_evaluator<Basis>::get_values_from_modal(
+    const arma::mat &modal_fields,
+    const Sampling_points &points) const {
+
+  if (modal_fields.n_rows != this->polynomial_order + 1) {
+    throw std::invalid_argument(
+        std::string{} + __FILE__ + ":" + std::to_string(__LINE__) +
+        ": "
+        "The number of modes does not match the polynomial order.");
+  }
+
+  // The coefficients of each position are gathered block-wise, such that
+  // the recurrence runs over contiguous arrays of the positions which stay
+  // in cache
+  const size_t num_points{points.elems.size()};
+  const size_t num_modes{modal_fields.n_rows};
+  arma::vec values(num_points);
+  arma::mat coefficients;
+  for (size_t first{0}; first < num_points; first += this->block_size) {
+    const size_t last{std::min(first + this->block_size, num_points) - 1};
+    coefficients.set_size(last - first + 1, num_modes);
+    for (size_t i{first}; i <= last; ++i) {
+      const double *modes{modal_fields.colptr(points.elems[i])};
+      for (size_t k{0}; k < num_modes; ++k) {
+        coefficients.at(i - first, k) = modes[k];
+      }
+    }
+
+    values.subvec(first, last) = this->basis.get_polynomial_expansion(
+        coefficients, points.ref_positions.subvec(first, last));
+  }
+
+  return values;
+}
+} // namespace DG
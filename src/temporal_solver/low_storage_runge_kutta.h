@@ -7,6 +7,16 @@
 #include <vector>
 
 namespace TD {
+
+/**
+ * @brief Buffers of Low_storage_runge_kutta::evolve_in_place(...), i.e.
+ * the low-storage register and the right-hand side of the stages
+ */
+struct Stage_buffers {
+  arma::mat interim_result;
+  arma::mat rhs;
+};
+
 class Low_storage_runge_kutta {
 
 public:
@@ -18,6 +28,24 @@ public:
       const double time,
       const double dt) const;
 
+  /**
+   * @brief Allocation-free counterpart of evolve_in_time(...), which
+   * evolves the solution in place. The ODE writes its right-hand side into
+   * the given matrix, i.e. it is called as ode(u, t, rhs). The ODE is a
+   * template parameter instead of a std::function, such that a lambda
+   * capturing its state is not copied to the heap.
+   *
+   * @param[in,out] buffers Stage buffers owned by the caller, which are
+   * sized on the first call
+   */
+  template <typename Ode>
+  void evolve_in_place(
+      const Ode &ode,
+      arma::mat &solution,
+      const double time,
+      const double dt,
+      Stage_buffers &buffers) const;
+
   std::tuple<std::vector<double>, std::vector<double>, std::vector<double>>
   get_butcher_coeffs(const size_t order, const size_t num_stages) const;
 
@@ -31,4 +59,6 @@ private:
 };
 } // namespace TD
 
+#include "low_storage_runge_kutta.tpp"
+
 #endif
@@ -0,0 +1,26 @@
+namespace TD {
+
+template <typename Ode>
+void Low_storage_runge_kutta::evolve_in_place(
+    const Ode &ode,
+    arma::mat &solution,
+    const double time,
+    const double dt,
+    Stage_buffers &buffers) const {
+
+  const auto &[butcher_coeff1, butcher_coeff2, butcher_coeff3] =
+      this->butcher_coeffs;
+
+  buffers.interim_result.zeros(solution.n_rows, solution.n_cols);
+  buffers.rhs.set_size(solution.n_rows, solution.n_cols);
+
+  for (size_t stage(0); stage < this->num_stages; ++stage) {
+    const double interim_time(time + dt * butcher_coeff3[stage]);
+
+    buffers.interim_result *= butcher_coeff1[stage];
+    ode(solution, interim_time, buffers.rhs);
+    buffers.interim_result += dt * buffers.rhs;
+    solution += butcher_coeff2[stage] * buffers.interim_result;
+  }
+}
+} // namespace TD
@@ -16,15 +16,48 @@ class Input {
       pt::read_json(json_filename, root);
 
       end_time = root.get<double>("end_time");
+      // Optional, zero means all hardware threads
+      mesh_import_threads = root.get<size_t>("mesh_import_threads", 1);
+      // Optional, store the preprocessed mesh next to the mesh file
+      mesh_cache = root.get<bool>("mesh_cache", false);
+      // Optional, DG kernels instantiated for the polynomial order
+      fixed_order_kernels = root.get<bool>("fixed_order_kernels", true);
+      // Optional, store the modal coefficients of the fields as well
+      modal_output = root.get<bool>("modal_output", false);
+      // Optional, pairs of contour names with periodic boundaries
+      const pt::ptree no_periodic_contours;
+      for (auto &&contour_tree :
+           root.get_child("periodic_contours", no_periodic_contours)) {
+        std::vector<std::string> contour_names;
+        for (auto &&name_tree : contour_tree.second) {
+          contour_names.push_back(name_tree.second.get_value<std::string>());
+        }
+        if (contour_names.size() != 2) {
+          throw std::invalid_argument(
+              "Periodic contours need to be given as pairs of names.");
+        }
+        periodic_contours.emplace_back(contour_names[0], contour_names[1]);
+      }
       for (auto &&region_tree : root.get_child("regions")) {
         const pt::ptree &region_params = region_tree.second;
 
+        region_names.push_back(region_params.get<std::string>("name"));
         pde_name = region_params.get<std::string>("pde");
         polynomial_order = region_params.get<size_t>("polynomial_order");
+        // Optional, "gauss_lobatto" or "gauss" quadrature nodes
+        basis = region_params.get<std::string>("basis", "gauss_lobatto");
         runge_kutta_order = region_params.get<size_t>("runge_kutta_order");
         runge_kutta_stages =
         region_params.get<size_t>("runge_kutta_stages");
         dt_factor = region_params.get<double>("dt_factor");
+        // Optional, "central", "upwind", "lax_friedrichs" or "hll", where
+        // the systems default to their local Lax-Friedrichs flux (see
+        // Conservation_system)
+        numerical_flux = region_params.get<std::string>(
+            "numerical_flux",
+            pde_name == "advection" ? "upwind" : "lax_friedrichs");
+        // Full upwinding, unless the parameters of the PDE state otherwise
+        upwind_param = 1.;
 
         if (pde_name == "advection") {
           for (auto &&param_tree : region_params.get_child("parameters")) {
@@ -33,18 +66,53 @@ class Input {
                 pde_params.get<double>("advection_speed"));
             upwind_param = pde_params.get<double>("upwind_param");
           }
+        } else if (pde_name == "maxwell") {
+          // Two material parameters per region
+          for (auto &&param_tree : region_params.get_child("parameters")) {
+            const pt::ptree &pde_params = param_tree.second;
+            material_params.push_back(
+                pde_params.get<double>("permittivity"));
+            material_params.push_back(
+                pde_params.get<double>("permeability"));
+            upwind_param = pde_params.get<double>("upwind_param", 1.);
+          }
+        } else if (pde_name == "shallow_water") {
+          for (auto &&param_tree : region_params.get_child("parameters")) {
+            const pt::ptree &pde_params = param_tree.second;
+            // Optional, gravitational acceleration
+            material_params.push_back(
+                pde_params.get<double>("gravity", 9.81));
+            upwind_param = pde_params.get<double>("upwind_param", 1.);
+          }
+        } else if (pde_name == "burgers") {
+          // Optional, since Burgers' equation has no parameter
+          const pt::ptree no_params;
+          for (auto &&param_tree :
+               region_params.get_child("parameters", no_params)) {
+            upwind_param =
+                param_tree.second.get<double>("upwind_param", 1.);
+          }
         }
       }
     };
 
     std::string pde_name;
     size_t polynomial_order;
+    std::string basis;
     size_t runge_kutta_order;
     size_t runge_kutta_stages;
     double dt_factor;
+    std::string numerical_flux;
     double end_time;
+    size_t mesh_import_threads;
+    bool mesh_cache;
+    bool fixed_order_kernels;
+    bool modal_output;
+    std::vector<std::pair<std::string, std::string>> periodic_contours;
     double upwind_param;
     std::vector<double> material_params;
+    /// @brief Names of the regions in the order of the input
+    std::vector<std::string> region_names;
 };
 
 #endif
@@ -0,0 +1,68 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Import {
+
+/**
+ * @brief Read-only memory mapping of an entire file. The file content is
+ * accessed in place, so that parsing a file does not require copying it
+ * into stream buffers or strings first. The mapping is released on
+ * destruction.
+ */
+class Mapped_file {
+public:
+  Mapped_file(const std::string &filename) {
+
+    const int file_descriptor{::open(filename.c_str(), O_RDONLY)};
+    struct stat file_status;
+    if (file_descriptor < 0 || ::fstat(file_descriptor, &file_status) < 0) {
+      if (file_descriptor >= 0)
+        ::close(file_descriptor);
+      throw std::ifstream::failure(
+          "Error loading file '" + filename + "'.");
+    }
+
+    file_size = static_cast<size_t>(file_status.st_size);
+    if (file_size > 0) {
+      void *mapping{::mmap(
+          nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0)};
+      if (mapping == MAP_FAILED) {
+        ::close(file_descriptor);
+        throw std::ifstream::failure(
+            "Error mapping file '" + filename + "'.");
+      }
+      ::madvise(mapping, file_size, MADV_SEQUENTIAL);
+      file_data = static_cast<const char *>(mapping);
+    }
+    ::close(file_descriptor);
+  };
+
+  Mapped_file(const Mapped_file &) = delete;
+  Mapped_file &operator=(const Mapped_file &) = delete;
+
+  ~Mapped_file() {
+    if (file_data != nullptr)
+      ::munmap(const_cast<char *>(file_data), file_size);
+  };
+
+  inline const char *begin() const { return file_data; };
+  inline const char *end() const { return file_data + file_size; };
+  inline size_t size() const { return file_size; };
+  inline std::string_view view() const { return {file_data, file_size}; };
+
+private:
+  const char *file_data{nullptr};
+  size_t file_size{0};
+};
+} // namespace Import
+#endif
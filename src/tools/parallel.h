@@ -0,0 +1,67 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Parallel {
+
+/**
+ * @brief Get the number of threads to use for a requested number, where
+ * zero requests all hardware threads
+ */
+inline size_t get_num_threads(const size_t requested_threads) {
+  if (requested_threads == 0) {
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+  return requested_threads;
+}
+
+/**
+ * @brief Run task(0), ..., task(num_tasks-1) on a pool of num_threads
+ * worker threads. The workers take the next task from a shared counter,
+ * so that tasks of different size are balanced. Tasks are independent of
+ * each other, i.e. they must only write to disjoint memory.<br>
+ * If tasks throw, the exception of the task with the smallest index is
+ * rethrown after all workers have finished. This way, errors are reported
+ * as if the tasks had been run in order.
+ */
+template <typename Task>
+void run_tasks(const size_t num_tasks, const size_t num_threads, Task task) {
+
+  std::vector<std::exception_ptr> exceptions(num_tasks);
+  std::atomic<size_t> next_task{0};
+
+  auto worker = [&]() {
+    for (size_t task_idx{next_task++}; task_idx < num_tasks;
+         task_idx = next_task++) {
+      try {
+        task(task_idx);
+      } catch (...) {
+        exceptions[task_idx] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  const size_t num_workers{std::min(num_threads, num_tasks)};
+  for (size_t n{1}; n < num_workers; ++n) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : workers) {
+    thread.join();
+  }
+
+  for (const auto &exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+} // namespace Parallel
+#endif
@@ -0,0 +1,197 @@
+#ifndef TOKEN_READER_H
+#define TOKEN_READER_H
+
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Import {
+
+/**
+ * @brief Tokenize a character range in place. Contrary to the stream based
+ * methods in import.h, no line is copied and no stream is constructed;
+ * numbers are converted by std::from_chars, which is locale independent
+ * and does not allocate. The reader keeps track of the current line
+ * number, so that errors can be reported with their position in the
+ * file.
+ */
+class Token_reader {
+public:
+  Token_reader(const char *_begin, const char *_end)
+      : begin{_begin}, position{_begin}, end{_end} {};
+  Token_reader(const std::string_view text, const size_t _line_number = 1)
+      : begin{text.data()}, position{text.data()},
+        end{text.data() + text.size()}, line_number{_line_number} {};
+
+  /**
+   * @brief Read the next whitespace separated entry, which may be on one
+   * of the following lines.
+   *
+   * Integer entries written as floating point numbers (e.g. "2.0") are
+   * accepted and converted, since Gmsh is not consistent in that regard
+   * (see Import_mesh_data::import_gmsh_entities()).
+   */
+  template <typename T> T next() {
+    this->skip_whitespace();
+
+    T value{};
+    const char *token_end{this->parse(value)};
+    if (token_end == this->position) {
+      throw std::invalid_argument(
+          "Could not convert entry '" + std::string(this->peek_word()) +
+          "' (line " + std::to_string(this->line_number) + ")");
+    }
+    this->position = token_end;
+    return value;
+  };
+
+  /// @brief Read the next whitespace separated entry as a word
+  std::string_view next_word() {
+    this->skip_whitespace();
+    const std::string_view word{this->peek_word()};
+    this->position += word.size();
+    return word;
+  };
+
+  /// @brief Read the remainder of the current line without the line break
+  std::string_view next_line() {
+    const char *line_end{this->find_line_end()};
+    if (line_end == this->position && line_end != this->end) {
+      this->register_empty_line();
+    }
+    std::string_view line{this->position, size_t(line_end - this->position)};
+    if (!line.empty() && line.back() == '\r')
+      line.remove_suffix(1);
+
+    this->position = line_end;
+    if (this->position != this->end) {
+      ++this->position;
+      ++this->line_number;
+    }
+    return line;
+  };
+
+  /// @brief Skip the remainder of the current line and num_lines-1 more
+  void skip_lines(const size_t num_lines = 1) {
+    for (size_t n{0}; n < num_lines; ++n) {
+      this->next_line();
+    }
+  };
+
+  /// @brief Check whether there is another entry left to read
+  bool has_next() {
+    this->skip_whitespace();
+    return !this->is_at_end();
+  };
+
+  /**
+   * @brief Continue reading at a given position, e.g. behind data which
+   * has been read in binary. Line numbers are not updated.
+   */
+  inline void set_position(const char *_position) {
+    this->position = _position;
+  };
+
+  inline bool is_at_end() const { return this->position == this->end; };
+  inline const char *get_position() const { return this->position; };
+  inline size_t get_line_number() const { return this->line_number; };
+
+  /**
+   * @brief Get the number of the first empty line passed so far, or zero
+   * if there was none. Empty lines do not disturb the tokenization, but
+   * Gmsh files must not contain them (see Gmsh_reader).
+   */
+  inline size_t get_first_empty_line() const {
+    return this->first_empty_line;
+  };
+
+private:
+  const char *const begin;
+  const char *position;
+  const char *const end;
+  size_t line_number{1};
+  size_t first_empty_line{0};
+
+  /// @brief Record the current line if the position is at its beginning
+  inline void register_empty_line() {
+    if (this->first_empty_line == 0 &&
+        (this->position == this->begin || *(this->position - 1) == '\n')) {
+      this->first_empty_line = this->line_number;
+    }
+  };
+
+  void skip_whitespace() {
+    for (; this->position != this->end; ++this->position) {
+      const char c{*this->position};
+      if (c == '\n') {
+        this->register_empty_line();
+        ++this->line_number;
+      } else if (c != ' ' && c != '\t' && c != '\r') {
+        break;
+      }
+    }
+  };
+
+  std::string_view peek_word() const {
+    const char *word_end{this->position};
+    while (word_end != this->end && !is_whitespace(*word_end))
+      ++word_end;
+    return {this->position, size_t(word_end - this->position)};
+  };
+
+  /// @brief std::isspace is undefined for negative values of a char
+  static inline bool is_whitespace(const char c) {
+    return std::isspace(static_cast<unsigned char>(c));
+  };
+
+  const char *find_line_end() const {
+    const void *line_end{std::memchr(
+        this->position, '\n', size_t(this->end - this->position))};
+    return line_end ? static_cast<const char *>(line_end) : this->end;
+  };
+
+  /**
+   * @brief Convert the entry at the current position, or return the
+   * current position if the entry is not entirely a value of type T, e.g.
+   * "12abc", or "3.7" for an integer
+   */
+  template <typename T> const char *parse(T &value) const {
+    auto [token_end, error] =
+        std::from_chars(this->position, this->end, value);
+    if (error != std::errc())
+      return this->position;
+
+    if constexpr (std::is_integral_v<T>) {
+      if (token_end != this->end &&
+          (*token_end == '.' || *token_end == 'e' || *token_end == 'E')) {
+        double floating_value;
+        const std::from_chars_result floating_result{
+            std::from_chars(this->position, this->end, floating_value)};
+        token_end = floating_result.ptr;
+        // The range is checked before the conversion, which is undefined
+        // for values that T cannot represent
+        if (floating_result.ec != std::errc() ||
+            floating_value != std::trunc(floating_value) ||
+            floating_value <
+                static_cast<double>(std::numeric_limits<T>::min()) ||
+            floating_value >=
+                std::ldexp(1., std::numeric_limits<T>::digits)) {
+          return this->position;
+        }
+        value = static_cast<T>(floating_value);
+      }
+    }
+    if (token_end != this->end && !is_whitespace(*token_end))
+      return this->position;
+    return token_end;
+  };
+};
+} // namespace Import
+#endif
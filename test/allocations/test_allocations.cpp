@@ -0,0 +1,151 @@
+#define BOOST_TEST_MODULE test_allocations
+#include "../../src/pde/maxwell.h"
+#include "../../src/temporal_solver/low_storage_runge_kutta.h"
+#include "../src/pde/periodic_scheme.h"
+#include "../src/pde/uniform_interval.h"
+
+#include <atomic>
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <new>
+
+/**
+ * The heap allocations of this test executable are counted by replacing
+ * all global allocation functions, i.e. operator new and new[] with and
+ * without alignment, and by wrapping posix_memalign, which Armadillo uses
+ * for all matrices beyond its small local storage. The latter relies on
+ * the dynamic linker of glibc, hence these tests do not share the
+ * executable of the other tests.
+ */
+namespace {
+std::atomic<size_t> num_allocations{0};
+
+void *allocate(const std::size_t size) {
+  ++num_allocations;
+  // Zero bytes still need a unique address
+  if (void *memory{std::malloc(size > 0 ? size : 1)}) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void *allocate(const std::size_t size, const std::align_val_t alignment) {
+  ++num_allocations;
+  // The size of aligned_alloc is a multiple of the alignment
+  const auto align{static_cast<std::size_t>(alignment)};
+  const std::size_t aligned_size{(size + align - 1) / align * align};
+  if (void *memory{std::aligned_alloc(align, aligned_size)}) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+} // namespace
+
+void *operator new(std::size_t size) { return allocate(size); }
+
+void *operator new[](std::size_t size) { return allocate(size); }
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, alignment);
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete[](void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](
+    void *memory, std::size_t, std::align_val_t) noexcept {
+  std::free(memory);
+}
+
+extern "C" int
+posix_memalign(void **memory, size_t alignment, size_t size) noexcept {
+  ++num_allocations;
+  using Posix_memalign = int (*)(void **, size_t, size_t);
+  static const auto next_posix_memalign{
+      reinterpret_cast<Posix_memalign>(dlsym(RTLD_NEXT, "posix_memalign"))};
+  return next_posix_memalign(memory, alignment, size);
+}
+
+BOOST_AUTO_TEST_SUITE(scheme_workspace);
+
+BOOST_AUTO_TEST_CASE(allocation_free_time_step) {
+  const size_t allocations_before{num_allocations};
+  const arma::mat large_matrix(100, 100);
+  BOOST_TEST_REQUIRE(num_allocations > allocations_before);
+
+  const TD::Low_storage_runge_kutta lsrk(4, 5);
+  for (auto &scheme : get_schemes()) {
+    auto ode = [&scheme](const arma::mat &u, const double t, arma::mat &rhs) {
+      scheme->write(u, t, rhs);
+    };
+    TD::Stage_buffers buffers;
+    const double dt{1e-3};
+
+    // The first step sizes the workspace and the stage buffers
+    lsrk.evolve_in_place(ode, scheme->fields, 0., dt, buffers);
+
+    const size_t steady_state_allocations{num_allocations};
+    for (size_t step{1}; step < 4; ++step) {
+      lsrk.evolve_in_place(ode, scheme->fields, step * dt, dt, buffers);
+    }
+    const size_t num_step_allocations{
+        num_allocations - steady_state_allocations};
+    BOOST_TEST_CONTEXT(
+        "polynomial order " << scheme->interval.operators->nodes.n_elem - 1) {
+      BOOST_TEST(num_step_allocations == 0);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(allocation_free_maxwell_time_step) {
+  const Uniform_interval interval(6, 9, false);
+  const Maxwell maxwell(2., 1., 1.);
+  arma::arma_rng::set_seed(interval.operators->nodes.n_elem);
+  arma::mat fields(
+      interval.operators->nodes.n_elem,
+      2 * interval.num_elems,
+      arma::fill::randn);
+
+  Scheme_workspace workspace;
+  auto ode = [&](const arma::mat &u, const double t, arma::mat &rhs) {
+    interval.write_spatial_scheme(maxwell, u, t, workspace, rhs);
+  };
+  const TD::Low_storage_runge_kutta lsrk(4, 5);
+  TD::Stage_buffers buffers;
+  const double dt{1e-3};
+  lsrk.evolve_in_place(ode, fields, 0., dt, buffers);
+
+  const size_t steady_state_allocations{num_allocations};
+  for (size_t step{1}; step < 4; ++step) {
+    lsrk.evolve_in_place(ode, fields, step * dt, dt, buffers);
+  }
+  BOOST_TEST(num_allocations - steady_state_allocations == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
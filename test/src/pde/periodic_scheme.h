@@ -0,0 +1,66 @@
+#ifndef PERIODIC_SCHEME_H
+#define PERIODIC_SCHEME_H
+
+#include "../../../src/pde/advection.h"
+#include "../../../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
+#include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../src/spatial_solver/reference_operators.h"
+#include "uniform_interval.h"
+
+#include <armadillo>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+/// Advection on a periodic interval of elements of different sizes
+struct Periodic_scheme {
+  Periodic_scheme(
+      const std::shared_ptr<const DG::Reference_operators> &operators,
+      const size_t num_elems,
+      const bool use_kernels)
+      : interval(operators, num_elems, true), advection(2 * M_PI, 0.8) {
+
+    advection.use_fixed_order_kernels(use_kernels);
+    advection.use_even_odd_diff_matrix(operators->even_odd_diff_matrix);
+    if (!operators->has_face_nodes) {
+      advection.use_face_interpolation(operators->face_interpolation_matrix);
+    }
+
+    for (size_t elem{0}; elem < num_elems; ++elem) {
+      interval.geo_factors[elem] = 1. + 0.1 * elem;
+    }
+    arma::arma_rng::set_seed(operators->nodes.n_elem);
+    fields.randn(operators->nodes.n_elem, num_elems);
+  };
+
+  void write(const arma::mat &u, const double t, arma::mat &rhs) {
+    interval.write_spatial_scheme(advection, u, t, workspace, rhs);
+  };
+
+  Uniform_interval interval;
+  Advection advection;
+  arma::mat fields;
+  Scheme_workspace workspace;
+};
+
+/// Schemes of all paths of the spatial scheme of Static_pde
+inline std::vector<std::unique_ptr<Periodic_scheme>> get_schemes() {
+  std::vector<std::unique_ptr<Periodic_scheme>> schemes;
+  // Fixed-order kernel, generic dense and even-odd products, and face
+  // interpolation
+  for (const bool use_kernels : {true, false}) {
+    schemes.push_back(std::make_unique<Periodic_scheme>(
+        DG::Operator_registry<DG::Legendre_basis>::get_operators(4),
+        9,
+        use_kernels));
+  }
+  schemes.push_back(std::make_unique<Periodic_scheme>(
+      DG::Operator_registry<DG::Legendre_basis>::get_operators(20), 9, true));
+  schemes.push_back(std::make_unique<Periodic_scheme>(
+      DG::Operator_registry<DG::Gauss_legendre_basis>::get_operators(5),
+      9,
+      true));
+  return schemes;
+}
+
+#endif
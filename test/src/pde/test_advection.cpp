@@ -110,6 +110,46 @@ BOOST_AUTO_TEST_CASE(field_name) {
   BOOST_TEST(field_name == "Advection");
 }
 
+BOOST_AUTO_TEST_CASE(even_odd_volume_fields) {
+  const arma::mat diff_matrix{
+      {-1.5, 2., -0.5}, {-0.5, 0., 0.5}, {0.5, -2., 1.5}};
+  const arma::mat fields{{0, 2, 1}, {5, 13, -1}, {3, -4, 7}};
+  const std::vector<double> geo_factors{1., 2., 0.5};
+
+  Advection even_odd_advection(2 * M_PI, upwind_param);
+  even_odd_advection.use_even_odd_diff_matrix(
+      std::make_shared<const DG::Even_odd_matrix>(diff_matrix));
+
+  const arma::mat dense(
+      advection.get_volume_fields(fields, geo_factors, diff_matrix));
+  const arma::mat even_odd(
+      even_odd_advection.get_volume_fields(fields, geo_factors, diff_matrix));
+  BOOST_TEST(arma::approx_equal(even_odd, dense, "absdiff", 1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(interpolated_field_jumps, *utf::tolerance(1e-15)) {
+  // Linear fields on two nodes per element which are interpolated to the
+  // element faces at -1 and 1 by averaging and extrapolating
+  const arma::mat face_interpolation{{1.5, -0.5}, {-0.5, 1.5}};
+  const arma::mat fields{{1, 3}, {2, 4}};
+  const std::vector<double> geo_factors{1., 1.};
+  const arma::mat lift_matrix{{1, 0}, {0, 1}};
+
+  Advection interpolating_advection(2 * M_PI, 0.);
+  interpolating_advection.use_face_interpolation(face_interpolation);
+
+  // Face values are 0.5 and 2.5 in the first, 2.5 and 4.5 in the second
+  // element, such that only the boundary faces contribute
+  const arma::mat surface_fields(interpolating_advection.get_surface_fields(
+      fields, 0.25, geo_factors, lift_matrix));
+  const auto [left_bc, right_bc] =
+      interpolating_advection.get_boundary_conditions(fields, 0.25);
+  BOOST_TEST(surface_fields(0, 0) == -M_PI * (0.5 - left_bc));
+  BOOST_TEST(surface_fields(1, 0) == 0.);
+  BOOST_TEST(surface_fields(0, 1) == 0.);
+  BOOST_TEST(surface_fields(1, 1) == M_PI * right_bc);
+}
+
 /**
  * get_surface_fields(...) is tested in test_dgtd_solver.cpp by testing
  * get_spatial_scheme(...)
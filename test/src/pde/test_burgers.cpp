@@ -0,0 +1,63 @@
+#include "../../../src/pde/burgers.h"
+#include "uniform_interval.h"
+
+#include <boost/test/unit_test.hpp>
+
+static_assert(System_pde<Burgers>);
+static_assert(!Linear_system_pde<Burgers>);
+
+BOOST_AUTO_TEST_SUITE(burgers);
+
+BOOST_AUTO_TEST_CASE(pointwise_functions) {
+  const Burgers burgers(1.);
+  BOOST_TEST(burgers.get_pointwise_flux({-3.}).front() == 4.5);
+  BOOST_TEST(burgers.get_wave_speed({-3.}) == 3.);
+  BOOST_TEST(burgers.get_boundary_state({2.}, 0.5, -1.).front() == 2.);
+}
+
+BOOST_AUTO_TEST_CASE(max_wave_speed) {
+  const Burgers burgers(1.);
+  const arma::mat fields{{0.5, -2.}, {1.5, 0.25}};
+  BOOST_TEST(burgers.get_max_wave_speed(fields) == 2.);
+}
+
+/// \f$\partial_t u = -u\,\partial_x u\f$ for the smooth initial values
+BOOST_AUTO_TEST_CASE(smooth_solution) {
+  const Uniform_interval interval(8, 10, true);
+  Burgers burgers(1.);
+  const arma::mat fields{burgers.get_initial_values(interval.node_coords)};
+  const arma::mat exact_scheme{
+      -fields % (0.5 * arma::cos(interval.node_coords))};
+
+  for (const bool use_kernels : {true, false}) {
+    burgers.use_fixed_order_kernels(use_kernels);
+    const arma::mat spatial_scheme{
+        interval.get_spatial_scheme(burgers, fields)};
+    BOOST_TEST(
+        arma::approx_equal(spatial_scheme, exact_scheme, "absdiff", 1e-6));
+  }
+}
+
+/**
+ * The integral of a periodic solution is conserved, since the numerical
+ * flux is evaluated once per interface
+ */
+BOOST_AUTO_TEST_CASE(conservation) {
+  const Uniform_interval interval(5, 7, true);
+  const Burgers burgers(0.6);
+  arma::arma_rng::set_seed(11);
+  const arma::mat fields(
+      interval.operators->nodes.n_elem, interval.num_elems, arma::fill::randn);
+
+  const arma::mat spatial_scheme{
+      interval.get_spatial_scheme(burgers, fields)};
+  const arma::mat mass_matrix{interval.get_mass_matrix()};
+  double integral_rate{0.};
+  for (size_t elem{0}; elem < interval.num_elems; ++elem) {
+    integral_rate += arma::accu(mass_matrix * spatial_scheme.col(elem)) /
+                     interval.geo_factors[elem];
+  }
+  BOOST_TEST(std::abs(integral_rate) < 1e-12);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
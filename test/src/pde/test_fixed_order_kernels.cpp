@@ -0,0 +1,58 @@
+#include "../../../src/pde/advection.h"
+#include "../../../src/pde/fixed_order_kernels.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_SUITE(fixed_order_kernels);
+
+BOOST_AUTO_TEST_CASE(dispatch_table) {
+  BOOST_TEST(DG::Kernels::get_volume_kernel(0) == nullptr);
+  BOOST_TEST(DG::Kernels::get_lift_kernel(0) == nullptr);
+  for (size_t order{1}; order <= DG::Kernels::max_fixed_order; ++order) {
+    BOOST_TEST(DG::Kernels::get_volume_kernel(order) != nullptr);
+    BOOST_TEST(DG::Kernels::get_lift_kernel(order) != nullptr);
+    BOOST_TEST(DG::Kernels::get_fused_kernel(order) != nullptr);
+  }
+  BOOST_TEST(DG::Kernels::get_fused_kernel(0) == nullptr);
+  BOOST_TEST(
+      DG::Kernels::get_fused_kernel(DG::Kernels::max_fixed_order + 1) ==
+      nullptr);
+  BOOST_TEST(
+      DG::Kernels::get_volume_kernel(DG::Kernels::max_fixed_order + 1) ==
+      nullptr);
+  BOOST_TEST(
+      DG::Kernels::get_volume_kernel(3) ==
+      &DG::Kernels::apply_volume_kernel<3>);
+}
+
+BOOST_AUTO_TEST_CASE(kernels_match_generic_path) {
+  const double upwind_param(0.7);
+  Advection generic(2 * M_PI, upwind_param);
+  Advection fixed(2 * M_PI, upwind_param);
+  fixed.use_fixed_order_kernels(true);
+
+  const size_t num_elems{5};
+  const std::vector<double> geo_factors{0.5, 2., 1.5, 3., 0.25};
+
+  // The highest order takes the generic path in both cases
+  for (size_t order{1}; order <= DG::Kernels::max_fixed_order + 1;
+       ++order) {
+    arma::arma_rng::set_seed(order);
+    const arma::mat fields(order + 1, num_elems, arma::fill::randu);
+    const arma::mat diff_matrix(order + 1, order + 1, arma::fill::randn);
+    const arma::mat lift_matrix(order + 1, 2, arma::fill::randn);
+
+    const arma::mat generic_scheme(generic.get_spatial_scheme(
+        fields, 0.3, geo_factors, diff_matrix, lift_matrix));
+    const arma::mat fixed_scheme(fixed.get_spatial_scheme(
+        fields, 0.3, geo_factors, diff_matrix, lift_matrix));
+
+    BOOST_TEST(
+        arma::approx_equal(fixed_scheme, generic_scheme, "absdiff", 1e-12));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,311 @@
+#include "../../../src/pde/advection.h"
+#include "../../../src/pde/maxwell.h"
+#include "../../../src/spatial_solver/mesh/mesh_generator.h"
+#include "../../../src/spatial_solver/mesh/process_mesh_data.h"
+#include "../../../src/temporal_solver/low_storage_runge_kutta.h"
+#include "uniform_interval.h"
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace utf = boost::unit_test;
+
+static_assert(Linear_system_pde<Maxwell>);
+
+BOOST_AUTO_TEST_SUITE(maxwell);
+
+BOOST_AUTO_TEST_CASE(invalid_material) {
+  BOOST_CHECK_THROW(Maxwell(0., 1., 1.), std::invalid_argument);
+  BOOST_CHECK_THROW(Maxwell(1., -1., 1.), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(pointwise_functions, *utf::tolerance(1e-15)) {
+  const Maxwell maxwell(4., 0.25, 1.);
+  const std::array<double, 2> flux{maxwell.get_pointwise_flux({2., 3.})};
+  BOOST_TEST(flux[0] == 0.75);
+  BOOST_TEST(flux[1] == 8.);
+  BOOST_TEST(maxwell.get_wave_speed({2., 3.}) == 1.);
+  BOOST_TEST(maxwell.get_max_wave_speed(arma::mat(3, 4)) == 1.);
+}
+
+BOOST_AUTO_TEST_CASE(initial_values) {
+  const Maxwell maxwell(1., 1., 1.);
+  const arma::mat node_coords{{0., 1.}, {0.5, 2.}};
+  const arma::mat initial_values{maxwell.get_initial_values(node_coords)};
+  BOOST_TEST(initial_values.n_cols == 4);
+  BOOST_TEST(
+      arma::approx_equal(
+          initial_values.cols(0, 1), arma::sin(node_coords), "absdiff", 0.));
+  BOOST_TEST(arma::all(arma::vectorise(initial_values.cols(2, 3)) == 0.));
+}
+
+/**
+ * For \f$\varepsilon = \mu = 1\f$, the characteristic variables \f$E \pm
+ * H\f$ are advected with the speeds \f$\pm 1\f$, where the numerical flux
+ * of Maxwell's equations is the upwind flux of both advections
+ */
+BOOST_AUTO_TEST_CASE(characteristic_advection) {
+  const Uniform_interval interval(6, 5, true);
+  for (const double upwind_param : {0., 0.5, 1.}) {
+    const Maxwell maxwell(1., 1., upwind_param);
+    const Advection right_advection(1., upwind_param);
+    const Advection left_advection(-1., upwind_param);
+
+    arma::arma_rng::set_seed(3);
+    const arma::mat fields(
+        interval.operators->nodes.n_elem,
+        2 * interval.num_elems,
+        arma::fill::randn);
+    const arma::mat electric{fields.cols(0, interval.num_elems - 1)};
+    const arma::mat magnetic{
+        fields.cols(interval.num_elems, 2 * interval.num_elems - 1)};
+
+    const arma::mat scheme{interval.get_spatial_scheme(maxwell, fields)};
+    const arma::mat electric_scheme{scheme.cols(0, interval.num_elems - 1)};
+    const arma::mat magnetic_scheme{
+        scheme.cols(interval.num_elems, 2 * interval.num_elems - 1)};
+
+    BOOST_TEST(
+        arma::approx_equal(
+            electric_scheme + magnetic_scheme,
+            interval.get_spatial_scheme(right_advection, electric + magnetic),
+            "absdiff",
+            1e-12));
+    BOOST_TEST(
+        arma::approx_equal(
+            electric_scheme - magnetic_scheme,
+            interval.get_spatial_scheme(left_advection, electric - magnetic),
+            "absdiff",
+            1e-12));
+  }
+}
+
+/// Wave of \f$E = \sin(x)\f$ and \f$H = \sqrt{\varepsilon/\mu} \sin(x)\f$
+BOOST_AUTO_TEST_CASE(travelling_wave) {
+  const Uniform_interval interval(8, 10, true);
+  const double permittivity{2.25};
+  const double permeability{1.};
+  const double speed{1. / std::sqrt(permittivity * permeability)};
+  const Maxwell maxwell(permittivity, permeability, 1.);
+
+  arma::mat fields(interval.node_coords.n_rows, 2 * interval.num_elems);
+  fields.cols(0, interval.num_elems - 1) = arma::sin(interval.node_coords);
+  fields.cols(interval.num_elems, 2 * interval.num_elems - 1) =
+      std::sqrt(permittivity / permeability) *
+      arma::sin(interval.node_coords);
+
+  const arma::mat scheme{interval.get_spatial_scheme(maxwell, fields)};
+  BOOST_TEST(
+      arma::approx_equal(
+          scheme.cols(0, interval.num_elems - 1),
+          -speed * arma::cos(interval.node_coords),
+          "absdiff",
+          1e-6));
+}
+
+/**
+ * The electromagnetic energy \f$\int \varepsilon E^2 + \mu H^2 \,
+ * \mathrm{d}x\f$ inside perfect electric conductors is conserved by the
+ * central flux and dissipated by the upwind flux
+ */
+BOOST_AUTO_TEST_CASE(perfect_electric_conductor) {
+  const Uniform_interval interval(5, 4, false);
+  const double permittivity{2.};
+  const double permeability{0.5};
+
+  arma::arma_rng::set_seed(5);
+  const arma::mat fields(
+      interval.operators->nodes.n_elem,
+      2 * interval.num_elems,
+      arma::fill::randn);
+  const arma::mat mass_matrix{interval.get_mass_matrix()};
+  auto get_energy_rate = [&](const double upwind_param) {
+    const Maxwell maxwell(permittivity, permeability, upwind_param);
+    const arma::mat scheme{interval.get_spatial_scheme(maxwell, fields)};
+    double energy_rate{0.};
+    for (size_t elem{0}; elem < interval.num_elems; ++elem) {
+      const size_t magnetic_col{interval.num_elems + elem};
+      energy_rate +=
+          (permittivity *
+               arma::dot(fields.col(elem), mass_matrix * scheme.col(elem)) +
+           permeability * arma::dot(
+                              fields.col(magnetic_col),
+                              mass_matrix * scheme.col(magnetic_col))) /
+          interval.geo_factors[elem];
+    }
+    return energy_rate;
+  };
+
+  BOOST_TEST(std::abs(get_energy_rate(0.)) < 1e-12);
+  BOOST_TEST(get_energy_rate(1.) < 0.);
+}
+
+/**
+ * A pulse which travels from the vacuum into the dielectric of the
+ * example two_materials.json, with the materials of maxwell.json, is
+ * reflected by \f$R = (Z_2 - Z_1) / (Z_2 + Z_1) = -0.2\f$ and transmitted
+ * by \f$T = 2 Z_2 / (Z_2 + Z_1) = 0.8\f$ with the impedances \f$Z_1 =
+ * 1\f$ and \f$Z_2 = 1/1.5\f$. The transmitted pulse is compressed by the
+ * ratio 1/1.5 of both wave speeds.
+ */
+BOOST_AUTO_TEST_CASE(reflection_and_transmission) {
+  const std::string mesh_name(
+      std::string(DGTD_ROOT) + "/test/examples/maxwell/two_materials.json");
+  const DG::Mesh::Process_mesh_data processed_mesh(
+      mesh_name,
+      DG::Mesh::Mesh_generator(mesh_name).generate_mesh_model(),
+      DG::Mesh::Mesh_section_index());
+  const DG::Mesh::Ordered_mesh &ordered_mesh(
+      processed_mesh.get_ordered_mesh());
+  const size_t num_elems{ordered_mesh.elem_tags.size()};
+  const auto operators{
+      DG::Operator_registry<DG::Legendre_basis>::get_operators(6)};
+  const size_t num_nodes{operators->nodes.n_elem};
+
+  const Maxwell vacuum(1., 1., 1.);
+  const Maxwell dielectric(2.25, 1., 1.);
+  Maxwell maxwell(vacuum);
+  maxwell.use_region_pdes(std::make_shared<const Region_pdes<Maxwell>>(
+      std::vector<Maxwell>{vacuum, dielectric}, ordered_mesh.region_offsets));
+
+  const double reflection{-0.2};
+  const double transmission{0.8};
+  const double dielectric_impedance{1. / 1.5};
+  const double interface{M_PI};
+  auto get_pulse = [](const double x) {
+    return std::exp(-std::pow((x - 0.5 * M_PI) / 0.4, 2));
+  };
+  auto get_fields = [&](const double time) {
+    arma::mat fields(num_nodes, 2 * num_elems);
+    for (size_t elem{0}; elem < num_elems; ++elem) {
+      const double left{ordered_mesh.elem_coords[2 * elem]};
+      const double right{ordered_mesh.elem_coords[2 * elem + 1]};
+      for (size_t node{0}; node < num_nodes; ++node) {
+        const double x{
+            left + 0.5 * (operators->nodes(node) + 1.) * (right - left)};
+        if (x < interface) {
+          const double incident{get_pulse(x - time)};
+          const double reflected{
+              reflection * get_pulse(2 * interface - x - time)};
+          fields(node, elem) = incident + reflected;
+          fields(node, num_elems + elem) = incident - reflected;
+        } else {
+          const double transmitted{
+              transmission *
+              get_pulse(interface + 1.5 * (x - interface) - time)};
+          fields(node, elem) = transmitted;
+          fields(node, num_elems + elem) =
+              transmitted / dielectric_impedance;
+        }
+      }
+    }
+    return fields;
+  };
+
+  const DG::Mesh::Trace_indices trace_indices{
+      processed_mesh.get_face_connectivity().get_trace_indices(num_nodes)};
+  const TD::Low_storage_runge_kutta lsrk(4, 5);
+  Scheme_workspace workspace;
+  TD::Stage_buffers stage_buffers;
+  auto dg_scheme = [&](const arma::mat &u, const double t, arma::mat &rhs) {
+    maxwell.write_spatial_scheme(
+        u,
+        t,
+        ordered_mesh.geo_factors,
+        operators->diff_matrix,
+        operators->lift_matrix,
+        trace_indices,
+        workspace,
+        rhs);
+  };
+
+  // Until the pulse has been split, but before it reaches the boundaries
+  const double end_time{0.5 * M_PI + 1.};
+  const double min_node_dist{
+      (operators->nodes(1) - operators->nodes(0)) * M_PI / 16};
+  const size_t num_steps{
+      static_cast<size_t>(std::ceil(end_time / (0.375 * min_node_dist)))};
+  const double time_step{end_time / num_steps};
+  arma::mat fields{get_fields(0.)};
+  for (size_t step{0}; step < num_steps; ++step) {
+    lsrk.evolve_in_place(
+        dg_scheme, fields, step * time_step, time_step, stage_buffers);
+  }
+
+  BOOST_TEST(
+      arma::approx_equal(fields, get_fields(end_time), "absdiff", 1e-3));
+}
+
+/**
+ * The waves travel at the speeds \f$\pm c\f$, such that the upwind, the
+ * Lax-Friedrichs and the HLL flux coincide, whereas the central flux is
+ * the Lax-Friedrichs flux without upwinding
+ */
+BOOST_AUTO_TEST_CASE(selected_numerical_flux) {
+  using DG::Fluxes::Numerical_flux;
+  const Uniform_interval interval(4, 6, false);
+  arma::arma_rng::set_seed(11);
+  const arma::mat fields(
+      interval.operators->nodes.n_elem,
+      2 * interval.num_elems,
+      arma::fill::randn);
+
+  Maxwell maxwell(2.25, 1., 1.);
+  BOOST_TEST((maxwell.get_numerical_flux() == Numerical_flux::lax_friedrichs));
+  const arma::mat scheme{interval.get_spatial_scheme(maxwell, fields)};
+  for (const auto numerical_flux :
+       {Numerical_flux::upwind, Numerical_flux::hll}) {
+    maxwell.use_numerical_flux(numerical_flux);
+    BOOST_TEST(
+        arma::approx_equal(
+            interval.get_spatial_scheme(maxwell, fields),
+            scheme,
+            "absdiff",
+            1e-12));
+  }
+
+  maxwell.use_numerical_flux(Numerical_flux::central);
+  BOOST_TEST(
+      arma::approx_equal(
+          interval.get_spatial_scheme(maxwell, fields),
+          interval.get_spatial_scheme(Maxwell(2.25, 1., 0.), fields),
+          "absdiff",
+          1e-12));
+  BOOST_TEST(
+      !arma::approx_equal(
+          interval.get_spatial_scheme(maxwell, fields),
+          scheme,
+          "absdiff",
+          1e-6));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_order_kernels_equal_matrix_product) {
+  const Uniform_interval interval(4, 6, false);
+  Maxwell maxwell(1.5, 0.8, 0.7);
+
+  arma::arma_rng::set_seed(7);
+  const arma::mat fields(
+      interval.operators->nodes.n_elem,
+      2 * interval.num_elems,
+      arma::fill::randn);
+  maxwell.use_fixed_order_kernels(true);
+  const arma::mat kernel_scheme{interval.get_spatial_scheme(maxwell, fields)};
+  maxwell.use_fixed_order_kernels(false);
+  const arma::mat product_scheme{interval.get_spatial_scheme(maxwell, fields)};
+
+  BOOST_TEST(
+      arma::approx_equal(kernel_scheme, product_scheme, "absdiff", 1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(fields_without_component_planes) {
+  const Uniform_interval interval(4, 6, true);
+  const Maxwell maxwell(1., 1., 1.);
+  const arma::mat fields(
+      interval.operators->nodes.n_elem, interval.num_elems, arma::fill::ones);
+  BOOST_CHECK_THROW(
+      interval.get_spatial_scheme(maxwell, fields), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
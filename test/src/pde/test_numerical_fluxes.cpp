@@ -0,0 +1,107 @@
+#include "../../../src/pde/advection.h"
+#include "../../../src/pde/burgers.h"
+#include "../../../src/pde/numerical_fluxes.h"
+#include "../../../src/pde/shallow_water.h"
+
+#include <boost/test/unit_test.hpp>
+#include <utility>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+namespace {
+/// Inviscid Burgers flux \f$f(u) = u^2/2\f$
+struct Burgers_flux {
+  inline double get_pointwise_flux(const double value) const {
+    return 0.5 * value * value;
+  };
+  inline double get_wave_speed(const double value) const { return value; };
+};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(numerical_fluxes);
+
+BOOST_AUTO_TEST_CASE(flux_names) {
+  using DG::Fluxes::Numerical_flux;
+  BOOST_TEST(
+      (DG::Fluxes::get_numerical_flux("central") == Numerical_flux::central));
+  BOOST_TEST(
+      (DG::Fluxes::get_numerical_flux("upwind") == Numerical_flux::upwind));
+  BOOST_TEST(
+      (DG::Fluxes::get_numerical_flux("rusanov") ==
+       Numerical_flux::lax_friedrichs));
+  BOOST_TEST((DG::Fluxes::get_numerical_flux("hll") == Numerical_flux::hll));
+  BOOST_CHECK_THROW(
+      DG::Fluxes::get_numerical_flux("roe"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(linear_advection, *utf::tolerance(1e-15)) {
+  // All upwinding fluxes take the value upwind of the interface
+  for (const double speed : {2., -2.}) {
+    const Advection advection(speed, 1.);
+    const double upwind_flux{speed > 0. ? 2. * speed : 5. * speed};
+    BOOST_TEST(
+        DG::Fluxes::Upwind{1.}.get_flux(advection, 2., 5.) == upwind_flux);
+    BOOST_TEST(
+        DG::Fluxes::Lax_friedrichs{}.get_flux(advection, 2., 5.) ==
+        upwind_flux);
+    BOOST_TEST(DG::Fluxes::Hll{}.get_flux(advection, 2., 5.) == upwind_flux);
+    BOOST_TEST(
+        DG::Fluxes::Central{}.get_flux(advection, 2., 5.) == 3.5 * speed);
+    BOOST_TEST(
+        DG::Fluxes::Upwind{0.}.get_flux(advection, 2., 5.) == 3.5 * speed);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(burgers, *utf::tolerance(1e-15)) {
+  const Burgers_flux burgers;
+  const DG::Fluxes::Lax_friedrichs lax_friedrichs;
+  const DG::Fluxes::Hll hll;
+
+  // Transonic rarefaction and stationary shock
+  BOOST_TEST(lax_friedrichs.get_flux(burgers, -1., 1.) == -0.5);
+  BOOST_TEST(hll.get_flux(burgers, -1., 1.) == -0.5);
+  BOOST_TEST(lax_friedrichs.get_flux(burgers, 1., -1.) == 1.5);
+  BOOST_TEST(hll.get_flux(burgers, 1., -1.) == 1.5);
+
+  // Waves to the right, where HLL is exact but Lax-Friedrichs diffusive
+  BOOST_TEST(hll.get_flux(burgers, 2., 1.) == 2.);
+  BOOST_TEST(lax_friedrichs.get_flux(burgers, 2., 1.) == 2.25);
+  BOOST_TEST(hll.get_flux(burgers, -2., -1.) == 0.5);
+}
+
+/// The fluxes of a system of a single component equal the scalar ones
+BOOST_AUTO_TEST_CASE(system_states, *utf::tolerance(1e-15)) {
+  const Burgers_flux scalar_burgers;
+  const Burgers burgers(1.);
+  for (const auto &[left, right] :
+       {std::pair{-1., 1.}, std::pair{1., -1.}, std::pair{2., 1.}}) {
+    const std::array<double, 1> left_state{left};
+    const std::array<double, 1> right_state{right};
+    BOOST_TEST(
+        DG::Fluxes::Hll{}
+            .get_flux(burgers, left_state, right_state)
+            .front() ==
+        DG::Fluxes::Hll{}.get_flux(scalar_burgers, left, right));
+    BOOST_TEST(
+        DG::Fluxes::Lax_friedrichs{}
+            .get_flux(burgers, left_state, right_state)
+            .front() ==
+        DG::Fluxes::Lax_friedrichs{}.get_flux(scalar_burgers, left, right));
+    BOOST_TEST(
+        DG::Fluxes::Central{}
+            .get_flux(burgers, left_state, right_state)
+            .front() ==
+        DG::Fluxes::Central{}.get_flux(scalar_burgers, left, right));
+  }
+
+  // Water at rest is left at rest by the flux of a uniform height
+  const Shallow_water shallow_water(9.81, 1.);
+  const std::array<double, 2> rest{2., 0.};
+  const std::array<double, 2> flux{
+      DG::Fluxes::Hll{}.get_flux(shallow_water, rest, rest)};
+  BOOST_TEST(flux[0] == 0.);
+  BOOST_TEST(flux[1] == 0.5 * 9.81 * 4.);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,31 @@
+#include "periodic_scheme.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(scheme_workspace);
+
+BOOST_AUTO_TEST_CASE(written_scheme_equals_spatial_scheme) {
+  for (auto &scheme : get_schemes()) {
+    const Uniform_interval &interval{scheme->interval};
+    const arma::mat spatial_scheme{scheme->advection.get_spatial_scheme(
+        scheme->fields,
+        0.3,
+        interval.geo_factors,
+        interval.operators->diff_matrix,
+        interval.operators->lift_matrix,
+        interval.trace_indices)};
+
+    arma::mat written_scheme;
+    scheme->write(scheme->fields, 0.3, written_scheme);
+    BOOST_TEST_CONTEXT(
+        "polynomial order " << scheme->interval.operators->nodes.n_elem - 1) {
+      BOOST_TEST(arma::approx_equal(
+          written_scheme,
+          spatial_scheme,
+          "absdiff",
+          1e-12 * arma::abs(spatial_scheme).max()));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
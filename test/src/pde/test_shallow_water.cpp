@@ -0,0 +1,66 @@
+#include "../../../src/pde/shallow_water.h"
+#include "uniform_interval.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace utf = boost::unit_test;
+
+static_assert(System_pde<Shallow_water>);
+static_assert(!Linear_system_pde<Shallow_water>);
+
+BOOST_AUTO_TEST_SUITE(shallow_water);
+
+BOOST_AUTO_TEST_CASE(invalid_gravity) {
+  BOOST_CHECK_THROW(Shallow_water(0., 1.), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(pointwise_functions, *utf::tolerance(1e-15)) {
+  const Shallow_water shallow_water(10., 1.);
+  const std::array<double, 2> flux{
+      shallow_water.get_pointwise_flux({2., -3.})};
+  BOOST_TEST(flux[0] == -3.);
+  BOOST_TEST(flux[1] == 4.5 + 20.);
+  BOOST_TEST(shallow_water.get_wave_speed({2., -3.}) == 1.5 + sqrt(20.));
+  BOOST_TEST(shallow_water.get_boundary_state({2., -3.}, 0., 1.)[1] == 3.);
+}
+
+BOOST_AUTO_TEST_CASE(max_wave_speed, *utf::tolerance(1e-15)) {
+  const Shallow_water shallow_water(10., 1.);
+  // Planes of h and hu of two elements
+  const arma::mat fields{{1., 2., 0.5, -6.}, {0.1, 0.4, 0., 0.}};
+  BOOST_TEST(shallow_water.get_max_wave_speed(fields) == 3. + sqrt(20.));
+}
+
+BOOST_AUTO_TEST_CASE(lake_at_rest) {
+  const Uniform_interval basin(6, 5, false);
+  const Shallow_water shallow_water(9.81, 1.);
+  arma::mat fields(
+      basin.operators->nodes.n_elem, 2 * basin.num_elems, arma::fill::zeros);
+  fields.cols(0, basin.num_elems - 1).fill(1.5);
+
+  const arma::mat spatial_scheme{
+      basin.get_spatial_scheme(shallow_water, fields)};
+  BOOST_TEST(arma::abs(spatial_scheme).max() < 1e-12);
+}
+
+/// The walls conserve the water volume \f$\int h \, \mathrm{d}x\f$
+BOOST_AUTO_TEST_CASE(volume_conservation) {
+  const Uniform_interval basin(5, 6, false);
+  const Shallow_water shallow_water(9.81, 1.);
+  arma::arma_rng::set_seed(13);
+  arma::mat fields(
+      basin.operators->nodes.n_elem, 2 * basin.num_elems, arma::fill::randu);
+  fields.cols(0, basin.num_elems - 1) += 1.;
+
+  const arma::mat spatial_scheme{
+      basin.get_spatial_scheme(shallow_water, fields)};
+  const arma::mat mass_matrix{basin.get_mass_matrix()};
+  double volume_rate{0.};
+  for (size_t elem{0}; elem < basin.num_elems; ++elem) {
+    volume_rate += arma::accu(mass_matrix * spatial_scheme.col(elem)) /
+                   basin.geo_factors[elem];
+  }
+  BOOST_TEST(std::abs(volume_rate) < 1e-12);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,179 @@
+#include "../../../src/pde/advection.h"
+#include "../../../src/pde/static_pde.h"
+#include "../../../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
+#include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../src/spatial_solver/reference_operators.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+static_assert(Pointwise_pde<Advection>);
+static_assert(!Pointwise_pde<Pde>);
+
+BOOST_AUTO_TEST_SUITE(static_pde);
+
+BOOST_AUTO_TEST_CASE(boundary_values, *utf::tolerance(1e-15)) {
+  const Advection advection(2., 1.);
+  // Inflow at the left boundary, no jump at the right one
+  BOOST_TEST(advection.get_boundary_value(3., 0.25, 1.) == 3.);
+  BOOST_TEST(advection.get_boundary_value(3., 0.25, -1.) == -sin(0.5));
+}
+
+BOOST_AUTO_TEST_CASE(max_wave_speed) {
+  const Advection advection(-2., 1.);
+  const arma::mat fields{{0.5, -3.}, {1.5, 0.25}};
+  BOOST_TEST(advection.get_max_wave_speed(fields) == 2.);
+}
+
+BOOST_AUTO_TEST_CASE(pointwise_kernel_dispatch) {
+  BOOST_TEST(
+      DG::Kernels::get_pointwise_fused_kernel<Advection>(3) ==
+      (&DG::Kernels::apply_pointwise_fused_kernel<3, Advection>));
+  BOOST_TEST(DG::Kernels::get_pointwise_fused_kernel<Advection>(0) == nullptr);
+  BOOST_TEST(
+      DG::Kernels::get_pointwise_fused_kernel<Advection>(
+          DG::Kernels::max_fixed_order + 1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(static_scheme_equals_virtual_adapter) {
+  const size_t num_elems{7};
+  std::vector<double> geo_factors(num_elems);
+  for (size_t elem{0}; elem < num_elems; ++elem) {
+    geo_factors[elem] = 1. + 0.2 * elem;
+  }
+
+  // Fixed-order kernel, generic dense and even-odd products, and face
+  // interpolation, each with both boundary faces
+  const std::vector<std::tuple<std::shared_ptr<const DG::Reference_operators>,
+                               bool>>
+      configurations{
+          {DG::Operator_registry<DG::Legendre_basis>::get_operators(4), true},
+          {DG::Operator_registry<DG::Legendre_basis>::get_operators(4),
+           false},
+          {DG::Operator_registry<DG::Legendre_basis>::get_operators(20),
+           true},
+          {DG::Operator_registry<DG::Gauss_legendre_basis>::get_operators(5),
+           true}};
+  for (const auto &[operators, use_kernels] : configurations) {
+    const size_t num_nodes{operators->nodes.n_elem};
+    Advection advection(2 * M_PI, 0.7);
+    advection.use_fixed_order_kernels(use_kernels);
+    advection.use_even_odd_diff_matrix(operators->even_odd_diff_matrix);
+    size_t num_trace_rows{num_nodes};
+    if (!operators->has_face_nodes) {
+      advection.use_face_interpolation(operators->face_interpolation_matrix);
+      num_trace_rows = 2;
+    }
+    const DG::Mesh::Trace_indices trace_indices{
+        DG::Mesh::Trace_indices::get_chain(num_trace_rows, num_elems)};
+
+    arma::arma_rng::set_seed(num_nodes);
+    const arma::mat fields(num_nodes, num_elems, arma::fill::randn);
+
+    arma::mat static_scheme, virtual_scheme;
+    Scheme_workspace static_workspace, virtual_workspace;
+    advection.write_spatial_scheme(
+        fields,
+        0.3,
+        geo_factors,
+        operators->diff_matrix,
+        operators->lift_matrix,
+        trace_indices,
+        static_workspace,
+        static_scheme);
+    const Pde &pde{advection};
+    pde.write_spatial_scheme(
+        fields,
+        0.3,
+        geo_factors,
+        operators->diff_matrix,
+        operators->lift_matrix,
+        trace_indices,
+        virtual_workspace,
+        virtual_scheme);
+
+    BOOST_TEST_CONTEXT("polynomial order " << num_nodes - 1) {
+      BOOST_TEST(arma::approx_equal(
+          static_scheme,
+          virtual_scheme,
+          "absdiff",
+          1e-12 * arma::abs(virtual_scheme).max()));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(numerical_flux_selection) {
+  using DG::Fluxes::Numerical_flux;
+  const size_t num_elems{6};
+  const std::vector<double> geo_factors(num_elems, 1.5);
+  const auto operators{
+      DG::Operator_registry<DG::Legendre_basis>::get_operators(5)};
+  const size_t num_nodes{operators->nodes.n_elem};
+  arma::arma_rng::set_seed(num_elems);
+  const arma::mat fields(num_nodes, num_elems, arma::fill::randn);
+
+  const DG::Mesh::Trace_indices periodic{
+      DG::Mesh::Trace_indices::get_chain(num_nodes, num_elems, true)};
+
+  for (const auto &trace_indices :
+       {DG::Mesh::Trace_indices::get_chain(num_nodes, num_elems),
+        periodic}) {
+    auto get_scheme = [&](const Pde &pde) {
+      arma::mat spatial_scheme;
+      Scheme_workspace workspace;
+      pde.write_spatial_scheme(
+          fields,
+          0.3,
+          geo_factors,
+          operators->diff_matrix,
+          operators->lift_matrix,
+          trace_indices,
+          workspace,
+          spatial_scheme);
+      return spatial_scheme;
+    };
+    auto get_static_scheme = [&](const Advection &advection) {
+      arma::mat spatial_scheme;
+      Scheme_workspace workspace;
+      advection.write_spatial_scheme(
+          fields,
+          0.3,
+          geo_factors,
+          operators->diff_matrix,
+          operators->lift_matrix,
+          trace_indices,
+          workspace,
+          spatial_scheme);
+      return spatial_scheme;
+    };
+
+    // For linear advection, all upwinding fluxes give the full upwinding
+    // of the virtual adapter, and the central flux gives no upwinding
+    const arma::mat upwind_scheme{get_scheme(Advection(2 * M_PI, 1.))};
+    const double tolerance{1e-12 * arma::abs(upwind_scheme).max()};
+    for (const auto numerical_flux :
+         {Numerical_flux::upwind,
+          Numerical_flux::lax_friedrichs,
+          Numerical_flux::hll}) {
+      Advection advection(2 * M_PI, 1.);
+      advection.use_numerical_flux(numerical_flux);
+      BOOST_TEST(arma::approx_equal(
+          get_static_scheme(advection),
+          upwind_scheme,
+          "absdiff",
+          tolerance));
+    }
+
+    Advection central(2 * M_PI, 1.);
+    central.use_numerical_flux(Numerical_flux::central);
+    BOOST_TEST(arma::approx_equal(
+        get_static_scheme(central),
+        get_scheme(Advection(2 * M_PI, 0.)),
+        "absdiff",
+        tolerance));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
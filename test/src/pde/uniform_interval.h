@@ -0,0 +1,96 @@
+#ifndef UNIFORM_INTERVAL_H
+#define UNIFORM_INTERVAL_H
+
+#include "../../../src/pde/scheme_workspace.h"
+#include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../src/spatial_solver/mesh/face_connectivity.h"
+#include "../../../src/spatial_solver/reference_operators.h"
+
+#include <armadillo>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Test fixture of elements of equal size on \f$[0, 2\pi]\f$, which
+ * are either periodic or bounded by the boundary faces of the first and
+ * the last element.
+ *
+ * Without face nodes, the trace indices refer to the two face values per
+ * element instead of the fields (see Mesh::Trace_indices).
+ */
+struct Uniform_interval {
+  Uniform_interval(
+      const std::shared_ptr<const DG::Reference_operators> &_operators,
+      const size_t _num_elems,
+      const bool periodic)
+      : operators{_operators}, num_elems{_num_elems},
+        geo_factors(num_elems, num_elems / M_PI),
+        node_coords(operators->nodes.n_elem, num_elems) {
+
+    const double elem_size{2 * M_PI / num_elems};
+    for (size_t elem{0}; elem < num_elems; ++elem) {
+      node_coords.col(elem) =
+          elem * elem_size + 0.5 * elem_size * (operators->nodes + 1.);
+    }
+    const size_t num_trace_rows{
+        operators->has_face_nodes ? operators->nodes.n_elem : 2};
+    trace_indices = DG::Mesh::Trace_indices::get_chain(
+        num_trace_rows, num_elems, periodic);
+  };
+
+  /// Elements of the Legendre basis of the given polynomial order
+  Uniform_interval(
+      const size_t polynomial_order,
+      const size_t _num_elems,
+      const bool periodic)
+      : Uniform_interval(
+            DG::Operator_registry<DG::Legendre_basis>::get_operators(
+                polynomial_order),
+            _num_elems,
+            periodic){};
+
+  /// Scheme of Conservation_system or Static_pde, i.e. with numerical fluxes
+  template <class Pde_impl>
+  void write_spatial_scheme(
+      const Pde_impl &pde,
+      const arma::mat &fields,
+      const double time,
+      Scheme_workspace &workspace,
+      arma::mat &spatial_scheme) const {
+    pde.write_spatial_scheme(
+        fields,
+        time,
+        geo_factors,
+        operators->diff_matrix,
+        operators->lift_matrix,
+        trace_indices,
+        workspace,
+        spatial_scheme);
+  };
+
+  template <class Pde_impl>
+  arma::mat get_spatial_scheme(
+      const Pde_impl &pde,
+      const arma::mat &fields,
+      const double time = 0.) const {
+    Scheme_workspace workspace;
+    arma::mat spatial_scheme;
+    this->write_spatial_scheme(pde, fields, time, workspace, spatial_scheme);
+    return spatial_scheme;
+  };
+
+  /// Mass matrix of the reference element, which the lift matrix refers to
+  arma::mat get_mass_matrix() const {
+    return arma::inv(
+        operators->vandermonde_matrix * operators->vandermonde_matrix.t());
+  };
+
+  std::shared_ptr<const DG::Reference_operators> operators;
+  size_t num_elems;
+  std::vector<double> geo_factors;
+  arma::mat node_coords;
+  DG::Mesh::Trace_indices trace_indices;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#include "../../../../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
+#include "../../../../src/spatial_solver/basis_functions/legendre_basis.h"
+
+#include <armadillo>
+#include <boost/test/unit_test.hpp>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+namespace DG {
+BOOST_AUTO_TEST_SUITE(basis_functions);
+// hard-coded (tabulated) values were taken from
+// https://en.wikipedia.org/wiki/Gaussian_quadrature
+
+BOOST_AUTO_TEST_CASE(gauss_nodes, *utf::tolerance(1e-15)) {
+  Gauss_legendre_basis gauss;
+  std::vector<double> nodes(gauss.get_quad_nodes(1));
+  BOOST_TEST(nodes.size() == 2);
+  BOOST_TEST(nodes[0] == -std::sqrt(1. / 3.));
+  BOOST_TEST(nodes[1] == std::sqrt(1. / 3.));
+
+  nodes = gauss.get_quad_nodes(2);
+  BOOST_TEST(nodes.size() == 3);
+  BOOST_TEST(nodes[0] == -std::sqrt(3. / 5.));
+  BOOST_TEST(nodes[1] == 0., tt::tolerance(1e-16));
+  BOOST_TEST(nodes[2] == std::sqrt(3. / 5.));
+}
+
+BOOST_AUTO_TEST_CASE(gauss_polynomials) {
+  // Same polynomials as the Gauss-Lobatto basis, only the nodes differ
+  Gauss_legendre_basis gauss;
+  Legendre_basis legendre;
+  const arma::vec positions{-1., -0.3, 0.8};
+  BOOST_TEST(arma::approx_equal(
+      gauss.get_polynomials(6, positions),
+      legendre.get_polynomials(6, positions),
+      "absdiff",
+      0.));
+  BOOST_TEST(arma::approx_equal(
+      gauss.get_polynomial_gradients(6, positions),
+      legendre.get_polynomial_gradients(6, positions),
+      "absdiff",
+      0.));
+  BOOST_TEST(
+      gauss.get_polynomial(3, 0.8) == legendre.get_polynomial(3, 0.8));
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG
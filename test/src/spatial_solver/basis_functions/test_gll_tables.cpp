@@ -0,0 +1,66 @@
+#include "../../../../src/spatial_solver/basis_functions/gll_tables.h"
+#include "../../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../../src/spatial_solver/elementwise_operations.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+namespace DG {
+
+BOOST_AUTO_TEST_SUITE(basis_functions);
+
+BOOST_AUTO_TEST_CASE(gll_table_lookup) {
+  BOOST_TEST(GLL_tables::get_table(0) == nullptr);
+  BOOST_TEST(GLL_tables::get_table(GLL_tables::max_order + 1) == nullptr);
+  for (size_t order{1}; order <= GLL_tables::max_order; ++order) {
+    BOOST_TEST(GLL_tables::get_table(order)->polynomial_order == order);
+  }
+  static_assert(GLL_tables::get_table(3)->nodes[0] == -1.);
+}
+
+BOOST_AUTO_TEST_CASE(gll_tables_match_runtime_path) {
+  // The runtime path, i.e. the Golub-Welsch nodes and weights, and the
+  // Vandermonde based differentiation and lift matrices
+  Legendre_basis legendre;
+  for (size_t order{1}; order <= GLL_tables::max_order; ++order) {
+    const size_t num_nodes{order + 1};
+    const auto table{GLL_tables::get_table(order)};
+    const Quadrature quadrature{
+        legendre.get_gauss_lobatto_quadrature(0, 0, order)};
+    const Elementwise_operations<Legendre_basis> eop(order);
+    const arma::mat diff_matrix{eop.get_diff_matrix()};
+    const arma::mat lift_matrix{eop.get_lift_matrix()};
+
+    const arma::vec table_nodes(table->nodes, num_nodes);
+    const arma::vec table_weights(table->weights, num_nodes);
+    const arma::mat table_diff(table->diff_matrix, num_nodes, num_nodes);
+    const arma::mat table_lift(table->lift_matrix, num_nodes, 2);
+
+    BOOST_TEST_CONTEXT("polynomial order " << order) {
+      BOOST_TEST(arma::approx_equal(
+          table_nodes, arma::vec(quadrature.nodes), "absdiff", 1e-14));
+      BOOST_TEST(arma::approx_equal(
+          table_weights, arma::vec(quadrature.weights), "absdiff", 1e-14));
+      BOOST_TEST(
+          arma::abs(table_diff - diff_matrix).max() <=
+          1e-12 * arma::abs(diff_matrix).max());
+      BOOST_TEST(
+          arma::abs(table_lift - lift_matrix).max() <=
+          1e-12 * arma::abs(lift_matrix).max());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(tabulated_quad_nodes) {
+  Legendre_basis legendre;
+  const auto table{legendre.get_gll_table(7)};
+  const std::vector<double> nodes{legendre.get_quad_nodes(7)};
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+      nodes.begin(), nodes.end(), table->nodes, table->nodes + 8);
+  BOOST_TEST(legendre.get_gll_table(GLL_tables::max_order + 1) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG
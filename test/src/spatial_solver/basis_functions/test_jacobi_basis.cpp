@@ -2,6 +2,9 @@
 
 #include <boost/test/unit_test.hpp>
 #include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
 
 namespace utf = boost::unit_test;
 namespace tt = boost::test_tools;
@@ -26,6 +29,67 @@ BOOST_AUTO_TEST_CASE(gauss_jacobi_nodes, *utf::tolerance(1e-16)) {
   BOOST_TEST(nodes[2] == 1, tt::tolerance(1e-15));
 }
 
+BOOST_AUTO_TEST_CASE(gauss_lobatto_weights, *utf::tolerance(1e-14)) {
+  // Legendre-Gauss-Lobatto weights w_i = 2/(N(N+1)P_N(x_i)^2), where the
+  // orthonormal polynomial is sqrt((2N+1)/2) P_N
+  for (const size_t polynomial_order : {1, 2, 5, 16}) {
+    const Quadrature quad(
+        jacobi.get_gauss_lobatto_quadrature(0, 0, polynomial_order));
+    const double order(polynomial_order);
+    for (size_t i{0}; i <= polynomial_order; ++i) {
+      const double legendre_poly{
+          jacobi.get_jacobi_polynomial(0, 0, polynomial_order, quad.nodes[i]) /
+          std::sqrt((2. * order + 1.) / 2.)};
+      BOOST_TEST(
+          quad.weights[i] ==
+          2. / (order * (order + 1.) * legendre_poly * legendre_poly));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(quadrature_exactness, *utf::tolerance(1e-13)) {
+  // Gauss-Lobatto rules of order n integrate polynomials up to order 2n-1
+  // exactly, Gauss-Jacobi rules of order n up to order 2n+1
+  const double alpha(1.), beta(0.5);
+  const size_t polynomial_order(8);
+  const Quadrature gl_quad(
+      jacobi.get_gauss_lobatto_quadrature(alpha, beta, polynomial_order));
+  const Quadrature gj_quad(
+      jacobi.get_gauss_jacobi_quadrature(alpha, beta, polynomial_order));
+
+  for (size_t power{0}; power < 2 * polynomial_order; ++power) {
+    double gl_integral{0.}, gj_integral{0.};
+    for (size_t i{0}; i <= polynomial_order; ++i) {
+      gl_integral += gl_quad.weights[i] * std::pow(gl_quad.nodes[i], power);
+      gj_integral += gj_quad.weights[i] * std::pow(gj_quad.nodes[i], power);
+    }
+    BOOST_TEST(gl_integral == gj_integral);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(high_order_nodes) {
+  // The inner Legendre-Gauss-Lobatto nodes are the roots of P_N', which
+  // change their sign within a few units in the last place of each node
+  const size_t polynomial_order(64);
+  auto get_gradient = [polynomial_order](const double position) {
+    return jacobi.get_jacobi_polynomial_gradient(
+        0, 0, polynomial_order, position);
+  };
+  const std::vector<double> nodes(
+      jacobi.get_gauss_lobatto_nodes(0, 0, polynomial_order));
+  BOOST_TEST(nodes.size() == polynomial_order + 1);
+  for (size_t i{1}; i < polynomial_order; ++i) {
+    BOOST_TEST(nodes[i - 1] < nodes[i]);
+    BOOST_TEST(nodes[i] == -nodes[polynomial_order - i]);
+    const double offset{
+        4. * std::numeric_limits<double>::epsilon() *
+        std::max(std::fabs(nodes[i]), 0.1)};
+    BOOST_TEST(
+        get_gradient(nodes[i] - offset) * get_gradient(nodes[i] + offset) <=
+        0.);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(jacobi_polynomials, *utf::tolerance(1e-16)) {
 
   /**
@@ -84,6 +148,111 @@ BOOST_AUTO_TEST_CASE(jacobi_polynomial_gradient, *utf::tolerance(1e-16)) {
       tt::tolerance(1e-14));
 }
 
+BOOST_AUTO_TEST_CASE(batched_jacobi_polynomials) {
+  const arma::vec positions{-1., -0.73, 0., 0.2527, 0.9, 1., 2.};
+  const size_t max_order{9};
+
+  for (const auto &[alpha, beta] : std::vector<std::pair<double, double>>{
+           {0., 0.}, {1., 3.}, {4., 2.}, {-0.5, 0.5}}) {
+    const arma::mat polys{
+        jacobi.get_jacobi_polynomials(alpha, beta, max_order, positions)};
+    const arma::mat grads{jacobi.get_jacobi_polynomial_gradients(
+        alpha, beta, max_order, positions)};
+    BOOST_TEST(polys.n_rows == positions.n_elem);
+    BOOST_TEST(polys.n_cols == max_order + 1);
+    BOOST_TEST(grads.n_cols == max_order + 1);
+
+    // The batched sweep has to reproduce the scalar evaluation up to
+    // rounding, which -Ofast is free to reassociate
+    arma::mat scalar_polys(arma::size(polys));
+    arma::mat scalar_grads(arma::size(grads));
+    for (size_t i{0}; i < positions.n_elem; ++i) {
+      for (size_t n{0}; n <= max_order; ++n) {
+        scalar_polys(i, n) =
+            jacobi.get_jacobi_polynomial(alpha, beta, n, positions[i]);
+        scalar_grads(i, n) = jacobi.get_jacobi_polynomial_gradient(
+            alpha, beta, n, positions[i]);
+      }
+    }
+    BOOST_TEST(arma::approx_equal(
+        polys, scalar_polys, "reldiff", 1e-13));
+    BOOST_TEST(arma::approx_equal(
+        grads, scalar_grads, "reldiff", 1e-13));
+  }
+
+  BOOST_TEST(
+      jacobi.get_jacobi_polynomials(0., 0., 0, positions).n_cols == 1);
+  BOOST_CHECK_THROW(
+      jacobi.get_jacobi_polynomials(-1., 0., 3, positions),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(clenshaw_jacobi_expansion) {
+  const arma::vec positions{-1., -0.73, 0., 0.2527, 0.9, 1.};
+  arma::arma_rng::set_seed(19);
+
+  for (const auto &[alpha, beta] : std::vector<std::pair<double, double>>{
+           {0., 0.}, {1., 3.}, {-0.5, 0.5}}) {
+    for (const size_t max_order : {0, 1, 2, 12}) {
+      const arma::mat coefficients(
+          positions.n_elem, max_order + 1, arma::fill::randn);
+
+      arma::vec expansion(positions.n_elem, arma::fill::zeros);
+      for (size_t i{0}; i < positions.n_elem; ++i) {
+        for (size_t k{0}; k <= max_order; ++k) {
+          expansion[i] += coefficients(i, k) * jacobi.get_jacobi_polynomial(
+                                                   alpha, beta, k, positions[i]);
+        }
+      }
+
+      BOOST_TEST(arma::approx_equal(
+          jacobi.get_jacobi_expansion(alpha, beta, coefficients, positions),
+          expansion,
+          "absdiff",
+          1e-12));
+    }
+  }
+
+  BOOST_CHECK_THROW(
+      jacobi.get_jacobi_expansion(0., 0., arma::mat(2, 3), positions),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(cached_recurrence_coefficients, *utf::tolerance(1e-15)) {
+  const auto recurrence{jacobi.get_recurrence_coefficients(2., 0.5, 5)};
+  BOOST_TEST(recurrence->b.size() > 5);
+  BOOST_TEST(recurrence->a.size() > 6);
+
+  // Repeated requests of the same or a lower order share the table, also
+  // across instances
+  BOOST_TEST(Jacobi_basis().get_recurrence_coefficients(2., 0.5, 3) ==
+             recurrence);
+  BOOST_TEST(jacobi.get_recurrence_coefficients(0.5, 2., 5) != recurrence);
+
+  // A higher order rebuilds the table, the previous one stays valid
+  const size_t high_order{recurrence->b.size() + 10};
+  const auto high_recurrence{
+      jacobi.get_recurrence_coefficients(2., 0.5, high_order)};
+  BOOST_TEST(high_recurrence->b.size() > high_order);
+  BOOST_TEST(
+      jacobi.get_recurrence_coefficients(2., 0.5, 5) == high_recurrence);
+  for (size_t n{0}; n < recurrence->b.size(); ++n) {
+    BOOST_TEST(high_recurrence->b[n] == recurrence->b[n]);
+    BOOST_TEST(high_recurrence->a[n + 1] == recurrence->a[n + 1]);
+  }
+
+  // p_1 = s (x - b_0) with the slope s = p_0/a_1
+  BOOST_TEST(
+      recurrence->initial_slope ==
+      recurrence->initial_polynomial / recurrence->a[1]);
+  BOOST_TEST(
+      jacobi.get_jacobi_polynomial(2., 0.5, 1, 0.3) ==
+      recurrence->initial_slope * (0.3 - recurrence->b[0]));
+
+  BOOST_CHECK_THROW(
+      jacobi.get_recurrence_coefficients(-1., 0., 3), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 } // namespace DG
 
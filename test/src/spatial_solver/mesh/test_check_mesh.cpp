@@ -44,6 +44,25 @@ BOOST_AUTO_TEST_CASE(empty_lines) {
       Check_mesh(std::string(mesh)), Mesh_error, expected_msg);
 }
 
+BOOST_AUTO_TEST_CASE(empty_line_in_section) {
+  const std::string mesh(root_dir + mesh_dir + "empty_line_in_nodes.msh");
+  error_msg = "[" + mesh + "] Detected empty line in mesh file. (line 21)";
+  BOOST_CHECK_EXCEPTION(
+      Check_mesh(std::string(mesh)), Mesh_error, expected_msg);
+  BOOST_CHECK_EXCEPTION(
+      Check_mesh(std::string(mesh), 4), Mesh_error, expected_msg);
+}
+
+BOOST_AUTO_TEST_CASE(meshformat_version) {
+  const std::string mesh(root_dir + mesh_dir + "wrong_mesh_format.msh");
+  error_msg = "[" + mesh +
+              "] Mesh format '2.200000' is not supported. Only meshes of "
+              "format 4.1 produced by gmsh are currently supported. Try "
+              "to export your gmsh mesh by using 'gmsh -format msh41'.";
+  BOOST_CHECK_EXCEPTION(
+      Check_mesh(std::string(mesh)), Mesh_error, expected_msg);
+}
+
 BOOST_AUTO_TEST_CASE(meshformat_specifiers) {
   std::string mesh(
       root_dir + mesh_dir + "missing_meshformat_begin_spec.msh");
@@ -89,5 +108,25 @@ BOOST_AUTO_TEST_CASE(multiple_specifiers) {
       Check_mesh(std::string(mesh)), Mesh_error, expected_msg);
 }
 
+/**
+ * The mesh model is imported while checking the mesh, so that it does not
+ * need to be read again.
+ */
+BOOST_AUTO_TEST_CASE(mesh_model_handover) {
+  Check_mesh check_mesh(root_dir + mesh_dir + "../line.msh");
+  BOOST_TEST(check_mesh.get_section_index().contains("$Nodes"));
+
+  const DG::Mesh::Mesh_model mesh_model(check_mesh.release_mesh_model());
+  BOOST_TEST(mesh_model.get_number_of_nodes() == 12);
+  BOOST_TEST(mesh_model.get_number_of_elems() == 13);
+}
+
+BOOST_AUTO_TEST_CASE(binary_mesh) {
+  BOOST_CHECK_NO_THROW(
+      Check_mesh(root_dir + mesh_dir + "../line_binary.msh"));
+  BOOST_CHECK_NO_THROW(
+      Check_mesh(root_dir + mesh_dir + "../cylinder_binary_swapped.msh"));
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 } // namespace Mesh
@@ -0,0 +1,145 @@
+#include "../../../../src/pde/advection.h"
+#include "../../../../src/spatial_solver/mesh/face_connectivity.h"
+#include "../../../../src/spatial_solver/mesh/process_mesh_data.h"
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+namespace DG::Mesh {
+
+BOOST_AUTO_TEST_SUITE(face_connectivity);
+
+const std::string root_dir(DGTD_ROOT);
+const std::string mesh_dir("/test/src/spatial_solver/mesh/test_meshes/");
+
+Process_mesh_data line(root_dir + mesh_dir + "line.msh");
+Process_mesh_data example(root_dir + mesh_dir + "example.msh");
+
+BOOST_AUTO_TEST_CASE(ordered_elems) {
+  const Face_connectivity connectivity(line.get_face_connectivity(2));
+  BOOST_TEST(connectivity.get_num_elems() == 11);
+
+  const size_t num_nodes{4};
+  const Trace_indices trace_indices(
+      connectivity.get_trace_indices(num_nodes));
+  const Trace_indices chain(Trace_indices::get_chain(num_nodes, 11));
+  BOOST_TEST(trace_indices.interior == chain.interior);
+  BOOST_TEST(trace_indices.exterior == chain.exterior);
+  BOOST_TEST(trace_indices.neighbour_faces == chain.neighbour_faces);
+}
+
+BOOST_AUTO_TEST_CASE(interrupted_region) {
+  // dom1 consists of the intervals [10, 20] and [42, 50]
+  const Face_connectivity connectivity(example.get_face_connectivity(4));
+  const std::vector<size_t> &neighbour_faces(
+      connectivity.get_neighbour_faces());
+  BOOST_TEST(
+      std::count(
+          neighbour_faces.begin(),
+          neighbour_faces.end(),
+          Face_connectivity::boundary_face) == 4);
+}
+
+BOOST_AUTO_TEST_CASE(all_regions) {
+  // The regions of the example cover [0, 60] without any gap, such that
+  // only its two end points are boundary faces, although dom1 is
+  // interrupted by other regions
+  const Face_connectivity connectivity(example.get_face_connectivity());
+  BOOST_TEST(
+      connectivity.get_num_elems() ==
+      example.get_ordered_mesh().elem_tags.size());
+  const std::vector<size_t> &neighbour_faces(
+      connectivity.get_neighbour_faces());
+  BOOST_TEST(
+      std::count(
+          neighbour_faces.begin(),
+          neighbour_faces.end(),
+          Face_connectivity::boundary_face) == 2);
+
+  const Face_connectivity periodic(
+      example.get_face_connectivity({{"outer_bc", "outer_bc"}}));
+  BOOST_TEST(
+      std::count(
+          periodic.get_neighbour_faces().begin(),
+          periodic.get_neighbour_faces().end(),
+          Face_connectivity::boundary_face) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(periodic_contours) {
+  const Face_connectivity connectivity(
+      line.get_face_connectivity(2, {{"outer_bc", "outer_bc"}}));
+  const std::vector<size_t> &neighbour_faces(
+      connectivity.get_neighbour_faces());
+  BOOST_TEST(neighbour_faces.front() == neighbour_faces.size() - 1);
+  BOOST_TEST(neighbour_faces.back() == 0);
+  BOOST_TEST(
+      std::count(
+          neighbour_faces.begin(),
+          neighbour_faces.end(),
+          Face_connectivity::boundary_face) == 0);
+
+  BOOST_CHECK_THROW(
+      line.get_face_connectivity(2, {{"outer_bc", "the_only_region"}}),
+      std::invalid_argument);
+  BOOST_CHECK_THROW(
+      example.get_face_connectivity(4, {{"outer_bc", "outer_bc"}}),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(neighbour_faces_of_trace_indices) {
+  // For a single node per element, the field indices of both faces of an
+  // element coincide
+  for (const size_t num_nodes : {1, 2, 5}) {
+    const Face_connectivity periodic(
+        line.get_face_connectivity(2, {{"outer_bc", "outer_bc"}}));
+    BOOST_TEST(
+        periodic.get_trace_indices(num_nodes).neighbour_faces ==
+        periodic.get_neighbour_faces());
+
+    const Face_connectivity interrupted(example.get_face_connectivity(4));
+    BOOST_TEST(
+        interrupted.get_trace_indices(num_nodes).neighbour_faces ==
+        interrupted.get_neighbour_faces());
+
+    const Trace_indices chain(Trace_indices::get_chain(num_nodes, 11, true));
+    BOOST_TEST(
+        chain.neighbour_faces ==
+        line.get_face_connectivity(2, {{"outer_bc", "outer_bc"}})
+            .get_neighbour_faces());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(permuted_elems) {
+  // Reversing the field columns together with the element order must not
+  // change the field jumps of any element
+  const std::span ordered_elems(line.get_ordered_finite_elems(2));
+  const std::vector<size_t> reversed_elems(
+      ordered_elems.rbegin(), ordered_elems.rend());
+  Mesh_section_index section_index;
+  const Mesh_model mesh_model(Import_mesh_data::import_mesh_model(
+      root_dir + mesh_dir + "line.msh", section_index));
+  const Face_connectivity reversed(mesh_model, reversed_elems);
+
+  const size_t num_nodes{3};
+  const arma::mat fields(arma::randu(num_nodes, ordered_elems.size()));
+  const arma::mat reversed_fields(arma::fliplr(fields));
+
+  const Advection advection(2 * M_PI, 1.);
+  const std::tuple<double, double> bc(0.3, 0.);
+  const auto jumps(advection.get_field_jumps(
+      fields, bc, line.get_face_connectivity(2).get_trace_indices(num_nodes)));
+  const auto reversed_jumps(advection.get_field_jumps(
+      reversed_fields, bc, reversed.get_trace_indices(num_nodes)));
+
+  for (size_t elem{0}; elem < ordered_elems.size(); ++elem) {
+    const auto [left_jump, right_jump] = jumps[elem];
+    const auto [reversed_left_jump, reversed_right_jump] =
+        reversed_jumps[ordered_elems.size() - 1 - elem];
+    BOOST_TEST(left_jump == reversed_left_jump);
+    BOOST_TEST(right_jump == reversed_right_jump);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG::Mesh
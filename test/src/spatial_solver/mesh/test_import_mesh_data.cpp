@@ -51,6 +51,47 @@ BOOST_AUTO_TEST_CASE(nodes) {
   BOOST_CHECK_THROW(parametric.import_gmsh_nodes(), Mesh_error);
 }
 
+BOOST_AUTO_TEST_CASE(more_nodes_than_stated) {
+  const std::string too_many_nodes(
+      root_dir + mesh_dir + "fail_meshes/too_many_nodes.msh");
+  for (const size_t num_threads : {1, 4}) {
+    Mesh_section_index section_index;
+    BOOST_CHECK_THROW(
+        Import_mesh_data::import_mesh_model(
+            too_many_nodes, section_index, num_threads),
+        Mesh_error);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(unknown_element_type) {
+  const std::string unknown_elem_type(
+      root_dir + mesh_dir + "fail_meshes/unknown_element_type.msh");
+  for (const size_t num_threads : {1, 4}) {
+    Mesh_section_index section_index;
+    BOOST_CHECK_THROW(
+        Import_mesh_data::import_mesh_model(
+            unknown_elem_type, section_index, num_threads),
+        Mesh_error);
+  }
+}
+
+/// Counts of a binary mesh which disagree with its entity blocks
+BOOST_AUTO_TEST_CASE(binary_counts) {
+  for (const std::string mesh_name :
+       {"too_many_nodes_binary.msh",
+        "huge_node_count_binary.msh",
+        "too_many_elements_binary.msh",
+        "huge_bounding_count_binary.msh"}) {
+    Mesh_section_index section_index;
+    BOOST_CHECK_THROW(
+        Import_mesh_data::import_mesh_model(
+            root_dir + mesh_dir + "fail_meshes/" + mesh_name,
+            section_index,
+            1),
+        Mesh_error);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(node_coordinates) {
   BOOST_TEST(line.import_gmsh_nodes()[1][0] == 0); // x coordinate
   BOOST_TEST(line.import_gmsh_nodes()[1][1] == 0); // y cooridnate
@@ -74,6 +115,49 @@ BOOST_AUTO_TEST_CASE(gmsh_element_node_tags) {
   BOOST_TEST(line.import_gmsh_elements(Entity.curve, 1)[13][1] == 2);
 }
 
+BOOST_AUTO_TEST_CASE(mesh_model) {
+  const Mesh_model model(line.import_mesh_model());
+  BOOST_TEST(model.dimension == 1);
+  BOOST_TEST(model.get_number_of_nodes() == 12);
+  BOOST_TEST(model.get_number_of_elems() == 13);
+
+  BOOST_TEST(model.get_regions()[0] == 2);
+  BOOST_TEST(model.get_contours()[0] == 1);
+  BOOST_TEST(model.get_physical_names()["the_only_region"] == 2);
+
+  const size_t curve_idx(model.get_entity_index(Entity.curve, 1));
+  const Entity_table &curves(model.entities[Entity.curve]);
+  BOOST_TEST(curves.phys_tags[curves.phys_tag_offsets[curve_idx]] == 2);
+
+  const size_t node_idx(model.get_node_index(7));
+  BOOST_TEST(model.node_coords[3 * node_idx] == 6.04422962956386);
+  BOOST_TEST(model.get_node_index(13) == invalid_index);
+
+  const size_t elem_idx(model.get_elem_index(13));
+  BOOST_TEST(
+      model.elem_node_tags[model.elem_node_offsets[elem_idx]] == 12);
+  BOOST_TEST(
+      model.elem_node_tags[model.elem_node_offsets[elem_idx] + 1] == 2);
+}
+
+BOOST_AUTO_TEST_CASE(mesh_model_binary) {
+  const Mesh_model model(line.import_mesh_model());
+  const Mesh_model binary_model(
+      Import_mesh_data(root_dir + mesh_dir + "line_binary.msh")
+          .import_mesh_model());
+
+  BOOST_TEST(binary_model.dimension == model.dimension);
+  BOOST_TEST(binary_model.phys_group_names == model.phys_group_names);
+  BOOST_TEST(
+      binary_model.entities[Entity.curve].phys_tags ==
+      model.entities[Entity.curve].phys_tags);
+  BOOST_TEST(binary_model.node_tags == model.node_tags);
+  BOOST_TEST(binary_model.node_coords == model.node_coords);
+  BOOST_TEST(binary_model.elem_tags == model.elem_tags);
+  BOOST_TEST(binary_model.elem_node_offsets == model.elem_node_offsets);
+  BOOST_TEST(binary_model.elem_node_tags == model.elem_node_tags);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 //-------------------------------------------------------------------------
 /**
@@ -177,5 +261,54 @@ BOOST_AUTO_TEST_CASE(gmsh_element_nodes_3d) {
       sphere.import_gmsh_elements(Entity.volume, 27)[39876][3] == 5150);
 }
 
+/**
+ * The sphere mesh is large enough to be split into several chunks of
+ * lines per entity block.
+ */
+BOOST_AUTO_TEST_CASE(mesh_model_parallel) {
+  const Mesh_model model(sphere.import_mesh_model());
+
+  Mesh_section_index section_index;
+  const Mesh_model parallel_model(Import_mesh_data::import_mesh_model(
+      root_dir + mesh_dir + "sphere.msh", section_index, 4));
+
+  BOOST_TEST(parallel_model.node_tags == model.node_tags);
+  BOOST_TEST(parallel_model.node_coords == model.node_coords);
+  BOOST_TEST(parallel_model.elem_tags == model.elem_tags);
+  BOOST_TEST(parallel_model.elem_node_offsets == model.elem_node_offsets);
+  BOOST_TEST(parallel_model.elem_node_tags == model.elem_node_tags);
+  BOOST_TEST(
+      parallel_model.get_elem_index(39876) == model.get_elem_index(39876));
+  BOOST_TEST(section_index.contains("$EndElements"));
+}
+
+/**
+ * The binary cylinder mesh is written in big-endian byte order, such that
+ * the byte swapping of the binary reader is tested as well.
+ */
+BOOST_AUTO_TEST_CASE(mesh_model_binary_swapped) {
+  const Mesh_model model(cylinder.import_mesh_model());
+  const Mesh_model binary_model(
+      Import_mesh_data(root_dir + mesh_dir + "cylinder_binary_swapped.msh")
+          .import_mesh_model());
+
+  BOOST_TEST(binary_model.dimension == 2);
+  BOOST_TEST(binary_model.phys_group_tags == model.phys_group_tags);
+  for (size_t entity_type{0}; entity_type < 4; ++entity_type) {
+    BOOST_TEST(
+        binary_model.entities[entity_type].tags ==
+        model.entities[entity_type].tags);
+    BOOST_TEST(
+        binary_model.entities[entity_type].phys_tags ==
+        model.entities[entity_type].phys_tags);
+  }
+  BOOST_TEST(binary_model.node_tags == model.node_tags);
+  BOOST_TEST(binary_model.node_coords == model.node_coords);
+  BOOST_TEST(binary_model.elem_tags == model.elem_tags);
+  BOOST_TEST(binary_model.elem_node_tags == model.elem_node_tags);
+  BOOST_TEST(
+      binary_model.get_elem_index(89) == model.get_elem_index(89));
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 } // namespace DG::Mesh
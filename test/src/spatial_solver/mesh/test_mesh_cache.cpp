@@ -0,0 +1,119 @@
+#include "../../../../src/spatial_solver/mesh/mesh_cache.h"
+#include "../../../../src/spatial_solver/mesh/process_mesh_data.h"
+#include "../../../../src/tools/custom_errors.h"
+
+#include <bit>
+#include <boost/test/unit_test.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace DG::Mesh {
+
+BOOST_AUTO_TEST_SUITE(mesh_cache);
+
+const std::string root_dir(DGTD_ROOT);
+const std::string mesh_dir("/test/src/spatial_solver/mesh/test_meshes/");
+
+/// Copy of a test mesh, such that no cache is written into the source tree
+std::string copy_test_mesh(const std::string &mesh_name) {
+  const std::string copy_name(
+      (std::filesystem::temp_directory_path() / ("cache_" + mesh_name))
+          .string());
+  std::filesystem::copy_file(
+      root_dir + mesh_dir + mesh_name,
+      copy_name,
+      std::filesystem::copy_options::overwrite_existing);
+  std::filesystem::remove(copy_name + ".dgtd_cache");
+  return copy_name;
+}
+
+BOOST_AUTO_TEST_CASE(store_and_load) {
+  const std::string mesh_name(copy_test_mesh("example.msh"));
+  const Mesh_cache cache(mesh_name);
+  BOOST_TEST(cache.get_cache_name() == mesh_name + ".dgtd_cache");
+  BOOST_TEST(!cache.is_valid());
+
+  const Process_mesh_data imported(mesh_name);
+  imported.store_cache(cache);
+  BOOST_TEST(cache.is_valid());
+
+  Process_mesh_data cached(mesh_name, cache.load());
+  BOOST_TEST(cached.get_dimension() == imported.get_dimension());
+  BOOST_CHECK(cached.get_physical_names() == imported.get_physical_names());
+  BOOST_TEST(
+      cached.get_ordered_regions() == std::vector<size_t>({3, 4, 5, 8}));
+  BOOST_TEST(
+      cached.get_ordered_mesh().elem_tags ==
+      imported.get_ordered_mesh().elem_tags);
+  BOOST_TEST(
+      cached.get_ordered_mesh().elem_coords ==
+      imported.get_ordered_mesh().elem_coords);
+  BOOST_TEST(
+      cached.get_ordered_mesh().geo_factors ==
+      imported.get_ordered_mesh().geo_factors);
+  BOOST_TEST(
+      cached.get_ordered_mesh().right_neighbours ==
+      imported.get_ordered_mesh().right_neighbours);
+  BOOST_TEST(cached.get_min_elem_size(3) == 1.0046848956386096);
+  BOOST_TEST(
+      cached.import_number_of_nodes() == imported.import_number_of_nodes());
+
+  std::filesystem::remove(cache.get_cache_name());
+}
+
+BOOST_AUTO_TEST_CASE(modified_mesh) {
+  const std::string mesh_name(copy_test_mesh("line.msh"));
+  const Process_mesh_data imported(mesh_name);
+  imported.store_cache(Mesh_cache(mesh_name));
+  BOOST_TEST(Mesh_cache(mesh_name).is_valid());
+
+  std::ofstream(mesh_name, std::ios::app) << "\n";
+  BOOST_TEST(!Mesh_cache(mesh_name).is_valid());
+
+  // A modification which keeps the size of the mesh file
+  imported.store_cache(Mesh_cache(mesh_name));
+  BOOST_TEST(Mesh_cache(mesh_name).is_valid());
+  std::fstream(mesh_name, std::ios::in | std::ios::out).seekp(1) << '5';
+  BOOST_TEST(!Mesh_cache(mesh_name).is_valid());
+
+  std::filesystem::remove(mesh_name + ".dgtd_cache");
+}
+
+BOOST_AUTO_TEST_CASE(truncated_cache) {
+  const std::string mesh_name(copy_test_mesh("line.msh"));
+  const Mesh_cache cache(mesh_name);
+  Process_mesh_data(mesh_name).store_cache(cache);
+
+  std::filesystem::resize_file(
+      cache.get_cache_name(),
+      std::filesystem::file_size(cache.get_cache_name()) / 2);
+  BOOST_TEST(cache.is_valid());
+  BOOST_CHECK_THROW(cache.load(), Mesh_error);
+
+  std::filesystem::remove(cache.get_cache_name());
+}
+
+BOOST_AUTO_TEST_CASE(content_hash) {
+  BOOST_TEST(Mesh_cache::get_content_hash("") == 14695981039346656037ull);
+  BOOST_TEST(
+      Mesh_cache::get_content_hash("$MeshFormat") ==
+      Mesh_cache::get_content_hash("$MeshFormat"));
+  BOOST_TEST(
+      Mesh_cache::get_content_hash("$MeshFormat") !=
+      Mesh_cache::get_content_hash("$MeshFormaT"));
+
+  // The highest bit of a word changes about half of the bits of the hash
+  const std::string content("$MeshFormat\n4.1 0 8");
+  for (const size_t byte : {7, 15}) {
+    std::string modified(content);
+    modified[byte] = char(modified[byte] ^ 0x80);
+    const uint64_t difference{
+        Mesh_cache::get_content_hash(content) ^
+        Mesh_cache::get_content_hash(modified)};
+    BOOST_TEST(std::popcount(difference) > 16);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG::Mesh
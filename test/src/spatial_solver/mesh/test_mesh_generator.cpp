@@ -0,0 +1,87 @@
+#include "../../../../src/spatial_solver/mesh/mesh_generator.h"
+#include "../../../../src/spatial_solver/mesh/process_mesh_data.h"
+#include "../../../../src/tools/custom_errors.h"
+
+#include <boost/test/unit_test.hpp>
+#include <span>
+#include <string>
+
+namespace DG::Mesh {
+
+BOOST_AUTO_TEST_SUITE(mesh_generator);
+
+const std::string root_dir(DGTD_ROOT);
+const std::string mesh_dir("/test/src/spatial_solver/mesh/test_meshes/");
+
+Mesh_generator generator(root_dir + mesh_dir + "generated_regions.json");
+
+BOOST_AUTO_TEST_CASE(region_specs) {
+  const auto &region_specs(generator.get_region_specs());
+  BOOST_TEST(region_specs.size() == 2);
+  BOOST_TEST(region_specs[0].name == "left_pml");
+  BOOST_TEST(region_specs[0].grading == 0.5);
+  BOOST_TEST(region_specs[1].num_elems == 10);
+  BOOST_TEST(region_specs[1].grading == 1.);
+}
+
+BOOST_AUTO_TEST_CASE(uniform_node_coords) {
+  const std::vector coords(
+      Mesh_generator::get_node_coords({"line", 0., 9., 3}));
+  BOOST_TEST(coords == std::vector<double>({0., 3., 6., 9.}));
+}
+
+BOOST_AUTO_TEST_CASE(graded_node_coords) {
+  const std::vector coords(
+      Mesh_generator::get_node_coords({"line", 0., 7., 3, 2.}));
+  BOOST_TEST(coords.size() == 4);
+  BOOST_TEST(coords[1] == 1., boost::test_tools::tolerance(1e-14));
+  BOOST_TEST(coords[2] == 3., boost::test_tools::tolerance(1e-14));
+  BOOST_TEST(coords[3] == 7.);
+}
+
+BOOST_AUTO_TEST_CASE(mesh_model) {
+  const Mesh_model mesh_model(generator.generate_mesh_model());
+  BOOST_TEST(mesh_model.dimension == 1);
+  BOOST_TEST(mesh_model.get_number_of_nodes() == 15);
+  BOOST_TEST(mesh_model.get_number_of_elems() == 16);
+  BOOST_TEST(mesh_model.get_regions() == std::vector<size_t>({2, 3}));
+  BOOST_TEST(mesh_model.get_contours() == std::vector<size_t>({1}));
+  BOOST_TEST(mesh_model.get_physical_names().at("outer_bc") == 1);
+  BOOST_TEST(mesh_model.get_physical_names().at("domain") == 3);
+  BOOST_TEST(mesh_model.elem_blocks.size() == 4);
+  BOOST_TEST(mesh_model.elem_blocks[3].num_elems == 10);
+}
+
+BOOST_AUTO_TEST_CASE(processed_mesh) {
+  Process_mesh_data processed_mesh(
+      "generated_regions.json",
+      generator.generate_mesh_model(),
+      Mesh_section_index());
+
+  BOOST_TEST(
+      processed_mesh.get_ordered_regions() == std::vector<size_t>({2, 3}));
+  BOOST_TEST(processed_mesh.get_finite_elems("left_pml").size() == 4);
+  BOOST_TEST(processed_mesh.get_min_elem_size("domain") == 1.);
+
+  const std::span pml_elems(processed_mesh.get_ordered_finite_elems(2));
+  const auto [left_coord, right_coord] =
+      processed_mesh.get_elem_coords(pml_elems.front());
+  BOOST_TEST(left_coord == -1.);
+  BOOST_TEST(right_coord - left_coord == 8. / 15.);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_specs) {
+  BOOST_CHECK_THROW(
+      Mesh_generator(std::vector<Region_spec>()), Mesh_error);
+  BOOST_CHECK_THROW(Mesh_generator({{"line", 0., 1., 0}}), Mesh_error);
+  BOOST_CHECK_THROW(Mesh_generator({{"line", 1., 0., 2}}), Mesh_error);
+  BOOST_CHECK_THROW(Mesh_generator({{"line", 0., 1., 2, 0.}}), Mesh_error);
+  BOOST_CHECK_THROW(
+      Mesh_generator({{"left", 0., 1., 2}, {"right", 2., 3., 2}}),
+      Mesh_error);
+  BOOST_CHECK_THROW(
+      Mesh_generator(root_dir + mesh_dir + "line.msh"), Mesh_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG::Mesh
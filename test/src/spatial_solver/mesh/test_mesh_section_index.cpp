@@ -0,0 +1,50 @@
+#include "../../../../src/spatial_solver/mesh/import_mesh_data.h"
+#include "../../../../src/spatial_solver/mesh/mesh_section_index.h"
+
+#include <boost/test/unit_test.hpp>
+#include <fstream>
+#include <string>
+
+namespace DG::Mesh {
+
+BOOST_AUTO_TEST_SUITE(mesh_section_index);
+
+const std::string root_dir(DGTD_ROOT);
+const std::string mesh_dir("/test/src/spatial_solver/mesh/test_meshes/");
+
+Mesh_section_index line_index(root_dir + mesh_dir + "line.msh");
+
+BOOST_AUTO_TEST_CASE(specifiers) {
+  BOOST_TEST(line_index.get_sections().size() == 10);
+  BOOST_TEST(line_index.get_sections()[0].specifier == "$MeshFormat");
+  BOOST_TEST(line_index.get_sections()[9].specifier == "$EndElements");
+  BOOST_TEST(line_index.contains("$Nodes"));
+  BOOST_TEST(!line_index.contains("$NodeData"));
+  BOOST_CHECK_THROW(
+      line_index.get_section("$NodeData"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(line_numbers) {
+  BOOST_TEST(line_index.get_section("$MeshFormat").line_number == 1);
+  BOOST_TEST(line_index.get_section("$Entities").line_number == 9);
+  BOOST_TEST(line_index.get_section("$Nodes").line_number == 15);
+  BOOST_TEST(line_index.get_section("$EndElements").line_number == 63);
+}
+
+BOOST_AUTO_TEST_CASE(positions) {
+  std::ifstream mesh_file{root_dir + mesh_dir + "line.msh"};
+  mesh_file.seekg(line_index.get_section("$Nodes").position);
+
+  std::string line;
+  std::getline(mesh_file, line);
+  BOOST_TEST(line == "3 12 1 12");
+}
+
+BOOST_AUTO_TEST_CASE(shared_index) {
+  Import_mesh_data line(root_dir + mesh_dir + "line.msh", line_index);
+  BOOST_TEST(line.get_dimension() == 1);
+  BOOST_TEST(line.import_number_of_nodes() == 12);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG::Mesh
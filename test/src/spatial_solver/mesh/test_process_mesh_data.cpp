@@ -2,6 +2,7 @@
 #include "../../../../src/spatial_solver/mesh/process_mesh_data.h"
 
 #include <boost/test/unit_test.hpp>
+#include <span>
 
 namespace DG::Mesh {
 
@@ -72,6 +73,60 @@ BOOST_AUTO_TEST_CASE(ordered_finite_elems) {
   BOOST_TEST(ordered_elem_tags[3] == 13);
 }
 
+BOOST_AUTO_TEST_CASE(ordered_finite_elems_of_region) {
+  const std::span ordered_elems(line.get_ordered_finite_elems(2));
+  BOOST_TEST(ordered_elems.size() == 11);
+  BOOST_TEST(ordered_elems.front() == 3);
+  BOOST_TEST(ordered_elems.back() == 13);
+
+  const std::span example_elems(example.get_ordered_finite_elems(8));
+  const std::vector expected_elems(
+      example.get_ordered_elems(example.get_finite_elems(8)));
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+      example_elems.begin(),
+      example_elems.end(),
+      expected_elems.begin(),
+      expected_elems.end());
+
+  BOOST_CHECK_THROW(
+      line.get_ordered_finite_elems(1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(geometric_factors) {
+  const std::span geo_factors(line.get_geometric_factors(2));
+  BOOST_TEST(geo_factors.size() == 11);
+  BOOST_TEST(geo_factors.front() == 2. / 1.491565972698457);
+  BOOST_TEST(geo_factors.back() == 2. / 0.4903203509669787);
+}
+
+BOOST_AUTO_TEST_CASE(neighbour_links) {
+  // The region dom1 consists of two intervals, which are separated by dom2
+  const Ordered_mesh &ordered_mesh(example.get_ordered_mesh());
+  const auto &coords(ordered_mesh.elem_coords);
+
+  size_t num_left_bounds{0};
+  size_t num_right_bounds{0};
+  for (size_t elem{0}; elem < ordered_mesh.elem_tags.size(); ++elem) {
+    const size_t left{ordered_mesh.left_neighbours[elem]};
+    const size_t right{ordered_mesh.right_neighbours[elem]};
+    if (left == Ordered_mesh::no_neighbour) {
+      ++num_left_bounds;
+      BOOST_TEST(coords[2 * elem] == 0);
+    } else {
+      BOOST_TEST(coords[2 * left + 1] == coords[2 * elem]);
+      BOOST_TEST(ordered_mesh.right_neighbours[left] == elem);
+    }
+    if (right == Ordered_mesh::no_neighbour) {
+      ++num_right_bounds;
+      BOOST_TEST(coords[2 * elem + 1] == 60);
+    } else {
+      BOOST_TEST(coords[2 * right] == coords[2 * elem + 1]);
+    }
+  }
+  BOOST_TEST(num_left_bounds == 1);
+  BOOST_TEST(num_right_bounds == 1);
+}
+
 BOOST_AUTO_TEST_CASE(min_elem_size) {
   BOOST_TEST(line.get_min_elem_size() == 0.4903203509669787);
 }
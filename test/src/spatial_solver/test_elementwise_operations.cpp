@@ -1,3 +1,4 @@
+#include "../../../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
 #include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
 #include "../../../src/spatial_solver/elementwise_operations.h"
 
@@ -207,5 +208,36 @@ BOOST_AUTO_TEST_CASE(lift_matrix, *utf::tolerance(1e-16)) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(face_interpolation, *utf::tolerance(1e-13)) {
+  // Gauss-Lobatto nodes include the faces
+  Elementwise_operations<Legendre_basis> gll(4);
+  BOOST_TEST(gll.has_face_nodes());
+  const arma::mat gll_interpolation(gll.get_face_interpolation_matrix());
+  BOOST_TEST(gll_interpolation(0, 0) == 1.);
+  BOOST_TEST(gll_interpolation(4, 1) == 1.);
+  BOOST_TEST(arma::accu(arma::abs(gll_interpolation)) == 2.);
+
+  // Gauss nodes do not, a polynomial of the order is interpolated exactly
+  const size_t order{4};
+  Elementwise_operations<Gauss_legendre_basis> gauss(order);
+  BOOST_TEST(!gauss.has_face_nodes());
+  const arma::vec nodes(Gauss_legendre_basis().get_quad_nodes(order));
+  const arma::vec values{arma::pow(nodes, 4) - 2. * nodes + 0.5};
+  const arma::rowvec face_values{
+      values.t() * gauss.get_face_interpolation_matrix()};
+  BOOST_TEST(face_values[0] == 3.5);
+  BOOST_TEST(face_values[1] == -0.5);
+}
+
+BOOST_AUTO_TEST_CASE(gauss_lift_matrix, *utf::tolerance(1e-12)) {
+  // L = M^{-1} E with the mass matrix M = (V V^T)^{-1}
+  Elementwise_operations<Gauss_legendre_basis> gauss(5);
+  const arma::mat vand_mat(gauss.get_vandermonde_matrix());
+  const arma::mat lift_matrix(
+      vand_mat * vand_mat.t() * gauss.get_face_interpolation_matrix());
+  const arma::mat difference(arma::abs(gauss.get_lift_matrix() - lift_matrix));
+  BOOST_TEST(difference.max() == 0., tt::tolerance(1e-12));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 } // namespace DG
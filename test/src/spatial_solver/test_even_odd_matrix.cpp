@@ -0,0 +1,57 @@
+#include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../src/spatial_solver/even_odd_matrix.h"
+#include "../../../src/spatial_solver/reference_operators.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+namespace DG {
+
+BOOST_AUTO_TEST_SUITE(even_odd_matrix);
+
+BOOST_AUTO_TEST_CASE(centro_antisymmetry) {
+  const arma::mat symmetric{{-1.5, 2., -0.5}, {-0.5, 0., 0.5}, {0.5, -2., 1.5}};
+  BOOST_TEST(Even_odd_matrix::is_centro_antisymmetric(symmetric));
+
+  arma::mat perturbed{symmetric};
+  perturbed(0, 1) += 1e-3;
+  BOOST_TEST(!Even_odd_matrix::is_centro_antisymmetric(perturbed));
+  BOOST_CHECK_THROW(Even_odd_matrix{perturbed}, std::invalid_argument);
+  BOOST_TEST(!Even_odd_matrix::is_centro_antisymmetric(arma::mat(2, 3)));
+}
+
+BOOST_AUTO_TEST_CASE(apply_equals_dense_product) {
+  // Even and odd numbers of nodes, tabulated and computed orders
+  for (const size_t order : {1, 2, 3, 8, 19, 20, 35}) {
+    const auto operators{
+        Operator_registry<Legendre_basis>::get_operators(order)};
+    BOOST_TEST_REQUIRE(operators->even_odd_diff_matrix != nullptr);
+
+    const arma::mat &diff_matrix{operators->diff_matrix};
+    arma::arma_rng::set_seed(order);
+    const arma::mat fields(order + 1, 7, arma::fill::randn);
+
+    const arma::mat dense{diff_matrix * fields};
+    const arma::mat even_odd{operators->even_odd_diff_matrix->apply(fields)};
+
+    arma::mat even_odd_columns(arma::size(fields));
+    std::vector<double> scratch(order + 1);
+    for (size_t col{0}; col < fields.n_cols; ++col) {
+      operators->even_odd_diff_matrix->apply(
+          fields.colptr(col), scratch.data(), even_odd_columns.colptr(col));
+    }
+
+    const double tolerance{
+        1e-13 * arma::abs(diff_matrix).max() * arma::abs(fields).max() *
+        (order + 1)};
+    BOOST_TEST_CONTEXT("polynomial order " << order) {
+      BOOST_TEST(arma::abs(even_odd - dense).max() <= tolerance);
+      BOOST_TEST(arma::abs(even_odd_columns - dense).max() <= tolerance);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG
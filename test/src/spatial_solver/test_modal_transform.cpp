@@ -0,0 +1,91 @@
+#include "../../../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
+#include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../src/spatial_solver/modal_transform.h"
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+namespace DG {
+
+BOOST_AUTO_TEST_SUITE(modal_transform);
+
+BOOST_AUTO_TEST_CASE(nodal_modal_round_trip) {
+  const size_t order{7};
+  const Modal_transform<Legendre_basis> transform(order);
+  arma::arma_rng::set_seed(7);
+  const arma::mat nodal_fields(order + 1, 5, arma::fill::randn);
+
+  const arma::mat modal_fields(transform.get_modal_fields(nodal_fields));
+  BOOST_TEST(modal_fields.n_rows == order + 1);
+  BOOST_TEST(modal_fields.n_cols == 5);
+  BOOST_TEST(arma::approx_equal(
+      transform.get_nodal_fields(modal_fields),
+      nodal_fields,
+      "absdiff",
+      1e-13));
+}
+
+BOOST_AUTO_TEST_CASE(modal_coefficients, *utf::tolerance(1e-14)) {
+  // u(x) = x^2 = (sqrt(2)/3) p_0 + (2 sqrt(10)/15) p_2 with the
+  // orthonormal Legendre polynomials p_k
+  const size_t order{4};
+  const Modal_transform<Legendre_basis> transform(order);
+  const arma::vec nodes(Legendre_basis().get_quad_nodes(order));
+  const arma::mat modal_fields(transform.get_modal_fields(arma::square(nodes)));
+
+  BOOST_TEST(modal_fields(0, 0) == std::sqrt(2.) / 3.);
+  BOOST_TEST(modal_fields(1, 0) == 0., tt::tolerance(1e-15));
+  BOOST_TEST(modal_fields(2, 0) == 2. * std::sqrt(10.) / 15.);
+  BOOST_TEST(modal_fields(3, 0) == 0., tt::tolerance(1e-15));
+  BOOST_TEST(modal_fields(4, 0) == 0., tt::tolerance(1e-15));
+}
+
+BOOST_AUTO_TEST_CASE(change_order) {
+  const arma::mat modal_fields{{1., 2.}, {3., 4.}, {5., 6.}};
+
+  const arma::mat restricted(
+      Modal_transform<Legendre_basis>::change_order(modal_fields, 1));
+  BOOST_TEST(restricted.n_rows == 2);
+  BOOST_TEST(arma::approx_equal(
+      restricted, modal_fields.rows(0, 1), "absdiff", 0.));
+
+  const arma::mat prolonged(
+      Modal_transform<Legendre_basis>::change_order(modal_fields, 4));
+  BOOST_TEST(prolonged.n_rows == 5);
+  BOOST_TEST(arma::approx_equal(
+      prolonged.rows(0, 2), modal_fields, "absdiff", 0.));
+  BOOST_TEST(arma::accu(arma::abs(prolonged.rows(3, 4))) == 0.);
+}
+
+BOOST_AUTO_TEST_CASE(project_nodal_fields) {
+  // A polynomial of order 3 is kept exactly by prolongation to order 9
+  // and by restriction to its own order, also across bases
+  const Modal_transform<Gauss_legendre_basis> transform(6);
+  const arma::vec nodes(Gauss_legendre_basis().get_quad_nodes(6));
+  const arma::vec fields{arma::pow(nodes, 3) - nodes};
+
+  for (const size_t order : {3, 9}) {
+    const arma::vec target_nodes(
+        Gauss_legendre_basis().get_quad_nodes(order));
+    BOOST_TEST(arma::approx_equal(
+        arma::vec(transform.project_nodal_fields(fields, order)),
+        arma::vec(arma::pow(target_nodes, 3) - target_nodes),
+        "absdiff",
+        1e-13));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(decay_indicator, *utf::tolerance(1e-14)) {
+  const arma::mat modal_fields{{1., 0., 3.}, {0., 0., 0.}, {0., 0., 4.}};
+  const arma::rowvec indicator(
+      Modal_transform<Legendre_basis>::get_decay_indicator(modal_fields));
+  BOOST_TEST(indicator[0] == 0.);
+  BOOST_TEST(indicator[1] == 0.);
+  BOOST_TEST(indicator[2] == 16. / 25.);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG
@@ -0,0 +1,94 @@
+#include "../../../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
+#include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../src/spatial_solver/elementwise_operations.h"
+#include "../../../src/spatial_solver/reference_operators.h"
+
+#include <boost/test/unit_test.hpp>
+#include <thread>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+namespace DG {
+
+BOOST_AUTO_TEST_SUITE(reference_operators);
+
+BOOST_AUTO_TEST_CASE(memoized_operators) {
+  const auto operators{Operator_registry<Legendre_basis>::get_operators(5)};
+  BOOST_TEST(
+      operators == Operator_registry<Legendre_basis>::get_operators(5));
+  BOOST_TEST(
+      operators != Operator_registry<Legendre_basis>::get_operators(6));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_requests) {
+  const size_t num_threads{8};
+  std::vector<std::shared_ptr<const Reference_operators>> operators(
+      num_threads);
+  std::vector<std::thread> threads;
+  for (size_t i{0}; i < num_threads; ++i) {
+    threads.emplace_back([&operators, i]() {
+      operators[i] = Operator_registry<Legendre_basis>::get_operators(11);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &op : operators) {
+    BOOST_TEST(op == operators.front());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(operators_of_elementwise_operations) {
+  for (const size_t order : {1, 4, 12}) {
+    const auto operators{
+        Operator_registry<Legendre_basis>::get_operators(order)};
+    const Elementwise_operations<Legendre_basis> eop(order);
+
+    BOOST_TEST(arma::approx_equal(
+        operators->diff_matrix, eop.get_diff_matrix(), "absdiff", 1e-11));
+    BOOST_TEST(arma::approx_equal(
+        operators->lift_matrix, eop.get_lift_matrix(), "absdiff", 1e-13));
+    BOOST_TEST(arma::approx_equal(
+        operators->vandermonde_matrix * operators->inverse_vandermonde_matrix,
+        arma::mat(arma::eye(order + 1, order + 1)),
+        "absdiff",
+        1e-13));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(quadrature_weights, *utf::tolerance(1e-14)) {
+  // Gauss-Lobatto-Legendre weights of order 4 (5 nodes)
+  const auto operators{Operator_registry<Legendre_basis>::get_operators(4)};
+  const arma::vec &weights{operators->weights};
+  BOOST_TEST(weights.n_elem == 5);
+  BOOST_TEST(weights[0] == 0.1);
+  BOOST_TEST(weights[1] == 49. / 90.);
+  BOOST_TEST(weights[2] == 32. / 45.);
+  BOOST_TEST(weights[3] == 49. / 90.);
+  BOOST_TEST(weights[4] == 0.1);
+}
+
+BOOST_AUTO_TEST_CASE(upwind_spectral_radius, *utf::tolerance(1e-10)) {
+  // With exact mass matrices the upwind DG operator does not depend on the
+  // nodes it is represented on, hence both bases share the time step bound
+  for (const size_t order : {1, 3, 8, 20}) {
+    const auto gll{Operator_registry<Legendre_basis>::get_operators(order)};
+    const auto gauss{
+        Operator_registry<Gauss_legendre_basis>::get_operators(order)};
+    BOOST_TEST(gll->has_face_nodes);
+    BOOST_TEST(!gauss->has_face_nodes);
+    BOOST_TEST(
+        gauss->get_upwind_spectral_radius() ==
+        gll->get_upwind_spectral_radius());
+  }
+  // The eigenvalues of order one are 1 +- i sqrt(2)/2
+  BOOST_TEST(
+      Operator_registry<Legendre_basis>::get_operators(1)
+          ->get_upwind_spectral_radius() == std::sqrt(1.5));
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG
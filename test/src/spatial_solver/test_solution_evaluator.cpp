@@ -0,0 +1,132 @@
+#include "../../../src/spatial_solver/basis_functions/gauss_legendre_basis.h"
+#include "../../../src/spatial_solver/basis_functions/legendre_basis.h"
+#include "../../../src/spatial_solver/solution_evaluator.h"
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+namespace DG {
+
+namespace {
+/**
+ * Two regions of [0,3], where the first region consists of the intervals
+ * [0,1] and [2,3]. Hence, the ordered elements are not sorted globally.
+ */
+Mesh::Ordered_mesh get_split_region_mesh() {
+  Mesh::Ordered_mesh ordered_mesh;
+  ordered_mesh.region_tags = {1, 2};
+  ordered_mesh.region_offsets = {0, 4, 6};
+  ordered_mesh.elem_tags = {1, 2, 5, 6, 3, 4};
+  ordered_mesh.elem_coords = {
+      0., 0.4, 0.4, 1., 2., 2.7, 2.7, 3., 1., 1.5, 1.5, 2.};
+  return ordered_mesh;
+}
+
+/// Nodal fields of a function on the elements of the ordered mesh
+template <class Basis, typename Function>
+arma::mat get_nodal_fields(
+    const Mesh::Ordered_mesh &ordered_mesh,
+    const size_t polynomial_order,
+    Function function) {
+  const std::vector<double> nodes{Basis().get_quad_nodes(polynomial_order)};
+  arma::mat fields(nodes.size(), ordered_mesh.elem_tags.size());
+  for (size_t elem{0}; elem < fields.n_cols; ++elem) {
+    const double left{ordered_mesh.elem_coords[2 * elem]};
+    const double right{ordered_mesh.elem_coords[2 * elem + 1]};
+    for (size_t node{0}; node < nodes.size(); ++node) {
+      fields(node, elem) =
+          function(left + (nodes[node] + 1.) / 2. * (right - left));
+    }
+  }
+  return fields;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(solution_evaluator);
+
+BOOST_AUTO_TEST_CASE(locate_positions, *utf::tolerance(1e-14)) {
+  const Solution_evaluator<Legendre_basis> evaluator(
+      get_split_region_mesh(), 3);
+  const Sampling_points points{
+      evaluator.locate_positions(arma::vec{0., 0.2, 0.4, 1.25, 2.1, 3.})};
+
+  BOOST_TEST(points.elems == std::vector<size_t>({0, 0, 1, 4, 2, 3}),
+             tt::per_element());
+  BOOST_TEST(points.ref_positions[0] == -1.);
+  BOOST_TEST(points.ref_positions[1] == 0.);
+  BOOST_TEST(points.ref_positions[2] == -1.);
+  BOOST_TEST(points.ref_positions[3] == 0.);
+  BOOST_TEST(points.ref_positions[5] == 1.);
+
+  BOOST_CHECK_THROW(
+      evaluator.locate_positions(arma::vec{-0.1}), std::invalid_argument);
+  BOOST_CHECK_THROW(
+      evaluator.locate_positions(arma::vec{3.1}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_fields) {
+  // Polynomials up to the basis order are represented exactly
+  const size_t order{5};
+  const Mesh::Ordered_mesh ordered_mesh{get_split_region_mesh()};
+  auto polynomial = [](const double x) {
+    return 1. - 2. * x + 0.5 * std::pow(x, 3) - 0.1 * std::pow(x, 5);
+  };
+
+  arma::arma_rng::set_seed(19);
+  // More positions than evaluated at once
+  const arma::vec positions(3. * arma::randu<arma::vec>(600));
+  arma::vec exact_values(positions);
+  exact_values.transform(polynomial);
+
+  const Solution_evaluator<Legendre_basis> gll_evaluator(ordered_mesh, order);
+  BOOST_TEST(arma::approx_equal(
+      gll_evaluator.get_values(
+          get_nodal_fields<Legendre_basis>(ordered_mesh, order, polynomial),
+          positions),
+      exact_values,
+      "absdiff",
+      1e-12));
+
+  const Solution_evaluator<Gauss_legendre_basis> gauss_evaluator(
+      ordered_mesh, order);
+  BOOST_TEST(arma::approx_equal(
+      gauss_evaluator.get_values(
+          get_nodal_fields<Gauss_legendre_basis>(
+              ordered_mesh, order, polynomial),
+          positions),
+      exact_values,
+      "absdiff",
+      1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(nodal_values) {
+  // Evaluating at the nodes reproduces the nodal fields of any function
+  const size_t order{8};
+  const Mesh::Ordered_mesh ordered_mesh{get_split_region_mesh()};
+  auto function = [](const double x) { return std::sin(4. * x); };
+  const arma::mat fields{
+      get_nodal_fields<Legendre_basis>(ordered_mesh, order, function)};
+
+  const Solution_evaluator<Legendre_basis> evaluator(ordered_mesh, order);
+  const std::vector<double> nodes{Legendre_basis().get_quad_nodes(order)};
+  Sampling_points points;
+  for (size_t elem{0}; elem < fields.n_cols; ++elem) {
+    points.elems.insert(points.elems.end(), nodes.size(), elem);
+  }
+  points.ref_positions = arma::repmat(arma::vec(nodes), fields.n_cols, 1);
+
+  BOOST_TEST(arma::approx_equal(
+      evaluator.get_values(fields, points),
+      arma::vectorise(fields),
+      "absdiff",
+      1e-13));
+  BOOST_CHECK_THROW(
+      evaluator.get_values_from_modal(fields.rows(0, order - 1), points),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+} // namespace DG
@@ -65,6 +65,25 @@ BOOST_AUTO_TEST_CASE(evolve_in_time, *utf::tolerance(1e-16)) {
   BOOST_TEST(
       first_evolution.front() == 0.021330398714844, tt::tolerance(1e-13));
 }
+//-------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(evolve_in_place) {
+
+  auto test_odes = [](const arma::mat &x, double t, arma::mat &odes) {
+    odes = (5 * t * t - x) / arma::exp(x + t);
+  };
+  const double time(7.);
+  const double dt(0.1);
+  arma::mat solution({0, 0.5});
+  Stage_buffers buffers;
+
+  lsrk_solver.evolve_in_place(test_odes, solution, time, dt, buffers);
+  BOOST_TEST(solution.front() == 0.021330398714844, tt::tolerance(1e-13));
+
+  // Reused buffers of the same size
+  const double *interim_memory{buffers.interim_result.memptr()};
+  lsrk_solver.evolve_in_place(test_odes, solution, time + dt, dt, buffers);
+  BOOST_TEST(buffers.interim_result.memptr() == interim_memory);
+}
 
 BOOST_AUTO_TEST_SUITE_END();
 } // namespace TD
@@ -1,12 +1,16 @@
 #include "../../src/dgtd_solver.h"
 #include "../../src/pde/advection.h"
+#include "../../src/pde/burgers.h"
+#include "../../src/pde/shallow_water.h"
 #include "../../src/spatial_solver/basis_functions/legendre_basis.h"
 #include "../../src/spatial_solver/elementwise_operations.h"
+#include "../../src/spatial_solver/mesh/mesh_generator.h"
 #include "../../src/temporal_solver/low_storage_runge_kutta.h"
 #include "../../src/tools/input.h"
 
 #include <boost/test/unit_test.hpp>
 
+#include <filesystem>
 #include <iomanip>
 
 namespace DGTD {
@@ -40,6 +44,24 @@ Dgtd_solver<Advection, Legendre_basis, Low_storage_runge_kutta>
 const double upwind_param(1.);
 Advection advection(2*M_PI, upwind_param);
 
+/**
+ * Solve in a temporary directory, since the solution is written into the
+ * current working directory
+ */
+template <class Solver, class Pde_arg>
+arma::mat get_solution_in_temp_dir(Solver &solver, Pde_arg &pde) {
+  const std::filesystem::path work_dir(std::filesystem::current_path());
+  const std::filesystem::path output_dir(
+      std::filesystem::temp_directory_path() / "dgtd_solution");
+  std::filesystem::create_directories(output_dir);
+  std::filesystem::current_path(output_dir);
+  const arma::mat solution(solver.get_solution(pde));
+  std::filesystem::current_path(work_dir);
+  std::filesystem::remove_all(output_dir);
+
+  return solution;
+}
+
 BOOST_AUTO_TEST_CASE(phys_node_coords, *utf::tolerance(1e-15)) {
   const arma::mat coords(dgtd.get_phys_node_coords());
   BOOST_TEST(coords(0, 0) == 0);
@@ -92,9 +114,110 @@ BOOST_AUTO_TEST_CASE(min_node_dist, *utf::tolerance(1e-16)) {
 }
 
 BOOST_AUTO_TEST_CASE(time_step, *utf::tolerance(1e-16)) {
-  // Tested against dt in Advec1D.m
+  // CFL condition of Advec1D.m for the advection speed 2 pi, but without
+  // dividing the end time into equal steps
+  BOOST_TEST(
+      dgtd.get_time_step(2 * M_PI, 0.) ==
+          input.dt_factor * 0.829179606750063 / (2 * M_PI),
+      tt::tolerance(1e-14));
+  // The final step ends exactly at the end time
+  BOOST_TEST(
+      dgtd.get_time_step(2 * M_PI, input.end_time - 0.01) == 0.01,
+      tt::tolerance(1e-14));
+  BOOST_TEST(dgtd.get_time_step(0., 0.) == input.end_time);
+  BOOST_TEST(
+      dgtd.get_time_step(0., 0.04) == input.end_time - 0.04,
+      tt::tolerance(1e-14));
+}
+
+/**
+ * The wave speed of Burgers' equation changes with the solution, such that
+ * the time steps vary and do not divide the end time
+ */
+BOOST_AUTO_TEST_CASE(final_time_of_variable_steps) {
+  const std::string burgers_dir(root_dir + "/test/examples/burgers/");
+  const std::string burgers_mesh(burgers_dir + "interval.json");
+  Mesh::Process_mesh_data burgers_processed_mesh(
+      burgers_mesh,
+      Mesh::Mesh_generator(burgers_mesh).generate_mesh_model(),
+      Mesh::Mesh_section_index());
+  const Input burgers_input(burgers_dir + "burgers.json");
+  Dgtd_solver<Burgers, Legendre_basis, Low_storage_runge_kutta>
+      burgers_dgtd(burgers_processed_mesh, burgers_input);
+
+  Burgers burgers(burgers_input.upwind_param);
+  const arma::mat solution(get_solution_in_temp_dir(burgers_dgtd, burgers));
+
+  BOOST_TEST(burgers_dgtd.get_final_time() == burgers_input.end_time);
+  BOOST_TEST(solution.is_finite());
+}
+
+/**
+ * The wave speeds of the shallow water equations depend on both fields of
+ * the system, i.e. the time steps vary with the depth and the velocity
+ */
+BOOST_AUTO_TEST_CASE(final_time_of_variable_system_steps) {
+  const std::string shallow_water_dir(
+      root_dir + "/test/examples/shallow_water/");
+  const std::string shallow_water_mesh(shallow_water_dir + "interval.json");
+  Mesh::Process_mesh_data shallow_water_processed_mesh(
+      shallow_water_mesh,
+      Mesh::Mesh_generator(shallow_water_mesh).generate_mesh_model(),
+      Mesh::Mesh_section_index());
+  const Input shallow_water_input(shallow_water_dir + "shallow_water.json");
+  Dgtd_solver<Shallow_water, Legendre_basis, Low_storage_runge_kutta>
+      shallow_water_dgtd(shallow_water_processed_mesh, shallow_water_input);
+
+  Shallow_water shallow_water(
+      shallow_water_input.material_params.front(),
+      shallow_water_input.upwind_param);
+  const arma::mat solution(
+      get_solution_in_temp_dir(shallow_water_dgtd, shallow_water));
+
+  BOOST_TEST(
+      shallow_water_dgtd.get_final_time() == shallow_water_input.end_time);
+  BOOST_TEST(solution.n_cols == 2 * 20);
+  BOOST_TEST(solution.is_finite());
+}
+
+/**
+ * The inflow of the advection enters at the left end of the domain only,
+ * i.e. the face shared by two regions is no boundary, such that splitting
+ * the interval into two regions does not change the solution
+ */
+BOOST_AUTO_TEST_CASE(coupled_regions, *utf::tolerance(1e-12)) {
+  const std::string name("coupled_regions");
+  Mesh::Process_mesh_data one_region(
+      name,
+      Mesh::Mesh_generator({{"interval", 0., 9., 6}}).generate_mesh_model(),
+      Mesh::Mesh_section_index());
+  Mesh::Process_mesh_data two_regions(
+      name,
+      Mesh::Mesh_generator({{"left", 0., 4.5, 3}, {"right", 4.5, 9., 3}})
+          .generate_mesh_model(),
+      Mesh::Mesh_section_index());
+
+  Dgtd_solver<Advection, Legendre_basis, Low_storage_runge_kutta>
+      one_region_dgtd(one_region, input);
+  Dgtd_solver<Advection, Legendre_basis, Low_storage_runge_kutta>
+      two_regions_dgtd(two_regions, input);
+  const arma::mat solution(
+      get_solution_in_temp_dir(one_region_dgtd, advection));
+  const arma::mat coupled_solution(
+      get_solution_in_temp_dir(two_regions_dgtd, advection));
+  BOOST_TEST(
+      arma::approx_equal(coupled_solution, solution, "absdiff", 1e-12));
+
+  // A PDE per region, whose interface takes the Lax-Friedrichs flux of
+  // both, which equals the upwind flux of linear advection
+  const auto physical_names(two_regions.get_physical_names());
+  std::map<size_t, Advection> region_pdes{
+      {physical_names.at("left"), advection},
+      {physical_names.at("right"), advection}};
+  const arma::mat region_solution(
+      get_solution_in_temp_dir(two_regions_dgtd, region_pdes));
   BOOST_TEST(
-      dgtd.get_time_step() == 0.033333333333333, tt::tolerance(1e-14));
+      arma::approx_equal(region_solution, solution, "absdiff", 1e-12));
 }
 
 BOOST_AUTO_TEST_CASE(initial_spatial_scheme, *utf::tolerance(1e-14)) {
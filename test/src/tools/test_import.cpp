@@ -1,4 +1,5 @@
 #include "../../../src/tools/import.h"
+#include "../../../src/tools/token_reader.h"
 
 #include <boost/test/unit_test.hpp>
 #include <fstream>
@@ -54,4 +55,38 @@ BOOST_AUTO_TEST_CASE(get_line_entries_from_file) {
   BOOST_TEST(line_number == 8);
 }
 
+BOOST_AUTO_TEST_CASE(token_reader) {
+  using namespace Import;
+
+  const std::string text("4 1.5e2 \n  $Nodes 3.0\r\n2 7 \n\"name\"\n");
+  Token_reader reader(text);
+
+  BOOST_TEST(reader.next<size_t>() == 4);
+  BOOST_TEST(reader.next<double>() == 150.);
+  BOOST_TEST(reader.next_word() == "$Nodes");
+  BOOST_TEST(reader.get_line_number() == 2);
+  // Integers written as floating point numbers are accepted
+  BOOST_TEST(reader.next<size_t>() == 3);
+  reader.skip_lines();
+
+  BOOST_TEST(reader.next_line() == "2 7 ");
+  BOOST_TEST(reader.get_line_number() == 4);
+  BOOST_CHECK_THROW(reader.next<size_t>(), std::invalid_argument);
+  BOOST_TEST(reader.next_line() == "\"name\"");
+  BOOST_TEST(reader.has_next() == false);
+}
+
+/// Entries which are only partly a value of the requested type
+BOOST_AUTO_TEST_CASE(token_reader_partial_entries) {
+  using namespace Import;
+
+  for (const std::string entry : {"12abc", "3.7", "-1.0", "1e30", "nan"}) {
+    Token_reader reader(entry + " 5");
+    BOOST_CHECK_THROW(reader.next<size_t>(), std::invalid_argument);
+  }
+  Token_reader reader("2.0\t1.5x");
+  BOOST_TEST(reader.next<int>() == 2);
+  BOOST_CHECK_THROW(reader.next<double>(), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
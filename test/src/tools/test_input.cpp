@@ -0,0 +1,28 @@
+#include "../../../src/tools/input.h"
+
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(input);
+
+const std::string root_dir(DGTD_ROOT);
+
+BOOST_AUTO_TEST_CASE(numerical_flux) {
+  const Input default_input(root_dir + "/test/examples/test_dgtd.json");
+  BOOST_TEST(default_input.numerical_flux == "upwind");
+
+  const Input advection_input(
+      root_dir + "/test/src/tools/inputs/advection_central_flux.json");
+  BOOST_TEST(advection_input.numerical_flux == "central");
+
+  const Input burgers_input(
+      root_dir + "/test/src/tools/inputs/burgers_hll_flux.json");
+  BOOST_TEST(burgers_input.numerical_flux == "hll");
+
+  // The systems default to their local Lax-Friedrichs flux
+  const Input maxwell_input(
+      root_dir + "/test/examples/maxwell/maxwell.json");
+  BOOST_TEST(maxwell_input.numerical_flux == "lax_friedrichs");
+}
+
+BOOST_AUTO_TEST_SUITE_END();